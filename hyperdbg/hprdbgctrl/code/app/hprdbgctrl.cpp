@@ -80,6 +80,11 @@ ShowMessages(const char * Fmt, ...)
             // if an output error occurs.
             //
             RemoteConnectionSendResultsToHost(TempMessage, sprintfresult);
+
+            //
+            // Subscribers receive the same output
+            //
+            BroadcastPublish(TempMessage, sprintfresult);
         }
         else if (g_IsSerialConnectedToRemoteDebugger)
         {
@@ -351,6 +356,16 @@ ReadIrpBasedBuffer()
 
                     break;
 
+                case OPERATION_LOG_CAPTURE_RECORDS:
+
+                    //
+                    // decode the records of capture actions
+                    //
+                    CaptureHandleRecords(
+                        (PDEBUGGER_CAPTURE_RECORDS_PACKET)(OutputBuffer + sizeof(UINT32)));
+
+                    break;
+
                 default:
 
                     if (g_BreakPrintingOutput)
@@ -704,6 +719,11 @@ HyperDbgUnloadVmm()
     //
     UdUninitializeUserDebugger();
 
+    //
+    // Unregister the shared command ring if it's registered
+    //
+    CommandRingUninitialize();
+
     //
     // Send IOCTL to mark complete all IRP Pending
     //
@@ -36,12 +36,13 @@ CommandDtHelp()
                  "[bitfield Bitfield (yesno)] [native Native (yesno)] [decl Declaration (yesno)] "
                  "[def Definitions (yesno)] [func Functions (yesno)] [pragma Pragma (yesno)] "
                  "[prefix Prefix (string)] [suffix Suffix (string)] [inline Expantion (string)] "
-                 "[output FileName (string)]\n\n");
+                 "[output FileName (string)] [count Count (hex)] [next FieldName (string)]\n\n");
     ShowMessages("syntax : \t!dt [Module!SymbolName (string)] [AddressExpression (string)] "
                  "[padding Padding (yesno)] [offset Offset (yesno)] [bitfield Bitfield (yesno)] "
                  "[native Native (yesno)] [decl Declaration (yesno)] [def Definitions (yesno)] "
                  "[func Functions (yesno)] [pragma Pragma (yesno)] [prefix Prefix (string)] "
-                 "[suffix Suffix (string)] [inline Expantion (string)] [output FileName (string)]\n");
+                 "[suffix Suffix (string)] [inline Expantion (string)] [output FileName (string)] "
+                 "[count Count (hex)] [next FieldName (string)]\n");
 
     ShowMessages("\n");
     ShowMessages("\t\te.g : dt nt!_EPROCESS\n");
@@ -52,6 +53,13 @@ CommandDtHelp()
     ShowMessages("\t\te.g : dt nt!_MY_STRUCT 7ff00040 pid 1420\n");
     ShowMessages("\t\te.g : dt nt!_EPROCESS $proc inline all\n");
     ShowMessages("\t\te.g : dt nt!_EPROCESS fffff8077356f010 inline no\n");
+    ShowMessages("\t\te.g : dt nt!_KPRCB fffff8077356f010 count 4\n");
+    ShowMessages("\t\te.g : dt nt!_EPROCESS $proc next ActiveProcessLinks\n");
+    ShowMessages("\t\te.g : dt nt!_EPROCESS $proc next ActiveProcessLinks count 10\n");
+
+    ShowMessages("\n");
+    ShowMessages("if no pdbex option is specified, the data is shown based on the compiled layout of the "
+                 "type ('count' shows an array of elements and 'next' walks a linked list)\n");
 }
 
 /**
@@ -85,25 +93,33 @@ CommandStructHelp()
  * @param ExtraArgs
  * @param PdbexArgs
  * @param ProcessId
+ * @param CountOfElements
+ * @param NextFieldName
  * 
  * @return BOOLEAN
  */
 BOOLEAN
 CommandDtAndStructConvertHyperDbgArgsToPdbex(vector<string> ExtraArgs,
                                              std::string &  PdbexArgs,
-                                             UINT32 *       ProcessId)
+                                             UINT32 *       ProcessId,
+                                             UINT32 *       CountOfElements,
+                                             std::string &  NextFieldName)
 {
     UINT32  TargetProcessId     = NULL;
+    UINT32  TargetCount         = NULL;
     BOOLEAN NextItemIsYesNo     = FALSE;
     BOOLEAN NextItemIsString    = FALSE;
     BOOLEAN NextItemIsInline    = FALSE;
     BOOLEAN NextItemIsFileName  = FALSE;
     BOOLEAN NextItemIsProcessId = FALSE;
+    BOOLEAN NextItemIsCount     = FALSE;
+    BOOLEAN NextItemIsNextField = FALSE;
 
     //
     // Clear the args
     //
     PdbexArgs = "";
+    NextFieldName.clear();
 
     //
     // Traverse through the extra arguments
@@ -136,6 +152,32 @@ CommandDtAndStructConvertHyperDbgArgsToPdbex(vector<string> ExtraArgs,
             continue;
         }
 
+        //
+        // Check for count of elements (or nodes)
+        //
+        if (NextItemIsCount)
+        {
+            if (!ConvertStringToUInt32(Item, &TargetCount) || TargetCount == 0)
+            {
+                ShowMessages("err, you should enter a valid count\n\n");
+                return FALSE;
+            }
+
+            NextItemIsCount = FALSE;
+            continue;
+        }
+
+        //
+        // Check for the field that links the nodes of a list
+        //
+        if (NextItemIsNextField)
+        {
+            NextFieldName = Item;
+
+            NextItemIsNextField = FALSE;
+            continue;
+        }
+
         //
         // Check if we expect yes/no answers
         //
@@ -210,6 +252,14 @@ CommandDtAndStructConvertHyperDbgArgsToPdbex(vector<string> ExtraArgs,
         {
             NextItemIsProcessId = TRUE;
         }
+        else if (!Item.compare("count"))
+        {
+            NextItemIsCount = TRUE;
+        }
+        else if (!Item.compare("next"))
+        {
+            NextItemIsNextField = TRUE;
+        }
         else if (!Item.compare("output"))
         {
             NextItemIsFileName = TRUE;
@@ -283,16 +333,18 @@ CommandDtAndStructConvertHyperDbgArgsToPdbex(vector<string> ExtraArgs,
     //
     // Check if user enetered yes/no or string when expected or not
     //
-    if (NextItemIsYesNo || NextItemIsString || NextItemIsInline || NextItemIsFileName || NextItemIsProcessId)
+    if (NextItemIsYesNo || NextItemIsString || NextItemIsInline || NextItemIsFileName || NextItemIsProcessId ||
+        NextItemIsCount || NextItemIsNextField)
     {
         ShowMessages("err, incomplete argument\n\n");
         return FALSE;
     }
 
     //
-    // Set the process id
+    // Set the process id and the count
     //
-    *ProcessId = TargetProcessId;
+    *ProcessId       = TargetProcessId;
+    *CountOfElements = TargetCount;
 
     return TRUE;
 }
@@ -307,6 +359,8 @@ CommandDtAndStructConvertHyperDbgArgsToPdbex(vector<string> ExtraArgs,
  * @param TargetPid
  * @param IsPhysicalAddress
  * @param AdditionalParameters
+ * @param CountOfElements count of elements of the array (or nodes of the list), zero if not specified
+ * @param NextFieldName the field that links the nodes of a list (can be NULL)
  * 
  * @return BOOLEAN
  */
@@ -318,9 +372,13 @@ CommandDtShowDataBasedOnSymbolTypes(
     PVOID        BufferAddress,
     UINT32       TargetPid,
     BOOLEAN      IsPhysicalAddress,
-    const char * AdditionalParameters)
+    const char * AdditionalParameters,
+    UINT32       CountOfElements,
+    const char * NextFieldName)
 {
     UINT64                      StructureSize       = 0;
+    UINT64                      FirstNodeAddress    = 0;
+    UINT32                      ElementsPerRead     = 0;
     BOOLEAN                     ResultOfFindingSize = FALSE;
     DEBUGGER_DT_COMMAND_OPTIONS DtOptions           = {0};
 
@@ -364,6 +422,20 @@ CommandDtShowDataBasedOnSymbolTypes(
     DtOptions.BufferAddress        = NULL; // we didn't read it yet
     DtOptions.TargetPid            = TargetPid;
     DtOptions.AdditionalParameters = AdditionalParameters;
+    DtOptions.NextFieldName        = NextFieldName;
+
+    //
+    // If there is no pdbex option, the data is shown based on the compiled layout
+    // of the type which is much faster than regenerating the type each time
+    //
+    DtOptions.UseTypeLayout = !IsStruct && Address != NULL &&
+                              (AdditionalParameters[0] == '\0' || !strcmp(AdditionalParameters, PDBEX_DEFAULT_CONFIGURATION));
+
+    if ((CountOfElements != 0 || NextFieldName != NULL) && !DtOptions.UseTypeLayout)
+    {
+        ShowMessages("err, 'count' and 'next' are only available for showing data without pdbex options\n");
+        return FALSE;
+    }
 
     if (Address != NULL)
     {
@@ -394,15 +466,87 @@ CommandDtShowDataBasedOnSymbolTypes(
         DtOptions.SizeOfTypeName = StructureSize;
 
         //
-        // Read the memory
+        // In the debugger mode, at least one element should fit in the
+        // read memory packet
         //
-        HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_COMMAND_DT,
-                                         Address,
-                                         IsPhysicalAddress ? DEBUGGER_READ_PHYSICAL_ADDRESS : DEBUGGER_READ_VIRTUAL_ADDRESS,
-                                         READ_FROM_KERNEL,
-                                         TargetPid,
-                                         StructureSize,
-                                         &DtOptions);
+        if (g_IsSerialConnectedToRemoteDebuggee && StructureSize > DT_MAXIMUM_SERIAL_READ_SIZE)
+        {
+            ShowMessages("err, the size of the structure (0x%llx) is larger than the maximum "
+                         "size that can be read in the debugger mode (0x%x)\n",
+                         StructureSize,
+                         DT_MAXIMUM_SERIAL_READ_SIZE);
+            return FALSE;
+        }
+
+        if (NextFieldName != NULL)
+        {
+            //
+            // Walk the linked list, each node is read at once and the address
+            // of the next node is extracted from the same buffer
+            //
+            FirstNodeAddress = Address;
+
+            if (CountOfElements == 0)
+            {
+                CountOfElements = DT_MAXIMUM_COUNT_OF_LIST_NODES;
+            }
+
+            for (UINT32 i = 0; i < CountOfElements; i++)
+            {
+                ShowMessages("[%d] %s\n", i, SeparateTo64BitValue(Address).c_str());
+
+                DtOptions.NextAddress = NULL;
+
+                HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_COMMAND_DT,
+                                                 Address,
+                                                 IsPhysicalAddress ? DEBUGGER_READ_PHYSICAL_ADDRESS : DEBUGGER_READ_VIRTUAL_ADDRESS,
+                                                 READ_FROM_KERNEL,
+                                                 TargetPid,
+                                                 StructureSize,
+                                                 &DtOptions);
+
+                if (DtOptions.NextAddress == NULL || DtOptions.NextAddress == FirstNodeAddress)
+                {
+                    break;
+                }
+
+                Address = DtOptions.NextAddress;
+            }
+        }
+        else
+        {
+            //
+            // The elements of the array are read at once, except in the debugger
+            // mode that they're read in chunks that fit in the read memory packet
+            //
+            if (CountOfElements == 0)
+            {
+                CountOfElements = 1;
+            }
+
+            if (StructureSize * CountOfElements > MAXUINT32)
+            {
+                ShowMessages("err, the count of elements is too large\n");
+                return FALSE;
+            }
+
+            ElementsPerRead = g_IsSerialConnectedToRemoteDebuggee ? (UINT32)(DT_MAXIMUM_SERIAL_READ_SIZE / StructureSize) : CountOfElements;
+
+            for (UINT32 i = 0; i < CountOfElements; i += ElementsPerRead)
+            {
+                UINT32 ElementsToRead = min(ElementsPerRead, CountOfElements - i);
+
+                HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_COMMAND_DT,
+                                                 Address + (i * StructureSize),
+                                                 IsPhysicalAddress ? DEBUGGER_READ_PHYSICAL_ADDRESS : DEBUGGER_READ_VIRTUAL_ADDRESS,
+                                                 READ_FROM_KERNEL,
+                                                 TargetPid,
+                                                 (UINT32)(StructureSize * ElementsToRead),
+                                                 &DtOptions);
+            }
+        }
+
+        return TRUE;
     }
     else
     {
@@ -429,7 +573,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
     BOOLEAN     IsStruct                           = FALSE;
     UINT64      TargetAddress                      = NULL;
     PVOID       BufferAddressRetrievedFromDebuggee = NULL;
+    std::string NextFieldName;
     UINT32      TargetPid                          = NULL;
+    UINT32      CountOfElements                    = 0;
     BOOLEAN     IsPhysicalAddress                  = FALSE;
 
     //
@@ -508,7 +654,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                             NULL,
                                             TargetPid,
                                             IsPhysicalAddress,
-                                            PDBEX_DEFAULT_CONFIGURATION);
+                                            PDBEX_DEFAULT_CONFIGURATION,
+                                            0,
+                                            NULL);
     }
     else
     {
@@ -545,7 +693,7 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                 //
                 // Convert to pdbex args
                 //
-                if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid))
+                if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid, &CountOfElements, NextFieldName))
                 {
                     if (IsStruct)
                     {
@@ -568,7 +716,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                                     BufferAddressRetrievedFromDebuggee,
                                                     TargetPid,
                                                     IsPhysicalAddress,
-                                                    PdbexArgs.c_str());
+                                                    PdbexArgs.c_str(),
+                                                    CountOfElements,
+                                                    NextFieldName.empty() ? NULL : NextFieldName.c_str());
             }
             else
             {
@@ -588,7 +738,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                                         BufferAddressRetrievedFromDebuggee,
                                                         TargetPid,
                                                         IsPhysicalAddress,
-                                                        PDBEX_DEFAULT_CONFIGURATION);
+                                                        PDBEX_DEFAULT_CONFIGURATION,
+                                                        0,
+                                                        NULL);
                 }
                 else
                 {
@@ -608,7 +760,7 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                     //
                     // Convert to pdbex args
                     //
-                    if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid))
+                    if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid, &CountOfElements, NextFieldName))
                     {
                         if (IsStruct)
                         {
@@ -631,7 +783,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                                         BufferAddressRetrievedFromDebuggee,
                                                         TargetPid,
                                                         IsPhysicalAddress,
-                                                        PdbexArgs.c_str());
+                                                        PdbexArgs.c_str(),
+                                                        CountOfElements,
+                                                        NextFieldName.empty() ? NULL : NextFieldName.c_str());
                 }
             }
         }
@@ -653,7 +807,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                                     BufferAddressRetrievedFromDebuggee,
                                                     TargetPid,
                                                     IsPhysicalAddress,
-                                                    PDBEX_DEFAULT_CONFIGURATION);
+                                                    PDBEX_DEFAULT_CONFIGURATION,
+                                                    0,
+                                                    NULL);
             }
             else
             {
@@ -673,7 +829,7 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                 //
                 // Convert to pdbex args
                 //
-                if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid))
+                if (!CommandDtAndStructConvertHyperDbgArgsToPdbex(TempSplittedCommand, PdbexArgs, &TargetPid, &CountOfElements, NextFieldName))
                 {
                     if (IsStruct)
                     {
@@ -696,7 +852,9 @@ CommandDtAndStruct(vector<string> SplittedCommand, string Command)
                                                     BufferAddressRetrievedFromDebuggee,
                                                     TargetPid,
                                                     IsPhysicalAddress,
-                                                    PdbexArgs.c_str());
+                                                    PdbexArgs.c_str(),
+                                                    CountOfElements,
+                                                    NextFieldName.empty() ? NULL : NextFieldName.c_str());
             }
         }
     }
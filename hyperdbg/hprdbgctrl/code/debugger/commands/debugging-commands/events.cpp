@@ -14,14 +14,15 @@
 //
 // Global Variables
 //
-extern LIST_ENTRY g_EventTrace;
-extern BOOLEAN    g_EventTraceInitialized;
-extern BOOLEAN    g_BreakPrintingOutput;
-extern BOOLEAN    g_AutoFlush;
-extern BOOLEAN    g_IsConnectedToRemoteDebuggee;
-extern BOOLEAN    g_IsSerialConnectedToRemoteDebuggee;
-extern BOOLEAN    g_IsSerialConnectedToRemoteDebugger;
-extern UINT64     g_EventTag;
+extern LIST_ENTRY                                       g_EventTrace;
+extern BOOLEAN                                          g_EventTraceInitialized;
+extern std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> g_EventTraceTagIndex;
+extern BOOLEAN                                          g_BreakPrintingOutput;
+extern BOOLEAN                                          g_AutoFlush;
+extern BOOLEAN                                          g_IsConnectedToRemoteDebuggee;
+extern BOOLEAN                                          g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN                                          g_IsSerialConnectedToRemoteDebugger;
+extern UINT64                                           g_EventTag;
 
 /**
  * @brief help of events command
@@ -35,13 +36,16 @@ CommandEventsHelp()
 
     ShowMessages("syntax : \tevents\n");
     ShowMessages("syntax : \tevents [e|d|c all|EventNumber (hex)]\n");
+    ShowMessages("syntax : \tevents [e|d|c EventNumber (hex)|FromEventNumber-ToEventNumber (hex) ...]\n");
 
     ShowMessages("e : enable\n");
     ShowMessages("d : disable\n");
     ShowMessages("c : clear\n");
 
     ShowMessages("note : If you specify 'all' then e, d, or c will be applied to "
-                 "all of the events.\n\n");
+                 "all of the events.\n");
+    ShowMessages("note : You can specify more than one event number or a range of "
+                 "event numbers (e.g., 2-8), all of them are modified at once.\n\n");
 
     ShowMessages("\n");
     ShowMessages("\te.g : events \n");
@@ -49,6 +53,7 @@ CommandEventsHelp()
     ShowMessages("\te.g : events d 10\n");
     ShowMessages("\te.g : events c 10\n");
     ShowMessages("\te.g : events c all\n");
+    ShowMessages("\te.g : events d 2 5 8-1f\n");
 }
 
 /**
@@ -63,11 +68,12 @@ CommandEvents(vector<string> SplittedCommand, string Command)
 {
     DEBUGGER_MODIFY_EVENTS_TYPE RequestedAction;
     UINT64                      RequestedTag;
+    vector<UINT64>              RequestedTags;
 
     //
     // Validate the parameters (size)
     //
-    if (SplittedCommand.size() != 1 && SplittedCommand.size() != 3)
+    if (SplittedCommand.size() != 1 && SplittedCommand.size() < 3)
     {
         ShowMessages("incorrect use of '%s'\n\n", SplittedCommand.at(0).c_str());
         CommandEventsHelp();
@@ -116,6 +122,32 @@ CommandEvents(vector<string> SplittedCommand, string Command)
         return;
     }
 
+    //
+    // Check if more than one event or a range of events is specified
+    //
+    if (SplittedCommand.size() != 3 ||
+        SplittedCommand.at(2).find('-') != string::npos)
+    {
+        if (!CommandEventsParseTags(SplittedCommand, g_EventTraceTagIndex, RequestedTags))
+        {
+            CommandEventsHelp();
+            return;
+        }
+
+        if (RequestedTags.empty())
+        {
+            ShowMessages("err, no event is found for the specified event numbers\n");
+            return;
+        }
+
+        //
+        // Perform event related tasks on all of the events at once
+        //
+        CommandEventsBulkModifyAndQueryEvents(RequestedTags, RequestedAction, NULL);
+
+        return;
+    }
+
     //
     // Validate third argument as it's not just a simple
     // events without any parameter
@@ -147,6 +179,150 @@ CommandEvents(vector<string> SplittedCommand, string Command)
     CommandEventsModifyAndQueryEvents(RequestedTag, RequestedAction);
 }
 
+/**
+ * @brief Parse the event numbers and the ranges of event numbers
+ * of the events command
+ * @details tags of the events that are not found are ignored, so
+ * the list might be empty
+ *
+ * @param SplittedCommand
+ * @param TagIndex the index of the registered events by their tags
+ * @param Tags the sorted list of the target tags
+ * @return BOOLEAN if the event numbers are valid then it returns
+ * true otherwise it returns false
+ */
+BOOLEAN
+CommandEventsParseTags(vector<string> &                                         SplittedCommand,
+                       const std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> & TagIndex,
+                       vector<UINT64> &                                         Tags)
+{
+    UINT64 FromTag;
+    UINT64 ToTag;
+    size_t SeparatorIndex;
+
+    for (size_t i = 2; i < SplittedCommand.size(); i++)
+    {
+        const string & Argument = SplittedCommand.at(i);
+
+        if (!Argument.compare("all"))
+        {
+            ShowMessages("err, 'all' can not be combined with other event numbers\n\n");
+            return FALSE;
+        }
+
+        SeparatorIndex = Argument.find('-');
+
+        if (SeparatorIndex == string::npos)
+        {
+            if (!ConvertStringToUInt64(Argument, &FromTag))
+            {
+                ShowMessages("please specify a correct hex value for tag id (event number)\n\n");
+                return FALSE;
+            }
+
+            if (TagIndex.find(FromTag + DebuggerEventTagStartSeed) == TagIndex.end())
+            {
+                ShowMessages("err, tag id %llx is invalid\n", FromTag);
+                continue;
+            }
+
+            ToTag = FromTag;
+        }
+        else if (!ConvertStringToUInt64(Argument.substr(0, SeparatorIndex), &FromTag) ||
+                 !ConvertStringToUInt64(Argument.substr(SeparatorIndex + 1), &ToTag) ||
+                 FromTag > ToTag)
+        {
+            ShowMessages("please specify a correct range of hex values for tag ids (event numbers)\n\n");
+            return FALSE;
+        }
+
+        //
+        // Tags are started from a constant, we find the events of the
+        // range from the tag index
+        //
+        FromTag = FromTag + DebuggerEventTagStartSeed;
+        ToTag   = ToTag + DebuggerEventTagStartSeed;
+
+        for (auto Item = TagIndex.lower_bound(FromTag);
+             Item != TagIndex.end() && Item->first <= ToTag;
+             Item++)
+        {
+            Tags.push_back(Item->first);
+        }
+    }
+
+    //
+    // Tags should be sorted and unique
+    //
+    std::sort(Tags.begin(), Tags.end());
+    Tags.erase(std::unique(Tags.begin(), Tags.end()), Tags.end());
+
+    return TRUE;
+}
+
+/**
+ * @brief Check the parser of the event numbers and the ranges of
+ * event numbers against a fake index of events
+ * @details used by the test command, it doesn't need the driver
+ *
+ * @return BOOLEAN if the results were as expected then it returns
+ * true otherwise it returns false
+ */
+BOOLEAN
+CommandEventsPerformSelfCheck()
+{
+    std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> TagIndex;
+    vector<UINT64>                                   Tags;
+    vector<UINT64>                                   ExpectedTags;
+    vector<string>                                   SplittedCommand;
+
+    for (UINT64 EventNumber : {0x0, 0x2, 0x3, 0x5, 0x9, 0x10, 0x20})
+    {
+        TagIndex[EventNumber + DebuggerEventTagStartSeed] = NULL;
+    }
+
+    //
+    // Overlapping ranges and event numbers are sorted and merged, and
+    // the ranges only contain the registered events
+    //
+    SplittedCommand = {"events", "d", "8-1f", "2", "5", "1-3"};
+
+    for (UINT64 EventNumber : {0x2, 0x3, 0x5, 0x9, 0x10})
+    {
+        ExpectedTags.push_back(EventNumber + DebuggerEventTagStartSeed);
+    }
+
+    if (!CommandEventsParseTags(SplittedCommand, TagIndex, Tags) || Tags != ExpectedTags)
+    {
+        return FALSE;
+    }
+
+    //
+    // A range without any registered event is valid but empty
+    //
+    Tags.clear();
+    SplittedCommand = {"events", "d", "21-30"};
+
+    if (!CommandEventsParseTags(SplittedCommand, TagIndex, Tags) || !Tags.empty())
+    {
+        return FALSE;
+    }
+
+    //
+    // The bounds of the ranges are included
+    //
+    Tags.clear();
+    SplittedCommand = {"events", "e", "0-0", "20-20"};
+    ExpectedTags    = {0x0 + DebuggerEventTagStartSeed, 0x20 + DebuggerEventTagStartSeed};
+
+    if (!CommandEventsParseTags(SplittedCommand, TagIndex, Tags) || Tags != ExpectedTags)
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
 /**
  * @brief Check the kernel whether the event is enabled or disabled
  *
@@ -204,15 +380,44 @@ CommandEventsShowEvents()
     // It's an events without any argument so we have to show
     // all the currently active events
     //
-    PLIST_ENTRY TempList         = 0;
-    BOOLEAN     IsThereAnyEvents = FALSE;
+    vector<UINT64>  Tags;
+    vector<BOOLEAN> States;
+    BOOLEAN         IsQueriedAtOnce = FALSE;
+    BOOLEAN         IsEnabled;
+    size_t          Index = 0;
 
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Blink)
+    if (g_EventTraceTagIndex.empty())
     {
-        TempList = TempList->Blink;
+        ShowMessages("no active/disabled events \n");
+        return;
+    }
+
+    //
+    // In VMI mode, the states of all of the events are queried by
+    // a single request
+    //
+    if (!g_IsSerialConnectedToRemoteDebuggee)
+    {
+        for (auto & Item : g_EventTraceTagIndex)
+        {
+            Tags.push_back(Item.first);
+        }
 
-        PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = CONTAINING_RECORD(TempList, DEBUGGER_GENERAL_EVENT_DETAIL, CommandsEventList);
+        if (!CommandEventsBulkModifyAndQueryEvents(Tags, DEBUGGER_MODIFY_EVENTS_QUERY_STATE, &States))
+        {
+            return;
+        }
+
+        IsQueriedAtOnce = TRUE;
+    }
+
+    //
+    // The index is sorted by tags, so events are shown in the
+    // order that they are registered
+    //
+    for (auto & Item : g_EventTraceTagIndex)
+    {
+        PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = Item.second;
         string                         CommandMessage((char *)CommandDetail->CommandStringBuffer);
 
         //
@@ -229,23 +434,16 @@ CommandEventsShowEvents()
             CommandMessage += "...";
         }
 
+        //
+        // Query is live now
+        //
+        IsEnabled = IsQueriedAtOnce ? States.at(Index) : CommandEventQueryEventState(CommandDetail->Tag);
+        Index++;
+
         ShowMessages("%x\t(%s)\t    %s\n",
                      CommandDetail->Tag - DebuggerEventTagStartSeed,
-                     // CommandDetail->IsEnabled ? "enabled" : "disabled",
-                     CommandEventQueryEventState(CommandDetail->Tag)
-                         ? "enabled"
-                         : "disabled", /* Query is live now */
+                     IsEnabled ? "enabled" : "disabled",
                      CommandMessage.c_str());
-
-        if (!IsThereAnyEvents)
-        {
-            IsThereAnyEvents = TRUE;
-        }
-    }
-
-    if (!IsThereAnyEvents)
-    {
-        ShowMessages("no active/disabled events \n");
     }
 }
 
@@ -259,44 +457,32 @@ CommandEventsShowEvents()
 BOOLEAN
 CommandEventDisableEvent(UINT64 Tag)
 {
-    PLIST_ENTRY TempList = 0;
-    BOOLEAN     Result   = FALSE;
-
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Blink)
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
     {
-        TempList = TempList->Blink;
-
-        PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = CONTAINING_RECORD(TempList, DEBUGGER_GENERAL_EVENT_DETAIL, CommandsEventList);
-
-        if (CommandDetail->Tag == Tag ||
-            Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+        for (auto & Item : g_EventTraceTagIndex)
         {
-            //
-            // Put it to FALSE, to indicate that it's not active
-            //
-            CommandDetail->IsEnabled = FALSE;
+            Item.second->IsEnabled = FALSE;
+        }
 
-            if (!Result)
-            {
-                Result = TRUE;
-            }
+        return !g_EventTraceTagIndex.empty();
+    }
 
-            if (Tag != DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
-            {
-                //
-                // Only, one command exist with a tag, so we need to return as we
-                // find it
-                //
-                return TRUE;
-            }
-        }
+    auto Item = g_EventTraceTagIndex.find(Tag);
+
+    if (Item == g_EventTraceTagIndex.end())
+    {
+        //
+        // Not found
+        //
+        return FALSE;
     }
 
     //
-    // Not found
+    // Put it to FALSE, to indicate that it's not active
     //
-    return Result;
+    Item->second->IsEnabled = FALSE;
+
+    return TRUE;
 }
 
 /**
@@ -309,44 +495,32 @@ CommandEventDisableEvent(UINT64 Tag)
 BOOLEAN
 CommandEventEnableEvent(UINT64 Tag)
 {
-    PLIST_ENTRY TempList = 0;
-    BOOLEAN     Result   = FALSE;
-
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Blink)
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
     {
-        TempList = TempList->Blink;
-
-        PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = CONTAINING_RECORD(TempList, DEBUGGER_GENERAL_EVENT_DETAIL, CommandsEventList);
-
-        if (CommandDetail->Tag == Tag ||
-            Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+        for (auto & Item : g_EventTraceTagIndex)
         {
-            //
-            // Put it to TRUE, to indicate that it's active
-            //
-            CommandDetail->IsEnabled = TRUE;
+            Item.second->IsEnabled = TRUE;
+        }
 
-            if (!Result)
-            {
-                Result = TRUE;
-            }
+        return !g_EventTraceTagIndex.empty();
+    }
 
-            if (Tag != DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
-            {
-                //
-                // Only, one command exist with a tag, so we need to return as we
-                // find it
-                //
-                return TRUE;
-            }
-        }
+    auto Item = g_EventTraceTagIndex.find(Tag);
+
+    if (Item == g_EventTraceTagIndex.end())
+    {
+        //
+        // Not found
+        //
+        return FALSE;
     }
 
     //
-    // Not found
+    // Put it to TRUE, to indicate that it's active
     //
-    return Result;
+    Item->second->IsEnabled = TRUE;
+
+    return TRUE;
 }
 
 /**
@@ -359,80 +533,58 @@ CommandEventEnableEvent(UINT64 Tag)
 BOOLEAN
 CommandEventClearEvent(UINT64 Tag)
 {
-    PLIST_ENTRY                    TempList         = 0;
-    BOOLEAN                        Result           = FALSE;
-    PDEBUGGER_GENERAL_EVENT_DETAIL TmpCommandDetail = NULL;
+    PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail;
+    BOOLEAN                        Result;
 
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Flink)
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
     {
-        TempList = TempList->Flink;
-
-        PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = CONTAINING_RECORD(TempList, DEBUGGER_GENERAL_EVENT_DETAIL, CommandsEventList);
+        Result = !g_EventTraceTagIndex.empty();
 
-        if (CommandDetail->Tag == Tag || Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+        //
+        // Free the buffer for string of command and the event it self,
+        // for all of the events
+        //
+        for (auto & Item : g_EventTraceTagIndex)
         {
-            //
-            // Free the buffer for string of command
-            //
-            free(CommandDetail->CommandStringBuffer);
-
-            if (!Result)
-            {
-                Result = TRUE;
-                //
-                // We'll save one element so we can traverse and deallocate
-                // all of the elements
-                //
-                TmpCommandDetail = CommandDetail;
-            }
-
-            if (Tag != DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
-            {
-                //
-                // Remove it from the list
-                //
-                RemoveEntryList(&CommandDetail->CommandsEventList);
+            free(Item.second->CommandStringBuffer);
+            free(Item.second);
+        }
 
-                //
-                // Free the event it self
-                //
-                free(CommandDetail);
+        g_EventTraceTagIndex.clear();
 
-                //
-                // Only, one command exist with a tag, so we need to return as we
-                // find it
-                //
+        //
+        // Reinitialize list head
+        //
+        InitializeListHead(&g_EventTrace);
 
-                return TRUE;
-            }
-        }
+        return Result;
     }
 
-    if (Result && Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+    auto Item = g_EventTraceTagIndex.find(Tag);
+
+    if (Item == g_EventTraceTagIndex.end())
     {
         //
-        // We have to deallocate all the elements (note that CommandDetail->CommandStringBuffer is
-        // already deallocated)
+        // Not found
         //
-        while ((UINT64)TmpCommandDetail != (UINT64)&g_EventTrace.Flink)
-        {
-            PVOID Temp       = (PVOID)TmpCommandDetail;
-            TmpCommandDetail = (PDEBUGGER_GENERAL_EVENT_DETAIL)TmpCommandDetail->CommandsEventList.Flink;
+        return FALSE;
+    }
 
-            free(Temp);
-        }
+    CommandDetail = Item->second;
 
-        //
-        // Reinitialize list head
-        //
-        InitializeListHead(&g_EventTrace);
-    }
+    //
+    // Remove it from the list and the index
+    //
+    RemoveEntryList(&CommandDetail->CommandsEventList);
+    g_EventTraceTagIndex.erase(Item);
 
     //
-    // Either not found or DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG is specified
+    // Free the buffer for string of command and the event it self
     //
-    return Result;
+    free(CommandDetail->CommandStringBuffer);
+    free(CommandDetail);
+
+    return TRUE;
 }
 
 /**
@@ -462,6 +614,34 @@ CommandEventsClearAllEventsAndResetTags()
     }
 }
 
+/**
+ * @brief Flush the kernel buffers after disabling or clearing events
+ * or show a hint if the auto-flush mode is disabled
+ *
+ * @return VOID
+ */
+VOID
+CommandEventsFlushBuffersOrShowAutoFlushHint()
+{
+    if (!g_AutoFlush)
+    {
+        ShowMessages(
+            "auto-flush mode is disabled, if there is still "
+            "messages or buffers in the kernel, you continue to see "
+            "the messages when you run 'g' until the kernel "
+            "buffers are empty. you can run 'settings autoflush "
+            "on' and after disabling and clearing events, "
+            "kernel buffers will be flushed automatically\n");
+    }
+    else
+    {
+        //
+        // We should flush buffers here
+        //
+        CommandFlushRequestFlush();
+    }
+}
+
 /**
  * @brief Handle events after modification
  *
@@ -514,23 +694,7 @@ CommandEventsHandleModifiedEvent(
                         !g_IsSerialConnectedToRemoteDebuggee &&
                         !g_IsSerialConnectedToRemoteDebugger)
                     {
-                        if (!g_AutoFlush)
-                        {
-                            ShowMessages(
-                                "auto-flush mode is disabled, if there is still "
-                                "messages or buffers in the kernel, you continue to see "
-                                "the messages when you run 'g' until the kernel "
-                                "buffers are empty. you can run 'settings autoflush "
-                                "on' and after disabling and clearing events, "
-                                "kernel buffers will be flushed automatically\n");
-                        }
-                        else
-                        {
-                            //
-                            // We should flush buffers here
-                            //
-                            CommandFlushRequestFlush();
-                        }
+                        CommandEventsFlushBuffersOrShowAutoFlushHint();
                     }
                 }
             }
@@ -557,23 +721,7 @@ CommandEventsHandleModifiedEvent(
                     //
                     if (!g_IsConnectedToRemoteDebuggee)
                     {
-                        if (!g_AutoFlush)
-                        {
-                            ShowMessages(
-                                "auto-flush mode is disabled, if there is still "
-                                "messages or buffers in the kernel, you continue to see "
-                                "the messages when you run 'g' until the kernel "
-                                "buffers are empty. you can run 'settings autoflush "
-                                "on' and after disabling and clearing events, "
-                                "kernel buffers will be flushed automatically\n");
-                        }
-                        else
-                        {
-                            //
-                            // We should flush buffers here
-                            //
-                            CommandFlushRequestFlush();
-                        }
+                        CommandEventsFlushBuffersOrShowAutoFlushHint();
                     }
                 }
             }
@@ -705,3 +853,213 @@ CommandEventsModifyAndQueryEvents(UINT64                      Tag,
     //
     return TRUE;
 }
+
+/**
+ * @brief modify or query a set of events (query/enable/disable/clear)
+ * by sending a single batch of requests to the kernel
+ * @details the tags should be sorted and unique, in the Debugger Mode,
+ * a request is sent to the debuggee for each of the tags
+ *
+ * @param Tags the tags of the target events
+ * @param TypeOfAction whether its a query/enable/disable/clear
+ * @param States if it's a query then the states of the events are
+ * returned in this vector (in the order of tags)
+ * @return BOOLEAN if the operation was successful then it returns
+ * true otherwise it returns false
+ */
+BOOLEAN
+CommandEventsBulkModifyAndQueryEvents(const vector<UINT64> &      Tags,
+                                      DEBUGGER_MODIFY_EVENTS_TYPE TypeOfAction,
+                                      vector<BOOLEAN> *           States)
+{
+    BOOLEAN                              IsEnabled;
+    UINT32                               CountOfTags;
+    UINT32                               RequestSize;
+    UINT32                               MaximumTagsInRequest;
+    BOOLEAN                              IsSuccessful = TRUE;
+    PDEBUGGER_BULK_MODIFY_EVENTS         BulkModifyRequest;
+    PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY   Entries;
+    COMMAND_RING_REQUEST_DETAILS         RingRequest;
+    vector<COMMAND_RING_REQUEST_DETAILS> Requests;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // Remote debuggee Debugger Mode, the debuggee doesn't support
+        // bulk requests, so we send them one by one
+        //
+        for (auto Tag : Tags)
+        {
+            if (TypeOfAction == DEBUGGER_MODIFY_EVENTS_QUERY_STATE)
+            {
+                IsEnabled = FALSE;
+                KdSendEventQueryAndModifyPacketToDebuggee(Tag, TypeOfAction, &IsEnabled);
+
+                if (States != NULL)
+                {
+                    States->push_back(IsEnabled);
+                }
+            }
+            else
+            {
+                KdSendEventQueryAndModifyPacketToDebuggee(Tag, TypeOfAction, NULL);
+            }
+        }
+
+        return TRUE;
+    }
+
+    //
+    // Local debugging VMI-Mode
+    //
+
+    //
+    // Check if debugger is loaded or not
+    //
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    //
+    // Split the tags into requests that each fit in the data area of
+    // the command ring, all the requests are then sent as a single
+    // batch (the ring falls back to IOCTLs if it's not available)
+    //
+    MaximumTagsInRequest = (UINT32)min((COMMAND_RING_DATA_AREA_SIZE - SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS) / sizeof(DEBUGGER_BULK_MODIFY_EVENTS_ENTRY),
+                                       (size_t)DEBUGGER_BULK_MODIFY_EVENTS_MAXIMUM_TAGS);
+
+    for (size_t Offset = 0; Offset < Tags.size(); Offset += CountOfTags)
+    {
+        CountOfTags = (UINT32)min(Tags.size() - Offset, (size_t)MaximumTagsInRequest);
+        RequestSize = SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS + CountOfTags * sizeof(DEBUGGER_BULK_MODIFY_EVENTS_ENTRY);
+
+        BulkModifyRequest = (PDEBUGGER_BULK_MODIFY_EVENTS)malloc(RequestSize);
+
+        if (BulkModifyRequest == NULL)
+        {
+            ShowMessages("err, unable to allocate memory for the request\n");
+
+            for (auto & Request : Requests)
+            {
+                free(Request.Buffer);
+            }
+
+            return FALSE;
+        }
+
+        //
+        // Fill the structure to send it to the kernel
+        //
+        RtlZeroMemory(BulkModifyRequest, RequestSize);
+
+        BulkModifyRequest->TypeOfAction = TypeOfAction;
+        BulkModifyRequest->CountOfTags  = CountOfTags;
+
+        Entries = (PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY)((UINT64)BulkModifyRequest + SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS);
+
+        for (UINT32 i = 0; i < CountOfTags; i++)
+        {
+            Entries[i].Tag = Tags.at(Offset + i);
+        }
+
+        RingRequest                    = {0};
+        RingRequest.IoctlCode          = IOCTL_DEBUGGER_BULK_MODIFY_EVENTS;
+        RingRequest.Buffer             = BulkModifyRequest;
+        RingRequest.InputBufferLength  = RequestSize;
+        RingRequest.OutputBufferLength = RequestSize;
+
+        Requests.push_back(RingRequest);
+    }
+
+    //
+    // Send the requests to the kernel
+    //
+    CommandRingSendRequests(Requests.data(), (UINT32)Requests.size());
+
+    for (auto & Request : Requests)
+    {
+        BulkModifyRequest = (PDEBUGGER_BULK_MODIFY_EVENTS)Request.Buffer;
+        Entries           = (PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY)((UINT64)BulkModifyRequest + SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS);
+
+        if (!Request.IsSuccessful)
+        {
+            if (Request.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+            {
+                ShowErrorMessage(Request.KernelStatus);
+            }
+            else
+            {
+                ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+            }
+
+            IsSuccessful = FALSE;
+            break;
+        }
+
+        if (BulkModifyRequest->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+        {
+            ShowErrorMessage((UINT32)BulkModifyRequest->KernelStatus);
+
+            IsSuccessful = FALSE;
+            break;
+        }
+
+        //
+        // Apply the same changes to the user-mode structures that
+        // hold the event data
+        //
+        for (UINT32 i = 0; i < BulkModifyRequest->CountOfTags; i++)
+        {
+            if (States != NULL)
+            {
+                States->push_back(Entries[i].IsFound && Entries[i].IsEnabled);
+            }
+
+            if (!Entries[i].IsFound)
+            {
+                if (TypeOfAction != DEBUGGER_MODIFY_EVENTS_QUERY_STATE)
+                {
+                    ShowMessages("err, tag id %llx is invalid\n",
+                                 Entries[i].Tag - DebuggerEventTagStartSeed);
+                }
+
+                continue;
+            }
+
+            if (TypeOfAction == DEBUGGER_MODIFY_EVENTS_ENABLE)
+            {
+                CommandEventEnableEvent(Entries[i].Tag);
+            }
+            else if (TypeOfAction == DEBUGGER_MODIFY_EVENTS_DISABLE)
+            {
+                CommandEventDisableEvent(Entries[i].Tag);
+            }
+            else if (TypeOfAction == DEBUGGER_MODIFY_EVENTS_CLEAR)
+            {
+                CommandEventClearEvent(Entries[i].Tag);
+            }
+        }
+    }
+
+    for (auto & Request : Requests)
+    {
+        free(Request.Buffer);
+    }
+
+    if (!IsSuccessful)
+    {
+        return FALSE;
+    }
+
+    //
+    // The action was applied successfully, the buffers are flushed
+    // once for all of the events
+    //
+    if ((TypeOfAction == DEBUGGER_MODIFY_EVENTS_DISABLE || TypeOfAction == DEBUGGER_MODIFY_EVENTS_CLEAR) &&
+        g_BreakPrintingOutput &&
+        !g_IsConnectedToRemoteDebuggee &&
+        !g_IsSerialConnectedToRemoteDebugger)
+    {
+        CommandEventsFlushBuffersOrShowAutoFlushHint();
+    }
+
+    return TRUE;
+}
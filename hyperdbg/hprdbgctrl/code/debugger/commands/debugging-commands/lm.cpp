@@ -117,9 +117,11 @@ CommandLmShowUserModeModule(UINT32 ProcessId, const char * SearchModule)
 
         //
         // Set the module details to get the modules (not count)
+        // (the generation of the count is sent, so the counted modules are returned)
         //
         ModuleDetailsRequest->ProcessId        = ProcessId;
         ModuleDetailsRequest->OnlyCountModules = FALSE;
+        ModuleDetailsRequest->Generation       = ModuleCountRequest.Generation;
 
         //
         // Send the request to the kernel
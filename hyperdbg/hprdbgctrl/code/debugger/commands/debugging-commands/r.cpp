@@ -163,6 +163,64 @@ CommandRHelp()
     ShowMessages("\t\te.g : r rax = @rbx + @rcx + 0n10\n");
 }
 
+/**
+ * @brief show all the registers of a state
+ *
+ * @param Regs
+ * @param ExtraRegs
+ * @return VOID
+ */
+VOID
+ShowAllRegistersFromState(PGUEST_REGS Regs, PGUEST_EXTRA_REGISTERS ExtraRegs)
+{
+    RFLAGS Rflags = {0};
+    Rflags.AsUInt = ExtraRegs->RFLAGS;
+
+    ShowMessages(
+        "RAX=%016llx RBX=%016llx RCX=%016llx\n"
+        "RDX=%016llx RSI=% 016llx RDI=%016llx\n"
+        "RIP=%016llx RSP=%016llx RBP=%016llx\n"
+        "R8=%016llx  R9=%016llx  R10=%016llx\n"
+        "R11=%016llx R12=%016llx R13=%016llx\n"
+        "R14=%016llx R15=%016llx IOPL=%02x\n"
+        "%s  %s  %s  %s\n%s  %s  %s  %s  \n"
+        "CS %04x SS %04x DS %04x ES %04x FS %04x GS %04x\n"
+        "RFLAGS=%016llx\n",
+        Regs->rax,
+        Regs->rbx,
+        Regs->rcx,
+        Regs->rdx,
+        Regs->rsi,
+        Regs->rdi,
+        ExtraRegs->RIP,
+        Regs->rsp,
+        Regs->rbp,
+        Regs->r8,
+        Regs->r9,
+        Regs->r10,
+        Regs->r11,
+        Regs->r12,
+        Regs->r13,
+        Regs->r14,
+        Regs->r15,
+        Rflags.IoPrivilegeLevel,
+        Rflags.OverflowFlag ? "OF 1" : "OF 0",
+        Rflags.DirectionFlag ? "DF 1" : "DF 0",
+        Rflags.InterruptEnableFlag ? "IF 1" : "IF 0",
+        Rflags.SignFlag ? "SF  1" : "SF  0",
+        Rflags.ZeroFlag ? "ZF 1" : "ZF 0",
+        Rflags.ParityFlag ? "PF 1" : "PF 0",
+        Rflags.CarryFlag ? "CF 1" : "CF 0",
+        Rflags.AuxiliaryCarryFlag ? "AXF 1" : "AXF 0",
+        ExtraRegs->CS,
+        ExtraRegs->SS,
+        ExtraRegs->DS,
+        ExtraRegs->ES,
+        ExtraRegs->FS,
+        ExtraRegs->GS,
+        ExtraRegs->RFLAGS);
+}
+
 /**
  * @brief handler of r show all registers command
  *
@@ -172,6 +230,14 @@ CommandRHelp()
 VOID
 ShowAllRegisters()
 {
+    //
+    // Registers might be prefetched on the halt
+    //
+    if (HaltPrefetchShowAllRegisters())
+    {
+        return;
+    }
+
     DEBUGGEE_REGISTER_READ_DESCRIPTION RegState = {0};
     RegState.RegisterID                         = DEBUGGEE_SHOW_ALL_REGISTERS;
     KdSendReadRegisterPacketToDebuggee(&RegState);
@@ -256,7 +322,17 @@ CommandR(std::vector<std::string> SplittedCommand, std::string Command)
             //
             if (g_IsSerialConnectedToRemoteDebuggee)
             {
-                KdSendReadRegisterPacketToDebuggee(&RegState);
+                if (HaltPrefetchGetRegisterValue(RegKind, &RegState.Value))
+                {
+                    //
+                    // The register is prefetched on the halt
+                    //
+                    ShowMessages("%s=%016llx\n", RegistersNames[RegKind], RegState.Value);
+                }
+                else
+                {
+                    KdSendReadRegisterPacketToDebuggee(&RegState);
+                }
             }
             else
             {
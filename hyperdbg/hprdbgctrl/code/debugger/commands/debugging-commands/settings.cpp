@@ -18,8 +18,12 @@ extern BOOLEAN g_AutoUnpause;
 extern BOOLEAN g_AutoFlush;
 extern BOOLEAN g_AddressConversion;
 extern BOOLEAN g_IsConnectedToRemoteDebuggee;
+extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
 extern UINT32  g_DisassemblerSyntax;
 
+extern DEBUGGEE_KD_HALT_PREFETCH_PROFILE g_HaltPrefetchProfile;
+extern BROADCAST_SLOW_SUBSCRIBER_POLICY  g_BroadcastSlowSubscriberPolicy;
+
 /**
  * @brief help of settings command
  *
@@ -35,6 +39,7 @@ CommandSettingsHelp()
     ShowMessages("syntax : \tsettings [OptionName (string)] [Value (hex)]\n");
     ShowMessages("syntax : \tsettings [OptionName (string)] [Value (string)]\n");
     ShowMessages("syntax : \tsettings [OptionName (string)] [on|off]\n");
+    ShowMessages("syntax : \tsettings haltprefetch [on] [StackSize (hex)] [CodeSize (hex)]\n");
 
     ShowMessages("\n");
     ShowMessages("\t\te.g : settings autounpause\n");
@@ -47,6 +52,11 @@ CommandSettingsHelp()
     ShowMessages("\t\te.g : settings syntax intel\n");
     ShowMessages("\t\te.g : settings syntax att\n");
     ShowMessages("\t\te.g : settings syntax masm\n");
+    ShowMessages("\t\te.g : settings haltprefetch on\n");
+    ShowMessages("\t\te.g : settings haltprefetch on 200 80\n");
+    ShowMessages("\t\te.g : settings haltprefetch off\n");
+    ShowMessages("\t\te.g : settings subscriberpolicy drop\n");
+    ShowMessages("\t\te.g : settings subscriberpolicy disconnect\n");
 }
 
 /**
@@ -240,6 +250,28 @@ CommandSettingsLoadDefaultValuesFromConfigFile()
         }
     }
 
+    //
+    // Set the policy of slow subscribers
+    //
+    if (CommandSettingsGetValueFromConfigFile("SubscriberPolicy", OptionValue))
+    {
+        if (!OptionValue.compare("drop"))
+        {
+            g_BroadcastSlowSubscriberPolicy = BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST;
+        }
+        else if (!OptionValue.compare("disconnect"))
+        {
+            g_BroadcastSlowSubscriberPolicy = BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT;
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect subscriber policy settings\n");
+        }
+    }
+
     //
     // Set the address conversion
     //
@@ -391,6 +423,163 @@ CommandSettingsAutoFlush(vector<string> SplittedCommand)
     }
 }
 
+/**
+ * @brief set the profile of the state (registers, stack and code) that
+ * the debuggee sends when it's halted and query the status of this mode
+ *
+ * @param SplittedCommand
+ * @return VOID
+ */
+VOID
+CommandSettingsHaltPrefetch(vector<string> SplittedCommand)
+{
+    DEBUGGEE_KD_HALT_PREFETCH_PROFILE Profile = {0};
+
+    if (SplittedCommand.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_HaltPrefetchProfile.IsEnabled)
+        {
+            ShowMessages("halt-prefetch is enabled (stack size: 0x%x, code size: 0x%x)\n",
+                         g_HaltPrefetchProfile.StackSize,
+                         g_HaltPrefetchProfile.CodeSize);
+        }
+        else
+        {
+            ShowMessages("halt-prefetch is disabled\n");
+        }
+
+        return;
+    }
+
+    if (SplittedCommand.size() == 3 && !SplittedCommand.at(2).compare("off"))
+    {
+        Profile.IsEnabled = FALSE;
+    }
+    else if (SplittedCommand.size() == 3 && !SplittedCommand.at(2).compare("on"))
+    {
+        Profile.IsEnabled = TRUE;
+        Profile.StackSize = DEBUGGEE_KD_HALT_PREFETCH_DEFAULT_STACK_SIZE;
+        Profile.CodeSize  = DEBUGGEE_KD_HALT_PREFETCH_DEFAULT_CODE_SIZE;
+    }
+    else if (SplittedCommand.size() == 5 && !SplittedCommand.at(2).compare("on"))
+    {
+        Profile.IsEnabled = TRUE;
+
+        if (!ConvertStringToUInt32(SplittedCommand.at(3), &Profile.StackSize))
+        {
+            ShowMessages("err, couldn't resolve error at '%s'\n", SplittedCommand.at(3).c_str());
+            return;
+        }
+
+        if (!ConvertStringToUInt32(SplittedCommand.at(4), &Profile.CodeSize))
+        {
+            ShowMessages("err, couldn't resolve error at '%s'\n", SplittedCommand.at(4).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                     "for more details\n");
+        return;
+    }
+
+    if (Profile.StackSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE ||
+        Profile.CodeSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE)
+    {
+        ShowMessages("err, the maximum stack size is 0x%x and the maximum code size is 0x%x\n",
+                     DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE,
+                     DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE);
+        return;
+    }
+
+    //
+    // Send the profile to the debuggee
+    //
+    if (!KdSendHaltPrefetchProfilePacketToDebuggee(&Profile))
+    {
+        return;
+    }
+
+    g_HaltPrefetchProfile = Profile;
+
+    if (Profile.IsEnabled)
+    {
+        ShowMessages("set halt-prefetch to enabled\n");
+    }
+    else
+    {
+        ShowMessages("set halt-prefetch to disabled\n");
+    }
+}
+
+/**
+ * @brief set what to do with the subscribers of the remote server
+ * that are slow and query the current policy
+ *
+ * @param SplittedCommand
+ * @return VOID
+ */
+VOID
+CommandSettingsSubscriberPolicy(vector<string> SplittedCommand)
+{
+    if (SplittedCommand.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_BroadcastSlowSubscriberPolicy == BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT)
+        {
+            ShowMessages("slow subscribers are disconnected\n");
+        }
+        else
+        {
+            ShowMessages("oldest messages of slow subscribers are dropped\n");
+        }
+    }
+    else if (SplittedCommand.size() == 3)
+    {
+        if (!SplittedCommand.at(2).compare("drop"))
+        {
+            g_BroadcastSlowSubscriberPolicy = BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST;
+            CommandSettingsSetValueFromConfigFile("SubscriberPolicy", "drop");
+
+            ShowMessages("set subscriber policy to drop\n");
+        }
+        else if (!SplittedCommand.at(2).compare("disconnect"))
+        {
+            g_BroadcastSlowSubscriberPolicy = BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT;
+            CommandSettingsSetValueFromConfigFile("SubscriberPolicy", "disconnect");
+
+            ShowMessages("set subscriber policy to disconnect\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                         "for more details\n");
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                     "for more details\n");
+        return;
+    }
+}
+
 /**
  * @brief set auto-unpause mode to enabled or disabled
  *
@@ -614,6 +803,32 @@ CommandSettings(vector<string> SplittedCommand, string Command)
             CommandSettingsAddressConversion(SplittedCommand);
         }
     }
+    else if (!SplittedCommand.at(1).compare("haltprefetch"))
+    {
+        //
+        // It's only available in the Debugger Mode
+        //
+        if (g_IsConnectedToRemoteDebuggee)
+        {
+            RemoteConnectionSendCommand(Command.c_str(), Command.length() + 1);
+        }
+        else if (g_IsSerialConnectedToRemoteDebuggee)
+        {
+            CommandSettingsHaltPrefetch(SplittedCommand);
+        }
+        else
+        {
+            ShowMessages("err, halt-prefetch is only available when you're connected "
+                         "to a debuggee\n");
+        }
+    }
+    else if (!SplittedCommand.at(1).compare("subscriberpolicy"))
+    {
+        //
+        // Handle it locally
+        //
+        CommandSettingsSubscriberPolicy(SplittedCommand);
+    }
     else
     {
         //
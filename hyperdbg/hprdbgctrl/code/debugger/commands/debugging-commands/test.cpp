@@ -101,7 +101,8 @@ CommandTestPerformKernelTestsIoctl()
 BOOLEAN
 CommandTestPerformTest(PDEBUGGEE_KERNEL_AND_USER_TEST_INFORMATION KernelSideInformation, UINT32 KernelSideInformationSize)
 {
-    BOOLEAN ResultOfTest = FALSE;
+    BOOLEAN ResultOfTest           = FALSE;
+    BOOLEAN ResultOfKernelSideTest = TRUE;
     HANDLE  PipeHandle;
     HANDLE  ThreadHandle;
     HANDLE  ProcessHandle;
@@ -159,15 +160,18 @@ WaitForResponse:
     if (strcmp(Buffer, "perform-kernel-test") == 0)
     {
         //
-        // Send IOCTL to perform kernel tasks
+        // Send IOCTL to perform kernel tasks (and the kernel self-checks)
         //
-        CommandTestPerformKernelTestsIoctl();
+        if (!CommandTestPerformKernelTestsIoctl())
+        {
+            ResultOfKernelSideTest = FALSE;
+        }
 
         goto WaitForResponse;
     }
     else if (strcmp(Buffer, "success") == 0)
     {
-        ResultOfTest = TRUE;
+        ResultOfTest = ResultOfKernelSideTest;
     }
     else if (Buffer[0] == 'c' &&
              Buffer[1] == 'm' &&
@@ -196,6 +200,32 @@ WaitForResponse:
     return ResultOfTest;
 }
 
+/**
+ * @brief Check the routines of the debugger that don't need the
+ * driver (and the debuggee) to be tested
+ *
+ * @return BOOLEAN returns true if all the checks were successful
+ */
+BOOLEAN
+CommandTestPerformSelfChecks()
+{
+    BOOLEAN Result = TRUE;
+
+    if (!CommandEventsPerformSelfCheck())
+    {
+        ShowMessages("err, self-check of parsing the event numbers failed\n");
+        Result = FALSE;
+    }
+
+    if (!BroadcastPerformSelfCheck())
+    {
+        ShowMessages("err, self-check of queueing the broadcast messages failed\n");
+        Result = FALSE;
+    }
+
+    return Result;
+}
+
 /**
  * @brief test command for VMI mode
  *
@@ -204,11 +234,17 @@ WaitForResponse:
 VOID
 CommandTestInVmiMode()
 {
-    BOOL  Status;
-    ULONG ReturnedLength;
+    BOOL    Status;
+    ULONG   ReturnedLength;
+    BOOLEAN IsSelfCheckSuccessful;
     PDEBUGGEE_KERNEL_AND_USER_TEST_INFORMATION
     KernelSideTestInformationRequestArray;
 
+    //
+    // Check the routines that don't need the driver
+    //
+    IsSelfCheckSuccessful = CommandTestPerformSelfChecks();
+
     AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturn);
 
     //
@@ -247,7 +283,8 @@ CommandTestInVmiMode()
     //
     // Means to check just one command
     //
-    if (CommandTestPerformTest(KernelSideTestInformationRequestArray, ReturnedLength))
+    if (CommandTestPerformTest(KernelSideTestInformationRequestArray, ReturnedLength) &&
+        IsSelfCheckSuccessful)
     {
         ShowMessages("all the tests were successful :)\n");
     }
@@ -24,6 +24,8 @@ CommandCpuidHelp()
 
     ShowMessages("syntax : \t!cpuid [pid ProcessId (hex)] [core CoreId (hex)] "
                  "[imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] "
+                 "[sample Rate (hex)] [rate HitsPerSecond (hex)] [hits MaximumHits (hex)] "
+                 "[capture Registers (string)] [snippet Register (string) Size (hex)] "
                  "[script { Script (string) }] [condition { Condition (hex) }] "
                  "[code { Code (hex) }]\n");
 
@@ -31,6 +33,8 @@ CommandCpuidHelp()
     ShowMessages("\t\te.g : !cpuid\n");
     ShowMessages("\t\te.g : !cpuid pid 400\n");
     ShowMessages("\t\te.g : !cpuid core 2 pid 400\n");
+    ShowMessages("\t\te.g : !cpuid sample 10 rate 100 hits 1000\n");
+    ShowMessages("\t\te.g : !cpuid capture rax,rcx,rip snippet rsp 20\n");
 }
 
 /**
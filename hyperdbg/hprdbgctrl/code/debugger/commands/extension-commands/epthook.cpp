@@ -24,6 +24,8 @@ CommandEptHookHelp()
     ShowMessages(
         "syntax : \t!epthook [Address (hex)] [pid ProcessId (hex)] [core CoreId (hex)] "
         "[imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] "
+        "[sample Rate (hex)] [rate HitsPerSecond (hex)] [hits MaximumHits (hex)] "
+        "[capture Registers (string)] [snippet Register (string) Size (hex)] "
         "[script { Script (string) }] [condition { Condition (hex) }] "
         "[code { Code (hex) }] \n");
 
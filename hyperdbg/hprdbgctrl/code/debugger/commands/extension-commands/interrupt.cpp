@@ -23,6 +23,8 @@ CommandInterruptHelp()
 
     ShowMessages("syntax : \t[IdtIndex (hex)] [pid ProcessId (hex)] "
                  "[core CoreId (hex)] [imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] "
+                 "[sample Rate (hex)] [rate HitsPerSecond (hex)] [hits MaximumHits (hex)] "
+                 "[capture Registers (string)] [snippet Register (string) Size (hex)] "
                  "[script { Script (string) }] [condition { Condition (hex) }] [code { Code (hex) }]\n");
 
     ShowMessages("\nnote : The index should be greater than 0x20 (32) and less "
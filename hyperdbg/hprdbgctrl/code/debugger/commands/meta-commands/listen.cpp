@@ -35,6 +35,9 @@ CommandListenHelp()
                  "default port (%s)\n",
                  DEFAULT_PORT);
 
+    ShowMessages("note : \tother clients that connect to the same port receive "
+                 "the output as subscribers (read-only)\n");
+
     ShowMessages("syntax : \t.listen [Port (decimal)]\n");
 
     ShowMessages("\n");
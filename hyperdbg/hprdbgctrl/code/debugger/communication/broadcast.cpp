@@ -0,0 +1,561 @@
+/**
+ * @file broadcast.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Broadcasting the output of the remote server to subscribers
+ * @details The first client of '.listen' controls the debugger, other
+ * clients that connect to the same port are subscribers that receive
+ * the same output (read-only), a single thread waits for the events of
+ * the listening socket and the subscribers and sends the queued messages
+ * when the sockets are writable
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN                            g_IsBroadcastRunning;
+extern HANDLE                             g_BroadcastThread;
+extern WSAEVENT                           g_BroadcastWakeUpEvent;
+extern WSAEVENT                           g_BroadcastAcceptEvent;
+extern CRITICAL_SECTION                   g_BroadcastLock;
+extern BOOLEAN                            g_IsBroadcastLockInitialized;
+extern std::vector<PBROADCAST_SUBSCRIBER> g_BroadcastSubscribers;
+extern BROADCAST_SLOW_SUBSCRIBER_POLICY   g_BroadcastSlowSubscriberPolicy;
+extern SOCKET                             g_ServerListenSocket;
+
+/**
+ * @brief Close the socket of a subscriber and free it
+ *
+ * @param Subscriber
+ *
+ * @return VOID
+ */
+static VOID
+BroadcastFreeSubscriber(PBROADCAST_SUBSCRIBER Subscriber)
+{
+    closesocket(Subscriber->Socket);
+    WSACloseEvent(Subscriber->Event);
+
+    delete Subscriber;
+}
+
+/**
+ * @brief Accept the clients that are waiting to subscribe
+ *
+ * @return VOID
+ */
+static VOID
+BroadcastAcceptSubscribers()
+{
+    WSANETWORKEVENTS      NetworkEvents       = {0};
+    SOCKET                Socket;
+    PBROADCAST_SUBSCRIBER Subscriber;
+    sockaddr_in           Name                = {0};
+    int                   NameLength          = sizeof(Name);
+    CHAR                  Ip[INET_ADDRSTRLEN] = {0};
+
+    if (WSAEnumNetworkEvents(g_ServerListenSocket, g_BroadcastAcceptEvent, &NetworkEvents) == SOCKET_ERROR ||
+        !(NetworkEvents.lNetworkEvents & FD_ACCEPT))
+    {
+        return;
+    }
+
+    //
+    // The listening socket is non-blocking, so accept until there is
+    // no waiting client
+    //
+    while ((Socket = accept(g_ServerListenSocket, (struct sockaddr *)&Name, &NameLength)) != INVALID_SOCKET)
+    {
+        NameLength = sizeof(Name);
+
+        if (g_BroadcastSubscribers.size() >= BROADCAST_MAXIMUM_SUBSCRIBERS)
+        {
+            closesocket(Socket);
+            continue;
+        }
+
+        Subscriber = new BROADCAST_SUBSCRIBER;
+
+        Subscriber->Socket                  = Socket;
+        Subscriber->Event                   = WSACreateEvent();
+        Subscriber->IsWritable              = TRUE;
+        Subscriber->IsClosed                = FALSE;
+        Subscriber->SentBytesOfFirstMessage = 0;
+        Subscriber->CountOfDroppedMessages  = 0;
+
+        //
+        // The accepted socket inherits the events of the listening socket,
+        // so the events of the subscriber are set here
+        //
+        if (Subscriber->Event == WSA_INVALID_EVENT ||
+            WSAEventSelect(Socket, Subscriber->Event, FD_READ | FD_WRITE | FD_CLOSE) == SOCKET_ERROR)
+        {
+            BroadcastFreeSubscriber(Subscriber);
+            continue;
+        }
+
+        EnterCriticalSection(&g_BroadcastLock);
+        g_BroadcastSubscribers.push_back(Subscriber);
+        LeaveCriticalSection(&g_BroadcastLock);
+
+        inet_ntop(AF_INET, &Name.sin_addr, Ip, sizeof(Ip));
+        ShowMessages("subscriber connected : %s:%d\n", Ip, ntohs(Name.sin_port));
+    }
+}
+
+/**
+ * @brief Send the queued messages of a subscriber until the socket
+ * is not writable anymore
+ * @details The lock should be held by the caller
+ *
+ * @param Subscriber
+ *
+ * @return VOID
+ */
+static VOID
+BroadcastFlushSubscriber(PBROADCAST_SUBSCRIBER Subscriber)
+{
+    int  Result;
+    CHAR DroppedMessage[64];
+
+    while (Subscriber->IsWritable && !Subscriber->IsClosed && !Subscriber->Queue.empty())
+    {
+        //
+        // Let the subscriber know about the dropped messages before
+        // the next message
+        //
+        if (Subscriber->CountOfDroppedMessages != 0 && Subscriber->SentBytesOfFirstMessage == 0)
+        {
+            sprintf_s(DroppedMessage,
+                      sizeof(DroppedMessage),
+                      "\nwarning, %llx message(s) are dropped\n",
+                      Subscriber->CountOfDroppedMessages);
+
+            Subscriber->Queue.push_front(std::make_shared<const std::string>(DroppedMessage));
+            Subscriber->CountOfDroppedMessages = 0;
+        }
+
+        const std::string & Message = *Subscriber->Queue.front();
+
+        Result = send(Subscriber->Socket,
+                      Message.data() + Subscriber->SentBytesOfFirstMessage,
+                      (int)(Message.size() - Subscriber->SentBytesOfFirstMessage),
+                      0);
+
+        if (Result == SOCKET_ERROR)
+        {
+            if (WSAGetLastError() == WSAEWOULDBLOCK)
+            {
+                //
+                // Wait for FD_WRITE
+                //
+                Subscriber->IsWritable = FALSE;
+            }
+            else
+            {
+                Subscriber->IsClosed = TRUE;
+            }
+
+            break;
+        }
+
+        Subscriber->SentBytesOfFirstMessage += Result;
+
+        if (Subscriber->SentBytesOfFirstMessage == Message.size())
+        {
+            Subscriber->Queue.pop_front();
+            Subscriber->SentBytesOfFirstMessage = 0;
+        }
+    }
+}
+
+/**
+ * @brief Handle the network events of the subscribers and send their
+ * queued messages
+ *
+ * @return VOID
+ */
+static VOID
+BroadcastServeSubscribers()
+{
+    WSANETWORKEVENTS NetworkEvents;
+    CHAR             Buffer[0x100];
+
+    EnterCriticalSection(&g_BroadcastLock);
+
+    for (auto Subscriber : g_BroadcastSubscribers)
+    {
+        if (WSAEnumNetworkEvents(Subscriber->Socket, Subscriber->Event, &NetworkEvents) == SOCKET_ERROR ||
+            (NetworkEvents.lNetworkEvents & FD_CLOSE))
+        {
+            Subscriber->IsClosed = TRUE;
+            continue;
+        }
+
+        if (NetworkEvents.lNetworkEvents & FD_READ)
+        {
+            //
+            // Subscribers are read-only, whatever they send is ignored
+            //
+            while (recv(Subscriber->Socket, Buffer, sizeof(Buffer), 0) > 0)
+            {
+                continue;
+            }
+        }
+
+        if (NetworkEvents.lNetworkEvents & FD_WRITE)
+        {
+            Subscriber->IsWritable = TRUE;
+        }
+
+        BroadcastFlushSubscriber(Subscriber);
+    }
+
+    //
+    // Remove the subscribers that are closed
+    //
+    for (auto It = g_BroadcastSubscribers.begin(); It != g_BroadcastSubscribers.end();)
+    {
+        if ((*It)->IsClosed)
+        {
+            BroadcastFreeSubscriber(*It);
+            It = g_BroadcastSubscribers.erase(It);
+        }
+        else
+        {
+            It++;
+        }
+    }
+
+    LeaveCriticalSection(&g_BroadcastLock);
+}
+
+/**
+ * @brief The thread that serves the subscribers
+ *
+ * @param lpParam
+ * @return DWORD
+ */
+DWORD WINAPI
+BroadcastThread(LPVOID lpParam)
+{
+    WSAEVENT Events[BROADCAST_MAXIMUM_SUBSCRIBERS + 2];
+    DWORD    CountOfEvents;
+
+    while (g_IsBroadcastRunning)
+    {
+        //
+        // Wait for new messages, new clients and the events of subscribers
+        //
+        Events[0]     = g_BroadcastWakeUpEvent;
+        Events[1]     = g_BroadcastAcceptEvent;
+        CountOfEvents = 2;
+
+        EnterCriticalSection(&g_BroadcastLock);
+
+        for (auto Subscriber : g_BroadcastSubscribers)
+        {
+            Events[CountOfEvents++] = Subscriber->Event;
+        }
+
+        LeaveCriticalSection(&g_BroadcastLock);
+
+        if (WSAWaitForMultipleEvents(CountOfEvents, Events, FALSE, WSA_INFINITE, FALSE) == WSA_WAIT_FAILED)
+        {
+            break;
+        }
+
+        if (!g_IsBroadcastRunning)
+        {
+            break;
+        }
+
+        WSAResetEvent(g_BroadcastWakeUpEvent);
+
+        BroadcastAcceptSubscribers();
+        BroadcastServeSubscribers();
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Start accepting subscribers on the listening socket of the
+ * remote server
+ *
+ * @param ListenSocket
+ * @return BOOLEAN
+ */
+BOOLEAN
+BroadcastStart(SOCKET ListenSocket)
+{
+    DWORD ThreadId;
+
+    if (g_IsBroadcastRunning)
+    {
+        return FALSE;
+    }
+
+    g_BroadcastWakeUpEvent = WSACreateEvent();
+    g_BroadcastAcceptEvent = WSACreateEvent();
+
+    if (g_BroadcastWakeUpEvent == WSA_INVALID_EVENT || g_BroadcastAcceptEvent == WSA_INVALID_EVENT ||
+        WSAEventSelect(ListenSocket, g_BroadcastAcceptEvent, FD_ACCEPT) == SOCKET_ERROR)
+    {
+        ShowMessages("err, unable to accept subscribers (%x)\n", WSAGetLastError());
+        BroadcastStop();
+        return FALSE;
+    }
+
+    //
+    // The lock is never deleted as messages might be published from
+    // other threads while broadcasting is stopped
+    //
+    if (!g_IsBroadcastLockInitialized)
+    {
+        InitializeCriticalSection(&g_BroadcastLock);
+        g_IsBroadcastLockInitialized = TRUE;
+    }
+
+    g_IsBroadcastRunning = TRUE;
+
+    g_BroadcastThread = CreateThread(NULL, 0, BroadcastThread, NULL, 0, &ThreadId);
+
+    if (g_BroadcastThread == NULL)
+    {
+        BroadcastStop();
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Stop broadcasting and disconnect all of the subscribers
+ * @details should be called before closing the listening socket
+ *
+ * @return VOID
+ */
+VOID
+BroadcastStop()
+{
+    g_IsBroadcastRunning = FALSE;
+
+    if (g_BroadcastThread != NULL)
+    {
+        WSASetEvent(g_BroadcastWakeUpEvent);
+        WaitForSingleObject(g_BroadcastThread, INFINITE);
+        CloseHandle(g_BroadcastThread);
+
+        g_BroadcastThread = NULL;
+    }
+
+    if (g_IsBroadcastLockInitialized)
+    {
+        EnterCriticalSection(&g_BroadcastLock);
+
+        for (auto Subscriber : g_BroadcastSubscribers)
+        {
+            BroadcastFreeSubscriber(Subscriber);
+        }
+
+        g_BroadcastSubscribers.clear();
+
+        LeaveCriticalSection(&g_BroadcastLock);
+    }
+
+    if (g_BroadcastWakeUpEvent != WSA_INVALID_EVENT)
+    {
+        WSACloseEvent(g_BroadcastWakeUpEvent);
+        g_BroadcastWakeUpEvent = WSA_INVALID_EVENT;
+    }
+
+    if (g_BroadcastAcceptEvent != WSA_INVALID_EVENT)
+    {
+        WSACloseEvent(g_BroadcastAcceptEvent);
+        g_BroadcastAcceptEvent = WSA_INVALID_EVENT;
+    }
+}
+
+/**
+ * @brief Queue a message for a subscriber
+ * @details if the queue of the subscriber is full, then based on the
+ * policy, either the oldest message that is not partially sent is dropped
+ * or the subscriber is marked as closed
+ *
+ * @param Subscriber
+ * @param Message
+ * @param Policy
+ * @return BOOLEAN whether the message is queued or not
+ */
+static BOOLEAN
+BroadcastEnqueueMessage(PBROADCAST_SUBSCRIBER                Subscriber,
+                        std::shared_ptr<const std::string> & Message,
+                        BROADCAST_SLOW_SUBSCRIBER_POLICY     Policy)
+{
+    if (Subscriber->IsClosed)
+    {
+        return FALSE;
+    }
+
+    if (Subscriber->Queue.size() >= BROADCAST_MAXIMUM_QUEUED_MESSAGES)
+    {
+        if (Policy == BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT)
+        {
+            Subscriber->IsClosed = TRUE;
+            return FALSE;
+        }
+
+        //
+        // Drop the oldest message that is not partially sent
+        //
+        auto Oldest = Subscriber->Queue.begin();
+
+        if (Subscriber->SentBytesOfFirstMessage != 0)
+        {
+            Oldest++;
+        }
+
+        Subscriber->Queue.erase(Oldest);
+        Subscriber->CountOfDroppedMessages++;
+    }
+
+    Subscriber->Queue.push_back(Message);
+
+    return TRUE;
+}
+
+/**
+ * @brief Publish a message to all of the subscribers
+ * @details The message is copied once and shared between the queues,
+ * if the queue of a subscriber is full, then based on the policy, either
+ * the oldest message is dropped or the subscriber is disconnected
+ *
+ * @param Buffer
+ * @param Length
+ * @return VOID
+ */
+VOID
+BroadcastPublish(const char * Buffer, UINT32 Length)
+{
+    if (!g_IsBroadcastRunning || Length == 0)
+    {
+        return;
+    }
+
+    EnterCriticalSection(&g_BroadcastLock);
+
+    if (g_BroadcastSubscribers.empty())
+    {
+        LeaveCriticalSection(&g_BroadcastLock);
+        return;
+    }
+
+    auto Message = std::make_shared<const std::string>(Buffer, Length);
+
+    for (auto Subscriber : g_BroadcastSubscribers)
+    {
+        BroadcastEnqueueMessage(Subscriber, Message, g_BroadcastSlowSubscriberPolicy);
+    }
+
+    LeaveCriticalSection(&g_BroadcastLock);
+
+    //
+    // Wake up the broadcasting thread to send the message
+    //
+    WSASetEvent(g_BroadcastWakeUpEvent);
+}
+
+/**
+ * @brief Check the policies of queueing the messages for a slow
+ * subscriber
+ * @details used by the test command, it doesn't need a connected
+ * subscriber as nothing is sent
+ *
+ * @return BOOLEAN if the results were as expected then it returns
+ * true otherwise it returns false
+ */
+BOOLEAN
+BroadcastPerformSelfCheck()
+{
+    BROADCAST_SUBSCRIBER                             Subscriber {};
+    std::vector<std::shared_ptr<const std::string>> Messages;
+
+    for (UINT32 i = 0; i < BROADCAST_MAXIMUM_QUEUED_MESSAGES + 2; i++)
+    {
+        Messages.push_back(std::make_shared<const std::string>(std::to_string(i)));
+    }
+
+    Subscriber.Socket = INVALID_SOCKET;
+    Subscriber.Event  = WSA_INVALID_EVENT;
+
+    //
+    // Fill the queue, nothing is dropped until the queue is full
+    //
+    for (UINT32 i = 0; i < BROADCAST_MAXIMUM_QUEUED_MESSAGES; i++)
+    {
+        if (!BroadcastEnqueueMessage(&Subscriber, Messages[i], BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST))
+        {
+            return FALSE;
+        }
+    }
+
+    if (Subscriber.Queue.size() != BROADCAST_MAXIMUM_QUEUED_MESSAGES || Subscriber.CountOfDroppedMessages != 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // The partially sent message is kept and the one after it is dropped
+    //
+    Subscriber.SentBytesOfFirstMessage = 1;
+
+    if (!BroadcastEnqueueMessage(&Subscriber, Messages[BROADCAST_MAXIMUM_QUEUED_MESSAGES], BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST) ||
+        Subscriber.Queue.size() != BROADCAST_MAXIMUM_QUEUED_MESSAGES ||
+        Subscriber.CountOfDroppedMessages != 1 ||
+        Subscriber.Queue.front() != Messages[0] ||
+        *std::next(Subscriber.Queue.begin()) != Messages[2] ||
+        Subscriber.Queue.back() != Messages[BROADCAST_MAXIMUM_QUEUED_MESSAGES])
+    {
+        return FALSE;
+    }
+
+    //
+    // Once the first message is sent, the oldest message is dropped
+    //
+    Subscriber.SentBytesOfFirstMessage = 0;
+
+    if (!BroadcastEnqueueMessage(&Subscriber, Messages[BROADCAST_MAXIMUM_QUEUED_MESSAGES + 1], BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST) ||
+        Subscriber.Queue.size() != BROADCAST_MAXIMUM_QUEUED_MESSAGES ||
+        Subscriber.CountOfDroppedMessages != 2 ||
+        Subscriber.Queue.front() != Messages[2] ||
+        Subscriber.Queue.back() != Messages[BROADCAST_MAXIMUM_QUEUED_MESSAGES + 1])
+    {
+        return FALSE;
+    }
+
+    //
+    // A full queue closes the subscriber when the policy is disconnecting,
+    // and nothing is queued for a closed subscriber
+    //
+    if (BroadcastEnqueueMessage(&Subscriber, Messages[0], BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT) ||
+        !Subscriber.IsClosed ||
+        Subscriber.CountOfDroppedMessages != 2 ||
+        Subscriber.Queue.back() != Messages[BROADCAST_MAXIMUM_QUEUED_MESSAGES + 1])
+    {
+        return FALSE;
+    }
+
+    if (BroadcastEnqueueMessage(&Subscriber, Messages[0], BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST) ||
+        Subscriber.Queue.size() != BROADCAST_MAXIMUM_QUEUED_MESSAGES)
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
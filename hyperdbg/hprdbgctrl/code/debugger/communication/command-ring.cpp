@@ -0,0 +1,373 @@
+/**
+ * @file command-ring.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Shared command ring between the debugger and the driver
+ * @details The requests are written to a ring that is shared with the
+ * driver, then a single IOCTL makes the driver process all of them
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern HANDLE        g_DeviceHandle;
+extern PCOMMAND_RING g_CommandRing;
+
+/**
+ * @brief Register or unregister the shared command ring
+ *
+ * @param Ring the address of the ring or NULL to unregister it
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandRingSendRegistration(PCOMMAND_RING Ring)
+{
+    BOOL                          Status;
+    ULONG                         ReturnedLength;
+    DEBUGGER_COMMAND_RING_REQUEST RingRequest = {0};
+
+    RingRequest.RingAddress = (UINT64)Ring;
+    RingRequest.IsRegister  = Ring != NULL;
+
+    //
+    // Send the request by IOCTL
+    //
+    Status = DeviceIoControl(g_DeviceHandle,                       // Handle to device
+                             IOCTL_REGISTER_COMMAND_RING,          // IO Control code
+                             &RingRequest,                         // Input Buffer to driver.
+                             SIZEOF_DEBUGGER_COMMAND_RING_REQUEST, // Input buffer length
+                             &RingRequest,                         // Output Buffer from driver.
+                             SIZEOF_DEBUGGER_COMMAND_RING_REQUEST, // Length of output buffer in bytes.
+                             &ReturnedLength,                      // Bytes placed in buffer.
+                             NULL                                  // synchronous call
+    );
+
+    if (!Status || RingRequest.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Allocate and register the shared command ring
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandRingInitialize()
+{
+    PCOMMAND_RING Ring;
+
+    if (g_CommandRing != NULL)
+    {
+        return TRUE;
+    }
+
+    if (!g_DeviceHandle)
+    {
+        return FALSE;
+    }
+
+    Ring = (PCOMMAND_RING)VirtualAlloc(NULL, sizeof(COMMAND_RING), MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+    if (Ring == NULL)
+    {
+        return FALSE;
+    }
+
+    if (!CommandRingSendRegistration(Ring))
+    {
+        VirtualFree(Ring, 0, MEM_RELEASE);
+        return FALSE;
+    }
+
+    g_CommandRing = Ring;
+
+    return TRUE;
+}
+
+/**
+ * @brief Unregister and free the shared command ring
+ *
+ * @return VOID
+ */
+VOID
+CommandRingUninitialize()
+{
+    if (g_CommandRing == NULL)
+    {
+        return;
+    }
+
+    //
+    // The driver should release the pages before freeing them
+    //
+    CommandRingSendRegistration(NULL);
+
+    VirtualFree(g_CommandRing, 0, MEM_RELEASE);
+
+    g_CommandRing = NULL;
+}
+
+/**
+ * @brief Send a single request using its IOCTL
+ * @details used when the ring is not available or the request
+ * is not supported by the ring
+ *
+ * @param Request
+ *
+ * @return VOID
+ */
+VOID
+CommandRingSendRequestByIoctl(PCOMMAND_RING_REQUEST_DETAILS Request)
+{
+    ULONG ReturnedLength = 0;
+
+    Request->IsSuccessful = DeviceIoControl(g_DeviceHandle,              // Handle to device
+                                            Request->IoctlCode,          // IO Control code
+                                            Request->Buffer,             // Input Buffer to driver.
+                                            Request->InputBufferLength,  // Input buffer length
+                                            Request->Buffer,             // Output Buffer from driver.
+                                            Request->OutputBufferLength, // Length of output buffer in bytes.
+                                            &ReturnedLength,             // Bytes placed in buffer.
+                                            NULL                         // synchronous call
+                                            ) != FALSE;
+
+    Request->ReturnedLength = ReturnedLength;
+    Request->KernelStatus   = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
+/**
+ * @brief Ask the driver to process the submissions and reap the completions
+ *
+ * @param Requests
+ * @param SubmissionOffsets the offset of the buffer of each request in the data area
+ * @param IsCompleted set for each request that is completed
+ * @param CountOfCompletions the number of the reaped completions is added to it
+ *
+ * @return BOOLEAN FALSE if the ring is not usable anymore
+ */
+BOOLEAN
+CommandRingProcessSubmissions(PCOMMAND_RING_REQUEST_DETAILS Requests,
+                              vector<UINT32> &              SubmissionOffsets,
+                              vector<BOOLEAN> &             IsCompleted,
+                              UINT32 *                      CountOfCompletions)
+{
+    BOOL                           Status;
+    ULONG                          ReturnedLength;
+    DEBUGGER_COMMAND_RING_REQUEST  RingRequest = {0};
+    PCOMMAND_RING_COMPLETION_ENTRY Completion;
+    PCOMMAND_RING_REQUEST_DETAILS  Request;
+
+    Status = DeviceIoControl(g_DeviceHandle,                       // Handle to device
+                             IOCTL_PROCESS_COMMAND_RING,           // IO Control code
+                             &RingRequest,                         // Input Buffer to driver.
+                             SIZEOF_DEBUGGER_COMMAND_RING_REQUEST, // Input buffer length
+                             &RingRequest,                         // Output Buffer from driver.
+                             SIZEOF_DEBUGGER_COMMAND_RING_REQUEST, // Length of output buffer in bytes.
+                             &ReturnedLength,                      // Bytes placed in buffer.
+                             NULL                                  // synchronous call
+    );
+
+    //
+    // The completions are always reaped, so the driver processes at
+    // least one of the submissions unless the ring is not valid
+    //
+    if (!Status ||
+        RingRequest.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL ||
+        RingRequest.CountOfProcessedEntries == 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // Read the entries after reading the tail
+    //
+    MemoryBarrier();
+
+    while (g_CommandRing->CompletionHead != g_CommandRing->CompletionTail)
+    {
+        Completion = &g_CommandRing->Completions[g_CommandRing->CompletionHead & (COMMAND_RING_ENTRY_COUNT - 1)];
+        Request    = &Requests[Completion->UserData];
+
+        if (Completion->KernelStatus == DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED)
+        {
+            CommandRingSendRequestByIoctl(Request);
+        }
+        else
+        {
+            Request->KernelStatus   = Completion->KernelStatus;
+            Request->IsSuccessful   = Completion->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+            Request->ReturnedLength = min(Completion->ReturnedLength, Request->OutputBufferLength);
+
+            memcpy(Request->Buffer, &g_CommandRing->Data[SubmissionOffsets[Completion->UserData]], Request->ReturnedLength);
+        }
+
+        IsCompleted[Completion->UserData] = TRUE;
+        (*CountOfCompletions)++;
+
+        g_CommandRing->CompletionHead++;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Send a batch of requests to the driver
+ * @details As many requests as fit in the ring are submitted and then
+ * processed by a single IOCTL, requests that are not supported by the
+ * ring (or are too big for it) are sent by their own IOCTLs, and if the
+ * ring is not usable then all the remaining requests are sent by IOCTLs
+ *
+ * @param Requests
+ * @param CountOfRequests
+ *
+ * @return BOOLEAN whether all of the requests were successful or not
+ */
+BOOLEAN
+CommandRingSendRequests(PCOMMAND_RING_REQUEST_DETAILS Requests, UINT32 CountOfRequests)
+{
+    PCOMMAND_RING_SUBMISSION_ENTRY Submission;
+    PCOMMAND_RING_REQUEST_DETAILS  Request;
+    UINT32                         BufferLength;
+    UINT32                         DataOffset;
+    UINT32                         CountOfSubmissions;
+    UINT32                         CountOfCompletions;
+    UINT32                         BatchStart;
+    UINT32                         Index         = 0;
+    BOOLEAN                        AllSuccessful = TRUE;
+    vector<UINT32>                 SubmissionOffsets(CountOfRequests);
+    vector<BOOLEAN>                IsCompleted(CountOfRequests, FALSE);
+
+    AssertShowMessageReturnStmt(g_DeviceHandle, ASSERT_MESSAGE_DRIVER_NOT_LOADED, AssertReturnFalse);
+
+    for (UINT32 i = 0; i < CountOfRequests; i++)
+    {
+        Requests[i].IsSuccessful   = FALSE;
+        Requests[i].ReturnedLength = 0;
+        Requests[i].KernelStatus   = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+    }
+
+    //
+    // The ring is optional, if it's not available then all the
+    // requests are sent by their IOCTLs
+    //
+    if (!CommandRingInitialize())
+    {
+        for (UINT32 i = 0; i < CountOfRequests; i++)
+        {
+            CommandRingSendRequestByIoctl(&Requests[i]);
+            AllSuccessful &= Requests[i].IsSuccessful;
+        }
+
+        return AllSuccessful;
+    }
+
+    while (Index < CountOfRequests)
+    {
+        BatchStart         = Index;
+        DataOffset         = 0;
+        CountOfSubmissions = 0;
+        CountOfCompletions = 0;
+
+        //
+        // Fill the submissions while there is room in the ring
+        //
+        while (Index < CountOfRequests && CountOfSubmissions < COMMAND_RING_ENTRY_COUNT)
+        {
+            Request      = &Requests[Index];
+            BufferLength = max(Request->InputBufferLength, Request->OutputBufferLength);
+
+            if (BufferLength > COMMAND_RING_DATA_AREA_SIZE)
+            {
+                //
+                // Too big for the ring
+                //
+                CommandRingSendRequestByIoctl(Request);
+                IsCompleted[Index] = TRUE;
+                Index++;
+                continue;
+            }
+
+            if (BufferLength > COMMAND_RING_DATA_AREA_SIZE - DataOffset)
+            {
+                //
+                // The data area is full, submit the current batch
+                //
+                break;
+            }
+
+            memcpy(&g_CommandRing->Data[DataOffset], Request->Buffer, Request->InputBufferLength);
+
+            Submission = &g_CommandRing->Submissions[g_CommandRing->SubmissionTail & (COMMAND_RING_ENTRY_COUNT - 1)];
+
+            Submission->UserData           = Index;
+            Submission->IoctlCode          = Request->IoctlCode;
+            Submission->BufferOffset       = DataOffset;
+            Submission->InputBufferLength  = Request->InputBufferLength;
+            Submission->OutputBufferLength = Request->OutputBufferLength;
+
+            SubmissionOffsets[Index] = DataOffset;
+
+            //
+            // Keep the buffers aligned
+            //
+            DataOffset += (BufferLength + 0xf) & ~0xf;
+            DataOffset = min(DataOffset, COMMAND_RING_DATA_AREA_SIZE);
+
+            //
+            // Publish the submission after writing it
+            //
+            MemoryBarrier();
+            g_CommandRing->SubmissionTail++;
+
+            CountOfSubmissions++;
+            Index++;
+        }
+
+        //
+        // The buffers of the batch are reused by the next batch, so all
+        // of its submissions should be completed first
+        //
+        while (CountOfCompletions < CountOfSubmissions)
+        {
+            if (!CommandRingProcessSubmissions(Requests, SubmissionOffsets, IsCompleted, &CountOfCompletions))
+            {
+                //
+                // The ring is not usable anymore, drop the pending submissions
+                // and send the rest of the requests by their IOCTLs
+                //
+                g_CommandRing->SubmissionTail = g_CommandRing->SubmissionHead;
+                CommandRingUninitialize();
+
+                for (UINT32 i = BatchStart; i < CountOfRequests; i++)
+                {
+                    if (!IsCompleted[i])
+                    {
+                        CommandRingSendRequestByIoctl(&Requests[i]);
+                        IsCompleted[i] = TRUE;
+                    }
+                }
+
+                Index = CountOfRequests;
+                break;
+            }
+        }
+    }
+
+    for (UINT32 i = 0; i < CountOfRequests; i++)
+    {
+        AllSuccessful &= Requests[i].IsSuccessful;
+    }
+
+    return AllSuccessful;
+}
@@ -64,6 +64,12 @@ RemoteConnectionListen(PCSTR Port)
     //
     g_IsConnectedToHyperDbgLocally = TRUE;
 
+    //
+    // Other clients that connect to the same port receive the output
+    // of the debugger as subscribers
+    //
+    BroadcastStart(g_ServerListenSocket);
+
     while (true)
     {
         //
@@ -106,6 +112,11 @@ RemoteConnectionListen(PCSTR Port)
         RtlZeroMemory(recvbuf, COMMUNICATION_BUFFER_SIZE);
     }
 
+    //
+    // Disconnect the subscribers
+    //
+    BroadcastStop();
+
     //
     // Indicate that debugger is not connected
     //
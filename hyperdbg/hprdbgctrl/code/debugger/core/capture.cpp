@@ -0,0 +1,248 @@
+/**
+ * @file capture.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Decoding the records of capture actions
+ * @details Capture actions send binary records, the records are decoded
+ * here into rows and are either shown or sent to the output sources of
+ * the event (e.g., files)
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> g_EventTraceTagIndex;
+extern BOOLEAN                                          g_EventTraceInitialized;
+extern BOOLEAN                                          g_BreakPrintingOutput;
+
+/**
+ * @brief Names of the registers that can be captured (the index of
+ * each name is the index of the register in the capture record)
+ *
+ */
+static const char * CaptureRegisterNames[DEBUGGER_CAPTURE_COUNT_OF_REGISTERS] = {
+    "rax",
+    "rcx",
+    "rdx",
+    "rbx",
+    "rsp",
+    "rbp",
+    "rsi",
+    "rdi",
+    "r8",
+    "r9",
+    "r10",
+    "r11",
+    "r12",
+    "r13",
+    "r14",
+    "r15",
+    "rip",
+    "rflags",
+};
+
+/**
+ * @brief Convert the name of a register to its index in the capture record
+ *
+ * @param RegisterName
+ * @param Index
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CaptureConvertRegisterNameToIndex(std::string RegisterName, UINT32 * Index)
+{
+    //
+    // Registers can be used with or without '@'
+    //
+    if (RegisterName.rfind('@', 0) == 0)
+    {
+        RegisterName.erase(0, 1);
+    }
+
+    for (UINT32 i = 0; i < DEBUGGER_CAPTURE_COUNT_OF_REGISTERS; i++)
+    {
+        if (!RegisterName.compare(CaptureRegisterNames[i]))
+        {
+            *Index = i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Convert a comma-separated list of registers (or 'all', or 'none')
+ * to the mask of registers in the capture record
+ *
+ * @param RegisterList
+ * @param RegisterMask
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CaptureConvertRegisterListToMask(std::string RegisterList, UINT32 * RegisterMask)
+{
+    UINT32 Index;
+    UINT32 Mask = 0;
+
+    if (!RegisterList.compare("all"))
+    {
+        *RegisterMask = (1 << DEBUGGER_CAPTURE_COUNT_OF_REGISTERS) - 1;
+        return TRUE;
+    }
+
+    if (!RegisterList.compare("none"))
+    {
+        *RegisterMask = 0;
+        return TRUE;
+    }
+
+    for (auto Item : Split(RegisterList, ','))
+    {
+        if (!CaptureConvertRegisterNameToIndex(Item, &Index))
+        {
+            return FALSE;
+        }
+
+        Mask |= 1 << Index;
+    }
+
+    *RegisterMask = Mask;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the details of an event by its tag
+ *
+ * @param Tag
+ *
+ * @return PDEBUGGER_GENERAL_EVENT_DETAIL NULL if not found
+ */
+static PDEBUGGER_GENERAL_EVENT_DETAIL
+CaptureGetEventDetailByTag(UINT64 Tag)
+{
+    if (!g_EventTraceInitialized)
+    {
+        return NULL;
+    }
+
+    auto Item = g_EventTraceTagIndex.find(Tag);
+
+    return Item != g_EventTraceTagIndex.end() ? Item->second : NULL;
+}
+
+/**
+ * @brief Decode a capture record to a row
+ *
+ * @param Record
+ * @param Row
+ *
+ * @return VOID
+ */
+static VOID
+CaptureDecodeRecord(PDEBUGGER_CAPTURE_RECORD Record, std::string & Row)
+{
+    CHAR Temp[64];
+
+    sprintf_s(Temp, sizeof(Temp), "%llx\t%x\t%016llx\t%016llx", Record->Tag, Record->CoreId, Record->Tsc, Record->Context);
+    Row = Temp;
+
+    for (UINT32 i = 0; i < DEBUGGER_CAPTURE_COUNT_OF_REGISTERS; i++)
+    {
+        if (Record->RegisterMask & (1 << i))
+        {
+            sprintf_s(Temp, sizeof(Temp), "\t%s=%016llx", CaptureRegisterNames[i], Record->Registers[i]);
+            Row += Temp;
+        }
+    }
+
+    if (Record->SnippetSize != 0)
+    {
+        sprintf_s(Temp, sizeof(Temp), "\tmem[%016llx]=", Record->SnippetAddress);
+        Row += Temp;
+
+        for (UINT32 i = 0; i < Record->SnippetSize && i < DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE; i++)
+        {
+            sprintf_s(Temp, sizeof(Temp), "%02x", Record->Snippet[i]);
+            Row += Temp;
+        }
+    }
+    else if (Record->SnippetAddress != NULL)
+    {
+        sprintf_s(Temp, sizeof(Temp), "\tmem[%016llx]=??", Record->SnippetAddress);
+        Row += Temp;
+    }
+
+    Row += "\n";
+}
+
+/**
+ * @brief Handle a packet of capture records that is received from
+ * the kernel (or the debuggee)
+ * @details Each record is a row of tab-separated columns (tag, core, tsc,
+ * context, registers and the memory snippet), rows of the events that
+ * have an output source are sent to the output sources, otherwise they
+ * are shown
+ *
+ * @param Packet
+ *
+ * @return VOID
+ */
+VOID
+CaptureHandleRecords(PDEBUGGER_CAPTURE_RECORDS_PACKET Packet)
+{
+    PDEBUGGER_CAPTURE_RECORD       Records = (PDEBUGGER_CAPTURE_RECORD)((CHAR *)Packet + sizeof(DEBUGGER_CAPTURE_RECORDS_PACKET));
+    PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail;
+    std::string                    Row;
+
+    if (g_BreakPrintingOutput)
+    {
+        //
+        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+        // we shouldn't show or save anything in this case
+        //
+        return;
+    }
+
+    if (Packet->CountOfRecords > DEBUGGER_CAPTURE_MAXIMUM_RECORDS_IN_PACKET)
+    {
+        ShowMessages("err, invalid packet of capture records\n");
+        return;
+    }
+
+    if (Packet->CountOfDroppedRecords != 0)
+    {
+        ShowMessages("warning, %llx capture record(s) of core %x are dropped as the "
+                     "messages are not received fast enough\n",
+                     Packet->CountOfDroppedRecords,
+                     Packet->CoreId);
+    }
+
+    for (UINT32 i = 0; i < Packet->CountOfRecords; i++)
+    {
+        CaptureDecodeRecord(&Records[i], Row);
+
+        EventDetail = CaptureGetEventDetailByTag(Records[i].Tag);
+
+        if (EventDetail != NULL && EventDetail->HasCustomOutput)
+        {
+            if (!ForwardingPerformEventForwarding(EventDetail, (CHAR *)Row.c_str(), (UINT32)Row.size()))
+            {
+                ShowMessages("err, there was an error transferring the "
+                             "message to the remote sources\n");
+            }
+        }
+        else
+        {
+            ShowMessages("%s", Row.c_str());
+        }
+    }
+}
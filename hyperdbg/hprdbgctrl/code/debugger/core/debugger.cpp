@@ -14,18 +14,19 @@
 //
 // Global Variables
 //
-extern UINT64                   g_EventTag;
-extern LIST_ENTRY               g_EventTrace;
-extern BOOLEAN                  g_EventTraceInitialized;
-extern BOOLEAN                  g_BreakPrintingOutput;
-extern BOOLEAN                  g_AutoUnpause;
-extern BOOLEAN                  g_OutputSourcesInitialized;
-extern LIST_ENTRY               g_OutputSources;
-extern BOOLEAN                  g_IsConnectedToRemoteDebuggee;
-extern BOOLEAN                  g_IsConnectedToRemoteDebugger;
-extern BOOLEAN                  g_IsSerialConnectedToRemoteDebuggee;
-extern BOOLEAN                  g_IsSerialConnectedToRemoteDebugger;
-extern ACTIVE_DEBUGGING_PROCESS g_ActiveProcessDebuggingState;
+extern UINT64                                           g_EventTag;
+extern LIST_ENTRY                                       g_EventTrace;
+extern BOOLEAN                                          g_EventTraceInitialized;
+extern std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> g_EventTraceTagIndex;
+extern BOOLEAN                                          g_BreakPrintingOutput;
+extern BOOLEAN                                          g_AutoUnpause;
+extern BOOLEAN                                          g_OutputSourcesInitialized;
+extern LIST_ENTRY                                       g_OutputSources;
+extern BOOLEAN                                          g_IsConnectedToRemoteDebuggee;
+extern BOOLEAN                                          g_IsConnectedToRemoteDebugger;
+extern BOOLEAN                                          g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN                                          g_IsSerialConnectedToRemoteDebugger;
+extern ACTIVE_DEBUGGING_PROCESS                         g_ActiveProcessDebuggingState;
 
 /**
  * @brief shows the error message
@@ -359,6 +360,36 @@ ShowErrorMessage(UINT32 Error)
                      Error);
         break;
 
+    case DEBUGGER_ERROR_BULK_MODIFY_EVENTS_INVALID_TAGS:
+        ShowMessages("err, the tags of the request are not sorted or are duplicated (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_CAPTURE_CONFIGURATION:
+        ShowMessages("err, the configuration of the capture is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_INVALID_HALT_PREFETCH_PROFILE:
+        ShowMessages("err, the profile of halt prefetching is invalid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID:
+        ShowMessages("err, the command ring is not registered or is not valid (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED:
+        ShowMessages("err, the request is not supported by the command ring (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_KERNEL_SELF_CHECK_FAILED:
+        ShowMessages("err, at least one of the self-checks of the kernel failed (%x)\n",
+                     Error);
+        break;
+
     default:
         ShowMessages("err, error not found (%x)\n",
                      Error);
@@ -519,32 +550,20 @@ IsConnectedToAnyInstanceOfDebuggerOrDebuggee()
 BOOLEAN
 IsTagExist(UINT64 Tag)
 {
-    PLIST_ENTRY                    TempList      = 0;
-    PDEBUGGER_GENERAL_EVENT_DETAIL CommandDetail = {0};
-
     if (!g_EventTraceInitialized)
     {
         return FALSE;
     }
 
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Blink)
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
     {
-        TempList = TempList->Blink;
-
-        CommandDetail = CONTAINING_RECORD(TempList, DEBUGGER_GENERAL_EVENT_DETAIL, CommandsEventList);
-
-        if (CommandDetail->Tag == Tag ||
-            Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
-        {
-            return TRUE;
-        }
+        return !g_EventTraceTagIndex.empty();
     }
 
     //
-    // Not found
+    // Search the tag index instead of the list of events
     //
-    return FALSE;
+    return g_EventTraceTagIndex.find(Tag) != g_EventTraceTagIndex.end();
 }
 
 /**
@@ -2001,6 +2020,11 @@ RegisterActionToEvent(PDEBUGGER_GENERAL_EVENT_DETAIL Event,
     //
     InsertHeadList(&g_EventTrace, &(Event->CommandsEventList));
 
+    //
+    // Also index the event by its tag
+    //
+    g_EventTraceTagIndex[Event->Tag] = Event;
+
     return TRUE;
 }
 
@@ -2115,6 +2139,13 @@ InterpretGeneralEventAndActionsFields(
     BOOLEAN                        IsNextCommandCoreId             = FALSE;
     BOOLEAN                        IsNextCommandBufferSize         = FALSE;
     BOOLEAN                        IsNextCommandImmediateMessaging = FALSE;
+    BOOLEAN                        IsNextCommandSamplingRate       = FALSE;
+    BOOLEAN                        IsNextCommandRateLimit          = FALSE;
+    BOOLEAN                        IsNextCommandHitLimit           = FALSE;
+    BOOLEAN                        IsNextCommandCaptureRegisters   = FALSE;
+    BOOLEAN                        IsNextCommandSnippetRegister    = FALSE;
+    BOOLEAN                        IsNextCommandSnippetSize        = FALSE;
+    BOOLEAN                        HasCapture                      = FALSE;
     BOOLEAN                        ImmediateMessagePassing         = UseImmediateMessagingByDefaultOnEvents;
     UINT32                         CoreId;
     UINT32                         ProcessId;
@@ -2127,6 +2158,8 @@ InterpretGeneralEventAndActionsFields(
     int                            NewIndexToRemove = 0;
     int                            Index            = 0;
 
+    DEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION CaptureConfiguration = {0};
+
     //
     // Create a command string to show in the history
     //
@@ -2744,6 +2777,125 @@ InterpretGeneralEventAndActionsFields(
             continue;
         }
 
+        if (IsNextCommandSamplingRate)
+        {
+            if (!ConvertStringToUInt32(Section, &TempEvent->SamplingRate))
+            {
+                ShowMessages("err, sampling rate is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandSamplingRate = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (IsNextCommandRateLimit)
+        {
+            if (!ConvertStringToUInt32(Section, &TempEvent->RateLimit))
+            {
+                ShowMessages("err, rate limit is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandRateLimit = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (IsNextCommandHitLimit)
+        {
+            if (!ConvertStringToUInt64(Section, &TempEvent->HitLimit))
+            {
+                ShowMessages("err, hit limit is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandHitLimit = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (IsNextCommandCaptureRegisters)
+        {
+            if (!CaptureConvertRegisterListToMask(Section, &CaptureConfiguration.RegisterMask))
+            {
+                ShowMessages("err, capture registers are invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandCaptureRegisters = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (IsNextCommandSnippetRegister)
+        {
+            if (!CaptureConvertRegisterNameToIndex(Section, &CaptureConfiguration.SnippetRegister) ||
+                CaptureConfiguration.SnippetRegister > DEBUGGER_CAPTURE_REGISTER_RIP)
+            {
+                ShowMessages("err, snippet register is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandSnippetRegister = FALSE;
+            IsNextCommandSnippetSize     = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (IsNextCommandSnippetSize)
+        {
+            if (!ConvertStringToUInt32(Section, &CaptureConfiguration.SnippetSize) ||
+                CaptureConfiguration.SnippetSize == 0 ||
+                CaptureConfiguration.SnippetSize > DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE)
+            {
+                ShowMessages("err, snippet size is invalid (maximum size is 0x%x)\n",
+                             DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE);
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandSnippetSize = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
         if (IsNextCommandCoreId)
         {
             if (!ConvertStringToUInt32(Section, &CoreId))
@@ -2818,6 +2970,68 @@ InterpretGeneralEventAndActionsFields(
 
             continue;
         }
+
+        if (!Section.compare("sample"))
+        {
+            IsNextCommandSamplingRate = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (!Section.compare("rate"))
+        {
+            IsNextCommandRateLimit = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (!Section.compare("hits"))
+        {
+            IsNextCommandHitLimit = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (!Section.compare("capture"))
+        {
+            IsNextCommandCaptureRegisters = TRUE;
+            HasCapture                    = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
+        if (!Section.compare("snippet"))
+        {
+            IsNextCommandSnippetRegister = TRUE;
+            HasCapture                   = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
     }
 
     //
@@ -2847,10 +3061,77 @@ InterpretGeneralEventAndActionsFields(
         goto ReturnWithError;
     }
 
+    if (IsNextCommandSamplingRate)
+    {
+        ShowMessages("err, please specify a value for 'sample'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    if (IsNextCommandRateLimit)
+    {
+        ShowMessages("err, please specify a value for 'rate'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    if (IsNextCommandHitLimit)
+    {
+        ShowMessages("err, please specify a value for 'hits'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    if (IsNextCommandCaptureRegisters)
+    {
+        ShowMessages("err, please specify a value for 'capture'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    if (IsNextCommandSnippetRegister || IsNextCommandSnippetSize)
+    {
+        ShowMessages("err, please specify a register and a size for 'snippet'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    //
+    // Capture actions save a binary record instead of breaking to the
+    // debugger, so if there is no script or custom code, the action that
+    // is created for breaking is used for capturing
+    //
+    if (HasCapture)
+    {
+        if (TempActionBreak == NULL)
+        {
+            LengthOfBreakActionBuffer = sizeof(DEBUGGER_GENERAL_ACTION);
+
+            TempActionBreak = (PDEBUGGER_GENERAL_ACTION)malloc(LengthOfBreakActionBuffer);
+
+            RtlZeroMemory(TempActionBreak, LengthOfBreakActionBuffer);
+
+            TempActionBreak->EventTag = TempEvent->Tag;
+
+            //
+            // Increase the count of actions
+            //
+            TempEvent->CountOfActions = TempEvent->CountOfActions + 1;
+        }
+
+        TempActionBreak->ActionType           = RUN_CAPTURE;
+        TempActionBreak->CaptureConfiguration = CaptureConfiguration;
+    }
+
     //
     // It's not possible to break to debugger in vmi-mode
     //
-    if (!g_IsSerialConnectedToRemoteDebuggee && TempActionBreak != NULL)
+    if (!g_IsSerialConnectedToRemoteDebuggee && TempActionBreak != NULL && TempActionBreak->ActionType == BREAK_TO_DEBUGGER)
     {
         ShowMessages(
             "err, it's not possible to break to the debugger in VMI Mode. "
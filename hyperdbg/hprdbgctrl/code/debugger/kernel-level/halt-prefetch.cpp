@@ -0,0 +1,308 @@
+/**
+ * @file halt-prefetch.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The state that is prefetched on halts
+ * @details When halt prefetching is enabled, the debuggee sends the
+ * registers, the top of the stack and the code from RIP along with the
+ * pausing packet, the state is kept here to serve 'r', 'd*' and 'u'
+ * commands without another round trip until the debuggee continues or
+ * a command changes its state
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN                          g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN                          g_IsHaltPrefetchedStateValid;
+extern BYTE                             g_HaltPrefetchedState[];
+extern std::map<std::string, REGS_ENUM> RegistersMap;
+
+/**
+ * @brief Save the state that is received along with the pausing packet
+ *
+ * @param PrefetchedState
+ * @param Length Length of the state (including the stack and the code bytes)
+ *
+ * @return VOID
+ */
+VOID
+HaltPrefetchSaveState(PDEBUGGEE_KD_HALT_PREFETCHED_STATE PrefetchedState, UINT32 Length)
+{
+    g_IsHaltPrefetchedStateValid = FALSE;
+
+    //
+    // Check whether the packet contains the stack and the code bytes
+    //
+    if (Length < sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) ||
+        PrefetchedState->StackSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE ||
+        PrefetchedState->CodeSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE ||
+        Length < sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) + PrefetchedState->StackSize + PrefetchedState->CodeSize)
+    {
+        return;
+    }
+
+    memcpy(g_HaltPrefetchedState,
+           PrefetchedState,
+           sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) + PrefetchedState->StackSize + PrefetchedState->CodeSize);
+
+    g_IsHaltPrefetchedStateValid = TRUE;
+}
+
+/**
+ * @brief Invalidate the prefetched state
+ *
+ * @return VOID
+ */
+VOID
+HaltPrefetchInvalidate()
+{
+    g_IsHaltPrefetchedStateValid = FALSE;
+}
+
+/**
+ * @brief Invalidate the prefetched state if the action that is sent to
+ * the debuggee might change the state of the debuggee
+ *
+ * @param RequestedAction
+ *
+ * @return VOID
+ */
+VOID
+HaltPrefetchInvalidateForAction(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction)
+{
+    switch (RequestedAction)
+    {
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_REGISTERS:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_MEMORY:
+    case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_CALLSTACK:
+
+        //
+        // These actions only read the state
+        //
+        break;
+
+    default:
+
+        HaltPrefetchInvalidate();
+        break;
+    }
+}
+
+/**
+ * @brief Get the value of a register from the prefetched state
+ * @details Only the full-size registers are prefetched
+ *
+ * @param RegisterId
+ * @param Value
+ *
+ * @return BOOLEAN shows whether the register is available or not
+ */
+BOOLEAN
+HaltPrefetchGetRegisterValue(REGS_ENUM RegisterId, UINT64 * Value)
+{
+    PDEBUGGEE_KD_HALT_PREFETCHED_STATE State = (PDEBUGGEE_KD_HALT_PREFETCHED_STATE)g_HaltPrefetchedState;
+
+    if (!g_IsSerialConnectedToRemoteDebuggee || !g_IsHaltPrefetchedStateValid)
+    {
+        return FALSE;
+    }
+
+    switch (RegisterId)
+    {
+    case REGISTER_RAX:
+        *Value = State->Regs.rax;
+        break;
+    case REGISTER_RCX:
+        *Value = State->Regs.rcx;
+        break;
+    case REGISTER_RDX:
+        *Value = State->Regs.rdx;
+        break;
+    case REGISTER_RBX:
+        *Value = State->Regs.rbx;
+        break;
+    case REGISTER_RSP:
+        *Value = State->Regs.rsp;
+        break;
+    case REGISTER_RBP:
+        *Value = State->Regs.rbp;
+        break;
+    case REGISTER_RSI:
+        *Value = State->Regs.rsi;
+        break;
+    case REGISTER_RDI:
+        *Value = State->Regs.rdi;
+        break;
+    case REGISTER_R8:
+        *Value = State->Regs.r8;
+        break;
+    case REGISTER_R9:
+        *Value = State->Regs.r9;
+        break;
+    case REGISTER_R10:
+        *Value = State->Regs.r10;
+        break;
+    case REGISTER_R11:
+        *Value = State->Regs.r11;
+        break;
+    case REGISTER_R12:
+        *Value = State->Regs.r12;
+        break;
+    case REGISTER_R13:
+        *Value = State->Regs.r13;
+        break;
+    case REGISTER_R14:
+        *Value = State->Regs.r14;
+        break;
+    case REGISTER_R15:
+        *Value = State->Regs.r15;
+        break;
+    case REGISTER_DS:
+        *Value = State->ExtraRegs.DS;
+        break;
+    case REGISTER_ES:
+        *Value = State->ExtraRegs.ES;
+        break;
+    case REGISTER_FS:
+        *Value = State->ExtraRegs.FS;
+        break;
+    case REGISTER_GS:
+        *Value = State->ExtraRegs.GS;
+        break;
+    case REGISTER_CS:
+        *Value = State->ExtraRegs.CS;
+        break;
+    case REGISTER_SS:
+        *Value = State->ExtraRegs.SS;
+        break;
+    case REGISTER_RFLAGS:
+        *Value = State->ExtraRegs.RFLAGS;
+        break;
+    case REGISTER_RIP:
+        *Value = State->ExtraRegs.RIP;
+        break;
+    case REGISTER_CR0:
+        *Value = State->Cr0;
+        break;
+    case REGISTER_CR2:
+        *Value = State->Cr2;
+        break;
+    case REGISTER_CR3:
+        *Value = State->Cr3;
+        break;
+    case REGISTER_CR4:
+        *Value = State->Cr4;
+        break;
+    default:
+
+        //
+        // The register is not prefetched
+        //
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the value of a register from the prefetched state by its name
+ * @details Registers can be used with or without '@'
+ *
+ * @param RegisterName
+ * @param Value
+ *
+ * @return BOOLEAN shows whether the register is available or not
+ */
+BOOLEAN
+HaltPrefetchGetRegisterValueByName(std::string RegisterName, UINT64 * Value)
+{
+    if (!g_IsSerialConnectedToRemoteDebuggee || !g_IsHaltPrefetchedStateValid)
+    {
+        return FALSE;
+    }
+
+    if (RegisterName.rfind('@', 0) == 0)
+    {
+        RegisterName.erase(0, 1);
+    }
+
+    if (RegistersMap.find(RegisterName) == RegistersMap.end())
+    {
+        return FALSE;
+    }
+
+    return HaltPrefetchGetRegisterValue(RegistersMap[RegisterName], Value);
+}
+
+/**
+ * @brief Show all the registers from the prefetched state
+ *
+ * @return BOOLEAN shows whether the registers are available or not
+ */
+BOOLEAN
+HaltPrefetchShowAllRegisters()
+{
+    PDEBUGGEE_KD_HALT_PREFETCHED_STATE State = (PDEBUGGEE_KD_HALT_PREFETCHED_STATE)g_HaltPrefetchedState;
+
+    if (!g_IsSerialConnectedToRemoteDebuggee || !g_IsHaltPrefetchedStateValid)
+    {
+        return FALSE;
+    }
+
+    ShowAllRegistersFromState(&State->Regs, &State->ExtraRegs);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the memory of the debuggee from the prefetched state
+ * @details The memory is only served if the whole range is in the
+ * prefetched stack or the prefetched code
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return BOOLEAN shows whether the memory is available or not
+ */
+BOOLEAN
+HaltPrefetchReadMemory(UINT64 Address, BYTE * Buffer, UINT32 Size)
+{
+    PDEBUGGEE_KD_HALT_PREFETCHED_STATE State           = (PDEBUGGEE_KD_HALT_PREFETCHED_STATE)g_HaltPrefetchedState;
+    BYTE *                             PrefetchedBytes = g_HaltPrefetchedState + sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE);
+
+    if (!g_IsSerialConnectedToRemoteDebuggee || !g_IsHaltPrefetchedStateValid || Size == 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // Check the stack
+    //
+    if (Address >= State->StackAddress &&
+        Address - State->StackAddress < State->StackSize &&
+        Size <= State->StackSize - (Address - State->StackAddress))
+    {
+        memcpy(Buffer, PrefetchedBytes + (Address - State->StackAddress), Size);
+        return TRUE;
+    }
+
+    //
+    // Check the code (it's after the stack bytes)
+    //
+    if (Address >= State->CodeAddress &&
+        Address - State->CodeAddress < State->CodeSize &&
+        Size <= State->CodeSize - (Address - State->CodeAddress))
+    {
+        memcpy(Buffer, PrefetchedBytes + State->StackSize + (Address - State->CodeAddress), Size);
+        return TRUE;
+    }
+
+    return FALSE;
+}
@@ -296,6 +296,35 @@ KdSendFlushPacketToDebuggee()
     return TRUE;
 }
 
+/**
+ * @brief Send the profile of halt prefetching to the debuggee
+ * @param Profile
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendHaltPrefetchProfilePacketToDebuggee(PDEBUGGEE_KD_HALT_PREFETCH_PROFILE Profile)
+{
+    //
+    // Send the profile of halt prefetching
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SET_HALT_PREFETCH_PROFILE,
+            (CHAR *)Profile,
+            sizeof(DEBUGGEE_KD_HALT_PREFETCH_PROFILE)))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the result of setting the profile received
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_HALT_PREFETCH_PROFILE_RESULT);
+
+    return Profile->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
 /**
  * @brief Send a callstack request to the debuggee
  * @param BaseAddress
@@ -1451,6 +1480,11 @@ KdCommandPacketToDebuggee(
     // sizeof(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION) + sizeof(DEBUGGER_REMOTE_PACKET)
     //
 
+    //
+    // The prefetched state is not valid if the action changes the state
+    //
+    HaltPrefetchInvalidateForAction(RequestedAction);
+
     //
     // Make the packet's structure
     //
@@ -1508,6 +1542,11 @@ KdCommandPacketAndBufferToDebuggee(
         return FALSE;
     }
 
+    //
+    // The prefetched state is not valid if the action changes the state
+    //
+    HaltPrefetchInvalidateForAction(RequestedAction);
+
     //
     // Make the packet's structure
     //
@@ -67,6 +67,7 @@ ListeningSerialPortInDebugger()
     PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS   PtePacket;
     PDEBUGGER_VA2PA_AND_PA2VA_COMMANDS          Va2paPa2vaPacket;
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET          ListOrModifyBreakpointPacket;
+    PDEBUGGEE_KD_HALT_PREFETCH_PROFILE          HaltPrefetchProfilePacket;
     PGUEST_REGS                                 Regs;
     PGUEST_EXTRA_REGISTERS                      ExtraRegs;
     unsigned char *                             MemoryBuffer;
@@ -188,7 +189,14 @@ StartAgain:
             //
             if (!g_IgnoreNewLoggingMessages)
             {
-                ShowMessages("%s", MessagePacket->Message);
+                if (MessagePacket->OperationCode == OPERATION_LOG_CAPTURE_RECORDS)
+                {
+                    CaptureHandleRecords((PDEBUGGER_CAPTURE_RECORDS_PACKET)MessagePacket->Message);
+                }
+                else
+                {
+                    ShowMessages("%s", MessagePacket->Message);
+                }
             }
 
             break;
@@ -221,6 +229,20 @@ StartAgain:
 
             g_IsRunningInstruction32Bit = PausePacket->Is32BitAddress;
 
+            //
+            // Save the state that is prefetched on the halt (if any)
+            //
+            if (PausePacket->HasPrefetchedState)
+            {
+                HaltPrefetchSaveState((PDEBUGGEE_KD_HALT_PREFETCHED_STATE)(((CHAR *)PausePacket) +
+                                                                           sizeof(DEBUGGEE_KD_PAUSED_PACKET)),
+                                      LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+            }
+            else
+            {
+                HaltPrefetchInvalidate();
+            }
+
             //
             // Show additional messages before showing assembly and pausing
             //
@@ -773,52 +795,7 @@ StartAgain:
                                                           sizeof(DEBUGGEE_REGISTER_READ_DESCRIPTION) +
                                                           sizeof(GUEST_REGS));
 
-                    RFLAGS Rflags = {0};
-                    Rflags.AsUInt = ExtraRegs->RFLAGS;
-
-                    ShowMessages(
-                        "RAX=%016llx RBX=%016llx RCX=%016llx\n"
-                        "RDX=%016llx RSI=% 016llx RDI=%016llx\n"
-                        "RIP=%016llx RSP=%016llx RBP=%016llx\n"
-                        "R8=%016llx  R9=%016llx  R10=%016llx\n"
-                        "R11=%016llx R12=%016llx R13=%016llx\n"
-                        "R14=%016llx R15=%016llx IOPL=%02x\n"
-                        "%s  %s  %s  %s\n%s  %s  %s  %s  \n"
-                        "CS %04x SS %04x DS %04x ES %04x FS %04x GS %04x\n"
-                        "RFLAGS=%016llx\n",
-                        Regs->rax,
-                        Regs->rbx,
-                        Regs->rcx,
-                        Regs->rdx,
-                        Regs->rsi,
-                        Regs->rdi,
-                        ExtraRegs->RIP,
-                        Regs->rsp,
-                        Regs->rbp,
-                        Regs->r8,
-                        Regs->r9,
-                        Regs->r10,
-                        Regs->r11,
-                        Regs->r12,
-                        Regs->r13,
-                        Regs->r14,
-                        Regs->r15,
-                        Rflags.IoPrivilegeLevel,
-                        Rflags.OverflowFlag ? "OF 1" : "OF 0",
-                        Rflags.DirectionFlag ? "DF 1" : "DF 0",
-                        Rflags.InterruptEnableFlag ? "IF 1" : "IF 0",
-                        Rflags.SignFlag ? "SF  1" : "SF  0",
-                        Rflags.ZeroFlag ? "ZF 1" : "ZF 0",
-                        Rflags.ParityFlag ? "PF 1" : "PF 0",
-                        Rflags.CarryFlag ? "CF 1" : "CF 0",
-                        Rflags.AuxiliaryCarryFlag ? "AXF 1" : "AXF 0",
-                        ExtraRegs->CS,
-                        ExtraRegs->SS,
-                        ExtraRegs->DS,
-                        ExtraRegs->ES,
-                        ExtraRegs->FS,
-                        ExtraRegs->GS,
-                        ExtraRegs->RFLAGS);
+                    ShowAllRegistersFromState(Regs, ExtraRegs);
                 }
                 else
                 {
@@ -923,11 +900,23 @@ StartAgain:
                     //
                     // Show the 'dt' command view
                     //
-                    ScriptEngineShowDataBasedOnSymbolTypesWrapper(ReadMemoryPacket->DtDetails->TypeName,
-                                                                  ReadMemoryPacket->Address,
-                                                                  FALSE,
-                                                                  MemoryBuffer,
-                                                                  ReadMemoryPacket->DtDetails->AdditionalParameters);
+                    if (ReadMemoryPacket->DtDetails->UseTypeLayout)
+                    {
+                        ScriptEngineShowDataBasedOnTypeLayoutWrapper(ReadMemoryPacket->DtDetails->TypeName,
+                                                                     ReadMemoryPacket->Address,
+                                                                     MemoryBuffer,
+                                                                     ReadMemoryPacket->ReturnLength,
+                                                                     ReadMemoryPacket->DtDetails->NextFieldName,
+                                                                     &ReadMemoryPacket->DtDetails->NextAddress);
+                    }
+                    else
+                    {
+                        ScriptEngineShowDataBasedOnSymbolTypesWrapper(ReadMemoryPacket->DtDetails->TypeName,
+                                                                      ReadMemoryPacket->Address,
+                                                                      FALSE,
+                                                                      MemoryBuffer,
+                                                                      ReadMemoryPacket->DtDetails->AdditionalParameters);
+                    }
 
                     break;
                 }
@@ -1044,6 +1033,23 @@ StartAgain:
 
             break;
 
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SETTING_HALT_PREFETCH_PROFILE:
+
+            HaltPrefetchProfilePacket = (DEBUGGEE_KD_HALT_PREFETCH_PROFILE *)(((CHAR *)TheActualPacket) +
+                                                                              sizeof(DEBUGGER_REMOTE_PACKET));
+
+            if (HaltPrefetchProfilePacket->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+            {
+                ShowErrorMessage(HaltPrefetchProfilePacket->KernelStatus);
+            }
+
+            //
+            // Signal the event relating to receiving result of setting the profile
+            //
+            DbgReceivedKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_HALT_PREFETCH_PROFILE_RESULT);
+
+            break;
+
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_LIST_OR_MODIFY_BREAKPOINTS:
 
             ListOrModifyBreakpointPacket =
@@ -58,7 +58,25 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
     //
     if (g_IsSerialConnectedToRemoteDebuggee)
     {
-        KdSendReadMemoryPacketToDebuggee(&ReadMem);
+        unsigned char * OutputBuffer = (unsigned char *)malloc(Size * sizeof(unsigned char));
+
+        //
+        // The memory might be prefetched on the halt (the stack or the
+        // code from RIP), otherwise it's requested from the debuggee
+        //
+        if (OutputBuffer == NULL ||
+            Style == DEBUGGER_SHOW_COMMAND_DT ||
+            MemoryType != DEBUGGER_READ_VIRTUAL_ADDRESS ||
+            !HaltPrefetchReadMemory(Address, OutputBuffer, Size))
+        {
+            free(OutputBuffer);
+            KdSendReadMemoryPacketToDebuggee(&ReadMem);
+            return;
+        }
+
+        HyperDbgShowMemoryAndDisassemble(Style, Address, MemoryType, Size, DtDetails, OutputBuffer, Size);
+
+        free(OutputBuffer);
         return;
     }
 
@@ -91,6 +109,37 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
         return;
     }
 
+    HyperDbgShowMemoryAndDisassemble(Style, Address, MemoryType, Size, DtDetails, OutputBuffer, ReturnedLength);
+
+    //
+    // free the buffer
+    //
+    free(OutputBuffer);
+}
+
+/**
+ * @brief Show the memory that is read or disassemble it
+ *
+ * @param Style style of show memory (as byte, dwrod, qword)
+ * @param Address location of where the memory is read
+ * @param MemoryType type of memory (phyical or virtual)
+ * @param Size size of memory that is requested
+ * @param DtDetails Options for dt structure show details
+ * @param OutputBuffer the memory that is read
+ * @param ReturnedLength length of the memory that is read
+ *
+ * @return VOID
+ */
+VOID
+HyperDbgShowMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
+                                 UINT64                       Address,
+                                 DEBUGGER_READ_MEMORY_TYPE    MemoryType,
+                                 UINT32                       Size,
+                                 PDEBUGGER_DT_COMMAND_OPTIONS DtDetails,
+                                 unsigned char *              OutputBuffer,
+                                 ULONG                        ReturnedLength)
+{
+
     switch (Style)
     {
     case DEBUGGER_SHOW_COMMAND_DT:
@@ -98,7 +147,16 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
         //
         // Show the 'dt' command view
         //
-        if (Size == ReturnedLength)
+        if (Size == ReturnedLength && DtDetails->UseTypeLayout)
+        {
+            ScriptEngineShowDataBasedOnTypeLayoutWrapper(DtDetails->TypeName,
+                                                         Address,
+                                                         OutputBuffer,
+                                                         Size,
+                                                         DtDetails->NextFieldName,
+                                                         &DtDetails->NextAddress);
+        }
+        else if (Size == ReturnedLength)
         {
             ScriptEngineShowDataBasedOnSymbolTypesWrapper(DtDetails->TypeName,
                                                           Address,
@@ -160,11 +218,6 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
         break;
     }
 
-    //
-    // free the buffer
-    //
-    free(OutputBuffer);
-
     ShowMessages("\n");
 }
 
@@ -15,11 +15,12 @@
 //
 // Global Variables
 //
-extern UINT64 * g_ScriptGlobalVariables;
-extern UINT64 * g_ScriptLocalVariables;
-extern UINT64 * g_ScriptTempVariables;
-extern UINT64   g_CurrentExprEvalResult;
-extern BOOLEAN  g_CurrentExprEvalResultHasError;
+extern UINT64 *                             g_ScriptGlobalVariables;
+extern UINT64 *                             g_ScriptLocalVariables;
+extern UINT64 *                             g_ScriptTempVariables;
+extern SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE g_ScriptPseudoRegistersCache;
+extern UINT64                               g_CurrentExprEvalResult;
+extern BOOLEAN                              g_CurrentExprEvalResultHasError;
 
 //
 // Temporary structures used only for testing
@@ -218,6 +219,30 @@ ScriptEngineShowDataBasedOnSymbolTypesWrapper(
     return ScriptEngineShowDataBasedOnSymbolTypes(TypeName, Address, IsStruct, BufferAddress, AdditionalParameters);
 }
 
+/**
+ * @brief ScriptEngineShowDataBasedOnTypeLayout wrapper
+ *
+ * @param TypeName
+ * @param Address
+ * @param BufferAddress
+ * @param BufferSize
+ * @param NextFieldName
+ * @param NextAddress
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineShowDataBasedOnTypeLayoutWrapper(
+    const char * TypeName,
+    UINT64       Address,
+    PVOID        BufferAddress,
+    UINT32       BufferSize,
+    const char * NextFieldName,
+    UINT64 *     NextAddress)
+{
+    return ScriptEngineShowDataBasedOnTypeLayout(TypeName, Address, BufferAddress, BufferSize, NextFieldName, NextAddress);
+}
+
 /**
  * @brief SymbolAbortLoading wrapper
  *
@@ -377,6 +402,12 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
             VariablesList.GlobalVariablesList = g_ScriptGlobalVariables;
             VariablesList.LocalVariablesList  = g_ScriptLocalVariables;
 
+            //
+            // Only the pseudo-registers of the process are cached in user-mode
+            // and they don't change, so the cache is never cleared
+            //
+            VariablesList.PseudoRegistersCache = &g_ScriptPseudoRegistersCache;
+
             //
             // If has error, show error message and abort
             //
@@ -368,6 +368,15 @@ SymbolConvertNameOrExprToAddress(const string & TextToConvert, PUINT64 Result)
         string ConstTextToConvert = TextToConvert;
         Address                   = ScriptEngineConvertNameToAddressWrapper(ConstTextToConvert.c_str(), &IsFound);
 
+        if (!IsFound)
+        {
+            //
+            // Registers (e.g., @rsp) might be prefetched on the halt, so
+            // there is no need to evaluate them in the debuggee
+            //
+            IsFound = HaltPrefetchGetRegisterValueByName(TextToConvert, &Address);
+        }
+
         if (!IsFound)
         {
             //
@@ -621,9 +630,11 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
 
             //
             // Set the module details to get the modules (not count)
+            // (the generation of the count is sent, so the counted modules are returned)
             //
             ModuleDetailsRequest->ProcessId        = UserProcessId;
             ModuleDetailsRequest->OnlyCountModules = FALSE;
+            ModuleDetailsRequest->Generation       = ModuleCountRequest.Generation;
 
             //
             // Send the request to the kernel
@@ -214,6 +214,326 @@ GuassianGenerateRandom(vector<double> Data, UINT64 * AverageOfData, UINT64 * Sta
     //
 }
 
+/**
+ * @brief initialize a P-square quantile estimator
+ *
+ * @param Estimator the estimator
+ * @param Quantile the target quantile (0.5 for median)
+ * @return VOID
+ */
+VOID
+P2QuantileInitialize(PP2_QUANTILE_ESTIMATOR Estimator, double Quantile)
+{
+    RtlZeroMemory(Estimator, sizeof(P2_QUANTILE_ESTIMATOR));
+
+    Estimator->Quantile = Quantile;
+
+    for (int i = 0; i < 5; i++)
+    {
+        Estimator->Positions[i] = i;
+    }
+
+    Estimator->DesiredPositions[0] = 0;
+    Estimator->DesiredPositions[1] = 2 * Quantile;
+    Estimator->DesiredPositions[2] = 4 * Quantile;
+    Estimator->DesiredPositions[3] = 2 + 2 * Quantile;
+    Estimator->DesiredPositions[4] = 4;
+
+    Estimator->Increments[0] = 0;
+    Estimator->Increments[1] = Quantile / 2;
+    Estimator->Increments[2] = Quantile;
+    Estimator->Increments[3] = (1 + Quantile) / 2;
+    Estimator->Increments[4] = 1;
+}
+
+/**
+ * @brief add a sample to the P-square quantile estimator
+ *
+ * @param Estimator the estimator
+ * @param Sample the sample
+ * @return VOID
+ */
+VOID
+P2QuantileAdd(PP2_QUANTILE_ESTIMATOR Estimator, double Sample)
+{
+    int      Cell;
+    double   Distance;
+    double   Parabolic;
+    double * q = Estimator->Heights;
+    double * n = Estimator->Positions;
+
+    //
+    // The first five samples are the initial markers
+    //
+    if (Estimator->Count < 5)
+    {
+        q[Estimator->Count++] = Sample;
+
+        if (Estimator->Count == 5)
+        {
+            sort(q, q + 5);
+        }
+        return;
+    }
+
+    Estimator->Count++;
+
+    //
+    // Find the cell of the sample and adjust the extreme markers
+    //
+    if (Sample < q[0])
+    {
+        q[0] = Sample;
+        Cell = 0;
+    }
+    else if (Sample >= q[4])
+    {
+        q[4] = Sample;
+        Cell = 3;
+    }
+    else
+    {
+        Cell = 0;
+        while (Sample >= q[Cell + 1])
+        {
+            Cell++;
+        }
+    }
+
+    for (int i = Cell + 1; i < 5; i++)
+    {
+        n[i]++;
+    }
+
+    for (int i = 0; i < 5; i++)
+    {
+        Estimator->DesiredPositions[i] += Estimator->Increments[i];
+    }
+
+    //
+    // Adjust the heights of the middle markers if necessary
+    //
+    for (int i = 1; i < 4; i++)
+    {
+        Distance = Estimator->DesiredPositions[i] - n[i];
+
+        if ((Distance >= 1 && n[i + 1] - n[i] > 1) || (Distance <= -1 && n[i - 1] - n[i] < -1))
+        {
+            Distance = Distance >= 0 ? 1 : -1;
+
+            Parabolic = q[i] + Distance / (n[i + 1] - n[i - 1]) *
+                                   ((n[i] - n[i - 1] + Distance) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                                    (n[i + 1] - n[i] - Distance) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+
+            if (q[i - 1] < Parabolic && Parabolic < q[i + 1])
+            {
+                q[i] = Parabolic;
+            }
+            else
+            {
+                //
+                // Use linear prediction instead
+                //
+                int j = i + (int)Distance;
+                q[i]  = q[i] + Distance * (q[j] - q[i]) / (n[j] - n[i]);
+            }
+
+            n[i] += Distance;
+        }
+    }
+}
+
+/**
+ * @brief get the estimated quantile
+ *
+ * @param Estimator the estimator
+ * @return double
+ */
+double
+P2QuantileGet(PP2_QUANTILE_ESTIMATOR Estimator)
+{
+    double Sorted[5];
+
+    if (Estimator->Count == 0)
+    {
+        return 0; // Undefined, really
+    }
+
+    if (Estimator->Count >= 5)
+    {
+        return Estimator->Heights[2];
+    }
+
+    //
+    // Not enough samples for the markers, compute it exactly
+    //
+    memcpy(Sorted, Estimator->Heights, sizeof(Sorted));
+    sort(Sorted, Sorted + Estimator->Count);
+
+    return Sorted[(size_t)((Estimator->Count - 1) * Estimator->Quantile)];
+}
+
+/**
+ * @brief initialize the streaming statistics
+ *
+ * @param Statistics the statistics
+ * @return VOID
+ */
+VOID
+GaussianStreamingInitialize(PGAUSSIAN_STREAMING_STATISTICS Statistics)
+{
+    RtlZeroMemory(Statistics, sizeof(GAUSSIAN_STREAMING_STATISTICS));
+
+    P2QuantileInitialize(&Statistics->Median, 0.5);
+    P2QuantileInitialize(&Statistics->AbsoluteDeviation, 0.5);
+    P2QuantileInitialize(&Statistics->AcceptedMedian, 0.5);
+}
+
+/**
+ * @brief check a sample against the MAD test and add it to the
+ * accepted samples if it's not an outlier
+ *
+ * @param Statistics the statistics
+ * @param Sample the sample
+ * @param Median current median of all the samples
+ * @param Mad current median absolute deviation of all the samples
+ * @return VOID
+ */
+VOID
+GaussianStreamingAccept(PGAUSSIAN_STREAMING_STATISTICS Statistics, double Sample, double Median, double Mad)
+{
+    double Delta;
+
+    if (Sample > (3 * Mad) + Median || Sample < -(3 * Mad) + Median)
+    {
+        Statistics->CountOfOutliers++;
+        return;
+    }
+
+    //
+    // Welford's algorithm for the mean and the variance
+    //
+    Statistics->AcceptedCount++;
+
+    Delta = Sample - Statistics->AcceptedMean;
+    Statistics->AcceptedMean += Delta / Statistics->AcceptedCount;
+    Statistics->AcceptedSquaredDistance += Delta * (Sample - Statistics->AcceptedMean);
+
+    P2QuantileAdd(&Statistics->AcceptedMedian, Sample);
+}
+
+/**
+ * @brief compute the exact median and MAD of the warmup samples and
+ * then pass them to the outlier test
+ *
+ * @param Statistics the statistics
+ * @return VOID
+ */
+VOID
+GaussianStreamingFinishWarmup(PGAUSSIAN_STREAMING_STATISTICS Statistics)
+{
+    vector<double> Samples(Statistics->WarmupSamples, Statistics->WarmupSamples + Statistics->WarmupCount);
+    double         WarmupMedian;
+    double         Mad;
+
+    WarmupMedian = Median(Samples);
+    Mad          = MedianAbsoluteDeviationTest(Samples);
+
+    for (UINT32 i = 0; i < Statistics->WarmupCount; i++)
+    {
+        P2QuantileAdd(&Statistics->AbsoluteDeviation, abs(Statistics->WarmupSamples[i] - WarmupMedian));
+        GaussianStreamingAccept(Statistics, Statistics->WarmupSamples[i], WarmupMedian, Mad);
+    }
+}
+
+/**
+ * @brief add a new sample to the streaming statistics
+ * @details the first samples are kept to compute an exact median and MAD,
+ * after that, the median and MAD are estimated in constant memory
+ *
+ * @param Statistics the statistics
+ * @param Sample the sample
+ * @return VOID
+ */
+VOID
+GaussianStreamingAddSample(PGAUSSIAN_STREAMING_STATISTICS Statistics, double Sample)
+{
+    double CurrentMedian;
+
+    Statistics->Count++;
+
+    P2QuantileAdd(&Statistics->Median, Sample);
+
+    if (Statistics->WarmupCount < GAUSSIAN_STREAMING_WARMUP_SAMPLES)
+    {
+        Statistics->WarmupSamples[Statistics->WarmupCount++] = Sample;
+
+        if (Statistics->WarmupCount == GAUSSIAN_STREAMING_WARMUP_SAMPLES)
+        {
+            GaussianStreamingFinishWarmup(Statistics);
+        }
+        return;
+    }
+
+    CurrentMedian = P2QuantileGet(&Statistics->Median);
+
+    P2QuantileAdd(&Statistics->AbsoluteDeviation, abs(Sample - CurrentMedian));
+
+    GaussianStreamingAccept(Statistics,
+                            Sample,
+                            CurrentMedian,
+                            1.4826 * P2QuantileGet(&Statistics->AbsoluteDeviation));
+}
+
+/**
+ * @brief get the average, standard deviation and median of the
+ * samples that are not outliers
+ *
+ * @param Statistics the statistics
+ * @param AverageOfData
+ * @param StandardDeviationOfData
+ * @param MedianOfData
+ * @return VOID
+ */
+VOID
+GaussianStreamingGetResults(PGAUSSIAN_STREAMING_STATISTICS Statistics,
+                            UINT64 *                       AverageOfData,
+                            UINT64 *                       StandardDeviationOfData,
+                            UINT64 *                       MedianOfData)
+{
+    double StandardDeviation = 0;
+
+    //
+    // Check whether the warmup samples are not yet processed
+    //
+    if (Statistics->WarmupCount != 0 && Statistics->WarmupCount < GAUSSIAN_STREAMING_WARMUP_SAMPLES)
+    {
+        GaussianStreamingFinishWarmup(Statistics);
+
+        //
+        // Mark the warmup as finished
+        //
+        Statistics->WarmupCount = GAUSSIAN_STREAMING_WARMUP_SAMPLES;
+    }
+
+    if (Statistics->AcceptedCount != 0)
+    {
+        StandardDeviation = std::sqrt(Statistics->AcceptedSquaredDistance / Statistics->AcceptedCount);
+    }
+
+    //
+    // Set the values to return
+    //
+    *AverageOfData = (UINT64)Statistics->AcceptedMean;
+
+    //
+    // We add 5 to the standard deviation because this value might be
+    // 0 or 1 so we need more variance
+    //
+    *StandardDeviationOfData = (UINT64)StandardDeviation + 5;
+    *MedianOfData            = (UINT64)P2QuantileGet(&Statistics->AcceptedMedian);
+}
+
 /**
  * @brief A simple test for the data based on 
  * pre-defined numbers in a file
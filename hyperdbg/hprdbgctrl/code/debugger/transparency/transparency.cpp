@@ -112,16 +112,18 @@ TransparentModeCpuidTimeStampCounter(UINT64 * Average,
                                      UINT64 * StandardDeviation,
                                      UINT64 * Median)
 {
-    unsigned long long Avg          = 0;
-    unsigned long long MeasuredTime = 0;
-    vector<double>     Results;
+    unsigned long long            Avg          = 0;
+    unsigned long long            MeasuredTime = 0;
+    GAUSSIAN_STREAMING_STATISTICS Statistics;
+
+    GaussianStreamingInitialize(&Statistics);
 
     for (int i = 0; i < TestCount; i++)
     {
         MeasuredTime = TransparentModeRdtscDiffVmexit();
         Avg          = Avg + MeasuredTime;
 
-        Results.push_back(MeasuredTime);
+        GaussianStreamingAddSample(&Statistics, (double)MeasuredTime);
 
         /*
     ShowMessages("(%d) Measured time : %d\n", i, MeasuredTime);
@@ -133,7 +135,7 @@ TransparentModeCpuidTimeStampCounter(UINT64 * Average,
         //
         // Compute the average and variance
         //
-        GuassianGenerateRandom(Results, Average, StandardDeviation, Median);
+        GaussianStreamingGetResults(&Statistics, Average, StandardDeviation, Median);
     }
 
     Avg = Avg / TestCount;
@@ -154,16 +156,18 @@ TransparentModeRdtscEmulationDetection(UINT64 * Average,
                                        UINT64 * StandardDeviation,
                                        UINT64 * Median)
 {
-    unsigned long long Avg          = 0;
-    unsigned long long MeasuredTime = 0;
-    vector<double>     Results;
+    unsigned long long            Avg          = 0;
+    unsigned long long            MeasuredTime = 0;
+    GAUSSIAN_STREAMING_STATISTICS Statistics;
+
+    GaussianStreamingInitialize(&Statistics);
 
     for (int i = 0; i < TestCount; i++)
     {
         MeasuredTime = TransparentModeRdtscVmexitTracing();
         Avg          = Avg + MeasuredTime;
 
-        Results.push_back(MeasuredTime);
+        GaussianStreamingAddSample(&Statistics, (double)MeasuredTime);
 
         /*
     ShowMessages("(%d) Measured time : %d\n", i, MeasuredTime);
@@ -175,7 +179,7 @@ TransparentModeRdtscEmulationDetection(UINT64 * Average,
         //
         // Compute the average and variance
         //
-        GuassianGenerateRandom(Results, Average, StandardDeviation, Median);
+        GaussianStreamingGetResults(&Statistics, Average, StandardDeviation, Median);
     }
 
     Avg = Avg / TestCount;
@@ -0,0 +1,83 @@
+/**
+ * @file broadcast.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of broadcasting the output of the remote server to subscribers
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of subscribers (each subscriber needs a
+ * wait event and the wake up and the accept events are also waited)
+ *
+ */
+#define BROADCAST_MAXIMUM_SUBSCRIBERS 32
+
+/**
+ * @brief Maximum number of messages that are queued for a subscriber
+ *
+ */
+#define BROADCAST_MAXIMUM_QUEUED_MESSAGES 4096
+
+//////////////////////////////////////////////////
+//					Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief What to do with a subscriber that doesn't receive the
+ * messages as fast as they're published
+ *
+ */
+typedef enum _BROADCAST_SLOW_SUBSCRIBER_POLICY
+{
+    BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST,
+    BROADCAST_SLOW_SUBSCRIBER_POLICY_DISCONNECT,
+
+} BROADCAST_SLOW_SUBSCRIBER_POLICY;
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A subscriber of the output of the remote server
+ * @details Messages are shared between the queues of all subscribers,
+ * so each message is copied only once
+ *
+ */
+typedef struct _BROADCAST_SUBSCRIBER
+{
+    SOCKET                                        Socket;
+    WSAEVENT                                      Event;
+    BOOLEAN                                       IsWritable;
+    BOOLEAN                                       IsClosed;
+    size_t                                        SentBytesOfFirstMessage;
+    UINT64                                        CountOfDroppedMessages;
+    std::list<std::shared_ptr<const std::string>> Queue;
+
+} BROADCAST_SUBSCRIBER, *PBROADCAST_SUBSCRIBER;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+BroadcastStart(SOCKET ListenSocket);
+
+VOID
+BroadcastStop();
+
+VOID
+BroadcastPublish(const char * Buffer, UINT32 Length);
+
+BOOLEAN
+BroadcastPerformSelfCheck();
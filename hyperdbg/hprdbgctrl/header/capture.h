@@ -0,0 +1,25 @@
+/**
+ * @file capture.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of decoding the records of capture actions
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+CaptureConvertRegisterNameToIndex(std::string RegisterName, UINT32 * Index);
+
+BOOLEAN
+CaptureConvertRegisterListToMask(std::string RegisterList, UINT32 * RegisterMask);
+
+VOID
+CaptureHandleRecords(PDEBUGGER_CAPTURE_RECORDS_PACKET Packet);
@@ -0,0 +1,48 @@
+/**
+ * @file command-ring.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of the shared command ring between the debugger and the driver
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A request that is sent through the shared command ring
+ * @details The input and the output buffers are at the same place
+ * like the buffers of METHOD_BUFFERED IOCTLs, the result of the request
+ * itself is in its buffer (exactly like its IOCTL)
+ *
+ */
+typedef struct _COMMAND_RING_REQUEST_DETAILS
+{
+    UINT32  IoctlCode;
+    PVOID   Buffer;
+    UINT32  InputBufferLength;
+    UINT32  OutputBufferLength;
+    UINT32  ReturnedLength;
+    UINT32  KernelStatus; // status of the ring for this request (successful if it's sent by IOCTL)
+    BOOLEAN IsSuccessful;
+
+} COMMAND_RING_REQUEST_DETAILS, *PCOMMAND_RING_REQUEST_DETAILS;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+BOOLEAN
+CommandRingInitialize();
+
+VOID
+CommandRingUninitialize();
+
+BOOLEAN
+CommandRingSendRequests(PCOMMAND_RING_REQUEST_DETAILS Requests, UINT32 CountOfRequests);
@@ -108,6 +108,15 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
                                  UINT32                       Size,
                                  PDEBUGGER_DT_COMMAND_OPTIONS DtDetails);
 
+VOID
+HyperDbgShowMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE   Style,
+                                 UINT64                       Address,
+                                 DEBUGGER_READ_MEMORY_TYPE    MemoryType,
+                                 UINT32                       Size,
+                                 PDEBUGGER_DT_COMMAND_OPTIONS DtDetails,
+                                 unsigned char *              OutputBuffer,
+                                 ULONG                        ReturnedLength);
+
 VOID
 InitializeCommandsDictionary();
 
@@ -65,6 +65,7 @@
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_SEARCH_QUERY_RESULT                 0x15
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_VA2PA_AND_PA2VA_RESULT              0x16
 #define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_PTE_RESULT                          0x17
+#define DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_HALT_PREFETCH_PROFILE_RESULT        0x18
 
 //////////////////////////////////////////////////
 //               Event Details                  //
@@ -219,6 +220,22 @@ CommandEventsHandleModifiedEvent(
     UINT64                  Tag,
     PDEBUGGER_MODIFY_EVENTS ModifyEventRequest);
 
+BOOLEAN
+CommandEventsBulkModifyAndQueryEvents(const vector<UINT64> &      Tags,
+                                      DEBUGGER_MODIFY_EVENTS_TYPE TypeOfAction,
+                                      vector<BOOLEAN> *           States);
+
+BOOLEAN
+CommandEventsParseTags(vector<string> &                                         SplittedCommand,
+                       const std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> & TagIndex,
+                       vector<UINT64> &                                         Tags);
+
+BOOLEAN
+CommandEventsPerformSelfCheck();
+
+VOID
+CommandEventsFlushBuffersOrShowAutoFlushHint();
+
 VOID
 CommandEventsClearAllEventsAndResetTags();
 
@@ -237,6 +254,9 @@ CommandLoadVmmModule();
 VOID
 ShowAllRegisters();
 
+VOID
+ShowAllRegistersFromState(PGUEST_REGS Regs, PGUEST_EXTRA_REGISTERS ExtraRegs);
+
 VOID
 CommandPauseRequest();
 
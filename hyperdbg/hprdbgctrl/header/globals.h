@@ -102,6 +102,56 @@ SOCKET g_SeverSocket = {0};
  */
 SOCKET g_ServerListenSocket = {0};
 
+/**
+ * @brief Whether the output of the remote server is broadcasted
+ * to the subscribers or not
+ *
+ */
+BOOLEAN g_IsBroadcastRunning = FALSE;
+
+/**
+ * @brief The thread that serves the subscribers of the remote server
+ *
+ */
+HANDLE g_BroadcastThread = NULL;
+
+/**
+ * @brief The event that wakes up the broadcasting thread (e.g., new
+ * messages are published)
+ *
+ */
+WSAEVENT g_BroadcastWakeUpEvent = WSA_INVALID_EVENT;
+
+/**
+ * @brief The event of accepting subscribers on the listening socket
+ *
+ */
+WSAEVENT g_BroadcastAcceptEvent = WSA_INVALID_EVENT;
+
+/**
+ * @brief The lock of the subscribers and their queues
+ *
+ */
+CRITICAL_SECTION g_BroadcastLock;
+
+/**
+ * @brief Whether the lock of the subscribers is initialized or not
+ *
+ */
+BOOLEAN g_IsBroadcastLockInitialized = FALSE;
+
+/**
+ * @brief The subscribers of the remote server
+ *
+ */
+std::vector<PBROADCAST_SUBSCRIBER> g_BroadcastSubscribers;
+
+/**
+ * @brief What to do with the subscribers that are slow
+ *
+ */
+BROADCAST_SLOW_SUBSCRIBER_POLICY g_BroadcastSlowSubscriberPolicy = BROADCAST_SLOW_SUBSCRIBER_POLICY_DROP_OLDEST;
+
 /**
  * @brief In debugger (not debuggee), we save the port of server
  * debuggee in this variable to use it later e.g, in signature
@@ -333,6 +383,12 @@ UINT64 * g_ScriptLocalVariables;
  */
 UINT64 * g_ScriptTempVariables;
 
+/**
+ * @brief Holder of cached pseudo-registers for script engine
+ *
+ */
+SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE g_ScriptPseudoRegistersCache = {0};
+
 /**
  * @brief Is list of command initialized
  *
@@ -385,6 +441,15 @@ BOOLEAN g_EventTraceInitialized = FALSE;
  */
 LIST_ENTRY g_EventTrace = {0};
 
+/**
+ * @brief Index of the events of g_EventTrace by their tags
+ *
+ * @details it's used to find events by tag and to iterate over
+ * a range of tags without walking the list of events
+ *
+ */
+std::map<UINT64, PDEBUGGER_GENERAL_EVENT_DETAIL> g_EventTraceTagIndex;
+
 /**
  * @brief it shows whether the debugger started using
  * output sources or not or in other words, is g_OutputSources
@@ -614,6 +679,44 @@ std::wstring g_StartCommandPath = L"";
  */
 std::wstring g_StartCommandPathAndArguments = L"";
 
+//////////////////////////////////////////////////
+//			     Halt Prefetch		            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief the profile of the state that the debuggee sends along
+ * with the pausing packet
+ *
+ */
+DEBUGGEE_KD_HALT_PREFETCH_PROFILE g_HaltPrefetchProfile = {0};
+
+/**
+ * @brief shows whether the prefetched state of the debuggee is valid
+ * (it's invalidated once the debuggee continues or its state changes)
+ *
+ */
+BOOLEAN g_IsHaltPrefetchedStateValid = FALSE;
+
+/**
+ * @brief the state (and the stack and the code bytes) that is prefetched
+ * on the last halt of the debuggee
+ *
+ */
+BYTE g_HaltPrefetchedState[sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) +
+                           DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE +
+                           DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE] = {0};
+
+//////////////////////////////////////////////////
+//			     Command Ring		            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief the ring that is shared with the driver to send
+ * batched requests
+ *
+ */
+PCOMMAND_RING g_CommandRing = NULL;
+
 //////////////////////////////////////////////////
 //			 Script engine tests		        //
 //////////////////////////////////////////////////
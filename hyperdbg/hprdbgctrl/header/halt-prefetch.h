@@ -0,0 +1,37 @@
+/**
+ * @file halt-prefetch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of the state that is prefetched on halts
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+VOID
+HaltPrefetchSaveState(PDEBUGGEE_KD_HALT_PREFETCHED_STATE PrefetchedState, UINT32 Length);
+
+VOID
+HaltPrefetchInvalidate();
+
+VOID
+HaltPrefetchInvalidateForAction(DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction);
+
+BOOLEAN
+HaltPrefetchGetRegisterValue(REGS_ENUM RegisterId, UINT64 * Value);
+
+BOOLEAN
+HaltPrefetchGetRegisterValueByName(std::string RegisterName, UINT64 * Value);
+
+BOOLEAN
+HaltPrefetchShowAllRegisters();
+
+BOOLEAN
+HaltPrefetchReadMemory(UINT64 Address, BYTE * Buffer, UINT32 Size);
@@ -106,6 +106,9 @@ KdSendEventQueryAndModifyPacketToDebuggee(
 BOOLEAN
 KdSendFlushPacketToDebuggee();
 
+BOOLEAN
+KdSendHaltPrefetchProfilePacketToDebuggee(PDEBUGGEE_KD_HALT_PREFETCH_PROFILE Profile);
+
 BOOLEAN
 KdSendCallStackPacketToDebuggee(UINT64                            BaseAddress,
                                 UINT32                            Size,
@@ -64,6 +64,15 @@ ScriptEngineShowDataBasedOnSymbolTypesWrapper(
     PVOID        BufferAddress,
     const char * AdditionalParameters);
 
+BOOLEAN
+ScriptEngineShowDataBasedOnTypeLayoutWrapper(
+    const char * TypeName,
+    UINT64       Address,
+    PVOID        BufferAddress,
+    UINT32       BufferSize,
+    const char * NextFieldName,
+    UINT64 *     NextAddress);
+
 VOID
 ScriptEngineSymbolAbortLoadingWrapper();
 
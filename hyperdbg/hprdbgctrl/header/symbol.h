@@ -32,6 +32,20 @@ typedef struct _LOCAL_FUNCTION_DESCRIPTION
 
 #define PDBEX_DEFAULT_CONFIGURATION "-j- -k- -e n -i"
 
+/**
+ * @brief Maximum nodes of a linked list that are shown by dt
+ * (if the count is not specified)
+ *
+ */
+#define DT_MAXIMUM_COUNT_OF_LIST_NODES 0x100
+
+/**
+ * @brief Maximum size of memory that is read by dt at once in the
+ * debugger mode (the read memory result should fit in a serial packet)
+ *
+ */
+#define DT_MAXIMUM_SERIAL_READ_SIZE (UsermodeBufferSize - SIZEOF_DEBUGGER_READ_MEMORY)
+
 //////////////////////////////////////////////////
 //			 For symbol (pdb) parsing		    //
 //////////////////////////////////////////////////
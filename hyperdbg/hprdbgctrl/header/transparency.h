@@ -14,9 +14,57 @@
 /**
  * @brief Number of tests for each instruction sets
  * @details used to generate test cases for rdts+cpuid+rdtsc
- * and rdtsc+rdtsc commands
+ * and rdtsc+rdtsc commands, the samples are not kept in memory
+ * so it's possible to use a large number of tests
  */
-#define TestCount 1000
+#define TestCount 100000
+
+/**
+ * @brief Number of samples that are kept before switching to
+ * streaming estimation of the median and MAD
+ */
+#define GAUSSIAN_STREAMING_WARMUP_SAMPLES 1024
+
+//////////////////////////////////////////////////
+//				    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief P-square estimator of a quantile (Jain and Chlamtac)
+ * @details estimates a quantile in constant memory by keeping
+ * five markers
+ */
+typedef struct _P2_QUANTILE_ESTIMATOR
+{
+    double Quantile;
+    UINT64 Count;
+    double Heights[5];
+    double Positions[5];
+    double DesiredPositions[5];
+    double Increments[5];
+
+} P2_QUANTILE_ESTIMATOR, *PP2_QUANTILE_ESTIMATOR;
+
+/**
+ * @brief Single-pass estimation of the average, standard deviation
+ * and median of the samples after removing the outliers (MAD test)
+ */
+typedef struct _GAUSSIAN_STREAMING_STATISTICS
+{
+    UINT64 Count;
+    UINT64 CountOfOutliers;
+    UINT64 AcceptedCount;
+    double AcceptedMean;
+    double AcceptedSquaredDistance;
+
+    P2_QUANTILE_ESTIMATOR Median;
+    P2_QUANTILE_ESTIMATOR AbsoluteDeviation;
+    P2_QUANTILE_ESTIMATOR AcceptedMedian;
+
+    UINT32 WarmupCount;
+    double WarmupSamples[GAUSSIAN_STREAMING_WARMUP_SAMPLES];
+
+} GAUSSIAN_STREAMING_STATISTICS, *PGAUSSIAN_STREAMING_STATISTICS;
 
 //////////////////////////////////////////////////
 //				    Functions                   //
@@ -25,6 +73,18 @@
 void
 GuassianGenerateRandom(vector<double> Data, UINT64 * AverageOfData, UINT64 * StandardDeviationOfData, UINT64 * MedianOfData);
 
+VOID
+GaussianStreamingInitialize(PGAUSSIAN_STREAMING_STATISTICS Statistics);
+
+VOID
+GaussianStreamingAddSample(PGAUSSIAN_STREAMING_STATISTICS Statistics, double Sample);
+
+VOID
+GaussianStreamingGetResults(PGAUSSIAN_STREAMING_STATISTICS Statistics,
+                            UINT64 *                       AverageOfData,
+                            UINT64 *                       StandardDeviationOfData,
+                            UINT64 *                       MedianOfData);
+
 BOOLEAN
 TransparentModeCheckHypervisorPresence(UINT64 * Average,
                                        UINT64 * StandardDeviation,
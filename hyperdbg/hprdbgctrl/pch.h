@@ -148,6 +148,10 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include "header/pe-parser.h"
 #include "header/ud.h"
 #include "header/objects.h"
+#include "header/capture.h"
+#include "header/halt-prefetch.h"
+#include "header/broadcast.h"
+#include "header/command-ring.h"
 
 #pragma comment(lib, "ntdll.lib")
 
@@ -28,8 +28,7 @@ SaveTheRegisters:
     push rax	
     
     mov rcx, rsp		    ; Fast call argument to PGUEST_REGS
-    mov rdx, [rsp +080h]    ; Fast call argument (second) - CalledFrom
-    sub rdx, 5              ; as we used (call $ + 5) so we subtract it by 5 
+    mov rdx, [rsp +080h]    ; Fast call argument (second) - Detour details (pushed by the entry stub)
     sub	rsp, 20h		; Free some space for Shadow Section
     call	DebuggerEventEptHook2GeneralDetourEventHandler
     
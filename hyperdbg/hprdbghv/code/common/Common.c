@@ -1206,6 +1206,509 @@ VmxrootCompatibleWcslen(const wchar_t * S)
     __writecr3(OriginalCr3.Flags);
 }
 
+/**
+ * @brief Get the size of the next chunk of a string that should be
+ * read from the guest memory
+ * @details The chunk doesn't pass the page boundary (unless a character
+ * is located on two pages) so the bytes after the null-terminator that
+ * are located on the next page are never accessed
+ *
+ * @param Address Address of the chunk
+ * @param CharSize Size of each character
+ *
+ * @return UINT32 Size of the chunk
+ */
+static UINT32
+VmxrootCompatibleGetStringChunkSize(UINT64 Address, UINT32 CharSize)
+{
+    UINT32 Size = min(VMXROOT_COMPATIBLE_CHUNK_SIZE, PAGE_SIZE - (UINT32)PAGE_OFFSET(Address));
+
+    Size = Size - (Size % CharSize);
+
+    return Size == 0 ? CharSize : Size;
+}
+
+/**
+ * @brief Get the size of the next chunk of a buffer that should be
+ * accessed on the guest memory
+ * @details The chunk doesn't pass the page boundary, so each chunk is
+ * mapped and accessed on a single page
+ *
+ * @param Address Address of the chunk
+ * @param Count Remaining bytes of the buffer
+ *
+ * @return UINT32 Size of the chunk
+ */
+static UINT32
+VmxrootCompatibleGetChunkSize(UINT64 Address, UINT32 Count)
+{
+    UINT32 Size = min(Count, VMXROOT_COMPATIBLE_CHUNK_SIZE);
+
+    return min(Size, PAGE_SIZE - (UINT32)PAGE_OFFSET(Address));
+}
+
+/**
+ * @brief Read a chunk of the guest memory
+ * @details Pages are only checked once, when the first chunk that is
+ * located on them is read, the caller should be on the guest cr3
+ *
+ * @param Address Address of the chunk
+ * @param Buffer Buffer to save the chunk
+ * @param Size Size of the chunk
+ * @param CheckedUntil The end of the range that is already checked
+ *
+ * @return BOOLEAN Shows whether the chunk is read or not
+ */
+static BOOLEAN
+VmxrootCompatibleReadChunk(UINT64 Address, PVOID Buffer, UINT32 Size, UINT64 * CheckedUntil)
+{
+    if (Address + Size > *CheckedUntil)
+    {
+        if (!CheckMemoryAccessSafety(Address, Size))
+        {
+            return FALSE;
+        }
+
+        *CheckedUntil = (UINT64)PAGE_ALIGN(Address + Size - 1) + PAGE_SIZE;
+    }
+
+    return MemoryMapperReadMemorySafe(Address, Buffer, Size);
+}
+
+/**
+ * @brief Read a character from a chunk of a string
+ *
+ * @param Buffer The chunk
+ * @param CharSize Size of each character
+ *
+ * @return UINT16 The character
+ */
+static UINT16
+VmxrootCompatibleGetChar(const UINT8 * Buffer, UINT32 CharSize)
+{
+    return CharSize == sizeof(CHAR) ? *Buffer : *(UINT16 *)Buffer;
+}
+
+/**
+ * @brief implementation of vmx-root mode compatible memcmp
+ * @details Both of the ranges are checked once and then compared
+ * chunk by chunk
+ *
+ * @param Buffer1
+ * @param Buffer2
+ * @param Count
+ * @param Result Result of comparison (like memcmp)
+ *
+ * @return BOOLEAN Shows whether the memory is accessible or not
+ */
+BOOLEAN
+VmxrootCompatibleMemcmp(UINT64 Buffer1, UINT64 Buffer2, UINT32 Count, INT32 * Result)
+{
+    UINT8    Chunk1[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT8    Chunk2[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT64   CheckedUntil = MAXIMUM_ADDRESS;
+    UINT32   Size;
+    BOOLEAN  Status = TRUE;
+    CR3_TYPE GuestCr3;
+    CR3_TYPE OriginalCr3;
+
+    *Result = 0;
+
+    if (Count == 0)
+    {
+        return TRUE;
+    }
+
+    //
+    // Check both of the ranges once
+    //
+    if (!CheckMemoryAccessSafety(Buffer1, Count) || !CheckMemoryAccessSafety(Buffer2, Count))
+    {
+        return FALSE;
+    }
+
+    //
+    // Move to the current process cr3
+    //
+    GuestCr3.Flags    = GetRunningCr3OnTargetProcess().Flags;
+    OriginalCr3.Flags = __readcr3();
+    __writecr3(GuestCr3.Flags);
+
+    while (Count != 0)
+    {
+        Size = min(VmxrootCompatibleGetChunkSize(Buffer1, Count),
+                   VmxrootCompatibleGetChunkSize(Buffer2, Count));
+
+        if (!VmxrootCompatibleReadChunk(Buffer1, Chunk1, Size, &CheckedUntil) ||
+            !VmxrootCompatibleReadChunk(Buffer2, Chunk2, Size, &CheckedUntil))
+        {
+            Status = FALSE;
+            break;
+        }
+
+        *Result = memcmp(Chunk1, Chunk2, Size);
+
+        if (*Result != 0)
+        {
+            break;
+        }
+
+        Buffer1 += Size;
+        Buffer2 += Size;
+        Count -= Size;
+    }
+
+    //
+    // Move back to original cr3
+    //
+    __writecr3(OriginalCr3.Flags);
+
+    return Status;
+}
+
+/**
+ * @brief implementation of vmx-root mode compatible memchr
+ * @details The range is checked once and then searched chunk by chunk
+ *
+ * @param Buffer
+ * @param Value
+ * @param Count
+ * @param Address Address of the first matching byte or NULL
+ *
+ * @return BOOLEAN Shows whether the memory is accessible or not
+ */
+BOOLEAN
+VmxrootCompatibleMemchr(UINT64 Buffer, UINT8 Value, UINT32 Count, UINT64 * Address)
+{
+    UINT8    Chunk[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT64   CheckedUntil = MAXIMUM_ADDRESS;
+    UINT32   Size;
+    UINT8 *  Found;
+    BOOLEAN  Status = TRUE;
+    CR3_TYPE GuestCr3;
+    CR3_TYPE OriginalCr3;
+
+    *Address = NULL;
+
+    if (Count == 0)
+    {
+        return TRUE;
+    }
+
+    //
+    // Check the range once
+    //
+    if (!CheckMemoryAccessSafety(Buffer, Count))
+    {
+        return FALSE;
+    }
+
+    //
+    // Move to the current process cr3
+    //
+    GuestCr3.Flags    = GetRunningCr3OnTargetProcess().Flags;
+    OriginalCr3.Flags = __readcr3();
+    __writecr3(GuestCr3.Flags);
+
+    while (Count != 0)
+    {
+        Size = VmxrootCompatibleGetChunkSize(Buffer, Count);
+
+        if (!VmxrootCompatibleReadChunk(Buffer, Chunk, Size, &CheckedUntil))
+        {
+            Status = FALSE;
+            break;
+        }
+
+        Found = memchr(Chunk, Value, Size);
+
+        if (Found != NULL)
+        {
+            *Address = Buffer + (Found - Chunk);
+            break;
+        }
+
+        Buffer += Size;
+        Count -= Size;
+    }
+
+    //
+    // Move back to original cr3
+    //
+    __writecr3(OriginalCr3.Flags);
+
+    return Status;
+}
+
+/**
+ * @brief implementation of vmx-root mode compatible memcpy
+ * @details Both of the ranges are checked once and then copied
+ * chunk by chunk
+ *
+ * @param Destination
+ * @param Source
+ * @param Count
+ *
+ * @return BOOLEAN Shows whether the memory is copied or not
+ */
+BOOLEAN
+VmxrootCompatibleMemcpy(UINT64 Destination, UINT64 Source, UINT32 Count)
+{
+    UINT8    Chunk[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT64   CheckedUntil = MAXIMUM_ADDRESS;
+    UINT32   Size;
+    BOOLEAN  Status = TRUE;
+    CR3_TYPE GuestCr3;
+    CR3_TYPE OriginalCr3;
+
+    if (Count == 0)
+    {
+        return TRUE;
+    }
+
+    //
+    // Check both of the ranges once
+    //
+    if (!CheckMemoryAccessSafety(Source, Count) || !CheckMemoryAccessSafety(Destination, Count))
+    {
+        return FALSE;
+    }
+
+    //
+    // Move to the current process cr3
+    //
+    GuestCr3.Flags    = GetRunningCr3OnTargetProcess().Flags;
+    OriginalCr3.Flags = __readcr3();
+    __writecr3(GuestCr3.Flags);
+
+    while (Count != 0)
+    {
+        Size = min(VmxrootCompatibleGetChunkSize(Source, Count),
+                   VmxrootCompatibleGetChunkSize(Destination, Count));
+
+        if (!VmxrootCompatibleReadChunk(Source, Chunk, Size, &CheckedUntil) ||
+            !MemoryMapperWriteMemorySafe(Destination, Chunk, Size, GuestCr3))
+        {
+            Status = FALSE;
+            break;
+        }
+
+        Destination += Size;
+        Source += Size;
+        Count -= Size;
+    }
+
+    //
+    // Move back to original cr3
+    //
+    __writecr3(OriginalCr3.Flags);
+
+    return Status;
+}
+
+/**
+ * @brief implementation of vmx-root mode compatible strcmp and wcscmp
+ * @details The strings are read chunk by chunk and each page is only
+ * checked once
+ *
+ * @param S1
+ * @param S2
+ * @param CharSize Size of each character (1 for strcmp and 2 for wcscmp)
+ * @param Result Result of comparison (like strcmp)
+ *
+ * @return BOOLEAN Shows whether the strings are accessible or not
+ */
+BOOLEAN
+VmxrootCompatibleStrcmp(UINT64 S1, UINT64 S2, UINT32 CharSize, INT32 * Result)
+{
+    UINT8    Chunk1[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT8    Chunk2[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT64   CheckedUntil1 = 0;
+    UINT64   CheckedUntil2 = 0;
+    UINT32   Size;
+    UINT16   Char1;
+    UINT16   Char2;
+    BOOLEAN  Status   = TRUE;
+    BOOLEAN  Finished = FALSE;
+    CR3_TYPE GuestCr3;
+    CR3_TYPE OriginalCr3;
+
+    *Result = 0;
+
+    //
+    // Move to the current process cr3
+    //
+    GuestCr3.Flags    = GetRunningCr3OnTargetProcess().Flags;
+    OriginalCr3.Flags = __readcr3();
+    __writecr3(GuestCr3.Flags);
+
+    while (!Finished)
+    {
+        Size = min(VmxrootCompatibleGetStringChunkSize(S1, CharSize),
+                   VmxrootCompatibleGetStringChunkSize(S2, CharSize));
+
+        if (!VmxrootCompatibleReadChunk(S1, Chunk1, Size, &CheckedUntil1) ||
+            !VmxrootCompatibleReadChunk(S2, Chunk2, Size, &CheckedUntil2))
+        {
+            Status = FALSE;
+            break;
+        }
+
+        for (UINT32 i = 0; i < Size; i += CharSize)
+        {
+            Char1 = VmxrootCompatibleGetChar(&Chunk1[i], CharSize);
+            Char2 = VmxrootCompatibleGetChar(&Chunk2[i], CharSize);
+
+            if (Char1 != Char2)
+            {
+                *Result  = Char1 < Char2 ? -1 : 1;
+                Finished = TRUE;
+                break;
+            }
+
+            if (Char1 == NULL)
+            {
+                Finished = TRUE;
+                break;
+            }
+        }
+
+        S1 += Size;
+        S2 += Size;
+    }
+
+    //
+    // Move back to original cr3
+    //
+    __writecr3(OriginalCr3.Flags);
+
+    return Status;
+}
+
+/**
+ * @brief implementation of vmx-root mode compatible strstr and wcsstr
+ * @details The sub-string (which should fit in a chunk) is read once, then
+ * the string is searched chunk by chunk, the tail of each chunk is kept
+ * for matches that are located on two chunks
+ *
+ * @param S
+ * @param SubStr
+ * @param CharSize Size of each character (1 for strstr and 2 for wcsstr)
+ * @param Address Address of the first occurrence or NULL
+ *
+ * @return BOOLEAN Shows whether the strings are accessible or not
+ */
+BOOLEAN
+VmxrootCompatibleStrstr(UINT64 S, UINT64 SubStr, UINT32 CharSize, UINT64 * Address)
+{
+    UINT8    Needle[VMXROOT_COMPATIBLE_CHUNK_SIZE];
+    UINT8    Window[VMXROOT_COMPATIBLE_CHUNK_SIZE * 2];
+    UINT64   CheckedUntil  = 0;
+    UINT64   WindowAddress = S;
+    UINT32   NeedleLength  = 0;
+    UINT32   Kept          = 0;
+    UINT32   End;
+    UINT32   Size;
+    BOOLEAN  Status     = TRUE;
+    BOOLEAN  Terminated = FALSE;
+    CR3_TYPE GuestCr3;
+    CR3_TYPE OriginalCr3;
+
+    *Address = NULL;
+
+    //
+    // Move to the current process cr3
+    //
+    GuestCr3.Flags    = GetRunningCr3OnTargetProcess().Flags;
+    OriginalCr3.Flags = __readcr3();
+    __writecr3(GuestCr3.Flags);
+
+    //
+    // Read the sub-string, it should fit in one chunk (including
+    // the null-terminator)
+    //
+    while (!Terminated)
+    {
+        Size = min(VmxrootCompatibleGetStringChunkSize(SubStr, CharSize),
+                   VMXROOT_COMPATIBLE_CHUNK_SIZE - NeedleLength);
+
+        if (Size < CharSize ||
+            !VmxrootCompatibleReadChunk(SubStr, &Needle[NeedleLength], Size, &CheckedUntil))
+        {
+            Status = FALSE;
+            goto Return;
+        }
+
+        for (End = NeedleLength + Size; NeedleLength < End; NeedleLength += CharSize)
+        {
+            if (VmxrootCompatibleGetChar(&Needle[NeedleLength], CharSize) == NULL)
+            {
+                Terminated = TRUE;
+                break;
+            }
+        }
+
+        SubStr += Size;
+    }
+
+    if (NeedleLength == 0)
+    {
+        *Address = S;
+        goto Return;
+    }
+
+    CheckedUntil = 0;
+    Terminated   = FALSE;
+
+    while (!Terminated)
+    {
+        Size = VmxrootCompatibleGetStringChunkSize(S, CharSize);
+
+        if (!VmxrootCompatibleReadChunk(S, &Window[Kept], Size, &CheckedUntil))
+        {
+            Status = FALSE;
+            break;
+        }
+
+        //
+        // Find the end of the string in the new part of the window
+        //
+        for (End = Kept; End < Kept + Size; End += CharSize)
+        {
+            if (VmxrootCompatibleGetChar(&Window[End], CharSize) == NULL)
+            {
+                Terminated = TRUE;
+                break;
+            }
+        }
+
+        for (UINT32 i = 0; i + NeedleLength <= End; i += CharSize)
+        {
+            if (memcmp(&Window[i], Needle, NeedleLength) == 0)
+            {
+                *Address = WindowAddress + i;
+                goto Return;
+            }
+        }
+
+        //
+        // Keep the last characters which might be the start of a match
+        //
+        Kept = min(NeedleLength - CharSize, End);
+        memmove(Window, &Window[End - Kept], Kept);
+
+        WindowAddress += End - Kept;
+        S += Size;
+    }
+
+Return:
+    //
+    // Move back to original cr3
+    //
+    __writecr3(OriginalCr3.Flags);
+
+    return Status;
+}
 /**
  * @brief Allocates a buffer and tests for the MSRs that cause #GP
  * 
@@ -39,7 +39,7 @@ LogInitialize()
     //
     // Initialize the lock for Vmx-root mode (HIGH_IRQL Spinlock)
     //
-    VmxRootLoggingLock = 0;
+    RtlZeroMemory(&VmxRootLoggingLock, sizeof(TICKET_SPINLOCK));
 
     //
     // Allocate buffer for messages and initialize the core buffer information
@@ -203,7 +203,7 @@ LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, BOOLEAN P
         // Set the index
         //
         Index = 1;
-        SpinlockLock(&VmxRootLoggingLock);
+        TicketSpinlockLock(&VmxRootLoggingLock);
     }
     else
     {
@@ -329,7 +329,7 @@ LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, BOOLEAN P
     //
     if (IsVmxRoot)
     {
-        SpinlockUnlock(&VmxRootLoggingLock);
+        TicketSpinlockUnlock(&VmxRootLoggingLock);
     }
     else
     {
@@ -368,7 +368,7 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
         //
         // Acquire the lock
         //
-        SpinlockLock(&VmxRootLoggingLock);
+        TicketSpinlockLock(&VmxRootLoggingLock);
     }
     else
     {
@@ -407,7 +407,7 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
             //
             if (IsVmxRoot)
             {
-                SpinlockUnlock(&VmxRootLoggingLock);
+                TicketSpinlockUnlock(&VmxRootLoggingLock);
             }
             else
             {
@@ -464,7 +464,7 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
     //
     if (IsVmxRoot)
     {
-        SpinlockUnlock(&VmxRootLoggingLock);
+        TicketSpinlockUnlock(&VmxRootLoggingLock);
     }
     else
     {
@@ -507,7 +507,7 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
         //
         // Acquire the lock
         //
-        SpinlockLock(&VmxRootLoggingLock);
+        TicketSpinlockLock(&VmxRootLoggingLock);
     }
     else
     {
@@ -551,7 +551,7 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
             //
             if (IsVmxRoot)
             {
-                SpinlockUnlock(&VmxRootLoggingLock);
+                TicketSpinlockUnlock(&VmxRootLoggingLock);
             }
             else
             {
@@ -685,7 +685,7 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
     //
     if (IsVmxRoot)
     {
-        SpinlockUnlock(&VmxRootLoggingLock);
+        TicketSpinlockUnlock(&VmxRootLoggingLock);
     }
     else
     {
@@ -973,7 +973,7 @@ LogSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, CHAR * L
             // Set the index
             //
             Index = 1;
-            SpinlockLock(&VmxRootLoggingLockForNonImmBuffers);
+            TicketSpinlockLock(&VmxRootLoggingLockForNonImmBuffers);
         }
         else
         {
@@ -1031,7 +1031,7 @@ LogSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, CHAR * L
         //
         if (IsVmxRootMode)
         {
-            SpinlockUnlock(&VmxRootLoggingLockForNonImmBuffers);
+            TicketSpinlockUnlock(&VmxRootLoggingLockForNonImmBuffers);
         }
         else
         {
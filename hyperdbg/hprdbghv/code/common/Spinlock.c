@@ -12,6 +12,11 @@
  * 
  * Also, benefit of this implementation is that we can use it with
  * STL lock guards, e.g.: std::lock_guard.
+ *
+ * The hot locks that are taken in vmx-root use the ticket spinlock, so
+ * the cores take the lock in FIFO order, a core that waits for the lock
+ * might be halted by the debugger, so the ticket of a waiter that doesn't
+ * take the lock is skipped (instead of handing the lock to a halted core).
  * 
  * Look here for more information:
  *      - https://locklessinc.com/articles/locks/
@@ -159,3 +164,72 @@ SpinlockUnlock(volatile LONG * Lock)
 {
     *Lock = 0;
 }
+
+/**
+ * @brief Get the ticket spinlock and won't return until successfully get the lock
+ * @details If the lock is handed to a waiter that doesn't take it (e.g.,
+ * it's halted by the debugger), its ticket is skipped, and if the ticket
+ * of this core is skipped, a new ticket is taken
+ *
+ * @param Lock The ticket spinlock
+ */
+void
+TicketSpinlockLock(PTICKET_SPINLOCK Lock)
+{
+    LONG64   Ticket    = InterlockedIncrement64(&Lock->NextTicket) - 1;
+    LONG64   LastGrant = -1;
+    unsigned Wait      = 0;
+    LONG64   Grant;
+
+    for (;;)
+    {
+        Grant = Lock->Grant;
+
+        if (Grant == (Ticket << 1))
+        {
+            if (InterlockedCompareExchange64(&Lock->Grant, Grant | 1, Grant) == Grant)
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        if ((Grant >> 1) > Ticket)
+        {
+            //
+            // The ticket is skipped as this core didn't take the lock
+            //
+            Ticket = InterlockedIncrement64(&Lock->NextTicket) - 1;
+            continue;
+        }
+
+        if (Grant != LastGrant)
+        {
+            LastGrant = Grant;
+            Wait      = 0;
+        }
+        else if (!(Grant & 1) && ++Wait > TICKET_SPINLOCK_MAXIMUM_GRANT_WAIT)
+        {
+            //
+            // The lock is handed to a waiter that doesn't take it
+            //
+            InterlockedCompareExchange64(&Lock->Grant, Grant + 2, Grant);
+            Wait = 0;
+        }
+
+        _mm_pause();
+    }
+}
+
+/**
+ * @brief Release the ticket spinlock
+ * @details Hands the lock to the next ticket
+ *
+ * @param Lock The ticket spinlock
+ */
+void
+TicketSpinlockUnlock(PTICKET_SPINLOCK Lock)
+{
+    InterlockedIncrement64(&Lock->Grant);
+}
@@ -255,12 +255,12 @@ BreakpointCheckAndHandleDebuggerDefinedBreakpoints(UINT32                  Curre
                 // instruction is our next instruction in the current execution
                 // context
                 //
-                __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+                Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
                 if (Rflags.InterruptEnableFlag)
                 {
                     Rflags.InterruptEnableFlag = FALSE;
-                    __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+                    VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
                     //
                     // An indicator to restore RFLAGS if to enabled state
@@ -304,7 +304,7 @@ BreakpointHandleBpTraps(UINT32 CurrentProcessorIndex, PGUEST_REGS GuestRegs)
     //
     // Reading guest's RIP
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &GuestRip);
+    GuestRip = VmcsCacheRead(VMCS_GUEST_RIP);
 
     //
     // Don't increment rip by default
@@ -0,0 +1,362 @@
+/**
+ * @file Capture.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Capture actions of events
+ * @details Capture actions save a fixed binary record (tag, core, tsc,
+ * context, selected registers and an optional memory snippet) into the
+ * capture buffer of the current core without running the script engine
+ * or formatting any text, the buffer is delivered as a single packet when
+ * it's full, periodically by a timer, or when the events are cleared
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the capture buffers
+ * @details should NOT be called in vmx-root
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CaptureInitialize()
+{
+    UINT32        ProcessorCount = KeQueryActiveProcessorCount(0);
+    LARGE_INTEGER DueTime;
+
+    g_CaptureBuffers = ExAllocatePoolWithTag(NonPagedPool, ProcessorCount * sizeof(CAPTURE_CORE_BUFFERS), POOLTAG);
+
+    if (g_CaptureBuffers == NULL)
+    {
+        return FALSE;
+    }
+
+    RtlZeroMemory(g_CaptureBuffers, ProcessorCount * sizeof(CAPTURE_CORE_BUFFERS));
+
+    for (size_t i = 0; i < ProcessorCount; i++)
+    {
+        g_CaptureBuffers[i].Buffers[0].Packet.CoreId = i;
+        g_CaptureBuffers[i].Buffers[1].Packet.CoreId = i;
+    }
+
+    //
+    // Deliver the partially filled buffers periodically, otherwise the last
+    // records of an event that is not triggered anymore are never delivered
+    //
+    DueTime.QuadPart = -((LONGLONG)CAPTURE_FLUSH_INTERVAL);
+
+    KeInitializeDpc(&g_CaptureFlushDpc,   // Dpc
+                    CaptureFlushCallback, // DeferredRoutine
+                    NULL                  // DeferredContext
+    );
+
+    KeInitializeTimer(&g_CaptureFlushTimer);
+
+    KeSetTimerEx(&g_CaptureFlushTimer, DueTime, CAPTURE_FLUSH_INTERVAL / 10000, &g_CaptureFlushDpc);
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the capture buffers
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+CaptureUninitialize()
+{
+    PCAPTURE_CORE_BUFFERS Buffers = g_CaptureBuffers;
+
+    if (Buffers == NULL)
+    {
+        return;
+    }
+
+    //
+    // Wait for the flush callback (if it's running) before freeing the buffers
+    //
+    KeCancelTimer(&g_CaptureFlushTimer);
+    KeFlushQueuedDpcs();
+
+    g_CaptureBuffers = NULL;
+
+    ExFreePoolWithTag(Buffers, POOLTAG);
+}
+
+/**
+ * @brief Deliver the records of a capture buffer
+ * @details The buffer should be either the active buffer of the current
+ * core (while it's busy) or the inactive buffer that is swapped by the
+ * caller (while it's flushing)
+ *
+ * @param CoreBuffers
+ * @param Buffer
+ *
+ * @return VOID
+ */
+static VOID
+CaptureSendBuffer(PCAPTURE_CORE_BUFFERS CoreBuffers, PCAPTURE_BUFFER Buffer)
+{
+    UINT32 Length;
+
+    //
+    // The records that are missed while the core was busy are reported
+    // as dropped records
+    //
+    Buffer->Packet.CountOfDroppedRecords += InterlockedExchange(&CoreBuffers->CountOfMissedRecords, 0);
+
+    if (Buffer->Packet.CountOfRecords == 0)
+    {
+        return;
+    }
+
+    Length = sizeof(DEBUGGER_CAPTURE_RECORDS_PACKET) + Buffer->Packet.CountOfRecords * sizeof(DEBUGGER_CAPTURE_RECORD);
+
+    if (LogSendBuffer(OPERATION_LOG_CAPTURE_RECORDS, &Buffer->Packet, Length, FALSE))
+    {
+        Buffer->Packet.CountOfDroppedRecords = 0;
+    }
+    else
+    {
+        //
+        // The message queue is full, the records are dropped and the
+        // count is reported with the next packet
+        //
+        Buffer->Packet.CountOfDroppedRecords += Buffer->Packet.CountOfRecords;
+    }
+
+    Buffer->Packet.CountOfRecords = 0;
+    CoreBuffers->LastFlushTime    = KeQueryInterruptTime();
+}
+
+/**
+ * @brief Perform the capture action
+ *
+ * @param Tag Tag of event
+ * @param Action Action object
+ * @param Regs Guest registers
+ * @param Context Optional parameter
+ *
+ * @return VOID
+ */
+VOID
+CapturePerformCapture(UINT64 Tag, PDEBUGGER_EVENT_ACTION Action, PGUEST_REGS Regs, PVOID Context)
+{
+    ULONG                    CoreIndex      = KeGetCurrentProcessorNumber();
+    BOOLEAN                  IsVmxRoot      = g_GuestState[CoreIndex].IsOnVmxRootMode;
+    UINT32                   RegisterMask   = Action->CaptureConfiguration.RegisterMask;
+    UINT32                   SnippetSize    = Action->CaptureConfiguration.SnippetSize;
+    UINT64 *                 GeneralRegs    = (UINT64 *)Regs;
+    UINT64                   SnippetAddress = NULL;
+    PCAPTURE_CORE_BUFFERS    CoreBuffers;
+    PCAPTURE_BUFFER          Buffer;
+    PDEBUGGER_CAPTURE_RECORD Record;
+    LONG                     State;
+    KIRQL                    OldIrql;
+
+    if (g_CaptureBuffers == NULL)
+    {
+        return;
+    }
+
+    CoreBuffers = &g_CaptureBuffers[CoreIndex];
+
+    //
+    // In vmx non-root, we raise the IRQL so another thread on this core
+    // won't use the same buffer
+    //
+    if (!IsVmxRoot)
+    {
+        OldIrql = KeRaiseIrqlToDpcLevel();
+    }
+
+    //
+    // Mark this core as busy, the active buffer is not swapped by other
+    // cores while it's busy, if it's already busy then a vm-exit happened
+    // while this core was saving a record in vmx non-root, so the record
+    // is missed rather than corrupting the record that is being saved
+    //
+    State = InterlockedOr(&CoreBuffers->State, CAPTURE_STATE_BUSY);
+
+    if (State & CAPTURE_STATE_BUSY)
+    {
+        InterlockedIncrement(&CoreBuffers->CountOfMissedRecords);
+
+        if (!IsVmxRoot)
+        {
+            KeLowerIrql(OldIrql);
+        }
+
+        return;
+    }
+
+    Buffer = &CoreBuffers->Buffers[State & CAPTURE_STATE_ACTIVE_BUFFER];
+    Record = &Buffer->Records[Buffer->Packet.CountOfRecords];
+
+    Record->Tag          = Tag;
+    Record->Tsc          = __rdtsc();
+    Record->Context      = Context;
+    Record->CoreId       = CoreIndex;
+    Record->RegisterMask = RegisterMask;
+
+    //
+    // General-purpose registers are in the same order as GUEST_REGS
+    //
+    for (size_t i = 0; i < DEBUGGER_CAPTURE_REGISTER_RIP; i++)
+    {
+        Record->Registers[i] = (RegisterMask & (1 << i)) ? GeneralRegs[i] : NULL;
+    }
+
+    //
+    // RIP and RFLAGS are only available in the VMCS
+    //
+    Record->Registers[DEBUGGER_CAPTURE_REGISTER_RIP] =
+        (IsVmxRoot && (RegisterMask & (1 << DEBUGGER_CAPTURE_REGISTER_RIP))) ? GetGuestRIP() : NULL;
+
+    Record->Registers[DEBUGGER_CAPTURE_REGISTER_RFLAGS] =
+        (IsVmxRoot && (RegisterMask & (1 << DEBUGGER_CAPTURE_REGISTER_RFLAGS))) ? GetGuestRFlags() : NULL;
+
+    //
+    // Capture the memory snippet
+    //
+    Record->SnippetSize = 0;
+
+    if (SnippetSize != 0)
+    {
+        if (Action->CaptureConfiguration.SnippetRegister < DEBUGGER_CAPTURE_REGISTER_RIP)
+        {
+            SnippetAddress = GeneralRegs[Action->CaptureConfiguration.SnippetRegister];
+        }
+        else if (Action->CaptureConfiguration.SnippetRegister == DEBUGGER_CAPTURE_REGISTER_RIP && IsVmxRoot)
+        {
+            SnippetAddress = GetGuestRIP();
+        }
+
+        Record->SnippetAddress = SnippetAddress;
+
+        if (SnippetAddress != NULL && CheckMemoryAccessSafety(SnippetAddress, SnippetSize))
+        {
+            MemoryMapperReadMemorySafeOnTargetProcess(SnippetAddress, Record->Snippet, SnippetSize);
+            Record->SnippetSize = SnippetSize;
+        }
+    }
+
+    Buffer->Packet.CountOfRecords++;
+
+    //
+    // Deliver the buffer if it's full, or if the results are needed
+    // immediately and the buffer is not delivered recently (otherwise,
+    // it's delivered by the flush timer)
+    //
+    if (Buffer->Packet.CountOfRecords == DEBUGGER_CAPTURE_MAXIMUM_RECORDS_IN_PACKET ||
+        (Action->ImmediatelySendTheResults && KeQueryInterruptTime() - CoreBuffers->LastFlushTime >= CAPTURE_FLUSH_INTERVAL))
+    {
+        CaptureSendBuffer(CoreBuffers, Buffer);
+    }
+
+    InterlockedAnd(&CoreBuffers->State, ~CAPTURE_STATE_BUSY);
+
+    if (!IsVmxRoot)
+    {
+        KeLowerIrql(OldIrql);
+    }
+}
+
+/**
+ * @brief Deliver the records of the capture buffers of all cores
+ * @details The active buffer of each core is swapped with its empty
+ * inactive buffer and the previously active buffer is delivered, the
+ * cores that are busy (saving a record) or flushed by another core are
+ * skipped, their records are delivered when the buffer is full or by
+ * the next timer callback
+ *
+ * @param OnlyExpiredBuffers Only deliver the buffers that are not
+ * delivered in the last CAPTURE_FLUSH_INTERVAL
+ *
+ * @return VOID
+ */
+static VOID
+CaptureFlushBuffers(BOOLEAN OnlyExpiredBuffers)
+{
+    UINT32                ProcessorCount = KeQueryActiveProcessorCount(0);
+    PCAPTURE_CORE_BUFFERS Buffers        = g_CaptureBuffers;
+    PCAPTURE_BUFFER       Buffer;
+    LONG                  State;
+
+    if (Buffers == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < ProcessorCount; i++)
+    {
+        State  = Buffers[i].State;
+        Buffer = &Buffers[i].Buffers[State & CAPTURE_STATE_ACTIVE_BUFFER];
+
+        if (State & (CAPTURE_STATE_BUSY | CAPTURE_STATE_FLUSHING))
+        {
+            continue;
+        }
+
+        if (Buffer->Packet.CountOfRecords == 0 && Buffers[i].CountOfMissedRecords == 0)
+        {
+            continue;
+        }
+
+        if (OnlyExpiredBuffers && KeQueryInterruptTime() - Buffers[i].LastFlushTime < CAPTURE_FLUSH_INTERVAL)
+        {
+            continue;
+        }
+
+        //
+        // Swap the active buffer, it fails if the core became busy
+        //
+        if (InterlockedCompareExchange(&Buffers[i].State,
+                                       (State ^ CAPTURE_STATE_ACTIVE_BUFFER) | CAPTURE_STATE_FLUSHING,
+                                       State) != State)
+        {
+            continue;
+        }
+
+        CaptureSendBuffer(&Buffers[i], Buffer);
+
+        InterlockedAnd(&Buffers[i].State, ~CAPTURE_STATE_FLUSHING);
+    }
+}
+
+/**
+ * @brief The timer callback of delivering partially filled capture buffers
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ *
+ * @return VOID
+ */
+VOID
+CaptureFlushCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+    UNREFERENCED_PARAMETER(SystemArgument1);
+    UNREFERENCED_PARAMETER(SystemArgument2);
+
+    CaptureFlushBuffers(TRUE);
+}
+
+/**
+ * @brief Deliver the remaining records of all cores
+ *
+ * @return VOID
+ */
+VOID
+CaptureFlushAllCores()
+{
+    CaptureFlushBuffers(FALSE);
+}
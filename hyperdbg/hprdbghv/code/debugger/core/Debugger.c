@@ -175,6 +175,35 @@ DebuggerInitialize()
         RtlZeroMemory(CurrentDebuggerState->ScriptEngineCoreSpecificTempVariable, MAX_TEMP_COUNT * sizeof(UINT64));
     }
 
+    //
+    // Initialize the maps of user-mode modules
+    //
+    ModuleMapInitialize();
+
+    //
+    // Initialize the filter of syscall and sysret events
+    //
+    if (!SyscallHookFilterInitialize())
+    {
+        return FALSE;
+    }
+
+    //
+    // Initialize the aggregation tables of the script engine
+    //
+    if (!AggregationInitialize())
+    {
+        return FALSE;
+    }
+
+    //
+    // Initialize the buffers of capture actions
+    //
+    if (!CaptureInitialize())
+    {
+        return FALSE;
+    }
+
     //
     // *** Initialize NMI broadcasting mechanism ***
     //
@@ -257,6 +286,26 @@ DebuggerUninitialize()
     //
     UdUninitializeUserDebugger();
 
+    //
+    // Free the maps of user-mode modules
+    //
+    ModuleMapUninitialize();
+
+    //
+    // Free the filter of syscall and sysret events
+    //
+    SyscallHookFilterUninitialize();
+
+    //
+    // Free the aggregation tables of the script engine
+    //
+    AggregationUninitialize();
+
+    //
+    // Free the buffers of capture actions
+    //
+    CaptureUninitialize();
+
     //
     // *** Uninitialize NMI broadcasting mechanism ***
     //
@@ -320,9 +369,16 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
     }
 
     //
-    // Initialize the event structure
+    // Initialize the event structure, the per-core states of the limiter
+    // and the condition buffer are allocated at the end of the event, the
+    // pool only guarantees 16 byte alignment, so a cache line of padding
+    // is allocated to move the per-core states to a cache line boundary
     //
-    PDEBUGGER_EVENT Event = ExAllocatePoolWithTag(NonPagedPool, sizeof(DEBUGGER_EVENT) + ConditionsBufferSize, POOLTAG);
+    SIZE_T LimiterStatesSize = KeQueryActiveProcessorCount(0) * sizeof(DEBUGGER_EVENT_LIMITER_STATE) +
+                               DEBUGGER_EVENT_LIMITER_STATE_ALIGNMENT;
+    SIZE_T EventSize = sizeof(DEBUGGER_EVENT) + LimiterStatesSize + ConditionsBufferSize;
+
+    PDEBUGGER_EVENT Event = ExAllocatePoolWithTag(NonPagedPool, EventSize, POOLTAG);
     if (!Event)
     {
         //
@@ -330,7 +386,7 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
         //
         return NULL;
     }
-    RtlZeroMemory(Event, sizeof(DEBUGGER_EVENT) + ConditionsBufferSize);
+    RtlZeroMemory(Event, EventSize);
 
     Event->CoreId         = CoreId;
     Event->ProcessId      = ProcessId;
@@ -342,6 +398,8 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
     Event->OptionalParam2 = OptionalParam2;
     Event->OptionalParam3 = OptionalParam3;
     Event->OptionalParam4 = OptionalParam4;
+    Event->LimiterStates  = (PDEBUGGER_EVENT_LIMITER_STATE)(((UINT64)Event + sizeof(DEBUGGER_EVENT) + DEBUGGER_EVENT_LIMITER_STATE_ALIGNMENT - 1) &
+                                                          ~((UINT64)DEBUGGER_EVENT_LIMITER_STATE_ALIGNMENT - 1));
 
     //
     // check if this event is conditional or not
@@ -352,7 +410,7 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
         // It's condtional
         //
         Event->ConditionsBufferSize   = ConditionsBufferSize;
-        Event->ConditionBufferAddress = (UINT64)Event + sizeof(DEBUGGER_EVENT);
+        Event->ConditionBufferAddress = (UINT64)Event + sizeof(DEBUGGER_EVENT) + LimiterStatesSize;
 
         //
         // copy the condtion buffer to the end of the buffer of the event
@@ -389,10 +447,11 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
  * by the user-mode immediately
  * @param InTheCaseOfCustomCode Custom code structure (if any)
  * @param InTheCaseOfRunScript Run script structure (if any)
+ * @param InTheCaseOfCapture Capture structure (if any)
  * @return PDEBUGGER_EVENT_ACTION
  */
 PDEBUGGER_EVENT_ACTION
-DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType, BOOLEAN SendTheResultsImmediately, PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE InTheCaseOfCustomCode, PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript)
+DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType, BOOLEAN SendTheResultsImmediately, PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE InTheCaseOfCustomCode, PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript, PDEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION InTheCaseOfCapture)
 {
     PDEBUGGER_EVENT_ACTION Action;
     SIZE_T                 Size;
@@ -592,6 +651,28 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM
         Action->ScriptConfiguration.OptionalRequestedBufferSize = InTheCaseOfRunScript->OptionalRequestedBufferSize;
     }
 
+    //
+    // If it's capture action type
+    //
+    else if (ActionType == RUN_CAPTURE)
+    {
+        //
+        // Check the configuration of capture
+        //
+        if (InTheCaseOfCapture == NULL ||
+            InTheCaseOfCapture->SnippetSize > DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE ||
+            (InTheCaseOfCapture->SnippetSize != 0 && InTheCaseOfCapture->SnippetRegister > DEBUGGER_CAPTURE_REGISTER_RIP))
+        {
+            //
+            // Invalid configuration
+            //
+            ExFreePoolWithTag(Action, POOLTAG);
+            return NULL;
+        }
+
+        Action->CaptureConfiguration = *InTheCaseOfCapture;
+    }
+
     //
     // Create an order code for the current action
     // and also increase the Count of action in event
@@ -645,9 +726,11 @@ DebuggerRegisterEvent(PDEBUGGER_EVENT Event)
         break;
     case SYSCALL_HOOK_EFER_SYSCALL:
         InsertHeadList(&g_Events->SyscallHooksEferSyscallEventsHead, &(Event->EventsOfSameTypeList));
+        SyscallHookFilterUpdate();
         break;
     case SYSCALL_HOOK_EFER_SYSRET:
         InsertHeadList(&g_Events->SyscallHooksEferSysretEventsHead, &(Event->EventsOfSameTypeList));
+        SyscallHookFilterUpdate();
         break;
     case CPUID_INSTRUCTION_EXECUTION:
         InsertHeadList(&g_Events->CpuidInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
@@ -712,6 +795,7 @@ DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOI
     DebuggerCheckForCondition * ConditionFunc;
     PLIST_ENTRY                 TempList              = 0;
     PLIST_ENTRY                 TempList2             = 0;
+    PVOID                       OriginalContext       = Context;
     UINT32                      CurrentProcessorIndex = KeGetCurrentProcessorNumber();
     VIRTUAL_MACHINE_STATE *     CurrentVmState        = &g_GuestState[CurrentProcessorIndex];
 
@@ -859,6 +943,12 @@ DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOI
         TempList                     = TempList->Flink;
         PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
 
+        //
+        // The context might be changed for the previous event (e.g., hidden
+        // hooks change it to the virtual address), so restore it
+        //
+        Context = OriginalContext;
+
         //
         // check if the event is enabled or not
         //
@@ -1075,6 +1165,15 @@ DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOI
             break;
         }
 
+        //
+        // Check the sampling, rate limit and hit limit of the event, it's
+        // checked before the condition, so the skipped hits won't run it
+        //
+        if (CurrentEvent->IsLimited && !DebuggerCheckEventLimits(CurrentEvent, CurrentProcessorIndex))
+        {
+            continue;
+        }
+
         //
         // Check if condtion is met or not , if the condition
         // is not met then we have to avoid performing the actions
@@ -1132,6 +1231,93 @@ DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOI
     }
 }
 
+/**
+ * @brief Check the sampling, rate limit and hit limit of an event
+ * @details Sampling and rate limiting are per-core (each core only
+ * updates its own state), the hit limit is shared between cores
+ *
+ * @param Event Event Object
+ * @param CoreIndex Index of the current core
+ * @return BOOLEAN TRUE if the event should run for this hit and FALSE
+ * if the hit should be skipped
+ */
+BOOLEAN
+DebuggerCheckEventLimits(PDEBUGGER_EVENT Event, UINT32 CoreIndex)
+{
+    PDEBUGGER_EVENT_LIMITER_STATE State = &Event->LimiterStates[CoreIndex];
+    UINT64                        CurrentTime;
+    UINT64                        ElapsedTime;
+    UINT64                        NewTokens;
+
+    //
+    // Run once in each SamplingRate hits (the first hit is sampled)
+    //
+    if (Event->SamplingRate > 1)
+    {
+        if (State->SampleCounter != 0)
+        {
+            State->SampleCounter--;
+            return FALSE;
+        }
+
+        State->SampleCounter = Event->SamplingRate - 1;
+    }
+
+    //
+    // Token bucket of rate limit, the bucket is filled with RateLimit
+    // tokens in each second and it holds at most one second of tokens
+    //
+    if (Event->RateLimit != 0)
+    {
+        CurrentTime = KeQueryInterruptTime();
+        ElapsedTime = CurrentTime - State->LastRefillTime;
+
+        if (ElapsedTime >= DEBUGGER_EVENT_RATE_LIMIT_INTERVAL)
+        {
+            State->Tokens         = Event->RateLimit;
+            State->LastRefillTime = CurrentTime;
+        }
+        else
+        {
+            NewTokens = (ElapsedTime * Event->RateLimit) / DEBUGGER_EVENT_RATE_LIMIT_INTERVAL;
+
+            if (NewTokens != 0)
+            {
+                State->Tokens = (UINT32)min(State->Tokens + NewTokens, Event->RateLimit);
+
+                //
+                // Only move forward for the time of the added tokens, so the
+                // remaining time is used for the next tokens
+                //
+                State->LastRefillTime += (NewTokens * DEBUGGER_EVENT_RATE_LIMIT_INTERVAL) / Event->RateLimit;
+            }
+        }
+
+        if (State->Tokens == 0)
+        {
+            return FALSE;
+        }
+
+        State->Tokens--;
+    }
+
+    //
+    // Only run for the first HitLimit hits, the count is checked before
+    // incrementing it, so the cores won't contend for the count after
+    // the limit is reached
+    //
+    if (Event->HitLimit != 0)
+    {
+        if ((UINT64)Event->CountOfHits >= Event->HitLimit ||
+            (UINT64)InterlockedIncrement64(&Event->CountOfHits) > Event->HitLimit)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
 /**
  * @brief Run a special event's action(s)
  *
@@ -1168,6 +1354,9 @@ DebuggerPerformActions(PDEBUGGER_EVENT Event, PGUEST_REGS Regs, PVOID Context)
         case RUN_CUSTOM_CODE:
             DebuggerPerformRunTheCustomCode(Event->Tag, CurrentAction, Regs, Context);
             break;
+        case RUN_CAPTURE:
+            CapturePerformCapture(Event->Tag, CurrentAction, Regs, Context);
+            break;
         default:
 
             //
@@ -1254,6 +1443,16 @@ DebuggerPerformRunScript(UINT64                  Tag,
     VariablesList.LocalVariablesList  = g_GuestState[CoreIndex].DebuggingState.ScriptEngineCoreSpecificLocalVariable;
     VariablesList.TempList            = g_GuestState[CoreIndex].DebuggingState.ScriptEngineCoreSpecificTempVariable;
 
+    //
+    // Pseudo-registers are shared between all scripts of the same VM exit,
+    // they're not cached in vmx non-root mode as the core might run other
+    // threads between the scripts
+    //
+    if (g_GuestState[CoreIndex].IsOnVmxRootMode)
+    {
+        VariablesList.PseudoRegistersCache = &g_GuestState[CoreIndex].DebuggingState.PseudoRegistersCache;
+    }
+
     for (int i = 0; i < CodeBuffer.Pointer;)
     {
         //
@@ -1812,6 +2011,16 @@ DebuggerRemoveEventFromEventList(UINT64 Tag)
                 // We have to remove the event from the list
                 //
                 RemoveEntryList(&CurrentEvent->EventsOfSameTypeList);
+
+                //
+                // Syscall and sysret events are compiled to the filter
+                //
+                if (CurrentEvent->EventType == SYSCALL_HOOK_EFER_SYSCALL ||
+                    CurrentEvent->EventType == SYSCALL_HOOK_EFER_SYSRET)
+                {
+                    SyscallHookFilterUpdate();
+                }
+
                 return TRUE;
             }
         }
@@ -1920,6 +2129,13 @@ DebuggerRemoveEvent(UINT64 Tag)
         return FALSE;
     }
 
+    //
+    // Deliver the remaining aggregations of the event's scripts
+    // and the remaining capture records
+    //
+    AggregationPrintAndClear(Tag);
+    CaptureFlushAllCores();
+
     //
     // Remove all of the actions and free its pools
     //
@@ -2153,6 +2369,14 @@ DebuggerParseEventFromUsermode(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetails, UINT
         return FALSE;
     }
 
+    //
+    // Set the sampling, rate limit and hit limit of the event
+    //
+    Event->SamplingRate = EventDetails->SamplingRate;
+    Event->RateLimit    = EventDetails->RateLimit;
+    Event->HitLimit     = EventDetails->HitLimit;
+    Event->IsLimited    = EventDetails->SamplingRate > 1 || EventDetails->RateLimit != 0 || EventDetails->HitLimit != 0;
+
     //
     // Register the event
     //
@@ -2197,6 +2421,24 @@ DebuggerParseEventFromUsermode(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetails, UINT
                                                                                      TRUE,
                                                                                      TRUE);
 
+            //
+            // Add the part of the range which is on this page, so the accesses to
+            // other offsets of the page won't be dispatched to the events
+            //
+            if (ResultOfApplyingEvent &&
+                !EptHookAddMonitorRange((UINT64)EventDetails->OptionalParam1 + (i * PAGE_SIZE),
+                                        EventDetails->OptionalParam1,
+                                        EventDetails->OptionalParam2,
+                                        EventDetails->Tag,
+                                        EventDetails->ProcessId))
+            {
+                EptHookUnHookSingleAddressMonitor((UINT64)EventDetails->OptionalParam1 + (i * PAGE_SIZE),
+                                                  EventDetails->Tag,
+                                                  EventDetails->ProcessId);
+
+                ResultOfApplyingEvent = FALSE;
+            }
+
             if (!ResultOfApplyingEvent)
             {
                 //
@@ -2209,7 +2451,9 @@ DebuggerParseEventFromUsermode(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetails, UINT
                 //
                 for (size_t j = 0; j < i; j++)
                 {
-                    EptHookUnHookSingleAddress((UINT64)EventDetails->OptionalParam1 + (j * PAGE_SIZE), NULL, Event->ProcessId);
+                    EptHookUnHookSingleAddressMonitor((UINT64)EventDetails->OptionalParam1 + (j * PAGE_SIZE),
+                                                      EventDetails->Tag,
+                                                      EventDetails->ProcessId);
                 }
 
                 break;
@@ -2804,7 +3048,7 @@ DebuggerParseActionFromUsermode(PDEBUGGER_GENERAL_ACTION Action, UINT32 BufferLe
         //
         // Add action to event
         //
-        DebuggerAddActionToEvent(Event, RUN_CUSTOM_CODE, Action->ImmediateMessagePassing, &CustomCode, NULL);
+        DebuggerAddActionToEvent(Event, RUN_CUSTOM_CODE, Action->ImmediateMessagePassing, &CustomCode, NULL, NULL);
 
         //
         // Enable the event
@@ -2839,7 +3083,7 @@ DebuggerParseActionFromUsermode(PDEBUGGER_GENERAL_ACTION Action, UINT32 BufferLe
         UserScriptConfig.ScriptPointer                                  = Action->ScriptBufferPointer;
         UserScriptConfig.OptionalRequestedBufferSize                    = Action->PreAllocatedBuffer;
 
-        DebuggerAddActionToEvent(Event, RUN_SCRIPT, Action->ImmediateMessagePassing, NULL, &UserScriptConfig);
+        DebuggerAddActionToEvent(Event, RUN_SCRIPT, Action->ImmediateMessagePassing, NULL, &UserScriptConfig, NULL);
 
         //
         // Enable the event
@@ -2851,7 +3095,28 @@ DebuggerParseActionFromUsermode(PDEBUGGER_GENERAL_ACTION Action, UINT32 BufferLe
         //
         // Add action BREAK_TO_DEBUGGER to event
         //
-        DebuggerAddActionToEvent(Event, BREAK_TO_DEBUGGER, Action->ImmediateMessagePassing, NULL, NULL);
+        DebuggerAddActionToEvent(Event, BREAK_TO_DEBUGGER, Action->ImmediateMessagePassing, NULL, NULL, NULL);
+
+        //
+        // Enable the event
+        //
+        DebuggerEnableEvent(Event->Tag);
+    }
+    else if (Action->ActionType == RUN_CAPTURE)
+    {
+        //
+        // Add action RUN_CAPTURE to event
+        //
+        if (DebuggerAddActionToEvent(Event, RUN_CAPTURE, Action->ImmediateMessagePassing, NULL, NULL, &Action->CaptureConfiguration) == NULL)
+        {
+            //
+            // Set the appropriate error
+            //
+            ResultsToReturnUsermode->IsSuccessful = FALSE;
+            ResultsToReturnUsermode->Error        = DEBUGGER_ERROR_INVALID_CAPTURE_CONFIGURATION;
+
+            return FALSE;
+        }
 
         //
         // Enable the event
@@ -2907,6 +3172,27 @@ DebuggerTerminateEvent(UINT64 Tag)
         return FALSE;
     }
 
+    //
+    // Terminate the event object
+    //
+    DebuggerTerminateEventObject(Event);
+
+    return TRUE;
+}
+
+/**
+ * @brief Terminate one event's effect by its object
+ *
+ * @details This function won't remove the event from
+ * the lists of event or de-allocated them, this should
+ * be called BEFORE the removing function
+ *
+ * @param Event Target event object
+ * @return VOID
+ */
+VOID
+DebuggerTerminateEventObject(PDEBUGGER_EVENT Event)
+{
     //
     // Check the event type of our specific tag
     //
@@ -3246,6 +3532,205 @@ DebuggerParseEventsModificationFromUsermode(PDEBUGGER_MODIFY_EVENTS DebuggerEven
     return TRUE;
 }
 
+/**
+ * @brief Check whether an event is targeted by a bulk modification request
+ *
+ * @param DebuggerBulkModificationRequest bulk modification request details
+ * @param Tag Tag of the event
+ * @param Entry The entry of the tag is returned in this parameter
+ * @return BOOLEAN TRUE if the event is targeted by the request, otherwise FALSE
+ */
+BOOLEAN
+DebuggerIsTargetOfBulkModification(PDEBUGGER_BULK_MODIFY_EVENTS        DebuggerBulkModificationRequest,
+                                   UINT64                              Tag,
+                                   PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY * Entry)
+{
+    PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY Entries;
+    UINT32                             Low;
+    UINT32                             High;
+    UINT32                             Middle;
+
+    *Entry = NULL;
+
+    //
+    // Entries are appended to the request and are sorted, so we
+    // use a binary search to find the tag
+    //
+    Entries = (PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY)((UINT64)DebuggerBulkModificationRequest + SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS);
+    Low     = 0;
+    High    = DebuggerBulkModificationRequest->CountOfTags;
+
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (Entries[Middle].Tag == Tag)
+        {
+            *Entry = &Entries[Middle];
+            return TRUE;
+        }
+        else if (Entries[Middle].Tag < Tag)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Parse and apply requests to query/enable/disable/clear a set
+ * of events from the user-mode
+ *
+ * @details all of the events are modified by walking the lists of events,
+ * instead of searching the lists for each of the tags
+ *
+ * @param DebuggerBulkModificationRequest bulk modification request details
+ * (the size of the buffer should be validated by the caller)
+ * @return BOOLEAN returns TRUE if there was no error, and FALSE if there was
+ * an error
+ */
+BOOLEAN
+DebuggerParseEventsBulkModificationFromUsermode(PDEBUGGER_BULK_MODIFY_EVENTS DebuggerBulkModificationRequest)
+{
+    PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY Entries;
+    PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY Entry;
+    PLIST_ENTRY                        TempList;
+    PLIST_ENTRY                        ListHead;
+    PDEBUGGER_EVENT                    CurrentEvent;
+    UINT32                             CountOfAffectedEvents = 0;
+
+    Entries = (PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY)((UINT64)DebuggerBulkModificationRequest + SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS);
+
+    //
+    // Check if it's a valid action
+    //
+    if (DebuggerBulkModificationRequest->TypeOfAction != DEBUGGER_MODIFY_EVENTS_QUERY_STATE &&
+        DebuggerBulkModificationRequest->TypeOfAction != DEBUGGER_MODIFY_EVENTS_ENABLE &&
+        DebuggerBulkModificationRequest->TypeOfAction != DEBUGGER_MODIFY_EVENTS_DISABLE &&
+        DebuggerBulkModificationRequest->TypeOfAction != DEBUGGER_MODIFY_EVENTS_CLEAR)
+    {
+        DebuggerBulkModificationRequest->KernelStatus = DEBUGGER_ERROR_MODIFY_EVENTS_INVALID_TYPE_OF_ACTION;
+        return FALSE;
+    }
+
+    //
+    // Tags should be sorted and unique, otherwise we're not able to
+    // search them
+    //
+    for (UINT32 i = 0; i < DebuggerBulkModificationRequest->CountOfTags; i++)
+    {
+        if (i != 0 && Entries[i].Tag <= Entries[i - 1].Tag)
+        {
+            DebuggerBulkModificationRequest->KernelStatus = DEBUGGER_ERROR_BULK_MODIFY_EVENTS_INVALID_TAGS;
+            return FALSE;
+        }
+
+        Entries[i].IsFound   = FALSE;
+        Entries[i].IsEnabled = FALSE;
+    }
+
+    //
+    // Apply the action on the target events, in the case of clearing
+    // events, we first disable all of them so the debugger no longer
+    // use these events, then we terminate and remove them
+    //
+    for (size_t i = 0; i < sizeof(DEBUGGER_CORE_EVENTS) / sizeof(LIST_ENTRY); i++)
+    {
+        ListHead = (PLIST_ENTRY)((UINT64)(g_Events) + (i * sizeof(LIST_ENTRY)));
+
+        for (TempList = ListHead->Flink; TempList != ListHead; TempList = TempList->Flink)
+        {
+            CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+            if (!DebuggerIsTargetOfBulkModification(DebuggerBulkModificationRequest, CurrentEvent->Tag, &Entry))
+            {
+                continue;
+            }
+
+            CountOfAffectedEvents++;
+
+            if (DebuggerBulkModificationRequest->TypeOfAction == DEBUGGER_MODIFY_EVENTS_ENABLE)
+            {
+                CurrentEvent->Enabled = TRUE;
+            }
+            else if (DebuggerBulkModificationRequest->TypeOfAction == DEBUGGER_MODIFY_EVENTS_DISABLE ||
+                     DebuggerBulkModificationRequest->TypeOfAction == DEBUGGER_MODIFY_EVENTS_CLEAR)
+            {
+                CurrentEvent->Enabled = FALSE;
+            }
+
+            Entry->IsFound   = TRUE;
+            Entry->IsEnabled = CurrentEvent->Enabled;
+        }
+    }
+
+    if (DebuggerBulkModificationRequest->TypeOfAction == DEBUGGER_MODIFY_EVENTS_CLEAR && CountOfAffectedEvents != 0)
+    {
+        //
+        // Each event is terminated and removed before terminating the next
+        // one, this way, the terminators won't re-apply the effects of the
+        // events that are already cleared
+        //
+        for (size_t i = 0; i < sizeof(DEBUGGER_CORE_EVENTS) / sizeof(LIST_ENTRY); i++)
+        {
+            ListHead = (PLIST_ENTRY)((UINT64)(g_Events) + (i * sizeof(LIST_ENTRY)));
+            TempList = ListHead->Flink;
+
+            while (TempList != ListHead)
+            {
+                CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+                TempList     = TempList->Flink;
+
+                if (!DebuggerIsTargetOfBulkModification(DebuggerBulkModificationRequest, CurrentEvent->Tag, &Entry))
+                {
+                    continue;
+                }
+
+                //
+                // Terminate the event
+                //
+                DebuggerTerminateEventObject(CurrentEvent);
+
+                //
+                // Deliver the remaining aggregations of the event's scripts
+                //
+                AggregationPrintAndClear(CurrentEvent->Tag);
+
+                //
+                // Remove it from the list, remove its actions and free
+                // the event (the conditions buffer is a part of the event)
+                //
+                RemoveEntryList(&CurrentEvent->EventsOfSameTypeList);
+                DebuggerRemoveAllActionsFromEvent(CurrentEvent);
+                ExFreePoolWithTag(CurrentEvent, POOLTAG);
+            }
+        }
+
+        //
+        // Rebuild the filter of syscall and sysret events
+        //
+        SyscallHookFilterUpdate();
+
+        //
+        // Deliver the remaining capture records
+        //
+        CaptureFlushAllCores();
+    }
+
+    //
+    // The function was successful
+    //
+    DebuggerBulkModificationRequest->CountOfAffectedEvents = CountOfAffectedEvents;
+    DebuggerBulkModificationRequest->KernelStatus          = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    return TRUE;
+}
+
 //
 //   //
 //   //---------------------------------------------------------------------------
@@ -3288,7 +3773,7 @@ DebuggerParseEventsModificationFromUsermode(PDEBUGGER_MODIFY_EVENTS DebuggerEven
 //   LogConfiguration.LogMask                                 = 0x1;
 //   LogConfiguration.LogValue                                = 0x4;
 //
-//   DebuggerAddActionToEvent(Event1, RUN_SCRIPT, TRUE, NULL, &LogConfiguration);
+//   DebuggerAddActionToEvent(Event1, RUN_SCRIPT, TRUE, NULL, &LogConfiguration, NULL);
 //
 //   //
 //   // Add action for RUN_CUSTOM_CODE
@@ -3309,7 +3794,7 @@ DebuggerParseEventsModificationFromUsermode(PDEBUGGER_MODIFY_EVENTS DebuggerEven
 //   CustomCode.CustomCodeBufferAddress     = CustomCodeBuffer;
 //   CustomCode.OptionalRequestedBufferSize = 0x100;
 //
-//   DebuggerAddActionToEvent(Event1, RUN_CUSTOM_CODE, TRUE, &CustomCode, NULL);
+//   DebuggerAddActionToEvent(Event1, RUN_CUSTOM_CODE, TRUE, &CustomCode, NULL, NULL);
 //
 //   //
 //   // Add action for BREAK_TO_DEBUGGER
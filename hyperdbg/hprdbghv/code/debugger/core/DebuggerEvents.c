@@ -57,13 +57,17 @@ DebuggerEventDisableMovToCr3ExitingOnAllProcessors()
 
 /**
  * @brief routines to generally handle breakpoint hit for detour 
+ * @details The entry stub of each hook passes its details, so there
+ * is no need to translate the address or search for the hook
  * 
- * @return PVOID 
+ * @param Regs Guest registers
+ * @param DetourDetails The details of the hook that is triggered
+ * 
+ * @return PVOID The address that the guest should continue from
  */
 PVOID
-DebuggerEventEptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFrom)
+DebuggerEventEptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PHIDDEN_HOOKS_DETOUR_DETAILS DetourDetails)
 {
-    PLIST_ENTRY                 TempList    = 0;
     EPT_HOOKS_TEMPORARY_CONTEXT TempContext = {0};
 
     //
@@ -85,42 +89,33 @@ DebuggerEventEptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFro
     //
 
     //
-    // Create temporary context
+    // The hook might be removed while this thread was in the entry stub,
+    // the details and the trampoline are still valid, so just continue
+    // the original function
     //
-    TempContext.VirtualAddress  = CalledFrom;
-    TempContext.PhysicalAddress = VirtualAddressToPhysicalAddress(CalledFrom);
+    if (DetourDetails->IsRemoved)
+    {
+        return DetourDetails->ReturnAddress;
+    }
 
     //
-    // As the context to event trigger, we send the address of function
-    // which is current hidden hook is triggered for it
+    // Create temporary context, the physical address is computed
+    // when the hook is applied
     //
-    DebuggerTriggerEvents(HIDDEN_HOOK_EXEC_DETOURS, Regs, &TempContext);
+    TempContext.VirtualAddress  = DetourDetails->HookedFunctionAddress;
+    TempContext.PhysicalAddress = DetourDetails->HookedFunctionPhysicalAddress;
 
     //
-    // Iterate through the list of hooked pages details to find
-    // and return where want to jump after this functions
+    // As the context to event trigger, we send the address of function
+    // which is current hidden hook is triggered for it
     //
-    TempList = &g_EptHook2sDetourListHead;
-
-    while (&g_EptHook2sDetourListHead != TempList->Flink)
-    {
-        TempList                                          = TempList->Flink;
-        PHIDDEN_HOOKS_DETOUR_DETAILS CurrentHookedDetails = CONTAINING_RECORD(TempList, HIDDEN_HOOKS_DETOUR_DETAILS, OtherHooksList);
-
-        if (CurrentHookedDetails->HookedFunctionAddress == CalledFrom)
-        {
-            return CurrentHookedDetails->ReturnAddress;
-        }
-    }
+    DebuggerTriggerEvents(HIDDEN_HOOK_EXEC_DETOURS, Regs, &TempContext);
 
     //
-    // If we reach here, means that we didn't find the return address
-    // that's an error, generally we can't do anything but as the user
-    // might already cleaned the hook and the structures are removed
-    // so we just return the original caller address and continue the
-    // guest normally
+    // Return to the trampoline (the original instructions of the
+    // hooked function)
     //
-    return CalledFrom;
+    return DetourDetails->ReturnAddress;
 }
 
 /**
@@ -120,7 +120,12 @@ TerminateHiddenHookReadAndWriteEvent(PDEBUGGER_EVENT Event)
 
     for (size_t i = 0; i <= PagesBytes / PAGE_SIZE; i++)
     {
-        EptHookUnHookSingleAddress((UINT64)TempOptionalParam1 + (i * PAGE_SIZE), NULL, Event->ProcessId);
+        //
+        // The page is unhooked only if there is no other monitor on it
+        //
+        EptHookUnHookSingleAddressMonitor((UINT64)TempOptionalParam1 + (i * PAGE_SIZE),
+                                          Event->Tag,
+                                          Event->ProcessId);
     }
 }
 
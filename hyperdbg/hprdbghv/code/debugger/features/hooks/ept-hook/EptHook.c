@@ -593,69 +593,64 @@ EptHookRestoreAllHooksToOrginalEntry()
  * @return VOID 
  */
 VOID
-EptHookWriteAbsoluteJump(PCHAR TargetBuffer, SIZE_T TargetAddress)
+EptHookWriteAbsoluteJump2(PCHAR TargetBuffer, SIZE_T TargetAddress)
 {
-    //
-    // call $ + 5 ; A 64-bit call instruction is still 5 bytes wide!
-    //
-
-    TargetBuffer[0] = 0xe8;
-    TargetBuffer[1] = 0x00;
-    TargetBuffer[2] = 0x00;
-    TargetBuffer[3] = 0x00;
-    TargetBuffer[4] = 0x00;
-
     //
     // push Lower 4-byte TargetAddress
     //
-    TargetBuffer[5] = 0x68;
+    TargetBuffer[0] = 0x68;
 
     //
     // Lower 4-byte TargetAddress
     //
-    *((PUINT32)&TargetBuffer[6]) = (UINT32)TargetAddress;
+    *((PUINT32)&TargetBuffer[1]) = (UINT32)TargetAddress;
 
     //
     // mov [rsp+4],High 4-byte TargetAddress
     //
-    TargetBuffer[10] = 0xC7;
-    TargetBuffer[11] = 0x44;
-    TargetBuffer[12] = 0x24;
-    TargetBuffer[13] = 0x04;
+    TargetBuffer[5] = 0xC7;
+    TargetBuffer[6] = 0x44;
+    TargetBuffer[7] = 0x24;
+    TargetBuffer[8] = 0x04;
 
     //
     // High 4-byte TargetAddress
     //
-    *((PUINT32)&TargetBuffer[14]) = (UINT32)(TargetAddress >> 32);
+    *((PUINT32)&TargetBuffer[9]) = (UINT32)(TargetAddress >> 32);
 
     //
     // ret
     //
-    TargetBuffer[18] = 0xC3;
+    TargetBuffer[13] = 0xC3;
 }
 
 /**
- * @brief Write an absolute x64 jump to an arbitrary address to a buffer
+ * @brief Write the entry stub of a detour hook to a buffer
+ * @details The stub pushes the address of the details of the hook and
+ * jumps to the hook function, the hook function should replace the pushed
+ * value with the address that it wants to continue (the trampoline) and
+ * return to it
  * 
  * @param TargetBuffer 
- * @param TargetAddress 
+ * @param DetourDetails 
+ * @param HookFunction 
  * @return VOID 
  */
 VOID
-EptHookWriteAbsoluteJump2(PCHAR TargetBuffer, SIZE_T TargetAddress)
+EptHookWriteDetourEntryStub(PCHAR TargetBuffer, PHIDDEN_HOOKS_DETOUR_DETAILS DetourDetails, SIZE_T HookFunction)
 {
     //
-    // push Lower 4-byte TargetAddress
+    // push Lower 4-byte DetourDetails
     //
     TargetBuffer[0] = 0x68;
 
     //
-    // Lower 4-byte TargetAddress
+    // Lower 4-byte DetourDetails
     //
-    *((PUINT32)&TargetBuffer[1]) = (UINT32)TargetAddress;
+    *((PUINT32)&TargetBuffer[1]) = (UINT32)DetourDetails;
 
     //
-    // mov [rsp+4],High 4-byte TargetAddress
+    // mov [rsp+4],High 4-byte DetourDetails
     //
     TargetBuffer[5] = 0xC7;
     TargetBuffer[6] = 0x44;
@@ -663,14 +658,14 @@ EptHookWriteAbsoluteJump2(PCHAR TargetBuffer, SIZE_T TargetAddress)
     TargetBuffer[8] = 0x04;
 
     //
-    // High 4-byte TargetAddress
+    // High 4-byte DetourDetails
     //
-    *((PUINT32)&TargetBuffer[9]) = (UINT32)(TargetAddress >> 32);
+    *((PUINT32)&TargetBuffer[9]) = (UINT32)((UINT64)DetourDetails >> 32);
 
     //
-    // ret
+    // Jump to the hook function
     //
-    TargetBuffer[13] = 0xC3;
+    EptHookWriteAbsoluteJump2(&TargetBuffer[13], HookFunction);
 }
 
 /**
@@ -694,6 +689,7 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     SIZE_T                       SizeOfHookedInstructions;
     SIZE_T                       OffsetIntoPage;
     CR3_TYPE                     Cr3OfCurrentProcess;
+    PCHAR                        EntryStub;
 
     OffsetIntoPage = ADDRMASK_EPT_PML1_OFFSET((SIZE_T)TargetFunction);
 
@@ -703,7 +699,7 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     // LogInfo("OffsetIntoPage: 0x%llx", OffsetIntoPage);
     //
 
-    if ((OffsetIntoPage + 19) > PAGE_SIZE - 1)
+    if ((OffsetIntoPage + EPT_HOOK2_ABSOLUTE_JUMP_SIZE) > PAGE_SIZE - 1)
     {
         LogError("Err, function extends past a page boundary");
         return FALSE;
@@ -713,7 +709,7 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     // Determine the number of instructions necessary to overwrite using Length Disassembler Engine
     //
     for (SizeOfHookedInstructions = 0;
-         SizeOfHookedInstructions < 19;
+         SizeOfHookedInstructions < EPT_HOOK2_ABSOLUTE_JUMP_SIZE;
          SizeOfHookedInstructions += ldisasm(((UINT64)TargetFunctionInSafeMemory + SizeOfHookedInstructions), TRUE))
     {
         //
@@ -791,9 +787,25 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     // function that changes the original function and if our structure is no ready after this
     // function then we probably see BSOD on other cores
     //
-    DetourHookDetails                        = PoolManagerRequestPool(DETOUR_HOOK_DETAILS, TRUE, sizeof(HIDDEN_HOOKS_DETOUR_DETAILS));
+    DetourHookDetails = PoolManagerRequestPool(DETOUR_HOOK_DETAILS, TRUE, sizeof(HIDDEN_HOOKS_DETOUR_DETAILS));
+
+    if (!DetourHookDetails)
+    {
+        PoolManagerFreePool(Hook->Trampoline);
+
+        LogError("Err, could not allocate the detour hook details");
+        return FALSE;
+    }
+
     DetourHookDetails->HookedFunctionAddress = TargetFunction;
     DetourHookDetails->ReturnAddress         = Hook->Trampoline;
+    DetourHookDetails->IsRemoved             = FALSE;
+
+    //
+    // The physical address is computed once here, so the hook function
+    // won't translate it each time the hooked function is called
+    //
+    DetourHookDetails->HookedFunctionPhysicalAddress = Hook->PhysicalBaseAddress + OffsetIntoPage;
 
     //
     // Save the address of DetourHookDetails because we want to
@@ -807,9 +819,16 @@ EptHookInstructionMemory(PEPT_HOOKED_PAGE_DETAIL Hook,
     InsertHeadList(&g_EptHook2sDetourListHead, &(DetourHookDetails->OtherHooksList));
 
     //
-    // Write the absolute jump to our shadow page memory to jump to our hook
+    // Write the entry stub after the jump back to the original function, the
+    // stub passes the details of this hook to the hook function
     //
-    EptHookWriteAbsoluteJump(&Hook->FakePageContents[OffsetIntoPage], (SIZE_T)HookFunction);
+    EntryStub = &Hook->Trampoline[SizeOfHookedInstructions + EPT_HOOK2_ABSOLUTE_JUMP_SIZE];
+    EptHookWriteDetourEntryStub(EntryStub, DetourHookDetails, (SIZE_T)HookFunction);
+
+    //
+    // Write the absolute jump to our shadow page memory to jump to the entry stub
+    //
+    EptHookWriteAbsoluteJump2(&Hook->FakePageContents[OffsetIntoPage], (SIZE_T)EntryStub);
 
     return TRUE;
 }
@@ -895,6 +914,17 @@ EptHookPerformPageHook2(PVOID    TargetAddress,
 
         if (HookedEntry->PhysicalBaseAddress == PhysicalBaseAddress)
         {
+            //
+            // Multiple monitors (read/write) can share a single page as
+            // they apply the same permissions, the range of each monitor
+            // is added to the page separately
+            //
+            if (HookFunction == NULL && !UnsetExecute && HookedEntry->CountOfMonitorRanges != 0 &&
+                !HookedEntry->IsExecutionHook && !HookedEntry->IsHiddenBreakpoint)
+            {
+                return TRUE;
+            }
+
             //
             // Means that we find the address and !epthook2 doesn't support
             // multiple breakpoints in on page
@@ -1215,6 +1245,316 @@ EptHook2(PVOID TargetAddress, PVOID HookFunction, UINT32 ProcessId, BOOLEAN SetH
     return FALSE;
 }
 
+/**
+ * @brief Sort the monitor ranges based on their start offset and
+ * merge the overlapping (or adjacent) ranges
+ *
+ * @param Ranges The ranges, the merged ranges are stored at the start
+ * @param Count Count of the ranges
+ * @return UINT32 Count of the merged ranges
+ */
+static UINT32
+EptHookSortAndMergeMonitorRanges(PEPT_HOOKED_PAGE_MONITOR_RANGE Ranges, UINT32 Count)
+{
+    EPT_HOOKED_PAGE_MONITOR_RANGE Temp;
+    UINT32                        MergedCount = 0;
+    UINT32                        j;
+
+    //
+    // Insertion sort, there are only a few ranges on a page
+    //
+    for (UINT32 i = 1; i < Count; i++)
+    {
+        Temp = Ranges[i];
+        j    = i;
+
+        while (j > 0 && Ranges[j - 1].StartOffset > Temp.StartOffset)
+        {
+            Ranges[j] = Ranges[j - 1];
+            j--;
+        }
+
+        Ranges[j] = Temp;
+    }
+
+    //
+    // Merge the overlapping ranges
+    //
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        if (MergedCount != 0 && Ranges[i].StartOffset <= Ranges[MergedCount - 1].EndOffset)
+        {
+            if (Ranges[i].EndOffset > Ranges[MergedCount - 1].EndOffset)
+            {
+                Ranges[MergedCount - 1].EndOffset = Ranges[i].EndOffset;
+            }
+        }
+        else
+        {
+            Ranges[MergedCount++] = Ranges[i];
+        }
+    }
+
+    return MergedCount;
+}
+
+/**
+ * @brief Search an offset in sorted and merged monitor ranges
+ *
+ * @param Ranges The sorted and merged ranges
+ * @param Count Count of the ranges
+ * @param Offset The offset in the page
+ * @return BOOLEAN Returns TRUE if the offset is in one of the ranges
+ */
+static BOOLEAN
+EptHookSearchMonitorRanges(PEPT_HOOKED_PAGE_MONITOR_RANGE Ranges, UINT32 Count, UINT16 Offset)
+{
+    UINT32 Low  = 0;
+    UINT32 High = Count;
+    UINT32 Middle;
+
+    //
+    // Find the first range that starts after the offset
+    //
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (Ranges[Middle].StartOffset <= Offset)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    //
+    // The previous range is the only candidate
+    //
+    return Low != 0 && Offset < Ranges[Low - 1].EndOffset;
+}
+
+/**
+ * @brief Check whether an offset of a hooked page is monitored or not
+ * @details The index is sorted and its ranges are not overlapping, so
+ * a binary search is enough, if there is no range (e.g., the page is
+ * monitored without an event) then all the offsets are considered as
+ * monitored
+ *
+ * @param HookedEntry The entry that describes the hooked page
+ * @param Offset The offset of the access in the page
+ * @return BOOLEAN Returns TRUE if the offset is in one of the ranges
+ */
+static BOOLEAN
+EptHookIsOffsetInMonitorRanges(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT16 Offset)
+{
+    PEPT_HOOKED_PAGE_MONITOR_RANGES_INDEX Index;
+    LONG                                  Generation;
+    BOOLEAN                               Result;
+
+    for (;;)
+    {
+        Index = HookedEntry->MonitorRangesIndex;
+
+        if (Index == NULL)
+        {
+            return TRUE;
+        }
+
+        //
+        // The index is being rebuilt (it was switched and then reused)
+        //
+        Generation = Index->Generation;
+
+        if (Generation & 1)
+        {
+            _mm_pause();
+            continue;
+        }
+
+        KeMemoryBarrier();
+
+        Result = Index->Count == 0 || EptHookSearchMonitorRanges(Index->Ranges, Index->Count, Offset);
+
+        KeMemoryBarrier();
+
+        //
+        // Check whether the index is changed while we read it
+        //
+        if (Index->Generation == Generation)
+        {
+            return Result;
+        }
+    }
+}
+
+/**
+ * @brief Rebuild the index of monitor ranges of a hooked page
+ * @details The ranges are sorted based on their start offset
+ * and then overlapping (or adjacent) ranges are merged, the index
+ * is built in the buffer that is not used by the vmx-root readers
+ * and then it's switched
+ *
+ * @param HookedEntry The entry that describes the hooked page
+ * @return VOID
+ */
+static VOID
+EptHookRebuildMonitorRangesIndex(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
+{
+    EPT_HOOKED_PAGE_MONITOR_RANGE         Ranges[MaximumMonitorRangesOnPage];
+    PEPT_HOOKED_PAGE_MONITOR_RANGES_INDEX Index;
+    UINT32                                IndexCount;
+
+    RtlCopyMemory(Ranges, HookedEntry->MonitorRanges, HookedEntry->CountOfMonitorRanges * sizeof(EPT_HOOKED_PAGE_MONITOR_RANGE));
+
+    IndexCount = EptHookSortAndMergeMonitorRanges(Ranges, HookedEntry->CountOfMonitorRanges);
+
+    //
+    // Build the new index in the buffer that is not used, a reader might
+    // still be in the previous (now unused) buffer, so the generation of
+    // the buffer is odd while it's being written
+    //
+    Index = HookedEntry->MonitorRangesIndex == &HookedEntry->MonitorRangesIndexBuffers[0] ? &HookedEntry->MonitorRangesIndexBuffers[1] : &HookedEntry->MonitorRangesIndexBuffers[0];
+
+    InterlockedIncrement(&Index->Generation);
+
+    RtlCopyMemory(Index->Ranges, Ranges, IndexCount * sizeof(EPT_HOOKED_PAGE_MONITOR_RANGE));
+    Index->Count = IndexCount;
+
+    InterlockedIncrement(&Index->Generation);
+
+    //
+    // Apply the new index
+    //
+    InterlockedExchangePointer((PVOID volatile *)&HookedEntry->MonitorRangesIndex, Index);
+}
+
+/**
+ * @brief Compute the part of a monitored range which is on a page
+ *
+ * @param PageAddress Address of the page
+ * @param FromAddress Start address of the monitored range
+ * @param ToAddress End address of the monitored range (not included)
+ * @param Range The computed range
+ * @return BOOLEAN Returns FALSE if the range has no byte on the page
+ */
+static BOOLEAN
+EptHookCalcMonitorRangeOfPage(UINT64                         PageAddress,
+                              UINT64                         FromAddress,
+                              UINT64                         ToAddress,
+                              PEPT_HOOKED_PAGE_MONITOR_RANGE Range)
+{
+    UINT64 PageStart = PAGE_ALIGN(PageAddress);
+    UINT64 PageEnd   = PageStart + PAGE_SIZE;
+
+    FromAddress = FromAddress > PageStart ? FromAddress : PageStart;
+    ToAddress   = ToAddress < PageEnd ? ToAddress : PageEnd;
+
+    if (FromAddress >= ToAddress)
+    {
+        return FALSE;
+    }
+
+    Range->StartOffset = (UINT16)(FromAddress - PageStart);
+    Range->EndOffset   = (UINT16)(ToAddress - PageStart);
+
+    return TRUE;
+}
+
+/**
+ * @brief Check the sort, merge and search of the monitor ranges
+ * @details used by the kernel-side tests, no page is hooked
+ *
+ * @return BOOLEAN Returns TRUE if the results were as expected
+ */
+BOOLEAN
+EptHookPerformMonitorRangesSelfCheck()
+{
+    EPT_HOOKED_PAGE_MONITOR_RANGE Range;
+    UINT32                        Count;
+    EPT_HOOKED_PAGE_MONITOR_RANGE Ranges[] = {
+        {0x800, 0x900}, // merged with the next range as they're adjacent
+        {0x900, 0x910},
+        {0x10, 0x20},
+        {0x18, 0x30}, // overlaps with the previous range
+        {0x40, 0x41},
+        {0x850, 0x860}, // completely inside another range
+    };
+
+    Count = EptHookSortAndMergeMonitorRanges(Ranges, sizeof(Ranges) / sizeof(Ranges[0]));
+
+    if (Count != 3 ||
+        Ranges[0].StartOffset != 0x10 || Ranges[0].EndOffset != 0x30 ||
+        Ranges[1].StartOffset != 0x40 || Ranges[1].EndOffset != 0x41 ||
+        Ranges[2].StartOffset != 0x800 || Ranges[2].EndOffset != 0x910)
+    {
+        return FALSE;
+    }
+
+    //
+    // The start offsets are included and the end offsets are not
+    //
+    if (EptHookSearchMonitorRanges(Ranges, Count, 0xf) ||
+        !EptHookSearchMonitorRanges(Ranges, Count, 0x10) ||
+        !EptHookSearchMonitorRanges(Ranges, Count, 0x2f) ||
+        EptHookSearchMonitorRanges(Ranges, Count, 0x30) ||
+        !EptHookSearchMonitorRanges(Ranges, Count, 0x40) ||
+        EptHookSearchMonitorRanges(Ranges, Count, 0x41) ||
+        !EptHookSearchMonitorRanges(Ranges, Count, 0x90f) ||
+        EptHookSearchMonitorRanges(Ranges, Count, 0x910) ||
+        EptHookSearchMonitorRanges(Ranges, Count, 0xfff))
+    {
+        return FALSE;
+    }
+
+    //
+    // Ranges are clipped to the page
+    //
+    if (!EptHookCalcMonitorRangeOfPage(0x10000, 0xff80, 0x10010, &Range) ||
+        Range.StartOffset != 0 || Range.EndOffset != 0x10 ||
+        !EptHookCalcMonitorRangeOfPage(0x10000, 0x10ff0, 0x11010, &Range) ||
+        Range.StartOffset != 0xff0 || Range.EndOffset != PAGE_SIZE ||
+        EptHookCalcMonitorRangeOfPage(0x10000, 0x11000, 0x11010, &Range))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the entry of a hooked page by its virtual address
+ *
+ * @param PageAddress Virtual address of the page
+ * @param ProcessId The process id of target process
+ * @return PEPT_HOOKED_PAGE_DETAIL Returns NULL if the page is not hooked
+ */
+static PEPT_HOOKED_PAGE_DETAIL
+EptHookFindMonitorPage(UINT64 PageAddress, UINT32 ProcessId)
+{
+    SIZE_T PhysicalAddress;
+
+    if (ProcessId == DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES || ProcessId == 0)
+    {
+        ProcessId = PsGetCurrentProcessId();
+    }
+
+    PhysicalAddress = PAGE_ALIGN(VirtualAddressToPhysicalAddressByProcessId(PageAddress, ProcessId));
+
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
+    {
+        if (CurrEntity->PhysicalBaseAddress == PhysicalAddress &&
+            !CurrEntity->IsExecutionHook && !CurrEntity->IsHiddenBreakpoint)
+        {
+            return CurrEntity;
+        }
+    }
+
+    return NULL;
+}
+
 /**
  * @brief Handles page hooks
  * 
@@ -1254,12 +1594,23 @@ EptHookHandleHookedPage(PGUEST_REGS                          Regs,
     TemporaryContext.PhysicalAddress = PhysicalAddress;
     TemporaryContext.VirtualAddress  = ExactAccessedVirtualAddress;
 
+    //
+    // Check whether the accessed offset is in any of the monitored ranges of this
+    // page, if not, there is no need to search the events, but the access is still
+    // handled (the entry is restored after the current instruction)
+    //
+    if (!HookedEntryDetails->IsExecutionHook &&
+        !EptHookIsOffsetInMonitorRanges(HookedEntryDetails, (UINT16)PAGE_OFFSET(PhysicalAddress)))
+    {
+        return TRUE;
+    }
+
     if (!ViolationQualification.EptExecutable && ViolationQualification.ExecuteAccess)
     {
         //
         // Reading guest's RIP
         //
-        __vmx_vmread(VMCS_GUEST_RIP, &GuestRip);
+        GuestRip = VmcsCacheRead(VMCS_GUEST_RIP);
 
         //
         // Generally, we should never reach here, we didn't implement HyperDbg like this ;)
@@ -1327,11 +1678,15 @@ EptHookHandleHookedPage(PGUEST_REGS                          Regs,
 /**
  * @brief Remove the enrty from g_EptHook2sDetourListHead in the case
  * of !epthook2 details
+ * @details The details are not freed, as the entry stub in the trampoline
+ * (which is not freed either) passes them to the hook function, so they're
+ * only marked as removed and freed when the pools are uninitialized
+ *
  * @param Address Address to remove
  * @return BOOLEAN TRUE if successfully removed and false if not found 
  */
 BOOLEAN
-EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(UINT64 Address)
+EptHookRemoveEntryFromEptHook2sDetourList(UINT64 Address)
 {
     //
     // Iterate through the list of hooked pages details to find
@@ -1342,18 +1697,14 @@ EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(UINT64 Address)
         if (CurrentHookedDetails->HookedFunctionAddress == Address)
         {
             //
-            // We found the address, we should remove it and add it for
-            // future deallocation
+            // We found the address, we should remove it and mark it as
+            // removed, so the threads that are still in the entry stub
+            // won't trigger the events
             //
             RemoveEntryList(&CurrentHookedDetails->OtherHooksList);
 
-            //
-            // Free the pool in next ioctl
-            //
-            if (!PoolManagerFreePool(CurrentHookedDetails))
-            {
-                LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
-            }
+            CurrentHookedDetails->IsRemoved = TRUE;
+
             return TRUE;
         }
     }
@@ -1415,7 +1766,7 @@ EptHookUnHookSingleAddressDetours(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
     // Now that we removed this hidden detours hook, it is
     // time to remove it from g_EptHook2sDetourListHead
     //
-    EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(HookedEntry->VirtualAddress);
+    EptHookRemoveEntryFromEptHook2sDetourList(HookedEntry->VirtualAddress);
 
     //
     // remove the entry from the list
@@ -1637,6 +1988,111 @@ EptHookUnHookSingleAddress(UINT64 VirtualAddress, UINT64 PhysAddress, UINT32 Pro
     return FALSE;
 }
 
+/**
+ * @brief Add the part of a monitored range which is on a page to the
+ * hooked page
+ * @details Should be called from vmx non-root after hooking the page
+ *
+ * @param PageAddress Virtual address of the hooked page
+ * @param FromAddress Start address of the monitored range
+ * @param ToAddress End address of the monitored range (not included)
+ * @param Tag Tag of the event that monitors the range
+ * @param ProcessId The process id of target process
+ * @return BOOLEAN Returns FALSE if there are too many monitors on the page
+ */
+BOOLEAN
+EptHookAddMonitorRange(UINT64 PageAddress, UINT64 FromAddress, UINT64 ToAddress, UINT64 Tag, UINT32 ProcessId)
+{
+    EPT_HOOKED_PAGE_MONITOR_RANGE Range;
+    PEPT_HOOKED_PAGE_DETAIL       HookedEntry;
+
+    if (!EptHookCalcMonitorRangeOfPage(PageAddress, FromAddress, ToAddress, &Range))
+    {
+        //
+        // Nothing from this range is on the page
+        //
+        return TRUE;
+    }
+
+    HookedEntry = EptHookFindMonitorPage(PageAddress, ProcessId);
+
+    if (HookedEntry == NULL)
+    {
+        return FALSE;
+    }
+
+    if (HookedEntry->CountOfMonitorRanges >= MaximumMonitorRangesOnPage)
+    {
+        DebuggerSetLastError(DEBUGGER_ERROR_EPT_MULTIPLE_HOOKS_IN_A_SINGLE_PAGE);
+        return FALSE;
+    }
+
+    HookedEntry->MonitorRanges[HookedEntry->CountOfMonitorRanges]     = Range;
+    HookedEntry->MonitorRangesTags[HookedEntry->CountOfMonitorRanges] = Tag;
+    HookedEntry->CountOfMonitorRanges++;
+
+    EptHookRebuildMonitorRangesIndex(HookedEntry);
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove the monitored range of an event which is on a page and 
+ * unhook the page if no other monitor is on the page
+ * @details Should be called from vmx non-root, the range is found by the
+ * tag of its event as other events might monitor the same range
+ *
+ * @param PageAddress Virtual address of the hooked page
+ * @param Tag Tag of the event that monitors the range
+ * @param ProcessId The process id of target process
+ * @return BOOLEAN If unhook was successful it returns true or if it was not successful returns false
+ */
+BOOLEAN
+EptHookUnHookSingleAddressMonitor(UINT64 PageAddress, UINT64 Tag, UINT32 ProcessId)
+{
+    PEPT_HOOKED_PAGE_DETAIL HookedEntry;
+
+    //
+    // Should be called from vmx non-root
+    //
+    if (GetCurrentVmxExecutionMode() == VmxExecutionModeRoot)
+    {
+        return FALSE;
+    }
+
+    HookedEntry = EptHookFindMonitorPage(PageAddress, ProcessId);
+
+    if (HookedEntry == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < HookedEntry->CountOfMonitorRanges; i++)
+    {
+        if (HookedEntry->MonitorRangesTags[i] == Tag)
+        {
+            //
+            // Replace it with the last range
+            //
+            HookedEntry->CountOfMonitorRanges--;
+            HookedEntry->MonitorRanges[i]     = HookedEntry->MonitorRanges[HookedEntry->CountOfMonitorRanges];
+            HookedEntry->MonitorRangesTags[i] = HookedEntry->MonitorRangesTags[HookedEntry->CountOfMonitorRanges];
+            break;
+        }
+    }
+
+    if (HookedEntry->CountOfMonitorRanges != 0)
+    {
+        //
+        // Other monitors still use this page
+        //
+        EptHookRebuildMonitorRangesIndex(HookedEntry);
+        return TRUE;
+    }
+
+    return EptHookUnHookSingleAddressDetours(HookedEntry);
+}
+
 /**
  * @brief Remove all hooks from the hooked pages list and invalidate TLB
  * @detailsShould be called from Vmx Non-root
@@ -1674,7 +2130,7 @@ EptHookUnHookAll()
         //
         if (!CurrEntity->IsHiddenBreakpoint)
         {
-            EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(CurrEntity->VirtualAddress);
+            EptHookRemoveEntryFromEptHook2sDetourList(CurrEntity->VirtualAddress);
         }
 
         //
@@ -122,17 +122,17 @@ SyscallHookEmulateSYSCALL(PGUEST_REGS Regs)
     //
     // Reading guest's RIP
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &GuestRip);
+    GuestRip = VmcsCacheRead(VMCS_GUEST_RIP);
 
     //
     // Reading instruction length
     //
-    __vmx_vmread(VMCS_VMEXIT_INSTRUCTION_LENGTH, &InstructionLength);
+    InstructionLength = (UINT32)VmcsCacheRead(VMCS_VMEXIT_INSTRUCTION_LENGTH);
 
     //
     // Reading guest's Rflags
     //
-    __vmx_vmread(VMCS_GUEST_RFLAGS, &GuestRflags);
+    GuestRflags = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
     //
     // Save the address of the instruction following SYSCALL into RCX and then
@@ -141,7 +141,7 @@ SyscallHookEmulateSYSCALL(PGUEST_REGS Regs)
     MsrValue  = __readmsr(IA32_LSTAR);
     Regs->rcx = GuestRip + InstructionLength;
     GuestRip  = MsrValue;
-    __vmx_vmwrite(VMCS_GUEST_RIP, GuestRip);
+    VmcsCacheWrite(VMCS_GUEST_RIP, GuestRip);
 
     //
     // Save RFLAGS into R11 and then mask RFLAGS using IA32_FMASK
@@ -149,7 +149,7 @@ SyscallHookEmulateSYSCALL(PGUEST_REGS Regs)
     MsrValue  = __readmsr(IA32_FMASK);
     Regs->r11 = GuestRflags;
     GuestRflags &= ~(MsrValue | X86_FLAGS_RF);
-    __vmx_vmwrite(VMCS_GUEST_RFLAGS, GuestRflags);
+    VmcsCacheWrite(VMCS_GUEST_RFLAGS, GuestRflags);
 
     //
     // Load the CS and SS selectors with values derived from bits 47:32 of IA32_STAR
@@ -189,13 +189,13 @@ SyscallHookEmulateSYSRET(PGUEST_REGS Regs)
     // Load RIP from RCX
     //
     GuestRip = Regs->rcx;
-    __vmx_vmwrite(VMCS_GUEST_RIP, GuestRip);
+    VmcsCacheWrite(VMCS_GUEST_RIP, GuestRip);
 
     //
     // Load RFLAGS from R11. Clear RF, VM, reserved bits
     //
     GuestRflags = (Regs->r11 & ~(X86_FLAGS_RF | X86_FLAGS_VM | X86_FLAGS_RESERVED_BITS)) | X86_FLAGS_FIXED;
-    __vmx_vmwrite(VMCS_GUEST_RFLAGS, GuestRflags);
+    VmcsCacheWrite(VMCS_GUEST_RFLAGS, GuestRflags);
 
     //
     // SYSRET loads the CS and SS selectors with values derived from bits 63:48 of IA32_STAR
@@ -236,7 +236,7 @@ SyscallHookHandleUD(PGUEST_REGS Regs, UINT32 CoreIndex)
     //
     // Reading guest's RIP
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &Rip);
+    Rip = VmcsCacheRead(VMCS_GUEST_RIP);
 
     if (g_IsUnsafeSyscallOrSysretHandling)
     {
@@ -346,9 +346,13 @@ EmulateSYSRET:
     //
 
     //
-    // We should trigger the event of SYSRET here
+    // We should trigger the event of SYSRET here, if there is an
+    // event for the current process
     //
-    DebuggerTriggerEvents(SYSCALL_HOOK_EFER_SYSRET, Regs, Rip);
+    if (SyscallHookFilterIsMatched(SYSCALL_HOOK_EFER_SYSRET, 0))
+    {
+        DebuggerTriggerEvents(SYSCALL_HOOK_EFER_SYSRET, Regs, Rip);
+    }
 
     Result                       = SyscallHookEmulateSYSRET(Regs);
     CurrentVmState->IncrementRip = FALSE;
@@ -368,9 +372,13 @@ EmulateSYSCALL:
 
     //
     // We should trigger the event of SYSCALL here, we send the
-    // syscall number in rax
+    // syscall number in rax, syscalls that are not needed by any
+    // event are just emulated
     //
-    DebuggerTriggerEvents(SYSCALL_HOOK_EFER_SYSCALL, Regs, Regs->rax);
+    if (SyscallHookFilterIsMatched(SYSCALL_HOOK_EFER_SYSCALL, Regs->rax))
+    {
+        DebuggerTriggerEvents(SYSCALL_HOOK_EFER_SYSCALL, Regs, Regs->rax);
+    }
 
     Result = SyscallHookEmulateSYSCALL(Regs);
 
@@ -0,0 +1,297 @@
+/**
+ * @file SyscallFilter.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Filter of EFER syscall and sysret hooks
+ * @details The registered !syscall and !sysret events are compiled to a
+ * bitmap of syscall numbers and a set of process ids, the #UD handler
+ * checks the filter and only triggers the events if the syscall might be
+ * needed by an event, other syscalls are just emulated
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the buffers of the syscall filter
+ * @details should NOT be called in vmx-root
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallHookFilterInitialize()
+{
+    //
+    // Two filters are allocated, one of them is used by the vmx-root
+    // and the other one is built when events are changed
+    //
+    g_SyscallHookFilterBuffers = ExAllocatePoolWithTag(NonPagedPool, 2 * sizeof(SYSCALL_HOOK_FILTER), POOLTAG);
+
+    if (g_SyscallHookFilterBuffers == NULL)
+    {
+        return FALSE;
+    }
+
+    RtlZeroMemory(g_SyscallHookFilterBuffers, 2 * sizeof(SYSCALL_HOOK_FILTER));
+
+    g_SyscallHookFilterLock = 0;
+    g_SyscallHookFilter     = &g_SyscallHookFilterBuffers[0];
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the buffers of the syscall filter
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+SyscallHookFilterUninitialize()
+{
+    PSYSCALL_HOOK_FILTER Buffers = g_SyscallHookFilterBuffers;
+
+    //
+    // Without the filter, all of the syscalls are matched
+    //
+    g_SyscallHookFilter        = NULL;
+    g_SyscallHookFilterBuffers = NULL;
+
+    if (Buffers != NULL)
+    {
+        ExFreePoolWithTag(Buffers, POOLTAG);
+    }
+}
+
+/**
+ * @brief Add the process of an event to the filter
+ *
+ * @param Processes Processes of syscall or sysret events
+ * @param ProcessId Process id of the event
+ *
+ * @return VOID
+ */
+VOID
+SyscallHookFilterAddProcess(PSYSCALL_HOOK_FILTER_PROCESSES Processes, UINT32 ProcessId)
+{
+    Processes->HasEvents = TRUE;
+
+    if (Processes->MatchAllProcesses)
+    {
+        return;
+    }
+
+    if (ProcessId == DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES ||
+        Processes->CountOfProcesses == SYSCALL_HOOK_FILTER_MAXIMUM_PROCESSES)
+    {
+        Processes->MatchAllProcesses = TRUE;
+        return;
+    }
+
+    for (UINT32 i = 0; i < Processes->CountOfProcesses; i++)
+    {
+        if (Processes->ProcessIds[i] == ProcessId)
+        {
+            return;
+        }
+    }
+
+    Processes->ProcessIds[Processes->CountOfProcesses] = ProcessId;
+    Processes->CountOfProcesses++;
+}
+
+/**
+ * @brief Check whether the current process is in the processes of the filter
+ *
+ * @param Processes Processes of syscall or sysret events
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SyscallHookFilterIsProcessMatched(PSYSCALL_HOOK_FILTER_PROCESSES Processes)
+{
+    UINT32 ProcessId;
+
+    if (!Processes->HasEvents)
+    {
+        return FALSE;
+    }
+
+    if (Processes->MatchAllProcesses)
+    {
+        return TRUE;
+    }
+
+    ProcessId = (UINT32)PsGetCurrentProcessId();
+
+    //
+    // The count is checked against the maximum as the filter might be
+    // rebuilt while it's read
+    //
+    for (UINT32 i = 0; i < Processes->CountOfProcesses && i < SYSCALL_HOOK_FILTER_MAXIMUM_PROCESSES; i++)
+    {
+        if (Processes->ProcessIds[i] == ProcessId)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Rebuild the syscall filter from the registered events
+ * @details should be called after adding or removing syscall or sysret
+ * events, enabling or disabling events doesn't change the filter
+ *
+ * @return VOID
+ */
+VOID
+SyscallHookFilterUpdate()
+{
+    PSYSCALL_HOOK_FILTER Filter;
+    PLIST_ENTRY          TempList;
+    PDEBUGGER_EVENT      CurrentEvent;
+    UINT64               SyscallNumber;
+
+    if (g_SyscallHookFilterBuffers == NULL)
+    {
+        return;
+    }
+
+    SpinlockLock(&g_SyscallHookFilterLock);
+
+    //
+    // Build the filter in the buffer that is not used by the vmx-root
+    //
+    Filter = g_SyscallHookFilter == &g_SyscallHookFilterBuffers[0] ? &g_SyscallHookFilterBuffers[1] : &g_SyscallHookFilterBuffers[0];
+
+    //
+    // Make the generation odd, so the cores that still read this filter
+    // (from before the previous switch) read the current filter again
+    //
+    InterlockedIncrement(&Filter->Generation);
+
+    RtlZeroMemory(&Filter->SyscallProcesses,
+                  sizeof(SYSCALL_HOOK_FILTER) - FIELD_OFFSET(SYSCALL_HOOK_FILTER, SyscallProcesses));
+
+    for (TempList = g_Events->SyscallHooksEferSyscallEventsHead.Flink;
+         TempList != &g_Events->SyscallHooksEferSyscallEventsHead;
+         TempList = TempList->Flink)
+    {
+        CurrentEvent  = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+        SyscallNumber = CurrentEvent->OptionalParam1;
+
+        SyscallHookFilterAddProcess(&Filter->SyscallProcesses, CurrentEvent->ProcessId);
+
+        if (SyscallNumber == DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS)
+        {
+            Filter->MatchAllSyscallNumbers = TRUE;
+        }
+        else if (SyscallNumber < SYSCALL_HOOK_FILTER_MAXIMUM_SYSCALL_NUMBER)
+        {
+            Filter->SyscallNumbersBitmap[SyscallNumber / 64] |= 1ULL << (SyscallNumber % 64);
+        }
+
+        //
+        // Syscall numbers out of the bitmap are checked by the
+        // triggering routine
+        //
+    }
+
+    for (TempList = g_Events->SyscallHooksEferSysretEventsHead.Flink;
+         TempList != &g_Events->SyscallHooksEferSysretEventsHead;
+         TempList = TempList->Flink)
+    {
+        CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        SyscallHookFilterAddProcess(&Filter->SysretProcesses, CurrentEvent->ProcessId);
+    }
+
+    //
+    // The filter is built, make the generation even and switch the
+    // vmx-root to the new filter
+    //
+    InterlockedIncrement(&Filter->Generation);
+
+    InterlockedExchangePointer((PVOID volatile *)&g_SyscallHookFilter, Filter);
+
+    SpinlockUnlock(&g_SyscallHookFilterLock);
+}
+
+/**
+ * @brief Check whether the events of a syscall or sysret should be triggered
+ * @details should be called in vmx-root
+ *
+ * @param EventType SYSCALL_HOOK_EFER_SYSCALL or SYSCALL_HOOK_EFER_SYSRET
+ * @param SyscallNumber Syscall number (only for syscalls)
+ *
+ * @return BOOLEAN TRUE if the events should be triggered and FALSE if
+ * no event needs it
+ */
+BOOLEAN
+SyscallHookFilterIsMatched(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT64 SyscallNumber)
+{
+    PSYSCALL_HOOK_FILTER Filter;
+    LONG                 Generation;
+    BOOLEAN              Result;
+
+    for (;;)
+    {
+        Filter = g_SyscallHookFilter;
+
+        //
+        // Without the filter, all of the syscalls are matched
+        //
+        if (Filter == NULL)
+        {
+            return TRUE;
+        }
+
+        Generation = Filter->Generation;
+
+        if (Generation & 1)
+        {
+            //
+            // It's a previous filter that is being rebuilt, the current
+            // filter is read again
+            //
+            _mm_pause();
+            continue;
+        }
+
+        KeMemoryBarrier();
+
+        if (EventType == SYSCALL_HOOK_EFER_SYSRET)
+        {
+            Result = SyscallHookFilterIsProcessMatched(&Filter->SysretProcesses);
+        }
+        else if (!Filter->MatchAllSyscallNumbers &&
+                 SyscallNumber < SYSCALL_HOOK_FILTER_MAXIMUM_SYSCALL_NUMBER &&
+                 !(Filter->SyscallNumbersBitmap[SyscallNumber / 64] & (1ULL << (SyscallNumber % 64))))
+        {
+            //
+            // The syscall number is checked first as it doesn't need to
+            // read the current process
+            //
+            Result = FALSE;
+        }
+        else
+        {
+            Result = SyscallHookFilterIsProcessMatched(&Filter->SyscallProcesses);
+        }
+
+        KeMemoryBarrier();
+
+        //
+        // If the filter is not rebuilt while it's read, the result is valid
+        //
+        if (Filter->Generation == Generation)
+        {
+            return Result;
+        }
+    }
+}
@@ -48,6 +48,19 @@ KdInitializeKernelDebugger()
     //
     RtlZeroMemory(&g_IgnoreBreaksToDebugger, sizeof(DEBUGGEE_REQUEST_TO_IGNORE_BREAKS_UNTIL_AN_EVENT));
 
+    //
+    // Halt prefetching is disabled until the debugger sets a profile
+    //
+    RtlZeroMemory(&g_KdHaltPrefetchProfile, sizeof(DEBUGGEE_KD_HALT_PREFETCH_PROFILE));
+
+    //
+    // Allocate the snapshot of processes list (used while the debuggee is halted)
+    //
+    if (!ProcessSnapshotInitialize())
+    {
+        LogError("Err, allocating the snapshot of processes list");
+    }
+
     //
     // Initialize list of breakpoints and breakpoint id
     //
@@ -203,7 +216,7 @@ KdResponsePacketToDebugger(
         // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
         // if not we use the windows spinlock
         //
-        ScopedSpinlock(
+        ScopedTicketSpinlock(
             DebuggerResponseLock,
             Result = SerialConnectionSend((CHAR *)&Packet,
                                           sizeof(DEBUGGER_REMOTE_PACKET)));
@@ -220,7 +233,7 @@ KdResponsePacketToDebugger(
         // if not we use the windows spinlock
         //
 
-        ScopedSpinlock(
+        ScopedTicketSpinlock(
             DebuggerResponseLock,
             Result = SerialConnectionSendTwoBuffers((CHAR *)&Packet,
                                                     sizeof(DEBUGGER_REMOTE_PACKET),
@@ -283,7 +296,7 @@ KdLoggingResponsePacketToDebugger(
     // if not we use the windows spinlock
     //
 
-    ScopedSpinlock(
+    ScopedTicketSpinlock(
         DebuggerResponseLock,
         Result = SerialConnectionSendThreeBuffers((CHAR *)&Packet,
                                                   sizeof(DEBUGGER_REMOTE_PACKET),
@@ -335,11 +348,11 @@ KdHandleDebugEventsWhenKernelDebuggerIsAttached(UINT32 CurrentCore, PGUEST_REGS
         //
         if (CurrentDebuggingState->DisableTrapFlagOnContinue)
         {
-            __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+            Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
             Rflags.TrapFlag = FALSE;
 
-            __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+            VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
             CurrentDebuggingState->DisableTrapFlagOnContinue = FALSE;
         }
@@ -557,7 +570,7 @@ KdContinueDebuggee(UINT32                                  CurrentCore,
         //
         // Check if there is at least an interrupt that needs to be delivered
         //
-        if (CurrentVmState->PendingExternalInterrupts[0] != NULL)
+        if (IdtEmulationIsAnyInterruptPending(CurrentCore))
         {
             //
             // Enable Interrupt-window exiting.
@@ -740,7 +753,7 @@ KdSwitchCore(UINT32 CurrentCore, UINT32 NewCore)
         //
         // Check if there is at least an interrupt that needs to be delivered
         //
-        if (CurrentVmState->PendingExternalInterrupts[0] != NULL)
+        if (IdtEmulationIsAnyInterruptPending(CurrentCore))
         {
             //
             // Enable Interrupt-window exiting.
@@ -1051,6 +1064,11 @@ KdHandleBreakpointAndDebugBreakpoints(UINT32                            CurrentC
     //
     g_DebuggeeHaltReason = Reason;
 
+    //
+    // The memory might be changed since the last halt
+    //
+    g_DebuggeeHaltGeneration++;
+
     //
     // Set the context and tag
     //
@@ -1290,13 +1308,13 @@ KdRegularStepInInstruction(UINT32 CurrentCore)
     //
     if (!CurrentDebuggingState->DisableTrapFlagOnContinue)
     {
-        __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+        Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
         if (Rflags.TrapFlag == FALSE)
         {
             Rflags.TrapFlag = TRUE;
 
-            __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+            VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
             CurrentDebuggingState->DisableTrapFlagOnContinue = TRUE;
         }
@@ -1619,6 +1637,7 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET EventRegPacket;
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET AddActionPacket;
     PDEBUGGER_MODIFY_EVENTS                             QueryAndModifyEventPacket;
+    PDEBUGGEE_KD_HALT_PREFETCH_PROFILE                  HaltPrefetchProfilePacket;
     UINT32                                              SizeToSend         = 0;
     BOOLEAN                                             UnlockTheNewCore   = FALSE;
     size_t                                              ReturnSize         = 0;
@@ -2292,6 +2311,26 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
 
                 break;
 
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SET_HALT_PREFETCH_PROFILE:
+
+                HaltPrefetchProfilePacket = (DEBUGGEE_KD_HALT_PREFETCH_PROFILE *)(((CHAR *)TheActualPacket) +
+                                                                                  sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Set the profile (applied on the next halt)
+                //
+                KdSetHaltPrefetchProfile(HaltPrefetchProfilePacket);
+
+                //
+                // Send the result of setting the profile back to the debuggee
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_SETTING_HALT_PREFETCH_PROFILE,
+                                           HaltPrefetchProfilePacket,
+                                           sizeof(DEBUGGEE_KD_HALT_PREFETCH_PROFILE));
+
+                break;
+
             case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_LIST_OR_MODIFY_BREAKPOINTS:
 
                 BpListOrModifyPacket = (DEBUGGEE_BP_LIST_OR_MODIFY_PACKET *)(((CHAR *)TheActualPacket) +
@@ -2410,6 +2449,167 @@ KdIsGuestOnUsermode32Bit()
     return FALSE;
 }
 
+/**
+ * @brief Set the profile of the state that is prefetched on halts
+ * @param Profile
+ *
+ * @return BOOLEAN
+ */
+_Use_decl_annotations_
+BOOLEAN
+KdSetHaltPrefetchProfile(PDEBUGGEE_KD_HALT_PREFETCH_PROFILE Profile)
+{
+    if (Profile->StackSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE ||
+        Profile->CodeSize > DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE)
+    {
+        Profile->KernelStatus = DEBUGGER_ERROR_INVALID_HALT_PREFETCH_PROFILE;
+        return FALSE;
+    }
+
+    g_KdHaltPrefetchProfile.StackSize = Profile->StackSize;
+    g_KdHaltPrefetchProfile.CodeSize  = Profile->CodeSize;
+    g_KdHaltPrefetchProfile.IsEnabled = Profile->IsEnabled;
+
+    Profile->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the memory of the guest for prefetching
+ * @details If the whole range is not accessible, then only the first
+ * page is read
+ *
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return UINT32 count of bytes that are read
+ */
+static UINT32
+KdHaltPrefetchReadMemory(UINT64 Address, BYTE * Buffer, UINT32 Size)
+{
+    DEBUGGER_READ_MEMORY ReadMem    = {0};
+    SIZE_T               ReturnSize = 0;
+
+    if (Size == 0)
+    {
+        return 0;
+    }
+
+    if (!CheckMemoryAccessSafety(Address, Size))
+    {
+        Size = min(Size, PAGE_SIZE - (Address & (PAGE_SIZE - 1)));
+
+        if (!CheckMemoryAccessSafety(Address, Size))
+        {
+            return 0;
+        }
+    }
+
+    //
+    // Read it the same as the debugger's read memory requests, so the
+    // 0xcc bytes of the 'bp' breakpoints are replaced by the previous bytes
+    //
+    ReadMem.Address    = Address;
+    ReadMem.Size       = Size;
+    ReadMem.MemoryType = DEBUGGER_READ_VIRTUAL_ADDRESS;
+
+    if (!DebuggerCommandReadMemoryVmxRoot(&ReadMem, Buffer, &ReturnSize))
+    {
+        return 0;
+    }
+
+    return (UINT32)ReturnSize;
+}
+
+/**
+ * @brief Send the pausing packet to the debugger
+ * @details If halt prefetching is enabled, the registers, the top of the
+ * stack and the code from RIP are sent in the same packet, so the debugger
+ * won't request them separately
+ *
+ * @param PausePacket
+ * @param GuestRegs
+ *
+ * @return VOID
+ */
+_Use_decl_annotations_
+VOID
+KdSendPausePacket(PDEBUGGEE_KD_PAUSED_PACKET PausePacket, PGUEST_REGS GuestRegs)
+{
+    PDEBUGGEE_KD_HALT_PREFETCHED_STATE PrefetchedState;
+    BYTE *                             PrefetchedBytes;
+
+    if (!g_KdHaltPrefetchProfile.IsEnabled)
+    {
+        KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                   DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
+                                   PausePacket,
+                                   sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+        return;
+    }
+
+    PausePacket->HasPrefetchedState = TRUE;
+
+    memcpy(g_KdHaltPrefetchBuffer, PausePacket, sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+
+    PrefetchedState = (PDEBUGGEE_KD_HALT_PREFETCHED_STATE)(g_KdHaltPrefetchBuffer + sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+    PrefetchedBytes = (BYTE *)PrefetchedState + sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE);
+
+    //
+    // Registers
+    //
+    memcpy(&PrefetchedState->Regs, GuestRegs, sizeof(GUEST_REGS));
+
+    PrefetchedState->ExtraRegs.CS     = DebuggerGetRegValueWrapper(NULL, REGISTER_CS);
+    PrefetchedState->ExtraRegs.SS     = DebuggerGetRegValueWrapper(NULL, REGISTER_SS);
+    PrefetchedState->ExtraRegs.DS     = DebuggerGetRegValueWrapper(NULL, REGISTER_DS);
+    PrefetchedState->ExtraRegs.ES     = DebuggerGetRegValueWrapper(NULL, REGISTER_ES);
+    PrefetchedState->ExtraRegs.FS     = DebuggerGetRegValueWrapper(NULL, REGISTER_FS);
+    PrefetchedState->ExtraRegs.GS     = DebuggerGetRegValueWrapper(NULL, REGISTER_GS);
+    PrefetchedState->ExtraRegs.RFLAGS = DebuggerGetRegValueWrapper(NULL, REGISTER_RFLAGS);
+    PrefetchedState->ExtraRegs.RIP    = DebuggerGetRegValueWrapper(NULL, REGISTER_RIP);
+
+    PrefetchedState->Cr0 = DebuggerGetRegValueWrapper(NULL, REGISTER_CR0);
+    PrefetchedState->Cr2 = DebuggerGetRegValueWrapper(NULL, REGISTER_CR2);
+    PrefetchedState->Cr3 = DebuggerGetRegValueWrapper(NULL, REGISTER_CR3);
+    PrefetchedState->Cr4 = DebuggerGetRegValueWrapper(NULL, REGISTER_CR4);
+
+    //
+    // Current process and thread
+    //
+    PrefetchedState->ProcessId = PsGetCurrentProcessId();
+    PrefetchedState->ThreadId  = PsGetCurrentThreadId();
+
+    //
+    // Top of the stack
+    //
+    PrefetchedState->StackAddress = GuestRegs->rsp;
+    PrefetchedState->StackSize    = KdHaltPrefetchReadMemory(GuestRegs->rsp,
+                                                          PrefetchedBytes,
+                                                          g_KdHaltPrefetchProfile.StackSize);
+
+    //
+    // Code from RIP (for disassembling)
+    //
+    PrefetchedState->CodeAddress = PrefetchedState->ExtraRegs.RIP;
+    PrefetchedState->CodeSize    = KdHaltPrefetchReadMemory(PrefetchedState->CodeAddress,
+                                                         PrefetchedBytes + PrefetchedState->StackSize,
+                                                         g_KdHaltPrefetchProfile.CodeSize);
+
+    //
+    // Only the bytes that are read are sent
+    //
+    KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                               DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
+                               g_KdHaltPrefetchBuffer,
+                               sizeof(DEBUGGEE_KD_PAUSED_PACKET) +
+                                   sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) +
+                                   PrefetchedState->StackSize +
+                                   PrefetchedState->CodeSize);
+}
+
 /**
  * @brief manage system halt on vmx-root mode
  * @details Thuis function should only be called from KdHandleBreakpointAndDebugBreakpoints
@@ -2468,7 +2668,7 @@ StartAgain:
         //
         // Set rflags for finding the results of conditional jumps
         //
-        __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+        Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
         PausePacket.Rflags = Rflags.AsUInt;
 
         //
@@ -2533,10 +2733,7 @@ StartAgain:
         // Send the pause packet, along with RIP and an indication
         // to pause to the debugger
         //
-        KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
-                                   DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
-                                   &PausePacket,
-                                   sizeof(DEBUGGEE_KD_PAUSED_PACKET));
+        KdSendPausePacket(&PausePacket, GuestRegs);
 
         //
         // Perform Commands from the debugger
@@ -43,6 +43,139 @@ ProcessHandleProcessChange(UINT32 ProcessorIndex, PGUEST_REGS GuestState)
     return FALSE;
 }
 
+/**
+ * @brief Clear the CR3-target list of the current core
+ * @details should be called on vmx root, after clearing the list
+ * all of the mov-to-cr3s cause vm-exits
+ *
+ * @param CurrentProcessorIndex
+ *
+ * @return VOID
+ */
+VOID
+ProcessCr3TargetListReset(UINT32 CurrentProcessorIndex)
+{
+    g_GuestState[CurrentProcessorIndex].DebuggingState.ThreadOrProcessTracingDetails.Cr3TargetListMissedExits = 0;
+
+    __vmx_vmwrite(VMCS_CTRL_CR3_TARGET_COUNT, 0);
+}
+
+/**
+ * @brief Check whether the operand of a mov-to-cr3 is an address space
+ * of the target process
+ * @details should be called on vmx root, the thread that moves to cr3
+ * is not necessarily a thread of the target process (e.g., a thread that
+ * is attached to the target process by KeStackAttachProcess), thus the
+ * owner of the address space (and its directory table base) is checked
+ * rather than the process of the thread
+ *
+ * @param Cr3Operand The source operand of the mov-to-cr3
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProcessIsTargetAddressSpace(UINT64 Cr3Operand)
+{
+    CR3_TYPE      Operand      = {0};
+    CR3_TYPE      TargetCr3    = {0};
+    NT_KPROCESS * AddressSpace = (NT_KPROCESS *)PsGetCurrentProcess();
+
+    //
+    // PsGetCurrentProcess is the process that the address space belongs
+    // to (the attached process if the thread is attached)
+    //
+    if ((g_ProcessSwitch.Process != NULL && g_ProcessSwitch.Process == AddressSpace) ||
+        (g_ProcessSwitch.ProcessId != NULL && g_ProcessSwitch.ProcessId == PsGetProcessId(AddressSpace)))
+    {
+        //
+        // Keep the kernel cr3 of the target process, so it's recognized
+        // even if the owner is not updated yet
+        //
+        g_ProcessSwitch.DirectoryTableBase = AddressSpace->DirectoryTableBase;
+
+        return TRUE;
+    }
+
+    if (g_ProcessSwitch.DirectoryTableBase == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Compare the page frames, the operand might have a PCID or
+    // the no-invalidate bit (bit 63)
+    //
+    Operand.Flags   = Cr3Operand;
+    TargetCr3.Flags = g_ProcessSwitch.DirectoryTableBase;
+
+    return Operand.Fields.PageFrameNumber == TargetCr3.Fields.PageFrameNumber;
+}
+
+/**
+ * @brief Add the operand of a mov-to-cr3 of a non-target process to the
+ * CR3-target list of the current core
+ * @details should be called on vmx root, mov-to-cr3s with an operand equal
+ * to one of the CR3-target values won't cause vm-exits anymore (the operand
+ * is compared as a whole, including PCID and bit 63), thus the cores only
+ * exit on the address spaces that are not hot, and the target process
+ * always causes a vm-exit as its CR3 is never added to the list
+ *
+ * @param CurrentProcessorIndex
+ * @param Cr3Operand The source operand of the mov-to-cr3
+ *
+ * @return VOID
+ */
+VOID
+ProcessCr3TargetListAdd(UINT32 CurrentProcessorIndex, UINT64 Cr3Operand)
+{
+    UINT64                                      Cr3TargetCount = 0;
+    PDEBUGGEE_PROCESS_OR_THREAD_TRACING_DETAILS TracingDetails =
+        &g_GuestState[CurrentProcessorIndex].DebuggingState.ThreadOrProcessTracingDetails;
+
+    //
+    // The user debugger needs all of the mov-to-cr3s for intercepting threads
+    //
+    if (g_CheckPageFaultsAndMov2Cr3VmexitsWithUserDebugger || TracingDetails->Cr3TargetListCapacity == 0)
+    {
+        return;
+    }
+
+    //
+    // Never add the target process, otherwise switching to it won't cause
+    // vm-exits anymore
+    //
+    if (ProcessIsTargetAddressSpace(Cr3Operand))
+    {
+        return;
+    }
+
+    __vmx_vmread(VMCS_CTRL_CR3_TARGET_COUNT, &Cr3TargetCount);
+
+    if (Cr3TargetCount >= TracingDetails->Cr3TargetListCapacity)
+    {
+        //
+        // The list is full, the address spaces that are not in the list
+        // cause vm-exits as before, if they're frequent then the list is
+        // no longer representing the hot address spaces, so relearn it
+        //
+        TracingDetails->Cr3TargetListMissedExits++;
+
+        if (TracingDetails->Cr3TargetListMissedExits < PROCESS_CR3_TARGET_LIST_RELEARN_EXITS)
+        {
+            return;
+        }
+
+        TracingDetails->Cr3TargetListMissedExits = 0;
+        Cr3TargetCount                           = 0;
+    }
+
+    //
+    // The CR3-target value fields are consecutive (even encodings)
+    //
+    __vmx_vmwrite(VMCS_CTRL_CR3_TARGET_VALUE_0 + (Cr3TargetCount * 2), Cr3Operand);
+    __vmx_vmwrite(VMCS_CTRL_CR3_TARGET_COUNT, Cr3TargetCount + 1);
+}
+
 /**
  * @brief make evnvironment ready to change the process
  * @param ProcessId
@@ -59,8 +192,9 @@ ProcessSwitch(UINT32 ProcessId, PEPROCESS EProcess, BOOLEAN IsSwitchByClockIntrr
     //
     // Initialized with NULL
     //
-    g_ProcessSwitch.Process   = NULL;
-    g_ProcessSwitch.ProcessId = NULL;
+    g_ProcessSwitch.Process            = NULL;
+    g_ProcessSwitch.ProcessId          = NULL;
+    g_ProcessSwitch.DirectoryTableBase = NULL;
 
     //
     // Check to avoid invalid switch
@@ -78,6 +212,14 @@ ProcessSwitch(UINT32 ProcessId, PEPROCESS EProcess, BOOLEAN IsSwitchByClockIntrr
         if (CheckMemoryAccessSafety(EProcess, sizeof(BYTE)))
         {
             g_ProcessSwitch.Process = EProcess;
+
+            //
+            // Keep the kernel cr3 of the target process to avoid adding
+            // it to the CR3-target list
+            //
+            MemoryMapperReadMemorySafe((UINT64) & ((NT_KPROCESS *)EProcess)->DirectoryTableBase,
+                                       &g_ProcessSwitch.DirectoryTableBase,
+                                       sizeof(g_ProcessSwitch.DirectoryTableBase));
         }
         else
         {
@@ -175,6 +317,8 @@ VOID
 ProcessDetectChangeByMov2Cr3Vmexits(UINT32  CurrentProcessorIndex,
                                     BOOLEAN Enable)
 {
+    IA32_VMX_MISC_REGISTER VmxMiscMsr = {0};
+
     if (Enable)
     {
         //
@@ -182,9 +326,18 @@ ProcessDetectChangeByMov2Cr3Vmexits(UINT32  CurrentProcessorIndex,
         //
         g_GuestState[CurrentProcessorIndex].DebuggingState.ThreadOrProcessTracingDetails.IsWatingForMovCr3VmExits = TRUE;
 
+        //
+        // Find the number of CR3-target values that are supported by the processor,
+        // the list is learned from the mov-to-cr3s of non-target processes
+        //
+        VmxMiscMsr.AsUInt = __readmsr(IA32_VMX_MISC);
+
+        g_GuestState[CurrentProcessorIndex].DebuggingState.ThreadOrProcessTracingDetails.Cr3TargetListCapacity =
+            min(VmxMiscMsr.Cr3TargetCount, PROCESS_CR3_TARGET_LIST_MAXIMUM_COUNT);
+
         //
         // Set mov to cr3 vm-exit, this flag is also use to remove the
-        // mov 2 cr3 on next halt
+        // mov 2 cr3 on next halt (it also clears the CR3-target list)
         //
         HvSetMovToCr3Vmexit(TRUE);
     }
@@ -195,6 +348,12 @@ ProcessDetectChangeByMov2Cr3Vmexits(UINT32  CurrentProcessorIndex,
         //
         g_GuestState[CurrentProcessorIndex].DebuggingState.ThreadOrProcessTracingDetails.IsWatingForMovCr3VmExits = FALSE;
 
+        //
+        // Clear the CR3-target list as the mov to cr3 vm-exits might remain
+        // enabled (e.g., for the user debugger)
+        //
+        ProcessCr3TargetListReset(CurrentProcessorIndex);
+
         //
         // Unset mov to cr3 vm-exit, this flag is also use to remove the
         // mov 2 cr3 on next halt
@@ -232,6 +391,387 @@ ProcessEnableOrDisableThreadChangeMonitor(UINT32  CurrentProcessorIndex,
     }
 }
 
+/**
+ * @brief Allocate the snapshot of the processes list that is used by
+ * the kernel debugger
+ * @details should NOT be called in vmx-root, the snapshot is only
+ * allocated once the kernel debugger is initialized
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ProcessSnapshotInitialize()
+{
+    if (!g_KdProcessSnapshot)
+    {
+        g_KdProcessSnapshot = ExAllocatePoolWithTag(NonPagedPool, sizeof(PROCESS_SNAPSHOT), POOLTAG);
+
+        if (!g_KdProcessSnapshot)
+        {
+            //
+            // Out of resource
+            //
+            return FALSE;
+        }
+    }
+
+    g_KdProcessSnapshot->IsValid = FALSE;
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the snapshot of the processes list of the kernel debugger
+ *
+ * @return VOID
+ */
+VOID
+ProcessSnapshotUninitialize()
+{
+    if (g_KdProcessSnapshot != NULL)
+    {
+        ExFreePoolWithTag(g_KdProcessSnapshot, POOLTAG);
+        g_KdProcessSnapshot = NULL;
+    }
+}
+
+/**
+ * @brief Get a snapshot for walking the processes list
+ * @details In vmx-root (the kernel debugger), the snapshot of the kernel
+ * debugger is used without a lock as it's only used by the halted core
+ * while the other cores are halted, in vmx non-root, a snapshot is
+ * allocated for the request (if Allocate is set) and it should be freed
+ * by ProcessSnapshotPut
+ *
+ * @param Allocate whether to allocate a snapshot in vmx non-root
+ *
+ * @return PPROCESS_SNAPSHOT NULL if there is no snapshot
+ */
+static PPROCESS_SNAPSHOT
+ProcessSnapshotGet(BOOLEAN Allocate)
+{
+    PPROCESS_SNAPSHOT Snapshot;
+
+    if (g_GuestState[KeGetCurrentProcessorNumber()].IsOnVmxRootMode)
+    {
+        if (g_DebuggeeHaltReason == DEBUGGEE_PAUSING_REASON_NOT_PAUSED)
+        {
+            //
+            // Not on the halted core
+            //
+            return NULL;
+        }
+
+        return g_KdProcessSnapshot;
+    }
+
+    if (!Allocate)
+    {
+        return NULL;
+    }
+
+    Snapshot = ExAllocatePoolWithTag(NonPagedPool, sizeof(PROCESS_SNAPSHOT), POOLTAG);
+
+    if (Snapshot != NULL)
+    {
+        Snapshot->IsValid = FALSE;
+    }
+
+    return Snapshot;
+}
+
+/**
+ * @brief Release a snapshot that is got by ProcessSnapshotGet
+ *
+ * @param Snapshot
+ *
+ * @return VOID
+ */
+static VOID
+ProcessSnapshotPut(PPROCESS_SNAPSHOT Snapshot)
+{
+    if (Snapshot != NULL && Snapshot != g_KdProcessSnapshot)
+    {
+        ExFreePoolWithTag(Snapshot, POOLTAG);
+    }
+}
+
+/**
+ * @brief Compute the index of an nt!_EPROCESS in the hash table
+ * @param Eprocess
+ *
+ * @return UINT32
+ */
+UINT32
+ProcessSnapshotHash(UINT64 Eprocess)
+{
+    return (UINT32)(((Eprocess >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & (PROCESS_SNAPSHOT_HASH_TABLE_SIZE - 1);
+}
+
+/**
+ * @brief Find an nt!_EPROCESS in the snapshot
+ *
+ * @param Snapshot
+ * @param Eprocess
+ *
+ * @return PPROCESS_SNAPSHOT_ENTRY NULL if not found
+ */
+PPROCESS_SNAPSHOT_ENTRY
+ProcessSnapshotFind(PPROCESS_SNAPSHOT Snapshot, UINT64 Eprocess)
+{
+    UINT32 Index = ProcessSnapshotHash(Eprocess);
+
+    while (Snapshot->HashTable[Index] != 0)
+    {
+        if (Snapshot->Entries[Snapshot->HashTable[Index] - 1].Eprocess == Eprocess)
+        {
+            return &Snapshot->Entries[Snapshot->HashTable[Index] - 1];
+        }
+
+        Index = (Index + 1) & (PROCESS_SNAPSHOT_HASH_TABLE_SIZE - 1);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Read the details of a process of the processes list
+ * @details the offsets of the snapshot are used for reading the fields
+ *
+ * @param Snapshot
+ * @param Process nt!_EPROCESS of the process
+ * @param Entry The entry to save the details
+ * @param NextProcess The next process in the processes list
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ProcessSnapshotReadProcess(PPROCESS_SNAPSHOT Snapshot, UINT64 Process, PPROCESS_SNAPSHOT_ENTRY Entry, UINT64 * NextProcess)
+{
+    UINT64                     UniquePid          = NULL;
+    UINT64                     DirectoryTableBase = NULL;
+    LIST_ENTRY                 ActiveProcessLinks;
+    UCHAR                      ImageFileName[15] = {0};
+    UINT32                     CountOfFields     = 0;
+    MEMORY_MAPPER_OBJECT_FIELD Fields[4];
+
+    //
+    // The fields that should be read from each process
+    //
+    Fields[CountOfFields].Offset   = Snapshot->ActiveProcessLinksOffset;
+    Fields[CountOfFields].Size     = sizeof(ActiveProcessLinks);
+    Fields[CountOfFields++].Buffer = &ActiveProcessLinks;
+
+    Fields[CountOfFields].Offset   = FIELD_OFFSET(NT_KPROCESS, DirectoryTableBase);
+    Fields[CountOfFields].Size     = sizeof(DirectoryTableBase);
+    Fields[CountOfFields++].Buffer = &DirectoryTableBase;
+
+    if (Snapshot->UniquePidOffset != NULL)
+    {
+        Fields[CountOfFields].Offset   = Snapshot->UniquePidOffset;
+        Fields[CountOfFields].Size     = sizeof(UniquePid);
+        Fields[CountOfFields++].Buffer = &UniquePid;
+    }
+
+    if (Snapshot->ImageFileNameOffset != NULL)
+    {
+        Fields[CountOfFields].Offset   = Snapshot->ImageFileNameOffset;
+        Fields[CountOfFields].Size     = sizeof(ImageFileName);
+        Fields[CountOfFields++].Buffer = &ImageFileName;
+    }
+
+    //
+    // Read the fields of the process, all of them are read by mapping
+    // the pages of the process once
+    //
+    if (!MemoryMapperReadObjectFieldsSafe(Process,
+                                          Fields,
+                                          CountOfFields,
+                                          Snapshot->ObjectBuffer,
+                                          sizeof(Snapshot->ObjectBuffer)))
+    {
+        return FALSE;
+    }
+
+    Entry->Eprocess = Process;
+    Entry->Pid      = UniquePid;
+    Entry->Cr3      = DirectoryTableBase;
+    RtlCopyMemory(Entry->ImageFileName, ImageFileName, sizeof(ImageFileName));
+
+    //
+    // Find the next process from the list of this process
+    //
+    *NextProcess = (UINT64)ActiveProcessLinks.Flink - Snapshot->ActiveProcessLinksOffset;
+
+    return TRUE;
+}
+
+/**
+ * @brief Take a snapshot of the processes list
+ * @details the previous snapshot is used if the debuggee is not continued
+ * after taking it, UniquePidOffset and ImageFileNameOffset are optional, if
+ * there are more than PROCESS_SNAPSHOT_MAXIMUM_ENTRIES processes then the
+ * snapshot is not complete and the rest of the list starts from NextProcess
+ *
+ * @param Snapshot
+ * @param ActiveProcessHead nt!PsActiveProcessHead
+ * @param ActiveProcessLinksOffset nt!_EPROCESS.ActiveProcessLinks
+ * @param UniquePidOffset nt!_EPROCESS.UniqueProcessId
+ * @param ImageFileNameOffset nt!_EPROCESS.ImageFileName
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ProcessSnapshotTake(PPROCESS_SNAPSHOT Snapshot,
+                    UINT64            ActiveProcessHead,
+                    ULONG             ActiveProcessLinksOffset,
+                    ULONG             UniquePidOffset,
+                    ULONG             ImageFileNameOffset)
+{
+    UINT64                  Process;
+    LIST_ENTRY              ActiveProcessLinks;
+    UINT32                  Index;
+    PPROCESS_SNAPSHOT_ENTRY Entry;
+
+    //
+    // Check whether the previous snapshot is still valid or not, the list
+    // might be changed if the debuggee is not halted
+    //
+    if (Snapshot->IsValid &&
+        g_DebuggeeHaltReason != DEBUGGEE_PAUSING_REASON_NOT_PAUSED &&
+        Snapshot->HaltGeneration == g_DebuggeeHaltGeneration &&
+        Snapshot->ActiveProcessHead == ActiveProcessHead &&
+        Snapshot->ActiveProcessLinksOffset == ActiveProcessLinksOffset &&
+        (UniquePidOffset == NULL || Snapshot->UniquePidOffset == UniquePidOffset) &&
+        (ImageFileNameOffset == NULL || Snapshot->ImageFileNameOffset == ImageFileNameOffset))
+    {
+        return TRUE;
+    }
+
+    Snapshot->IsValid        = FALSE;
+    Snapshot->IsComplete     = TRUE;
+    Snapshot->CountOfEntries = 0;
+    Snapshot->NextProcess    = NULL;
+
+    RtlZeroMemory(Snapshot->HashTable, sizeof(Snapshot->HashTable));
+
+    //
+    // Check if address is valid
+    //
+    if (!CheckMemoryAccessSafety(ActiveProcessHead, sizeof(BYTE)))
+    {
+        return FALSE;
+    }
+
+    Snapshot->HaltGeneration           = g_DebuggeeHaltGeneration;
+    Snapshot->ActiveProcessHead        = ActiveProcessHead;
+    Snapshot->ActiveProcessLinksOffset = ActiveProcessLinksOffset;
+    Snapshot->UniquePidOffset          = UniquePidOffset;
+    Snapshot->ImageFileNameOffset      = ImageFileNameOffset;
+
+    //
+    // Read everything from the view of system process
+    //
+    MemoryMapperReadMemorySafe(ActiveProcessHead, &ActiveProcessLinks, sizeof(ActiveProcessLinks));
+
+    //
+    // Find the top of EPROCESS from nt!_EPROCESS.ActiveProcessLinks
+    //
+    Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+
+    while (Process + ActiveProcessLinksOffset != ActiveProcessHead)
+    {
+        if (Snapshot->CountOfEntries == PROCESS_SNAPSHOT_MAXIMUM_ENTRIES)
+        {
+            //
+            // Snapshot is full, the rest of the list is walked by the callers
+            //
+            Snapshot->IsComplete  = FALSE;
+            Snapshot->NextProcess = Process;
+            break;
+        }
+
+        Entry = &Snapshot->Entries[Snapshot->CountOfEntries];
+
+        if (!ProcessSnapshotReadProcess(Snapshot, Process, Entry, &Process))
+        {
+            Snapshot->IsComplete = FALSE;
+            break;
+        }
+
+        Snapshot->CountOfEntries++;
+
+        //
+        // Add it to the hash table
+        //
+        Index = ProcessSnapshotHash(Entry->Eprocess);
+
+        while (Snapshot->HashTable[Index] != 0)
+        {
+            Index = (Index + 1) & (PROCESS_SNAPSHOT_HASH_TABLE_SIZE - 1);
+        }
+
+        Snapshot->HashTable[Index] = Snapshot->CountOfEntries;
+    }
+
+    Snapshot->IsValid = TRUE;
+
+    return TRUE;
+}
+
+/**
+ * @brief checks whether the given nt!_EPROCESS is valid or not by
+ * walking the processes list
+ * @param Eprocess target nt!_EPROCESS
+ * @param ActiveProcessHead nt!PsActiveProcessHead
+ * @param ActiveProcessLinksOffset nt!_EPROCESS.ActiveProcessLinks
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ProcessCheckIfEprocessIsValidByWalkingList(UINT64 Eprocess, UINT64 ActiveProcessHead, ULONG ActiveProcessLinksOffset)
+{
+    UINT64     Process;
+    LIST_ENTRY ActiveProcessLinks;
+
+    //
+    // Show processes list, we read everything from the view of system
+    // process
+    //
+    MemoryMapperReadMemorySafe(ActiveProcessHead, &ActiveProcessLinks, sizeof(ActiveProcessLinks));
+
+    //
+    // Find the top of EPROCESS from nt!_EPROCESS.ActiveProcessLinks
+    //
+    Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+
+    do
+    {
+        //
+        // Read the next process
+        //
+        MemoryMapperReadMemorySafe(Process + ActiveProcessLinksOffset,
+                                   &ActiveProcessLinks,
+                                   sizeof(ActiveProcessLinks));
+
+        //
+        // Check if we find the process
+        //
+        if (Process == Eprocess)
+        {
+            return TRUE;
+        }
+
+        //
+        // Find the next process from the list of this process
+        //
+        Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+
+    } while ((UINT64)ActiveProcessLinks.Flink != ActiveProcessHead);
+
+    return FALSE;
+}
+
 /**
  * @brief checks whether the given nt!_EPROCESS is valid or not
  * @param Eprocess target nt!_EPROCESS
@@ -243,8 +783,8 @@ ProcessEnableOrDisableThreadChangeMonitor(UINT32  CurrentProcessorIndex,
 BOOLEAN
 ProcessCheckIfEprocessIsValid(UINT64 Eprocess, UINT64 ActiveProcessHead, ULONG ActiveProcessLinksOffset)
 {
-    UINT64     Process;
-    LIST_ENTRY ActiveProcessLinks;
+    BOOLEAN           Result;
+    PPROCESS_SNAPSHOT Snapshot;
 
     //
     // Dirty validation of parameters
@@ -256,58 +796,127 @@ ProcessCheckIfEprocessIsValid(UINT64 Eprocess, UINT64 ActiveProcessHead, ULONG A
     }
 
     //
-    // Check if address is valid
+    // A single check is not worth allocating a snapshot in vmx non-root
     //
-    if (CheckMemoryAccessSafety(ActiveProcessHead, sizeof(BYTE)))
+    Snapshot = ProcessSnapshotGet(FALSE);
+
+    if (Snapshot == NULL)
     {
         //
-        // Show processes list, we read everything from the view of system
-        // process
+        // There is no snapshot, so the list is walked
         //
-        MemoryMapperReadMemorySafe(ActiveProcessHead, &ActiveProcessLinks, sizeof(ActiveProcessLinks));
+        if (!CheckMemoryAccessSafety(ActiveProcessHead, sizeof(BYTE)))
+        {
+            return FALSE;
+        }
+
+        return ProcessCheckIfEprocessIsValidByWalkingList(Eprocess, ActiveProcessHead, ActiveProcessLinksOffset);
+    }
 
+    if (!ProcessSnapshotTake(Snapshot, ActiveProcessHead, ActiveProcessLinksOffset, NULL, NULL))
+    {
         //
-        // Find the top of EPROCESS from nt!_EPROCESS.ActiveProcessLinks
+        // An invalid address is specified
         //
-        Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+        Result = FALSE;
+    }
+    else if (ProcessSnapshotFind(Snapshot, Eprocess) != NULL)
+    {
+        Result = TRUE;
+    }
+    else if (!Snapshot->IsComplete)
+    {
+        //
+        // The process might be in the part of the list that is not
+        // in the snapshot
+        //
+        Result = ProcessCheckIfEprocessIsValidByWalkingList(Eprocess, ActiveProcessHead, ActiveProcessLinksOffset);
+    }
+    else
+    {
+        Result = FALSE;
+    }
 
-        do
-        {
-            //
-            // Read the next process
-            //
-            MemoryMapperReadMemorySafe(Process + ActiveProcessLinksOffset,
-                                       &ActiveProcessLinks,
-                                       sizeof(ActiveProcessLinks));
+    ProcessSnapshotPut(Snapshot);
 
-            //
-            // Check if we find the process
-            //
-            if (Process == Eprocess)
-            {
-                return TRUE;
-            }
+    return Result;
+}
 
+/**
+ * @brief Show, count or save a process of the processes list
+ *
+ * @param Entry Details of the process
+ * @param QueryAction
+ * @param EnumerationCount Count of processes that are enumerated
+ * @param SavingEntries
+ * @param MaximumBufferCount
+ *
+ * @return BOOLEAN FALSE if the buffer of saving the details is full
+ */
+static BOOLEAN
+ProcessShowListEntry(PPROCESS_SNAPSHOT_ENTRY                            Entry,
+                     DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTIONS QueryAction,
+                     UINT32 *                                           EnumerationCount,
+                     PDEBUGGEE_PROCESS_LIST_DETAILS_ENTRY               SavingEntries,
+                     UINT32                                             MaximumBufferCount)
+{
+    switch (QueryAction)
+    {
+    case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_SHOW_INSTANTLY:
+
+        Log("PROCESS\t%llx\n\tProcess Id: %04x\tDirBase (Kernel Cr3): %016llx\tImage: %s\n\n",
+            Entry->Eprocess,
+            Entry->Pid,
+            Entry->Cr3,
+            Entry->ImageFileName);
+
+    case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_QUERY_COUNT:
+
+        (*EnumerationCount)++;
+
+        break;
+
+    case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_QUERY_SAVE_DETAILS:
+
+        (*EnumerationCount)++;
+
+        //
+        // Check to avoid overflow
+        //
+        if (*EnumerationCount == MaximumBufferCount - 1)
+        {
             //
-            // Find the next process from the list of this process
+            // buffer is full
             //
-            Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+            return FALSE;
+        }
 
-        } while ((UINT64)ActiveProcessLinks.Flink != ActiveProcessHead);
-    }
-    else
-    {
         //
-        // An invalid address is specified
+        // Save the details
         //
-        return FALSE;
+        SavingEntries[*EnumerationCount - 1].Eprocess = Entry->Eprocess;
+        SavingEntries[*EnumerationCount - 1].Pid      = Entry->Pid;
+        SavingEntries[*EnumerationCount - 1].Cr3      = Entry->Cr3;
+        RtlCopyMemory(&SavingEntries[*EnumerationCount - 1].ImageFileName, Entry->ImageFileName, 15);
+
+        break;
+
+    default:
+
+        LogError("Err, invalid action specified for process enumeration");
+
+        break;
     }
 
-    return FALSE;
+    return TRUE;
 }
 
 /**
  * @brief shows the processes list
+ * @details the processes that don't fit in the snapshot are read by
+ * walking the rest of the list, so the count and the details are not
+ * truncated
+ *
  * @param PorcessListSymbolInfo
  * @param QueryAction
  * @param CountOfProcesses
@@ -323,11 +932,10 @@ ProcessShowList(PDEBUGGEE_PROCESS_LIST_NEEDED_DETAILS              PorcessListSy
                 PVOID                                              ListSaveBuffer,
                 UINT64                                             ListSaveBuffSize)
 {
+    PROCESS_SNAPSHOT_ENTRY               Entry;
+    PPROCESS_SNAPSHOT                    Snapshot;
     UINT64                               Process;
-    UINT64                               UniquePid;
-    LIST_ENTRY                           ActiveProcessLinks;
-    UCHAR                                ImageFileName[15]  = {0};
-    CR3_TYPE                             ProcessCr3         = {0};
+    BOOLEAN                              IsTruncated        = FALSE;
     UINT32                               EnumerationCount   = 0;
     UINT32                               MaximumBufferCount = 0;
     PDEBUGGEE_PROCESS_LIST_DETAILS_ENTRY SavingEntries      = ListSaveBuffer;
@@ -374,113 +982,65 @@ ProcessShowList(PDEBUGGEE_PROCESS_LIST_NEEDED_DETAILS              PorcessListSy
         return FALSE;
     }
 
+    Snapshot = ProcessSnapshotGet(TRUE);
+
+    if (Snapshot == NULL)
+    {
+        return FALSE;
+    }
+
     //
-    // Check if address is valid
+    // Take (or reuse) the snapshot of the processes
     //
-    if (CheckMemoryAccessSafety(ActiveProcessHead, sizeof(BYTE)))
+    if (!ProcessSnapshotTake(Snapshot, ActiveProcessHead, ActiveProcessLinksOffset, UniquePidOffset, ImageFileNameOffset))
     {
         //
-        // Show processes list, we read everything from the view of system
-        // process
+        // An invalid address is specified by the debugger
         //
-        MemoryMapperReadMemorySafe(ActiveProcessHead, &ActiveProcessLinks, sizeof(ActiveProcessLinks));
+        ProcessSnapshotPut(Snapshot);
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Snapshot->CountOfEntries; i++)
+    {
+        if (!ProcessShowListEntry(&Snapshot->Entries[i], QueryAction, &EnumerationCount, SavingEntries, MaximumBufferCount))
+        {
+            goto ReturnEnd;
+        }
+    }
 
+    if (!Snapshot->IsComplete)
+    {
         //
-        // Find the top of EPROCESS from nt!_EPROCESS.ActiveProcessLinks
+        // Walk the rest of the list (that is not in the snapshot)
         //
-        Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
+        Process     = Snapshot->NextProcess;
+        IsTruncated = (Process == NULL);
 
-        do
+        while (Process != NULL && Process + ActiveProcessLinksOffset != ActiveProcessHead)
         {
-            //
-            // Read Process name, Process ID, CR3 of the target process
-            //
-            MemoryMapperReadMemorySafe(Process + ImageFileNameOffset,
-                                       &ImageFileName,
-                                       sizeof(ImageFileName));
-
-            MemoryMapperReadMemorySafe(Process + UniquePidOffset,
-                                       &UniquePid,
-                                       sizeof(UniquePid));
-
-            MemoryMapperReadMemorySafe(Process + ActiveProcessLinksOffset,
-                                       &ActiveProcessLinks,
-                                       sizeof(ActiveProcessLinks));
-
-            //
-            // Get the kernel CR3 for the target process
-            //
-            NT_KPROCESS * CurrentProcess = (NT_KPROCESS *)(Process);
-            ProcessCr3.Flags             = CurrentProcess->DirectoryTableBase;
-
-            //
-            // Show the list of process
-            //
-            switch (QueryAction)
+            if (!ProcessSnapshotReadProcess(Snapshot, Process, &Entry, &Process))
             {
-            case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_SHOW_INSTANTLY:
-
-                Log("PROCESS\t%llx\n\tProcess Id: %04x\tDirBase (Kernel Cr3): %016llx\tImage: %s\n\n",
-                    Process,
-                    UniquePid,
-                    ProcessCr3.Flags,
-                    ImageFileName);
-
-            case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_QUERY_COUNT:
-
-                EnumerationCount++;
-
-                break;
-
-            case DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_QUERY_SAVE_DETAILS:
-
-                EnumerationCount++;
-
-                //
-                // Check to avoid overflow
-                //
-                if (EnumerationCount == MaximumBufferCount - 1)
-                {
-                    //
-                    // buffer is full
-                    //
-                    goto ReturnEnd;
-                }
-
-                //
-                // Save the details
-                //
-                SavingEntries[EnumerationCount - 1].Eprocess = Process;
-                SavingEntries[EnumerationCount - 1].Pid      = UniquePid;
-                SavingEntries[EnumerationCount - 1].Cr3      = ProcessCr3.Flags;
-                RtlCopyMemory(&SavingEntries[EnumerationCount - 1].ImageFileName, ImageFileName, 15);
-
-                break;
-
-            default:
-
-                LogError("Err, invalid action specified for process enumeration");
-
+                IsTruncated = TRUE;
                 break;
             }
 
-            //
-            // Find the next process from the list of this process
-            //
-            Process = (UINT64)ActiveProcessLinks.Flink - ActiveProcessLinksOffset;
-
-        } while ((UINT64)ActiveProcessLinks.Flink != ActiveProcessHead);
+            if (!ProcessShowListEntry(&Entry, QueryAction, &EnumerationCount, SavingEntries, MaximumBufferCount))
+            {
+                goto ReturnEnd;
+            }
+        }
     }
-    else
+
+    if (IsTruncated && QueryAction == DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_SHOW_INSTANTLY)
     {
-        //
-        // An invalid address is specified by the debugger
-        //
-        return FALSE;
+        Log("the list is truncated after %d processes\n", EnumerationCount);
     }
 
 ReturnEnd:
 
+    ProcessSnapshotPut(Snapshot);
+
     //
     // In case of query count of processes, we'll set this parameter
     //
@@ -131,7 +131,10 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
     LIST_ENTRY                          ThreadLinks        = {0};
     CLIENT_ID                           ThreadCid          = {0};
     UINT32                              MaximumBufferCount = 0;
+    PCHAR                               ProcessName        = NULL;
     PDEBUGGEE_THREAD_LIST_DETAILS_ENTRY SavingEntries      = ListSaveBuffer;
+    MEMORY_MAPPER_OBJECT_FIELD          Fields[2];
+    BYTE                                ObjectBuffer[0x100];
 
     //
     // validate parameters
@@ -211,6 +214,11 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
         return FALSE;
     }
 
+    //
+    // All of the threads belong to the same process
+    //
+    ProcessName = GetProcessNameFromEprocess(ThreadListSymbolInfo->Process);
+
     if (QueryAction == DEBUGGER_QUERY_ACTIVE_PROCESSES_OR_THREADS_ACTION_SHOW_INSTANTLY)
     {
         //
@@ -218,9 +226,20 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
         //
         Log("PROCESS\t%llx\tIMAGE\t%s\n",
             ThreadListSymbolInfo->Process,
-            GetProcessNameFromEprocess(ThreadListSymbolInfo->Process));
+            ProcessName);
     }
 
+    //
+    // The client id and the link of each thread are read together
+    //
+    Fields[0].Offset = CidOffset;
+    Fields[0].Size   = sizeof(ThreadCid);
+    Fields[0].Buffer = &ThreadCid;
+
+    Fields[1].Offset = ThreadListEntryOffset;
+    Fields[1].Size   = sizeof(ThreadLinks);
+    Fields[1].Buffer = &ThreadLinks;
+
     //
     // Show thread list, we read everything from the view of system process
     //
@@ -236,9 +255,11 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
         //
         // Show thread list, we read everything from the view of system process
         //
-        MemoryMapperReadMemorySafe(Thread + CidOffset,
-                                   &ThreadCid,
-                                   sizeof(ThreadCid));
+        MemoryMapperReadObjectFieldsSafe(Thread,
+                                         Fields,
+                                         RTL_NUMBER_OF(Fields),
+                                         ObjectBuffer,
+                                         sizeof(ObjectBuffer));
 
         switch (QueryAction)
         {
@@ -281,7 +302,7 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
             SavingEntries[EnumerationCount - 1].Ethread  = Thread;
 
             RtlCopyMemory(&SavingEntries[EnumerationCount - 1].ImageFileName,
-                          GetProcessNameFromEprocess(ThreadListSymbolInfo->Process),
+                          ProcessName,
                           15);
 
             break;
@@ -290,10 +311,6 @@ ThreadShowList(PDEBUGGEE_THREAD_LIST_NEEDED_DETAILS               ThreadListSymb
             break;
         }
 
-        MemoryMapperReadMemorySafe(Thread + ThreadListEntryOffset,
-                                   &ThreadLinks,
-                                   sizeof(ThreadLinks));
-
         //
         // Find the next process from the list of this process
         //
@@ -0,0 +1,939 @@
+/**
+ * @file Aggregation.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Aggregations (count, sum, min, max, hist) of the script engine
+ * @details Each core keeps its own fixed-size hash table of aggregations,
+ * so scripts can profile high-frequency events without sending a message
+ * for each hit, the tables of all cores are merged from snapshots (without
+ * any lock) when the script calls agg_print or when the event is cleared,
+ * the merged results are sorted and shown in vmx non-root
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Allocate the aggregation tables
+ * @details should NOT be called in vmx-root
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+AggregationInitialize()
+{
+    UINT32        ProcessorCount = KeQueryActiveProcessorCount(0);
+    LARGE_INTEGER DueTime;
+
+    g_AggregationTables = ExAllocatePoolWithTag(NonPagedPool, ProcessorCount * sizeof(AGGREGATION_TABLE), POOLTAG);
+
+    if (g_AggregationTables == NULL)
+    {
+        return FALSE;
+    }
+
+    g_AggregationPrintRequests = ExAllocatePoolWithTag(NonPagedPool,
+                                                       AGGREGATION_MAXIMUM_PENDING_PRINTS * sizeof(AGGREGATION_PRINT_REQUEST),
+                                                       POOLTAG);
+
+    if (g_AggregationPrintRequests == NULL)
+    {
+        ExFreePoolWithTag(g_AggregationTables, POOLTAG);
+        g_AggregationTables = NULL;
+
+        return FALSE;
+    }
+
+    RtlZeroMemory(g_AggregationTables, ProcessorCount * sizeof(AGGREGATION_TABLE));
+    RtlZeroMemory(g_AggregationPrintRequests, AGGREGATION_MAXIMUM_PENDING_PRINTS * sizeof(AGGREGATION_PRINT_REQUEST));
+    RtlZeroMemory(g_AggregationClearRequests, sizeof(g_AggregationClearRequests));
+
+    g_AggregationCountOfClears        = 0;
+    g_AggregationCountOfDroppedPrints = 0;
+
+    //
+    // Show the results that are merged in vmx-root periodically
+    //
+    DueTime.QuadPart = -((LONGLONG)AGGREGATION_PRINT_INTERVAL);
+
+    KeInitializeDpc(&g_AggregationPrintDpc,   // Dpc
+                    AggregationPrintCallback, // DeferredRoutine
+                    NULL                      // DeferredContext
+    );
+
+    KeInitializeTimer(&g_AggregationPrintTimer);
+
+    KeSetTimerEx(&g_AggregationPrintTimer, DueTime, AGGREGATION_PRINT_INTERVAL / 10000, &g_AggregationPrintDpc);
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the aggregation tables
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+AggregationUninitialize()
+{
+    PAGGREGATION_TABLE         Tables   = g_AggregationTables;
+    PAGGREGATION_PRINT_REQUEST Requests = g_AggregationPrintRequests;
+
+    if (Tables == NULL)
+    {
+        return;
+    }
+
+    //
+    // Wait for the print callback (if it's running) before freeing the tables
+    //
+    KeCancelTimer(&g_AggregationPrintTimer);
+    KeFlushQueuedDpcs();
+
+    g_AggregationTables        = NULL;
+    g_AggregationPrintRequests = NULL;
+
+    ExFreePoolWithTag(Tables, POOLTAG);
+    ExFreePoolWithTag(Requests, POOLTAG);
+}
+
+/**
+ * @brief Find the bucket of a value in histograms
+ * @details Buckets are power of two, bucket 0 is for zero and bucket n
+ * is for values in [2^(n-1), 2^n - 1]
+ *
+ * @param Value
+ *
+ * @return UINT32
+ */
+static UINT32
+AggregationGetBucket(UINT64 Value)
+{
+    ULONG Index;
+
+    if (!_BitScanReverse64(&Index, Value))
+    {
+        return 0;
+    }
+
+    return Index + 1;
+}
+
+/**
+ * @brief Find the index of the first entry that is probed for a key
+ *
+ * @param Tag
+ * @param Type
+ * @param Key
+ * @param Bucket
+ *
+ * @return UINT32
+ */
+static UINT32
+AggregationHash(UINT64 Tag, UINT32 Type, UINT64 Key, UINT32 Bucket)
+{
+    UINT64 Hash;
+
+    Hash = (Tag * 0x9E3779B97F4A7C15ULL) ^ (Key * 0xC2B2AE3D27D4EB4FULL) ^ ((UINT64)Type << 48) ^ Bucket;
+    Hash ^= Hash >> 29;
+
+    return (UINT32)(Hash & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1));
+}
+
+/**
+ * @brief Find an entry in an aggregation table
+ *
+ * @param Table
+ * @param Tag
+ * @param Type
+ * @param Key
+ * @param Bucket
+ *
+ * @return PAGGREGATION_ENTRY the entry, or the free entry that the key
+ * should be added to it, NULL if not found and the table is full around
+ * this key
+ */
+static PAGGREGATION_ENTRY
+AggregationFindEntry(PAGGREGATION_TABLE Table,
+                     UINT64             Tag,
+                     AGGREGATION_TYPE   Type,
+                     UINT64             Key,
+                     UINT32             Bucket)
+{
+    PAGGREGATION_ENTRY Entry;
+    UINT32             Index = AggregationHash(Tag, Type, Key, Bucket);
+
+    for (UINT32 i = 0; i < AGGREGATION_TABLE_MAXIMUM_PROBES; i++)
+    {
+        Entry = &Table->Entries[(Index + i) & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1)];
+
+        if (Entry->Type == AGGREGATION_TYPE_FREE)
+        {
+            return Entry;
+        }
+
+        if (Entry->Tag == Tag && Entry->Type == Type && Entry->Key == Key && Entry->Bucket == Bucket)
+        {
+            return Entry;
+        }
+    }
+
+    //
+    // The table is full around this key
+    //
+    return NULL;
+}
+
+/**
+ * @brief Apply a value (or a merged entry) to an aggregation entry
+ *
+ * @param Entry
+ * @param Count Count of values
+ * @param Value The value (or sum, min, max of the values)
+ *
+ * @return VOID
+ */
+static VOID
+AggregationApply(PAGGREGATION_ENTRY Entry, UINT64 Count, UINT64 Value)
+{
+    switch (Entry->Type)
+    {
+    case AGGREGATION_TYPE_SUM:
+
+        Entry->Value += Value;
+        break;
+
+    case AGGREGATION_TYPE_MIN:
+
+        if (Entry->Count == 0 || Value < Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+        break;
+
+    case AGGREGATION_TYPE_MAX:
+
+        if (Entry->Count == 0 || Value > Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    Entry->Count += Count;
+}
+
+/**
+ * @brief Check whether the aggregations of an event are cleared after
+ * the clears that are applied to a table
+ *
+ * @param CountOfAppliedClears
+ * @param Tag Tag of the event
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+AggregationIsClearPending(UINT64 CountOfAppliedClears, UINT64 Tag)
+{
+    UINT64                     CountOfClears = g_AggregationCountOfClears;
+    PAGGREGATION_CLEAR_REQUEST Request;
+
+    if (CountOfClears - CountOfAppliedClears > AGGREGATION_MAXIMUM_PENDING_CLEARS)
+    {
+        //
+        // The core missed some of the clears, so its table is reset
+        // once it applies them
+        //
+        return TRUE;
+    }
+
+    for (UINT64 i = CountOfAppliedClears; i < CountOfClears; i++)
+    {
+        Request = &g_AggregationClearRequests[i & (AGGREGATION_MAXIMUM_PENDING_CLEARS - 1)];
+
+        if (Request->Sequence == (LONG64)(i + 1) && Request->Tag == Tag)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Remove an entry from the table of the current core
+ * @details The next entries of the probing sequence are moved back, so
+ * no deleted entry is left in the table
+ *
+ * @param Table
+ * @param Index
+ *
+ * @return VOID
+ */
+static VOID
+AggregationRemoveEntry(PAGGREGATION_TABLE Table, UINT32 Index)
+{
+    PAGGREGATION_ENTRY Entry;
+    UINT32             Next = Index;
+    UINT32             Home;
+
+    while (TRUE)
+    {
+        Next  = (Next + 1) & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1);
+        Entry = &Table->Entries[Next];
+
+        if (Entry->Type == AGGREGATION_TYPE_FREE || Next == Index)
+        {
+            break;
+        }
+
+        Home = AggregationHash(Entry->Tag, Entry->Type, Entry->Key, Entry->Bucket);
+
+        //
+        // Move the entry back if the removed entry is in its probing sequence
+        //
+        if (((Next - Home) & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1)) >=
+            ((Next - Index) & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1)))
+        {
+            Table->Entries[Index] = *Entry;
+            Index                 = Next;
+        }
+    }
+
+    Table->Entries[Index].Type = AGGREGATION_TYPE_FREE;
+}
+
+/**
+ * @brief Apply the clears to the table of the current core
+ * @details Only the core itself removes the entries of its table
+ *
+ * @param Table
+ *
+ * @return VOID
+ */
+static VOID
+AggregationApplyClears(PAGGREGATION_TABLE Table)
+{
+    UINT64                     CountOfClears = g_AggregationCountOfClears;
+    UINT64                     i             = Table->CountOfAppliedClears;
+    BOOLEAN                    Reset         = FALSE;
+    UINT32                     Start         = 0;
+    PAGGREGATION_CLEAR_REQUEST Request;
+    UINT64                     Tag;
+    LONG64                     Sequence;
+    UINT32                     j;
+
+    if (i == CountOfClears)
+    {
+        return;
+    }
+
+    //
+    // Entries are moved, so the snapshots that are taken meanwhile are invalid
+    //
+    Table->Sequence++;
+    KeMemoryBarrier();
+
+    if (CountOfClears - i > AGGREGATION_MAXIMUM_PENDING_CLEARS)
+    {
+        Reset = TRUE;
+    }
+
+    for (; !Reset && i < CountOfClears; i++)
+    {
+        Request  = &g_AggregationClearRequests[i & (AGGREGATION_MAXIMUM_PENDING_CLEARS - 1)];
+        Sequence = Request->Sequence;
+
+        if (Sequence < (LONG64)(i + 1))
+        {
+            //
+            // The request is not written yet, it's applied later
+            //
+            break;
+        }
+
+        Tag = Request->Tag;
+        KeMemoryBarrier();
+
+        if (Sequence != (LONG64)(i + 1) || Request->Sequence != Sequence)
+        {
+            //
+            // The request is overwritten by newer clears
+            //
+            Reset = TRUE;
+            break;
+        }
+
+        //
+        // Start after a free entry, so the entries that are moved back
+        // are not moved to the entries that are already checked
+        //
+        for (j = 0; j < AGGREGATION_TABLE_MAXIMUM_ENTRIES; j++)
+        {
+            if (Table->Entries[j].Type == AGGREGATION_TYPE_FREE)
+            {
+                Start = j;
+                break;
+            }
+        }
+
+        for (UINT32 k = 1; k <= AGGREGATION_TABLE_MAXIMUM_ENTRIES; k++)
+        {
+            j = (Start + k) & (AGGREGATION_TABLE_MAXIMUM_ENTRIES - 1);
+
+            //
+            // The removed entry is replaced by the next entries, so the
+            // same index is checked again
+            //
+            while (Table->Entries[j].Type != AGGREGATION_TYPE_FREE && Table->Entries[j].Tag == Tag)
+            {
+                AggregationRemoveEntry(Table, j);
+            }
+        }
+    }
+
+    if (Reset)
+    {
+        RtlZeroMemory(Table->Entries, sizeof(Table->Entries));
+        i = CountOfClears;
+    }
+
+    Table->CountOfAppliedClears  = i;
+    Table->CountOfDroppedUpdates = 0;
+
+    KeMemoryBarrier();
+    Table->Sequence++;
+}
+
+/**
+ * @brief Update an aggregation of the current core
+ * @details called from the script engine (vmx-root), the table of each
+ * core is only updated by the core itself
+ *
+ * @param Tag Tag of the event
+ * @param Type Type of aggregation
+ * @param Key Key of aggregation
+ * @param Value Value to aggregate (ignored for count)
+ *
+ * @return VOID
+ */
+VOID
+AggregationUpdate(UINT64 Tag, AGGREGATION_TYPE Type, UINT64 Key, UINT64 Value)
+{
+    PAGGREGATION_TABLE Table;
+    PAGGREGATION_ENTRY Entry;
+    UINT32             Bucket = 0;
+
+    if (g_AggregationTables == NULL)
+    {
+        return;
+    }
+
+    Table = &g_AggregationTables[KeGetCurrentProcessorNumber()];
+
+    AggregationApplyClears(Table);
+
+    if (Type == AGGREGATION_TYPE_HIST)
+    {
+        Bucket = AggregationGetBucket(Value);
+    }
+
+    Entry = AggregationFindEntry(Table, Tag, Type, Key, Bucket);
+
+    if (Entry == NULL)
+    {
+        Table->CountOfDroppedUpdates++;
+        return;
+    }
+
+    //
+    // The sequence is odd while the entry is updated, so the snapshots
+    // don't use a partially updated entry, only this core writes to the
+    // entry and the stores are not reordered, so a compiler barrier is
+    // enough here
+    //
+    Entry->Sequence++;
+    KeMemoryBarrierWithoutFence();
+
+    if (Entry->Type == AGGREGATION_TYPE_FREE)
+    {
+        Entry->Tag    = Tag;
+        Entry->Key    = Key;
+        Entry->Bucket = Bucket;
+        Entry->Count  = 0;
+        Entry->Value  = 0;
+        Entry->Type   = Type;
+    }
+
+    AggregationApply(Entry, 1, Value);
+
+    KeMemoryBarrierWithoutFence();
+    Entry->Sequence++;
+}
+
+/**
+ * @brief Take a snapshot of an entry of the table of another core
+ *
+ * @param Entry
+ * @param Snapshot
+ *
+ * @return BOOLEAN FALSE if the entry is always being updated
+ */
+static BOOLEAN
+AggregationReadEntry(PAGGREGATION_ENTRY Entry, PAGGREGATION_ENTRY Snapshot)
+{
+    UINT64 Sequence;
+
+    for (UINT32 i = 0; i < AGGREGATION_MAXIMUM_SNAPSHOT_RETRIES; i++)
+    {
+        Sequence = Entry->Sequence;
+
+        if ((Sequence & 1) == 0)
+        {
+            KeMemoryBarrier();
+
+            Snapshot->Tag    = Entry->Tag;
+            Snapshot->Key    = Entry->Key;
+            Snapshot->Type   = Entry->Type;
+            Snapshot->Bucket = Entry->Bucket;
+            Snapshot->Count  = Entry->Count;
+            Snapshot->Value  = Entry->Value;
+
+            KeMemoryBarrier();
+
+            if (Entry->Sequence == Sequence)
+            {
+                return TRUE;
+            }
+        }
+
+        _mm_pause();
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Take a snapshot of the entries of an event in the table of a core
+ * @details The entries of the event are copied to the start of the snapshot
+ *
+ * @param Table
+ * @param Tag Tag of the event
+ * @param Snapshot
+ * @param CountOfEntries Count of the copied entries
+ *
+ * @return BOOLEAN FALSE if the core is always changing its table
+ */
+static BOOLEAN
+AggregationSnapshotTable(PAGGREGATION_TABLE Table, UINT64 Tag, PAGGREGATION_TABLE Snapshot, UINT32 * CountOfEntries)
+{
+    PAGGREGATION_ENTRY Entry;
+    UINT64             Sequence;
+    UINT32             Count;
+    BOOLEAN            IsConsistent;
+
+    for (UINT32 i = 0; i < AGGREGATION_MAXIMUM_SNAPSHOT_RETRIES; i++)
+    {
+        Sequence = Table->Sequence;
+
+        if (Sequence & 1)
+        {
+            _mm_pause();
+            continue;
+        }
+
+        KeMemoryBarrier();
+
+        Count        = 0;
+        IsConsistent = TRUE;
+
+        //
+        // The entries of a cleared event are ignored if the core
+        // has not applied the clear yet
+        //
+        if (!AggregationIsClearPending(Table->CountOfAppliedClears, Tag))
+        {
+            for (UINT32 j = 0; j < AGGREGATION_TABLE_MAXIMUM_ENTRIES; j++)
+            {
+                Entry = &Snapshot->Entries[Count];
+
+                if (!AggregationReadEntry(&Table->Entries[j], Entry))
+                {
+                    IsConsistent = FALSE;
+                    break;
+                }
+
+                if (Entry->Type != AGGREGATION_TYPE_FREE && Entry->Tag == Tag)
+                {
+                    Count++;
+                }
+            }
+        }
+
+        Snapshot->CountOfDroppedUpdates = Table->CountOfDroppedUpdates;
+
+        KeMemoryBarrier();
+
+        if (IsConsistent && Table->Sequence == Sequence)
+        {
+            *CountOfEntries = Count;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Merge the aggregations of an event on all cores
+ * @details could be called from vmx-root, no lock is held and the tables
+ * of other cores are only read
+ *
+ * @param Request The request that the results are merged to it
+ * @param Tag Tag of the event
+ *
+ * @return VOID
+ */
+static VOID
+AggregationMerge(PAGGREGATION_PRINT_REQUEST Request, UINT64 Tag)
+{
+    PAGGREGATION_ENTRY Entry;
+    PAGGREGATION_ENTRY MergedEntry;
+    UINT32             CountOfEntries;
+    UINT32             ProcessorCount = KeQueryActiveProcessorCount(0);
+
+    Request->Tag                   = Tag;
+    Request->IsIncomplete          = FALSE;
+    Request->CountOfDroppedUpdates = 0;
+
+    RtlZeroMemory(Request->Table.Entries, sizeof(Request->Table.Entries));
+
+    for (UINT32 i = 0; i < ProcessorCount; i++)
+    {
+        if (!AggregationSnapshotTable(&g_AggregationTables[i], Tag, &Request->Snapshot, &CountOfEntries))
+        {
+            Request->IsIncomplete = TRUE;
+            continue;
+        }
+
+        Request->CountOfDroppedUpdates += Request->Snapshot.CountOfDroppedUpdates;
+
+        for (UINT32 j = 0; j < CountOfEntries; j++)
+        {
+            Entry       = &Request->Snapshot.Entries[j];
+            MergedEntry = AggregationFindEntry(&Request->Table, Tag, Entry->Type, Entry->Key, Entry->Bucket);
+
+            if (MergedEntry == NULL)
+            {
+                Request->CountOfDroppedUpdates += Entry->Count;
+                continue;
+            }
+
+            if (MergedEntry->Type == AGGREGATION_TYPE_FREE)
+            {
+                *MergedEntry       = *Entry;
+                MergedEntry->Count = 0;
+                MergedEntry->Value = 0;
+            }
+
+            AggregationApply(MergedEntry, Entry->Count, Entry->Value);
+        }
+    }
+}
+
+/**
+ * @brief Compare two merged aggregation entries for sorting the results
+ *
+ * @param Entry1
+ * @param Entry2
+ *
+ * @return BOOLEAN TRUE if Entry1 should be shown after Entry2
+ */
+static BOOLEAN
+AggregationIsAfter(PAGGREGATION_ENTRY Entry1, PAGGREGATION_ENTRY Entry2)
+{
+    if (Entry1->Type != Entry2->Type)
+    {
+        return Entry1->Type > Entry2->Type;
+    }
+
+    if (Entry1->Key != Entry2->Key)
+    {
+        return Entry1->Key > Entry2->Key;
+    }
+
+    return Entry1->Bucket > Entry2->Bucket;
+}
+
+/**
+ * @brief Sort and show the merged results
+ * @details should NOT be called in vmx-root
+ *
+ * @param Request
+ *
+ * @return VOID
+ */
+static VOID
+AggregationShow(PAGGREGATION_PRINT_REQUEST Request)
+{
+    PAGGREGATION_TABLE Table                = &Request->Table;
+    UINT64             Tag                  = Request->Tag;
+    BOOLEAN            Immediate            = Request->ImmediateMessagePassing;
+    UINT32             CountOfMergedEntries = 0;
+    PAGGREGATION_ENTRY Entry;
+    AGGREGATION_ENTRY  Temp;
+    UINT64             BucketStart;
+    UINT64             BucketEnd;
+    LONG               CountOfDroppedPrints;
+    UINT32             j;
+    char               TempBuffer[128] = {0};
+    UINT32             TempBufferLen;
+
+    //
+    // Move the merged entries to the start of the table and sort them
+    //
+    for (UINT32 i = 0; i < AGGREGATION_TABLE_MAXIMUM_ENTRIES; i++)
+    {
+        if (Table->Entries[i].Type == AGGREGATION_TYPE_FREE)
+        {
+            continue;
+        }
+
+        Temp = Table->Entries[i];
+        j    = CountOfMergedEntries++;
+
+        while (j > 0 && AggregationIsAfter(&Table->Entries[j - 1], &Temp))
+        {
+            Table->Entries[j] = Table->Entries[j - 1];
+            j--;
+        }
+
+        Table->Entries[j] = Temp;
+    }
+
+    //
+    // Show the results
+    //
+    for (UINT32 i = 0; i < CountOfMergedEntries; i++)
+    {
+        Entry = &Table->Entries[i];
+
+        switch (Entry->Type)
+        {
+        case AGGREGATION_TYPE_COUNT:
+
+            TempBufferLen = sprintf(TempBuffer, "count(%llx) = %llx\n", Entry->Key, Entry->Count);
+            break;
+
+        case AGGREGATION_TYPE_SUM:
+
+            TempBufferLen = sprintf(TempBuffer, "sum(%llx) = %llx\n", Entry->Key, Entry->Value);
+            break;
+
+        case AGGREGATION_TYPE_MIN:
+
+            TempBufferLen = sprintf(TempBuffer, "min(%llx) = %llx\n", Entry->Key, Entry->Value);
+            break;
+
+        case AGGREGATION_TYPE_MAX:
+
+            TempBufferLen = sprintf(TempBuffer, "max(%llx) = %llx\n", Entry->Key, Entry->Value);
+            break;
+
+        case AGGREGATION_TYPE_HIST:
+
+            BucketStart   = Entry->Bucket == 0 ? 0 : 1ULL << (Entry->Bucket - 1);
+            BucketEnd     = Entry->Bucket == 0 ? 0 : (BucketStart << 1) - 1;
+            TempBufferLen = sprintf(TempBuffer, "hist(%llx) [%llx, %llx] = %llx\n", Entry->Key, BucketStart, BucketEnd, Entry->Count);
+            break;
+
+        default:
+            continue;
+        }
+
+        LogSimpleWithTag(Tag, Immediate, TempBuffer, TempBufferLen + 1);
+    }
+
+    if (Request->CountOfDroppedUpdates != 0)
+    {
+        TempBufferLen = sprintf(TempBuffer, "warning, %llx aggregation updates are dropped as the tables are full\n", Request->CountOfDroppedUpdates);
+        LogSimpleWithTag(Tag, Immediate, TempBuffer, TempBufferLen + 1);
+    }
+
+    if (Request->IsIncomplete)
+    {
+        TempBufferLen = sprintf(TempBuffer, "warning, aggregations of some cores are not shown as they were changing\n");
+        LogSimpleWithTag(Tag, Immediate, TempBuffer, TempBufferLen + 1);
+    }
+
+    CountOfDroppedPrints = InterlockedExchange(&g_AggregationCountOfDroppedPrints, 0);
+
+    if (CountOfDroppedPrints != 0)
+    {
+        TempBufferLen = sprintf(TempBuffer, "warning, %x requests of showing aggregations are dropped\n", CountOfDroppedPrints);
+        LogSimpleWithTag(Tag, Immediate, TempBuffer, TempBufferLen + 1);
+    }
+}
+
+/**
+ * @brief Merge the aggregations of an event on all cores and show them
+ * @details could be called from vmx-root, in that case, the results are
+ * merged at the time of the call but they are shown by the print timer
+ * in vmx non-root
+ *
+ * @param Tag Tag of the event
+ * @param ImmediateMessagePassing
+ *
+ * @return VOID
+ */
+VOID
+AggregationPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing)
+{
+    PAGGREGATION_PRINT_REQUEST Request = NULL;
+    BOOLEAN                    IsVmxRoot;
+
+    if (g_AggregationTables == NULL)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < AGGREGATION_MAXIMUM_PENDING_PRINTS; i++)
+    {
+        if (InterlockedCompareExchange(&g_AggregationPrintRequests[i].State,
+                                       AGGREGATION_PRINT_STATE_MERGING,
+                                       AGGREGATION_PRINT_STATE_FREE) == AGGREGATION_PRINT_STATE_FREE)
+        {
+            Request = &g_AggregationPrintRequests[i];
+            break;
+        }
+    }
+
+    if (Request == NULL)
+    {
+        //
+        // The previous results are not shown yet
+        //
+        InterlockedIncrement(&g_AggregationCountOfDroppedPrints);
+        return;
+    }
+
+    Request->ImmediateMessagePassing = ImmediateMessagePassing;
+
+    AggregationMerge(Request, Tag);
+
+    IsVmxRoot = g_GuestState[KeGetCurrentProcessorNumber()].IsOnVmxRootMode;
+
+    if (!IsVmxRoot && KeGetCurrentIrql() <= DISPATCH_LEVEL)
+    {
+        AggregationShow(Request);
+        InterlockedExchange(&Request->State, AGGREGATION_PRINT_STATE_FREE);
+    }
+    else
+    {
+        InterlockedExchange(&Request->State, AGGREGATION_PRINT_STATE_READY);
+    }
+}
+
+/**
+ * @brief The timer callback of showing the results that are merged in vmx-root
+ *
+ * @param Dpc
+ * @param DeferredContext
+ * @param SystemArgument1
+ * @param SystemArgument2
+ *
+ * @return VOID
+ */
+VOID
+AggregationPrintCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    PAGGREGATION_PRINT_REQUEST Requests = g_AggregationPrintRequests;
+
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+    UNREFERENCED_PARAMETER(SystemArgument1);
+    UNREFERENCED_PARAMETER(SystemArgument2);
+
+    if (Requests == NULL)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < AGGREGATION_MAXIMUM_PENDING_PRINTS; i++)
+    {
+        if (Requests[i].State == AGGREGATION_PRINT_STATE_READY)
+        {
+            AggregationShow(&Requests[i]);
+            InterlockedExchange(&Requests[i].State, AGGREGATION_PRINT_STATE_FREE);
+        }
+    }
+}
+
+/**
+ * @brief Remove the aggregations of an event on all cores
+ * @details could be called from vmx-root, the clear is recorded and each
+ * core removes the entries of the event from its own table before its
+ * next update
+ *
+ * @param Tag Tag of the event
+ *
+ * @return VOID
+ */
+VOID
+AggregationClear(UINT64 Tag)
+{
+    PAGGREGATION_CLEAR_REQUEST Request;
+    LONG64                     Number;
+
+    if (g_AggregationTables == NULL)
+    {
+        return;
+    }
+
+    Number  = InterlockedIncrement64(&g_AggregationCountOfClears) - 1;
+    Request = &g_AggregationClearRequests[Number & (AGGREGATION_MAXIMUM_PENDING_CLEARS - 1)];
+
+    Request->Tag = Tag;
+    InterlockedExchange64(&Request->Sequence, Number + 1);
+}
+
+/**
+ * @brief Deliver the aggregations of an event (if any) and remove them
+ * @details called when the event is cleared (vmx non-root)
+ *
+ * @param Tag Tag of the event
+ *
+ * @return VOID
+ */
+VOID
+AggregationPrintAndClear(UINT64 Tag)
+{
+    UINT32 ProcessorCount = KeQueryActiveProcessorCount(0);
+
+    if (g_AggregationTables == NULL)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < ProcessorCount; i++)
+    {
+        for (UINT32 j = 0; j < AGGREGATION_TABLE_MAXIMUM_ENTRIES; j++)
+        {
+            if (g_AggregationTables[i].Entries[j].Type != AGGREGATION_TYPE_FREE &&
+                g_AggregationTables[i].Entries[j].Tag == Tag)
+            {
+                AggregationPrint(Tag, TRUE);
+                AggregationClear(Tag);
+
+                return;
+            }
+        }
+    }
+}
@@ -29,7 +29,7 @@ ScriptEngineWrapperGetInstructionPointer()
     //
     if (g_GuestState[CurrentProcessorIndex].IsOnVmxRootMode)
     {
-        __vmx_vmread(VMCS_GUEST_RIP, &GuestRip);
+        GuestRip = VmcsCacheRead(VMCS_GUEST_RIP);
         return GuestRip;
     }
     else
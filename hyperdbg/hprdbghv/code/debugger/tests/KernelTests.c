@@ -71,6 +71,32 @@ TestKernelConfigureTagsAndCallTargetFunction(UINT64 Tag1,
     return TargetFuncResult;
 }
 
+/**
+ * @brief Perform the self-checks of the kernel routines that don't
+ * need any event to be triggered
+ * 
+ * @return BOOLEAN TRUE if all the checks were successful
+ */
+BOOLEAN
+TestKernelPerformSelfChecks()
+{
+    BOOLEAN Result = TRUE;
+
+    if (!EptHookPerformMonitorRangesSelfCheck())
+    {
+        LogError("Err, self-check of the monitor ranges failed");
+        Result = FALSE;
+    }
+
+    if (!IdtEmulationPerformPendingInterruptsSelfCheck())
+    {
+        LogError("Err, self-check of the pending interrupts failed");
+        Result = FALSE;
+    }
+
+    return Result;
+}
+
 /**
  * @brief Perform the kernel-side tests
  * 
@@ -105,6 +131,15 @@ TestKernelPerformTests(PDEBUGGER_PERFORM_KERNEL_TESTS KernelTestRequest)
 
     LogInfo("All the kernel events are triggered");
 
+    //
+    // Check the routines that can be tested without triggering events
+    //
+    if (!TestKernelPerformSelfChecks())
+    {
+        KernelTestRequest->KernelStatus = DEBUGGER_ERROR_KERNEL_SELF_CHECK_FAILED;
+        return;
+    }
+
     KernelTestRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
 }
 
@@ -11,260 +11,325 @@
  */
 #include "pch.h"
 /**
- * @brief maximum random value
+ * @brief The tables below are the standard normal ziggurat of Marsaglia and Tsang
+ * @details generated for 128 layers (r = 3.442619855899, v = 9.91256303526217e-3)
+ * and converted to fixed-point as we want to avoid using floating-points in kernel
+ *
  */
-#define MY_RAND_MAX 32768
 
 /**
- * @brief pre-defined log result
- * @details we used this because we want to avoid using floating-points in
- * kernel
+ * @brief Ziggurat acceptance thresholds of each layer (|hz| < K means the sample
+ * is inside the rectangle and can be returned directly)
  */
-int TransparentTableLog[] =
-    {
-        0,
-        69,
-        110,
-        139,
-        161,
-        179,
-        195,
-        208,
-        220,
-        230,
-        240,
-        248,
-        256,
-        264,
-        271,
-        277,
-        283,
-        289,
-        294,
-        300,
-        304,
-        309,
-        314,
-        318,
-        322,
-        326,
-        330,
-        333,
-        337,
-        340,
-        343,
-        347,
-        350,
-        353,
-        356,
-        358,
-        361,
-        364,
-        366,
-        369,
-        371,
-        374,
-        376,
-        378,
-        381,
-        383,
-        385,
-        387,
-        389,
-        391,
-        393,
-        395,
-        397,
-        399,
-        401,
-        403,
-        404,
-        406,
-        408,
-        409,
-        411,
-        413,
-        414,
-        416,
-        417,
-        419,
-        420,
-        422,
-        423,
-        425,
-        426,
-        428,
-        429,
-        430,
-        432,
-        433,
-        434,
-        436,
-        437,
-        438,
-        439,
-        441,
-        442,
-        443,
-        444,
-        445,
-        447,
-        448,
-        449,
-        450,
-        451,
-        452,
-        453,
-        454,
-        455,
-        456,
-        457,
-        458,
-        460,
-        461};
+const UINT32 TransparentZigguratK[TRANSPARENT_ZIGGURAT_LAYERS] = {
+    0x76ad2212, 0x00000000, 0x600f1b53, 0x6ce447a6, 0x725b46a2, 0x7560051d, 0x774921eb, 0x789a25bd,
+    0x799045c3, 0x7a4bce5d, 0x7adf629f, 0x7b5682a6, 0x7bb8a8c6, 0x7c0ae722, 0x7c50cce7, 0x7c8cec5b,
+    0x7cc12cd6, 0x7ceefed2, 0x7d177e0b, 0x7d3b8883, 0x7d5bce6c, 0x7d78dd64, 0x7d932886, 0x7dab0e57,
+    0x7dc0dd30, 0x7dd4d688, 0x7de73185, 0x7df81cea, 0x7e07c0a3, 0x7e163efa, 0x7e23b587, 0x7e303dfd,
+    0x7e3beec2, 0x7e46db77, 0x7e51155d, 0x7e5aabb3, 0x7e63abf7, 0x7e6c222c, 0x7e741906, 0x7e7b9a18,
+    0x7e82adfa, 0x7e895c63, 0x7e8fac4b, 0x7e95a3fb, 0x7e9b4924, 0x7ea0a0ef, 0x7ea5b00d, 0x7eaa7ac3,
+    0x7eaf04f3, 0x7eb3522a, 0x7eb765a5, 0x7ebb4259, 0x7ebeeafd, 0x7ec2620a, 0x7ec5a9c4, 0x7ec8c441,
+    0x7ecbb365, 0x7ece78ed, 0x7ed11671, 0x7ed38d62, 0x7ed5df12, 0x7ed80cb4, 0x7eda175c, 0x7edc0005,
+    0x7eddc78e, 0x7edf6ebf, 0x7ee0f647, 0x7ee25ebe, 0x7ee3a8a9, 0x7ee4d473, 0x7ee5e276, 0x7ee6d2f5,
+    0x7ee7a620, 0x7ee85c10, 0x7ee8f4cd, 0x7ee97047, 0x7ee9ce59, 0x7eea0eca, 0x7eea3147, 0x7eea3568,
+    0x7eea1aab, 0x7ee9e071, 0x7ee98602, 0x7ee90a88, 0x7ee86d08, 0x7ee7ac6a, 0x7ee6c769, 0x7ee5bc9c,
+    0x7ee48a67, 0x7ee32efc, 0x7ee1a857, 0x7edff42f, 0x7ede0ffa, 0x7edbf8d9, 0x7ed9ab94, 0x7ed7248d,
+    0x7ed45fae, 0x7ed1585c, 0x7ece095f, 0x7eca6ccb, 0x7ec67be2, 0x7ec22eee, 0x7ebd7d1a, 0x7eb85c35,
+    0x7eb2c075, 0x7eac9c20, 0x7ea5df27, 0x7e9e769f, 0x7e964c16, 0x7e8d44ba, 0x7e834033, 0x7e781728,
+    0x7e6b9933, 0x7e5d8a1a, 0x7e4d9ded, 0x7e3b737a, 0x7e268c2f, 0x7e0e3ff5, 0x7df1aa5d, 0x7dcf8c72,
+    0x7da61a1e, 0x7d72a0fb, 0x7d30e097, 0x7cd9b4ab, 0x7c600f1a, 0x7ba90bdc, 0x7a722176, 0x77d664e5,
+};
 
 /**
- * @brief Generate a random number by utilizing RDTSC instruction.
- *
- * Masking 16 LSB of the measured clock time.
- * @return UINT32 
+ * @brief Right edge of each layer (x[i]) in 16.16 fixed-point format
  */
-UINT32
-TransparentGetRand()
-{
-    UINT64 Tsc;
-    UINT32 Rand;
+const UINT32 TransparentZigguratW[TRANSPARENT_ZIGGURAT_LAYERS] = {
+    0x0003b68d, 0x000045b7, 0x00005ce5, 0x00006d32, 0x00007a39, 0x0000854a, 0x00008f06, 0x000097cc,
+    0x00009fd6, 0x0000a74a, 0x0000ae45, 0x0000b4dc, 0x0000bb1d, 0x0000c115, 0x0000c6ce, 0x0000cc50,
+    0x0000d1a0, 0x0000d6c6, 0x0000dbc4, 0x0000e09f, 0x0000e55b, 0x0000e9fa, 0x0000ee7e, 0x0000f2eb,
+    0x0000f742, 0x0000fb85, 0x0000ffb6, 0x000103d5, 0x000107e4, 0x00010be6, 0x00010fd9, 0x000113c0,
+    0x0001179c, 0x00011b6c, 0x00011f33, 0x000122f1, 0x000126a6, 0x00012a53, 0x00012df9, 0x00013199,
+    0x00013532, 0x000138c5, 0x00013c54, 0x00013fdd, 0x00014362, 0x000146e4, 0x00014a61, 0x00014ddc,
+    0x00015154, 0x000154ca, 0x0001583e, 0x00015bb0, 0x00015f21, 0x00016290, 0x00016600, 0x0001696e,
+    0x00016cdd, 0x0001704c, 0x000173bc, 0x0001772d, 0x00017a9f, 0x00017e12, 0x00018187, 0x000184ff,
+    0x00018878, 0x00018bf5, 0x00018f75, 0x000192f8, 0x0001967f, 0x00019a0a, 0x00019d9a, 0x0001a12e,
+    0x0001a4c8, 0x0001a867, 0x0001ac0c, 0x0001afb8, 0x0001b36a, 0x0001b724, 0x0001bae5, 0x0001beae,
+    0x0001c280, 0x0001c65c, 0x0001ca41, 0x0001ce30, 0x0001d22a, 0x0001d630, 0x0001da42, 0x0001de61,
+    0x0001e28d, 0x0001e6c8, 0x0001eb13, 0x0001ef6e, 0x0001f3da, 0x0001f859, 0x0001fceb, 0x00020192,
+    0x0002064f, 0x00020b24, 0x00021012, 0x0002151c, 0x00021a42, 0x00021f88, 0x000224ef, 0x00022a7a,
+    0x0002302d, 0x00023609, 0x00023c14, 0x00024252, 0x000248c6, 0x00024f77, 0x0002566b, 0x00025daa,
+    0x0002653b, 0x00026d2a, 0x00027582, 0x00027e53, 0x000287af, 0x000291ac, 0x00029c69, 0x0002a80a,
+    0x0002b4c4, 0x0002c2dc, 0x0002d2b8, 0x0002e4f4, 0x0002fa8c, 0x0003154e, 0x0003391c, 0x00037150,
+};
 
-    Tsc  = __rdtsc();
-    Rand = Tsc & 0xffff;
-
-    return Rand;
-}
+/**
+ * @brief Density at the right edge of each layer (exp(-x[i]^2 / 2)) in 8.24
+ * fixed-point format
+ */
+const UINT32 TransparentZigguratF[TRANSPARENT_ZIGGURAT_LAYERS] = {
+    0x01000000, 0x00f6ae78, 0x00efb039, 0x00e9bd3a, 0x00e46c92, 0x00df8cdb, 0x00db0216, 0x00d6ba86,
+    0x00d2aa0c, 0x00cec7f0, 0x00cb0da6, 0x00c7761e, 0x00c3fd53, 0x00c0a003, 0x00bd5b7d, 0x00ba2d82,
+    0x00b7142b, 0x00b40dd6, 0x00b11918, 0x00ae34b7, 0x00ab5f9d, 0x00a898d4, 0x00a5df84, 0x00a332e7,
+    0x00a0924f, 0x009dfd1c, 0x009b72bd, 0x0098f2b1, 0x00967c7d, 0x00940fb5, 0x0091abf3, 0x008f50d9,
+    0x008cfe12, 0x008ab34c, 0x0088703e, 0x008634a1, 0x00840036, 0x0081d2c0, 0x007fac06, 0x007d8bd3,
+    0x007b71f6, 0x00795e3e, 0x00775081, 0x00754894, 0x00734650, 0x00714990, 0x006f5230, 0x006d600f,
+    0x006b730e, 0x00698b0e, 0x0067a7f2, 0x0065c9a1, 0x0063efff, 0x00621af5, 0x00604a6a, 0x005e7e49,
+    0x005cb67c, 0x005af2ef, 0x0059338f, 0x00577849, 0x0055c10b, 0x00540dc5, 0x00525e66, 0x0050b2e0,
+    0x004f0b22, 0x004d6720, 0x004bc6cc, 0x004a2a19, 0x004890fb, 0x0046fb65, 0x0045694e, 0x0043daaa,
+    0x00424f6f, 0x0040c794, 0x003f430e, 0x003dc1d7, 0x003c43e4, 0x003ac92f, 0x003951b0, 0x0037dd60,
+    0x00366c38, 0x0034fe32, 0x00339348, 0x00322b76, 0x0030c6b5, 0x002f6502, 0x002e0658, 0x002caab3,
+    0x002b520f, 0x0029fc6b, 0x0028a9c3, 0x00275a15, 0x00260d60, 0x0024c3a1, 0x00237cd9, 0x00223907,
+    0x0020f82a, 0x001fba45, 0x001e7f57, 0x001d4763, 0x001c126b, 0x001ae072, 0x0019b17c, 0x0018858d,
+    0x00175cac, 0x001636dd, 0x00151429, 0x0013f498, 0x0012d834, 0x0011bf07, 0x0010a91f, 0x000f968a,
+    0x000e8758, 0x000d7b9c, 0x000c736e, 0x000b6ee5, 0x000a6e20, 0x00097141, 0x00087873, 0x000783e5,
+    0x000693d6, 0x0005a890, 0x0004c274, 0x0003e201, 0x000307e9, 0x00023537, 0x00016ba9, 0x0000aef5,
+};
 
 /**
- * @brief Integer power function definition.
+ * @brief Generate a random number by utilizing a per-core xorshift64* generator
+ * @details The state is seeded from the time-stamp counter on the first use
+ * in each core, so there is no shared state between cores
  *
- * @params x Base Value 
- * @params p Power Value 
- * @return int 
+ * @param TransparencyState The transparency state of the current core
+ * @return UINT64
  */
-int
-TransparentPow(int x, int p)
+UINT64
+TransparentGetRand(PVM_EXIT_TRANSPARENCY TransparencyState)
 {
-    int Res = 1;
-    for (int i = 0; i < p; i++)
+    UINT64 State = TransparencyState->RandomState;
+
+    if (State == NULL)
     {
-        Res = Res * x;
+        //
+        // Seed the generator, the state should never be zero
+        //
+        State = __rdtsc() ^ ((UINT64)TransparencyState * 0x9e3779b97f4a7c15ull);
+
+        if (State == NULL)
+        {
+            State = 0x9e3779b97f4a7c15ull;
+        }
     }
-    return Res;
+
+    State ^= State >> 12;
+    State ^= State << 25;
+    State ^= State >> 27;
+
+    TransparencyState->RandomState = State;
+
+    return State * 0x2545f4914f6cdd1dull;
 }
 
 /**
- * @brief Integer Natural Logarithm function estimation.
+ * @brief Integer estimation of exp(-x)
  *
- * @params x input value 
- * @return int 
+ * @param x input value in 16.16 fixed-point format
+ * @return UINT32 result in 8.24 fixed-point format
  */
-int
-TransparentLog(int x)
+UINT32
+TransparentExpNeg(UINT64 x)
 {
-    int n     = x;
-    int Digit = 0;
+    UINT64 Shift;
+    INT64  Remainder;
+    INT64  Term;
+    INT64  Sum;
 
-    while (n >= 100)
+    //
+    // exp(-17) is smaller than the precision of the result
+    //
+    if (x >= (17 << 16))
     {
-        n = n / 10;
-        Digit++;
+        return 0;
     }
 
     //
-    //Use pre-defined values of logarithms and estimate the total value
+    // exp(-x) = 2^(-Shift) * exp(-Remainder) where Remainder is in [0, ln2)
+    //
+    Shift    = x / TRANSPARENT_LN2_Q16;
+    Remainder = (INT64)(x - Shift * TRANSPARENT_LN2_Q16) << 14;
+
     //
-    return TransparentTableLog[n] / 100 + (Digit * 23) / 10;
+    // Taylor series of exp(-Remainder) in 2.30 fixed-point format
+    //
+    Term = 1ll << 30;
+    Sum  = Term;
+
+    for (INT64 i = 1; i <= 10; i++)
+    {
+        Term = -((Term * Remainder) >> 30) / i;
+        Sum += Term;
+    }
+
+    return (UINT32)((Sum >> 6) >> Shift);
 }
+
 /**
- * @brief Integer root function estimation.
+ * @brief Integer estimation of -ln(x / 2^32)
  *
- * @params x input value 
- * @return int 
+ * @param x input value (should not be zero)
+ * @return UINT64 result in 16.16 fixed-point format
  */
-int
-TransparentSqrt(int x)
+UINT64
+TransparentNegLog(UINT32 x)
 {
-    int Res = 0;
-    int Bit;
+    ULONG  Msb;
+    INT64  Mantissa;
+    INT64  Ratio;
+    INT64  RatioSquare;
+    INT64  Term;
+    INT64  Sum;
+
+    _BitScanReverse(&Msb, x);
 
     //
-    // The second-to-top bit is set.
+    // x = 2^(Msb - 32) * Mantissa where Mantissa is in [1, 2) (2.30 format)
     //
-    Bit = 1 << 30;
+    Mantissa = Msb <= 30 ? (INT64)x << (30 - Msb) : (INT64)x >> (Msb - 30);
 
     //
-    // "Bit" starts at the highest power of four <= the argument.
+    // ln(Mantissa) = 2 * atanh((Mantissa - 1) / (Mantissa + 1)), the
+    // ratio is less than 1/3 so the series converges quickly
     //
-    while (Bit > x)
-        Bit >>= 2;
+    Ratio       = ((Mantissa - (1ll << 30)) << 30) / (Mantissa + (1ll << 30));
+    RatioSquare = (Ratio * Ratio) >> 30;
+    Term        = Ratio;
+    Sum         = Ratio;
 
-    while (Bit != 0)
+    for (INT64 i = 3; i <= 19; i += 2)
     {
-        if (x >= Res + Bit)
-        {
-            x -= Res + Bit;
-            Res = (Res >> 1) + Bit;
-        }
-        else
-            Res >>= 1;
-        Bit >>= 2;
+        Term = (Term * RatioSquare) >> 30;
+        Sum += Term / i;
     }
-    return Res;
+
+    return (UINT64)(((INT64)(32 - Msb) * TRANSPARENT_LN2_Q30 - 2 * Sum) >> 14);
 }
 
 /**
- * @brief Integer Gaussian Random Number Generator(GRNG) based on Box-Muller method. A Float to Integer 
- * mapping is used in the function.
+ * @brief Precompute the ziggurat layers for the targeted Gaussian distribution
  *
- * @params Average Mean 
- * @parans Sigma Standard Deviation of the targeted Gaussian Distribution
- * @return int 
+ * @param Table The table that should be filled
+ * @param Average Mean
+ * @param Sigma Standard Deviation of the targeted Gaussian Distribution
+ * @return VOID
  */
-int
-TransparentRandn(int Average, int Sigma)
+VOID
+TransparentGaussianTableInitialize(PTRANSPARENCY_GAUSSIAN_TABLE Table, UINT64 Average, UINT64 Sigma)
 {
-    int U1, r1, U2, r2, W, Mult;
-    int X1, X2 = 0, XS1;
-    int State   = 0;
-    int LogTemp = 0;
+    //
+    // Larger deviations are meaningless for the timing of a vm-exit, and
+    // clamping it keeps the products of the fast path in 64-bit
+    //
+    if (Sigma > TRANSPARENT_MAXIMUM_SIGMA)
+    {
+        Sigma = TRANSPARENT_MAXIMUM_SIGMA;
+    }
+
+    Table->Average = Average;
+    Table->Sigma   = Sigma;
 
-    if (State == 1)
+    //
+    // Right edge of each layer scaled by sigma (24.8 fixed-point format)
+    //
+    for (UINT32 i = 0; i < TRANSPARENT_ZIGGURAT_LAYERS; i++)
     {
-        State = !State;
-        return (Average + Sigma * X2);
+        Table->ScaledW[i] = (UINT32)((Sigma * TransparentZigguratW[i]) >> 8);
     }
+}
+
+/**
+ * @brief Apply the mean and the standard deviation to a standard normal sample
+ *
+ * @param Table The precomputed table
+ * @param x The standard normal sample in 16.16 fixed-point format
+ * @return UINT64
+ */
+UINT64
+TransparentGaussianScale(PTRANSPARENCY_GAUSSIAN_TABLE Table, INT64 x)
+{
+    INT64 Result = (INT64)Table->Average + ((x * (INT64)Table->Sigma) >> 16);
+
+    //
+    // The result is added to a time-stamp counter, so it can't be negative
+    //
+    return Result < 0 ? 0 : (UINT64)Result;
+}
 
-    do
+/**
+ * @brief Integer Gaussian Random Number Generator(GRNG) based on the ziggurat method
+ * @details The fast path (about 98.8% of samples) only needs one random number, a
+ * comparison and a multiplication, the remaining samples are handled by the
+ * fixed-point estimation of the wedges and the tail of the distribution
+ *
+ * @param TransparencyState The transparency state of the current core
+ * @param Table The precomputed table of the targeted Gaussian distribution
+ * @return UINT64
+ */
+UINT64
+TransparentRandn(PVM_EXIT_TRANSPARENCY TransparencyState, PTRANSPARENCY_GAUSSIAN_TABLE Table)
+{
+    UINT64 Rand;
+    INT64  Hz;
+    UINT32 Iz;
+    INT64  x;
+    INT64  y;
+    UINT32 Uniform;
+    UINT32 Density;
+
+    for (;;)
     {
-        r1 = TransparentGetRand();
-        r2 = TransparentGetRand();
+        //
+        // Upper bits are used as the sample and the lower bits as the layer
+        //
+        Rand = TransparentGetRand(TransparencyState);
+        Hz   = (INT32)(Rand >> 32);
+        Iz   = Rand & (TRANSPARENT_ZIGGURAT_LAYERS - 1);
 
-        U1 = (r1 % MY_RAND_MAX) - (MY_RAND_MAX / 2);
+        if ((UINT64)(Hz < 0 ? -Hz : Hz) < TransparentZigguratK[Iz])
+        {
+            //
+            // Inside the rectangle of the layer (fast path)
+            //
+            INT64 Result = (INT64)Table->Average + ((Hz * (INT64)Table->ScaledW[Iz]) >> 39);
 
-        U2 = (r2 % MY_RAND_MAX) - (MY_RAND_MAX / 2);
+            return Result < 0 ? 0 : (UINT64)Result;
+        }
 
-        W = U1 * U1 + U2 * U2;
-    } while (W >= MY_RAND_MAX * MY_RAND_MAX / 2 || W == 0);
+        //
+        // Sample in 16.16 fixed-point format
+        //
+        x = (Hz * (INT64)TransparentZigguratW[Iz]) >> 31;
 
-    LogTemp = (TransparentLog(W) - TransparentLog(MY_RAND_MAX * MY_RAND_MAX));
+        if (Iz == 0)
+        {
+            //
+            // Base layer, sample from the tail of the distribution
+            //
+            do
+            {
+                Rand = TransparentGetRand(TransparencyState);
 
-    Mult = TransparentSqrt((-2 * LogTemp) * (MY_RAND_MAX * MY_RAND_MAX / W));
+                x = (INT64)((TransparentNegLog((UINT32)(Rand >> 32) | 1) << 16) / TRANSPARENT_ZIGGURAT_R_Q16);
+                y = (INT64)TransparentNegLog((UINT32)Rand | 1);
 
-    X1  = U1 * Mult / MY_RAND_MAX;
-    XS1 = U1 * Mult;
+            } while (y + y < ((x * x) >> 16));
 
-    X2 = U2 * Mult / MY_RAND_MAX;
+            x += TRANSPARENT_ZIGGURAT_R_Q16;
 
-    State = !State;
+            return TransparentGaussianScale(Table, Hz > 0 ? x : -x);
+        }
 
-    return (Average + (Sigma * XS1) / MY_RAND_MAX);
+        //
+        // Check whether the sample is below the curve in the wedge of the layer
+        //
+        Uniform = (UINT32)(TransparentGetRand(TransparencyState) >> 40);
+        Density = TransparentZigguratF[Iz] +
+                  (UINT32)(((UINT64)Uniform * (TransparentZigguratF[Iz - 1] - TransparentZigguratF[Iz])) >> 24);
+
+        if (Density < TransparentExpNeg((UINT64)(x * x) >> 17))
+        {
+            return TransparentGaussianScale(Table, x);
+        }
+    }
 }
 
 /**
@@ -406,6 +471,17 @@ TransparentHideDebugger(PDEBUGGER_HIDE_AND_TRANSPARENT_DEBUGGER_MODE Measurement
         g_TransparentModeMeasurements->RdtscMedian            = Measurements->RdtscMedian;
         g_TransparentModeMeasurements->RdtscStandardDeviation = Measurements->RdtscStandardDeviation;
 
+        //
+        // Precompute the gaussian samplers of the measurements
+        //
+        TransparentGaussianTableInitialize(&g_TransparentModeMeasurements->CpuidGaussianTable,
+                                           Measurements->CpuidAverage,
+                                           Measurements->CpuidStandardDeviation);
+
+        TransparentGaussianTableInitialize(&g_TransparentModeMeasurements->RdtscGaussianTable,
+                                           Measurements->RdtscAverage,
+                                           Measurements->RdtscStandardDeviation);
+
         //
         // add the new process name or Id to the list
         //
@@ -633,9 +709,8 @@ TransparentModeStart(PGUEST_REGS GuestRegs, ULONG ProcessorIndex, UINT32 ExitRea
             // It's a new rdtscp, let's save the new value
             //
             CurrentVmState->TransparencyState.RevealedTimeStampCounterByRdtsc +=
-                TransparentRandn(g_TransparentModeMeasurements->CpuidAverage,
-                                 g_TransparentModeMeasurements->CpuidStandardDeviation);
-            ;
+                TransparentRandn(&CurrentVmState->TransparencyState,
+                                 &g_TransparentModeMeasurements->RdtscGaussianTable);
         }
 
         //
@@ -668,8 +743,8 @@ TransparentModeStart(PGUEST_REGS GuestRegs, ULONG ProcessorIndex, UINT32 ExitRea
         //  we need to store it somewhere to remeber this behavior
         //
         CurrentVmState->TransparencyState.RevealedTimeStampCounterByRdtsc +=
-            TransparentRandn(g_TransparentModeMeasurements->CpuidAverage,
-                             g_TransparentModeMeasurements->CpuidStandardDeviation);
+            TransparentRandn(&CurrentVmState->TransparencyState,
+                             &g_TransparentModeMeasurements->CpuidGaussianTable);
 
         CurrentVmState->TransparencyState.CpuidAfterRdtscDetected = TRUE;
     }
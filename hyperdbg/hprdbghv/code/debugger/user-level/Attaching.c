@@ -527,6 +527,10 @@ AttachingHandleEntrypointDebugBreak(UINT32 CurrentProcessorIndex, PGUEST_REGS Gu
 
 /**
  * @brief Allocate a nop-sled buffer 
+ * @details Paused threads don't spin on CPUIDs, instead they spin on a
+ * pause loop which polls the wake flag of the buffer and a CPUID (vm-exit)
+ * is only executed when there is a pending command for the process
+ *
  * @param ReservedBuffAddress
  * @param ProcessId
  * 
@@ -538,6 +542,21 @@ AttachingAdjustNopSledBuffer(UINT64 ReservedBuffAddress, UINT32 ProcessId)
     PEPROCESS  SourceProcess;
     KAPC_STATE State = {0};
 
+    //
+    // Disassembly of section .text:
+    // 0000000000000000 <PauseLoop>:
+    // 0:  f3 90                   pause
+    // 2:  80 3d xx xx xx xx 00    cmp    BYTE PTR [WakeFlag], 0x0
+    // 9:  74 f5                   je     0 <PauseLoop>
+    // b:  0f a2                   cpuid
+    // d:  eb f1                   jmp    0 <PauseLoop>
+    //
+    // The same bytes are used for both 64-bit and 32-bit threads, the only
+    // difference is the operand of cmp which is RIP-relative in long mode
+    // and an absolute address in the compatibility mode
+    //
+    UINT8 PauseLoop[] = {0xf3, 0x90, 0x80, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xf5, 0x0f, 0xa2, 0xeb, 0xf1};
+
     if (PsLookupProcessByProcessId(ProcessId, &SourceProcess) != STATUS_SUCCESS)
     {
         //
@@ -556,23 +575,22 @@ AttachingAdjustNopSledBuffer(UINT64 ReservedBuffAddress, UINT32 ProcessId)
         memset(ReservedBuffAddress, 0x90, PAGE_SIZE);
 
         //
-        // Set jmps to form a loop (little endians)
+        // Set the loop of 64-bit threads (the displacement is relative to
+        // the end of the cmp instruction)
+        //
+        *(INT32 *)(PauseLoop + 4) = USERMODE_NOP_SLED_WAKE_FLAG_OFFSET - (USERMODE_NOP_SLED_LOOP64_OFFSET + 9);
+        memcpy(ReservedBuffAddress + USERMODE_NOP_SLED_LOOP64_OFFSET, PauseLoop, sizeof(PauseLoop));
+
         //
-        // Disassembly of section .text:
-        // 0000000000000000 <NopLoop>:
-        // 0:  90                      nop
-        // 1:  90                      nop
-        // 2:  90                      nop
-        // 3:  90                      nop
-        // 4:  90                      nop
-        // 5:  90                      nop
-        // 6:  90                      nop
-        // 7:  90                      nop
-        // 8:  0f a2                   cpuid
-        // a:  eb f4                   jmp    0 <NopLoop>
+        // Set the loop of 32-bit threads
         //
-        *(UINT16 *)(ReservedBuffAddress + PAGE_SIZE - 4) = 0xa20f;
-        *(UINT16 *)(ReservedBuffAddress + PAGE_SIZE - 2) = 0xf4eb;
+        *(UINT32 *)(PauseLoop + 4) = (UINT32)(ReservedBuffAddress + USERMODE_NOP_SLED_WAKE_FLAG_OFFSET);
+        memcpy(ReservedBuffAddress + USERMODE_NOP_SLED_LOOP32_OFFSET, PauseLoop, sizeof(PauseLoop));
+
+        //
+        // No command is pending for now
+        //
+        *(UINT8 *)(ReservedBuffAddress + USERMODE_NOP_SLED_WAKE_FLAG_OFFSET) = 0;
 
         KeUnstackDetachProcess(&State);
 
@@ -588,6 +606,63 @@ AttachingAdjustNopSledBuffer(UINT64 ReservedBuffAddress, UINT32 ProcessId)
     return TRUE;
 }
 
+/**
+ * @brief Set or clear the wake flag of the nop-sled buffer
+ * @details This function can be used in vmx-root (only in the context of
+ * the target process) and in vmx non-root
+ *
+ * @param ProcessDebuggingDetail
+ * @param Wake
+ * 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+AttachingSetNopSledWakeFlag(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail, BOOLEAN Wake)
+{
+    PEPROCESS  SourceProcess;
+    KAPC_STATE State       = {0};
+    UINT8      WakeFlag    = Wake ? 1 : 0;
+    UINT64     FlagAddress = ProcessDebuggingDetail->UsermodeReservedBuffer + USERMODE_NOP_SLED_WAKE_FLAG_OFFSET;
+
+    if (g_GuestState[KeGetCurrentProcessorNumber()].IsOnVmxRootMode)
+    {
+        //
+        // The page is accessed by the paused threads, so we can safely
+        // write it through the page tables of the target process
+        //
+        return MemoryMapperWriteMemorySafeOnTargetProcess(FlagAddress, &WakeFlag, sizeof(UINT8));
+    }
+
+    if (PsLookupProcessByProcessId(ProcessDebuggingDetail->ProcessId, &SourceProcess) != STATUS_SUCCESS)
+    {
+        //
+        // if the process not found
+        //
+        return FALSE;
+    }
+
+    __try
+    {
+        KeStackAttachProcess(SourceProcess, &State);
+
+        *(volatile UINT8 *)FlagAddress = WakeFlag;
+
+        KeUnstackDetachProcess(&State);
+
+        ObDereferenceObject(SourceProcess);
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        KeUnstackDetachProcess(&State);
+
+        ObDereferenceObject(SourceProcess);
+
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
 /**
  * @brief Check page-faults with user-debugger
  * @param CurrentProcessorIndex
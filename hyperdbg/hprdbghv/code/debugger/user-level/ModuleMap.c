@@ -0,0 +1,668 @@
+/**
+ * @file ModuleMap.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Map of loaded modules of user-mode processes
+ * @details The modules of a process are kept between the requests, each
+ * time that the loader's list is walked, only the names of new modules
+ * are read from the target process, the list is walked without holding
+ * the lock of module maps and the new list of modules is then published
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize the list of module maps
+ *
+ * @return VOID
+ */
+VOID
+ModuleMapInitialize()
+{
+    InitializeListHead(&g_ModuleMapsListHead);
+    g_CountOfModuleMaps = 0;
+}
+
+/**
+ * @brief Release a reference to a list of modules
+ * @details The list is freed when the last reference is released
+ *
+ * @param List
+ *
+ * @return VOID
+ */
+VOID
+ModuleMapReleaseList(PUSERMODE_MODULE_MAP_LIST List)
+{
+    if (List == NULL || InterlockedDecrement(&List->ReferenceCount) != 0)
+    {
+        return;
+    }
+
+    if (List->Modules != NULL)
+    {
+        ExFreePoolWithTag(List->Modules, POOLTAG);
+    }
+
+    if (List->SortedIndexes != NULL)
+    {
+        ExFreePoolWithTag(List->SortedIndexes, POOLTAG);
+    }
+
+    ExFreePoolWithTag(List, POOLTAG);
+}
+
+/**
+ * @brief Free a module map
+ *
+ * @param ModuleMap
+ *
+ * @return VOID
+ */
+VOID
+ModuleMapFree(PUSERMODE_MODULE_MAP ModuleMap)
+{
+    ModuleMapReleaseList(ModuleMap->List);
+
+    ExFreePoolWithTag(ModuleMap, POOLTAG);
+}
+
+/**
+ * @brief Free all of the module maps
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+ModuleMapUninitialize()
+{
+    PLIST_ENTRY Entry;
+
+    if (g_ModuleMapsListHead.Flink == NULL)
+    {
+        //
+        // Not initialized
+        //
+        return;
+    }
+
+    SpinlockLock(&g_ModuleMapsLock);
+
+    while (!IsListEmpty(&g_ModuleMapsListHead))
+    {
+        Entry = RemoveHeadList(&g_ModuleMapsListHead);
+        ModuleMapFree(CONTAINING_RECORD(Entry, USERMODE_MODULE_MAP, ModuleMapsList));
+    }
+
+    g_CountOfModuleMaps = 0;
+
+    SpinlockUnlock(&g_ModuleMapsLock);
+}
+
+/**
+ * @brief Find the module that contains an address
+ *
+ * @param List
+ * @param Address
+ *
+ * @return PUSERMODE_MODULE_MAP_ENTRY NULL if not found
+ */
+PUSERMODE_MODULE_MAP_ENTRY
+ModuleMapFindByAddress(PUSERMODE_MODULE_MAP_LIST List, UINT64 Address)
+{
+    PUSERMODE_MODULE_MAP_ENTRY Module;
+    UINT32                     Low  = 0;
+    UINT32                     High = List->CountOfModules;
+    UINT32                     Middle;
+
+    //
+    // Find the last module that its base address is less than or
+    // equal to the address
+    //
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (List->Modules[List->SortedIndexes[Middle]].Details.BaseAddress <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == 0)
+    {
+        return NULL;
+    }
+
+    Module = &List->Modules[List->SortedIndexes[Low - 1]];
+
+    if (Address >= Module->Details.BaseAddress + max(Module->SizeOfImage, 1))
+    {
+        return NULL;
+    }
+
+    return Module;
+}
+
+/**
+ * @brief Find or create the module map of a process
+ * @details the lock of module maps should be held by the caller
+ *
+ * @param ProcessId
+ * @param Eprocess
+ *
+ * @return PUSERMODE_MODULE_MAP NULL if there is not enough memory
+ */
+PUSERMODE_MODULE_MAP
+ModuleMapGet(UINT32 ProcessId, PEPROCESS Eprocess)
+{
+    PUSERMODE_MODULE_MAP ModuleMap;
+    PLIST_ENTRY          TempList = &g_ModuleMapsListHead;
+
+    while (&g_ModuleMapsListHead != TempList->Flink)
+    {
+        TempList  = TempList->Flink;
+        ModuleMap = CONTAINING_RECORD(TempList, USERMODE_MODULE_MAP, ModuleMapsList);
+
+        if (ModuleMap->ProcessId == ProcessId)
+        {
+            if (ModuleMap->Eprocess != Eprocess)
+            {
+                //
+                // The process id is reused by another process
+                //
+                ModuleMapReleaseList(ModuleMap->List);
+
+                ModuleMap->List     = NULL;
+                ModuleMap->Eprocess = Eprocess;
+                ModuleMap->Generation++;
+            }
+
+            //
+            // Keep the recently used maps at the head of the list
+            //
+            RemoveEntryList(&ModuleMap->ModuleMapsList);
+            InsertHeadList(&g_ModuleMapsListHead, &ModuleMap->ModuleMapsList);
+
+            return ModuleMap;
+        }
+    }
+
+    if (g_CountOfModuleMaps == USERMODE_MODULE_MAP_MAXIMUM_PROCESSES)
+    {
+        //
+        // Remove the least recently used map
+        //
+        TempList = RemoveTailList(&g_ModuleMapsListHead);
+        ModuleMapFree(CONTAINING_RECORD(TempList, USERMODE_MODULE_MAP, ModuleMapsList));
+        g_CountOfModuleMaps--;
+    }
+
+    ModuleMap = ExAllocatePoolWithTag(NonPagedPool, sizeof(USERMODE_MODULE_MAP), POOLTAG);
+
+    if (ModuleMap == NULL)
+    {
+        return NULL;
+    }
+
+    RtlZeroMemory(ModuleMap, sizeof(USERMODE_MODULE_MAP));
+
+    ModuleMap->ProcessId = ProcessId;
+    ModuleMap->Eprocess  = Eprocess;
+
+    InsertHeadList(&g_ModuleMapsListHead, &ModuleMap->ModuleMapsList);
+    g_CountOfModuleMaps++;
+
+    return ModuleMap;
+}
+
+/**
+ * @brief Add a module (that is found in the loader's list) to the new
+ * list of modules
+ * @details the name of the module is only read if the module is not
+ * available in the previous list
+ *
+ * @param OldList The previous list of modules (might be NULL)
+ * @param NewList
+ * @param BaseAddress
+ * @param Entrypoint
+ * @param SizeOfImage
+ * @param FullDllName
+ * @param FullDllNameLength
+ * @param IsChanged
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ModuleMapAddModule(PUSERMODE_MODULE_MAP_LIST OldList,
+                   PUSERMODE_MODULE_MAP_LIST NewList,
+                   UINT64                    BaseAddress,
+                   UINT64                    Entrypoint,
+                   UINT64                    SizeOfImage,
+                   PWCH                      FullDllName,
+                   UINT16                    FullDllNameLength,
+                   PBOOLEAN                  IsChanged)
+{
+    PUSERMODE_MODULE_MAP_ENTRY OldModule = NULL;
+    PUSERMODE_MODULE_MAP_ENTRY NewModule;
+    PUSERMODE_MODULE_MAP_ENTRY Buffer;
+
+    if (NewList->CountOfModules == NewList->Capacity)
+    {
+        //
+        // Grow the list
+        //
+        Buffer = ExAllocatePoolWithTag(NonPagedPool, NewList->Capacity * 2 * sizeof(USERMODE_MODULE_MAP_ENTRY), POOLTAG);
+
+        if (Buffer == NULL)
+        {
+            return FALSE;
+        }
+
+        RtlCopyMemory(Buffer, NewList->Modules, NewList->CountOfModules * sizeof(USERMODE_MODULE_MAP_ENTRY));
+        ExFreePoolWithTag(NewList->Modules, POOLTAG);
+
+        NewList->Modules = Buffer;
+        NewList->Capacity *= 2;
+    }
+
+    NewModule = &NewList->Modules[NewList->CountOfModules];
+
+    if (OldList != NULL)
+    {
+        OldModule = ModuleMapFindByAddress(OldList, BaseAddress);
+    }
+
+    if (OldModule != NULL &&
+        OldModule->Details.BaseAddress == BaseAddress &&
+        OldModule->Details.Entrypoint == Entrypoint &&
+        OldModule->SizeOfImage == SizeOfImage)
+    {
+        //
+        // The module is not changed, no need to read its name again
+        //
+        RtlCopyMemory(NewModule, OldModule, sizeof(USERMODE_MODULE_MAP_ENTRY));
+
+        if (OldModule - OldList->Modules != NewList->CountOfModules)
+        {
+            //
+            // The order of modules is changed
+            //
+            *IsChanged = TRUE;
+        }
+    }
+    else
+    {
+        RtlZeroMemory(NewModule, sizeof(USERMODE_MODULE_MAP_ENTRY));
+
+        NewModule->SizeOfImage         = SizeOfImage;
+        NewModule->Details.BaseAddress = BaseAddress;
+        NewModule->Details.Entrypoint  = Entrypoint;
+
+        //
+        // Copy the path (the last character remains null)
+        //
+        if (FullDllName != NULL)
+        {
+            RtlCopyMemory(NewModule->Details.FilePath,
+                          FullDllName,
+                          min(FullDllNameLength, sizeof(NewModule->Details.FilePath) - sizeof(WCHAR)));
+        }
+
+        *IsChanged = TRUE;
+    }
+
+    NewList->CountOfModules++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Walk the loader's list of the process
+ * @details the lock of module maps should NOT be held by the caller, as
+ * the process is attached and its memory might be paged out, this function
+ * should be called in vmx non-root
+ *
+ * @param NewList The list that the modules are added to
+ * @param OldList The previous list of modules (might be NULL)
+ * @param Process
+ * @param Is32Bit
+ * @param IsChanged
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ModuleMapWalkLoaderList(PUSERMODE_MODULE_MAP_LIST NewList,
+                        PUSERMODE_MODULE_MAP_LIST OldList,
+                        PEPROCESS                 Process,
+                        BOOLEAN                   Is32Bit,
+                        PBOOLEAN                  IsChanged)
+{
+    KAPC_STATE      State;
+    PPEB            Peb    = NULL;
+    PPEB32          Peb32  = NULL;
+    PPEB_LDR_DATA   Ldr    = NULL;
+    PPEB_LDR_DATA32 Ldr32  = NULL;
+    BOOLEAN         Result = TRUE;
+
+    //
+    // Process PEB, functions are unexported and undocumented
+    //
+    if (Is32Bit)
+    {
+        if (g_PsGetProcessWow64Process == NULL ||
+            (Peb32 = (PPEB32)g_PsGetProcessWow64Process(Process)) == NULL)
+        {
+            return FALSE;
+        }
+    }
+    else
+    {
+        if (g_PsGetProcessPeb == NULL ||
+            (Peb = (PPEB)g_PsGetProcessPeb(Process)) == NULL)
+        {
+            return FALSE;
+        }
+    }
+
+    KeStackAttachProcess(Process, &State);
+
+    __try
+    {
+        if (Is32Bit)
+        {
+            Ldr32 = (PPEB_LDR_DATA32)Peb32->Ldr;
+
+            if (!Ldr32)
+            {
+                Result = FALSE;
+            }
+            else
+            {
+                for (PLIST_ENTRY32 List = (PLIST_ENTRY32)Ldr32->InLoadOrderModuleList.Flink;
+                     List != &Ldr32->InLoadOrderModuleList;
+                     List = (PLIST_ENTRY32)List->Flink)
+                {
+                    PLDR_DATA_TABLE_ENTRY32 Entry =
+                        CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY32, InLoadOrderLinks);
+
+                    if (!ModuleMapAddModule(OldList,
+                                            NewList,
+                                            Entry->DllBase,
+                                            Entry->EntryPoint,
+                                            Entry->SizeOfImage,
+                                            (PWCH)(UINT64)Entry->FullDllName.Buffer,
+                                            Entry->FullDllName.Length,
+                                            IsChanged))
+                    {
+                        Result = FALSE;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            Ldr = (PPEB_LDR_DATA)Peb->Ldr;
+
+            if (!Ldr)
+            {
+                Result = FALSE;
+            }
+            else
+            {
+                for (PLIST_ENTRY List = (PLIST_ENTRY)Ldr->ModuleListLoadOrder.Flink;
+                     List != &Ldr->ModuleListLoadOrder;
+                     List = (PLIST_ENTRY)List->Flink)
+                {
+                    PLDR_DATA_TABLE_ENTRY Entry =
+                        CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY, InLoadOrderModuleList);
+
+                    if (!ModuleMapAddModule(OldList,
+                                            NewList,
+                                            Entry->DllBase,
+                                            Entry->EntryPoint,
+                                            Entry->SizeOfImage,
+                                            Entry->FullDllName.Buffer,
+                                            Entry->FullDllName.Length,
+                                            IsChanged))
+                    {
+                        Result = FALSE;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        //
+        // The loader's list is changed (or paged out) while walking it
+        //
+        Result = FALSE;
+    }
+
+    KeUnstackDetachProcess(&State);
+
+    return Result;
+}
+
+/**
+ * @brief Build a new list of modules by walking the loader's list of the
+ * process
+ * @details the lock of module maps should NOT be held by the caller and
+ * this function should be called in vmx non-root
+ *
+ * @param OldList The previous list of modules (might be NULL)
+ * @param Process
+ * @param Is32Bit
+ * @param IsChanged Set if the modules are different from the previous list
+ *
+ * @return PUSERMODE_MODULE_MAP_LIST The new list (with one reference) or NULL
+ */
+PUSERMODE_MODULE_MAP_LIST
+ModuleMapBuildList(PUSERMODE_MODULE_MAP_LIST OldList, PEPROCESS Process, BOOLEAN Is32Bit, PBOOLEAN IsChanged)
+{
+    PUSERMODE_MODULE_MAP_LIST NewList;
+    UINT32                    Index;
+
+    NewList = ExAllocatePoolWithTag(NonPagedPool, sizeof(USERMODE_MODULE_MAP_LIST), POOLTAG);
+
+    if (NewList == NULL)
+    {
+        return NULL;
+    }
+
+    RtlZeroMemory(NewList, sizeof(USERMODE_MODULE_MAP_LIST));
+
+    NewList->ReferenceCount = 1;
+    NewList->Capacity       = max(OldList != NULL ? OldList->Capacity : 0, USERMODE_MODULE_MAP_INITIAL_CAPACITY);
+    NewList->Modules        = ExAllocatePoolWithTag(NonPagedPool, NewList->Capacity * sizeof(USERMODE_MODULE_MAP_ENTRY), POOLTAG);
+
+    if (NewList->Modules == NULL ||
+        !ModuleMapWalkLoaderList(NewList, OldList, Process, Is32Bit, IsChanged) ||
+        (NewList->SortedIndexes = ExAllocatePoolWithTag(NonPagedPool, NewList->Capacity * sizeof(UINT32), POOLTAG)) == NULL)
+    {
+        ModuleMapReleaseList(NewList);
+        return NULL;
+    }
+
+    //
+    // Sort the modules by their base addresses, modules are mostly
+    // in the same order as the previous walk
+    //
+    for (UINT32 i = 0; i < NewList->CountOfModules; i++)
+    {
+        Index = i;
+
+        while (Index > 0 &&
+               NewList->Modules[NewList->SortedIndexes[Index - 1]].Details.BaseAddress > NewList->Modules[i].Details.BaseAddress)
+        {
+            NewList->SortedIndexes[Index] = NewList->SortedIndexes[Index - 1];
+            Index--;
+        }
+
+        NewList->SortedIndexes[Index] = i;
+    }
+
+    if (OldList == NULL || NewList->CountOfModules != OldList->CountOfModules)
+    {
+        //
+        // At least one module is loaded or unloaded
+        //
+        *IsChanged = TRUE;
+    }
+
+    return NewList;
+}
+
+/**
+ * @brief Query the count or the details of the loaded modules of a process
+ * @details This function should be called in vmx non-root, the loader's
+ * list is walked while counting the modules (or if the modules are changed
+ * since they're counted by the caller) and the details are copied from the
+ * map, the lock of module maps is only held to get or publish the list
+ *
+ * @param Process
+ * @param Is32Bit
+ * @param ProcessLoadedModuleRequest
+ * @param BufferSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ModuleMapQuery(PEPROCESS                       Process,
+               BOOLEAN                         Is32Bit,
+               PUSERMODE_LOADED_MODULE_DETAILS ProcessLoadedModuleRequest,
+               UINT32                          BufferSize)
+{
+    PUSERMODE_MODULE_MAP            ModuleMap;
+    PUSERMODE_MODULE_MAP_LIST       List;
+    PUSERMODE_MODULE_MAP_LIST       NewList;
+    PUSERMODE_LOADED_MODULE_SYMBOLS ModulesList;
+    UINT32                          CountOfModules;
+    UINT64                          Generation;
+    BOOLEAN                         NeedsUpdate;
+    BOOLEAN                         IsChanged = FALSE;
+
+    if (BufferSize < sizeof(USERMODE_LOADED_MODULE_DETAILS))
+    {
+        return FALSE;
+    }
+
+    ModulesList    = (PUSERMODE_LOADED_MODULE_SYMBOLS)((UINT64)ProcessLoadedModuleRequest + sizeof(USERMODE_LOADED_MODULE_DETAILS));
+    CountOfModules = (BufferSize - sizeof(USERMODE_LOADED_MODULE_DETAILS)) / sizeof(USERMODE_LOADED_MODULE_SYMBOLS);
+
+    //
+    // Get a reference to the current list of the process, the details are
+    // served from the list only if it's the list that the caller counted
+    //
+    SpinlockLock(&g_ModuleMapsLock);
+
+    ModuleMap = ModuleMapGet(ProcessLoadedModuleRequest->ProcessId, Process);
+
+    if (ModuleMap == NULL)
+    {
+        SpinlockUnlock(&g_ModuleMapsLock);
+        return FALSE;
+    }
+
+    List        = ModuleMap->List;
+    Generation  = ModuleMap->Generation;
+    NeedsUpdate = ProcessLoadedModuleRequest->OnlyCountModules ||
+                  List == NULL ||
+                  ProcessLoadedModuleRequest->Generation != Generation;
+
+    if (List != NULL)
+    {
+        InterlockedIncrement(&List->ReferenceCount);
+    }
+
+    SpinlockUnlock(&g_ModuleMapsLock);
+
+    if (NeedsUpdate)
+    {
+        //
+        // Walk the loader's list without holding the lock
+        //
+        NewList = ModuleMapBuildList(List, Process, Is32Bit, &IsChanged);
+
+        if (NewList == NULL)
+        {
+            ModuleMapReleaseList(List);
+            return FALSE;
+        }
+
+        //
+        // Publish the new list, the map might be changed (or removed) by
+        // other requests while the list was walked
+        //
+        SpinlockLock(&g_ModuleMapsLock);
+
+        ModuleMap = ModuleMapGet(ProcessLoadedModuleRequest->ProcessId, Process);
+
+        if (ModuleMap != NULL)
+        {
+            if (ModuleMap->List != List)
+            {
+                IsChanged = TRUE;
+            }
+
+            ModuleMapReleaseList(ModuleMap->List);
+
+            InterlockedIncrement(&NewList->ReferenceCount);
+            ModuleMap->List = NewList;
+
+            if (IsChanged)
+            {
+                ModuleMap->Generation++;
+            }
+
+            Generation = ModuleMap->Generation;
+        }
+
+        SpinlockUnlock(&g_ModuleMapsLock);
+
+        ModuleMapReleaseList(List);
+
+        if (ModuleMap == NULL)
+        {
+            ModuleMapReleaseList(NewList);
+            return FALSE;
+        }
+
+        List = NewList;
+    }
+
+    ProcessLoadedModuleRequest->Generation = Generation;
+
+    if (ProcessLoadedModuleRequest->OnlyCountModules)
+    {
+        ProcessLoadedModuleRequest->ModulesCount = List->CountOfModules;
+    }
+    else
+    {
+        //
+        // If a module is loaded after counting, the buffer might not be
+        // enough for all of the modules
+        //
+        CountOfModules = min(CountOfModules, List->CountOfModules);
+
+        for (UINT32 i = 0; i < CountOfModules; i++)
+        {
+            RtlCopyMemory(&ModulesList[i], &List->Modules[i].Details, sizeof(USERMODE_LOADED_MODULE_SYMBOLS));
+        }
+    }
+
+    ModuleMapReleaseList(List);
+
+    return TRUE;
+}
@@ -351,6 +351,131 @@ ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGI
     return &NewThreadHolder->Threads[0];
 }
 
+/**
+ * @brief Queue an action in the action ring of a thread
+ * @details The action is published by advancing the tail, so the
+ * vmx-root consumer never sees a partially filled action
+ * 
+ * @param ProcessDebuggingDetail 
+ * @param ThreadDebuggingDetail 
+ * @param ActionRequest 
+ *
+ * @return BOOLEAN Shows whether the action is queued or not (queue is full)
+ */
+BOOLEAN
+ThreadHolderQueueAction(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail,
+                        PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetail,
+                        PDEBUGGER_UD_COMMAND_PACKET         ActionRequest)
+{
+    PDEBUGGER_UD_COMMAND_ACTION Action;
+    LONG                        Tail = ThreadDebuggingDetail->UdActionTail;
+
+    if ((UINT32)(Tail - ThreadDebuggingDetail->UdActionHead) >= MAX_USER_ACTIONS_FOR_THREADS)
+    {
+        //
+        // The queue is full
+        //
+        return FALSE;
+    }
+
+    //
+    // Count the action before it's visible to the consumer, so the
+    // pending counter never goes below zero
+    //
+    InterlockedIncrement(&ProcessDebuggingDetail->CountOfPendingThreadActions);
+
+    //
+    // Set the action
+    //
+    Action = &ThreadDebuggingDetail->UdAction[Tail & (MAX_USER_ACTIONS_FOR_THREADS - 1)];
+
+    Action->OptionalParam1 = ActionRequest->UdAction.OptionalParam1;
+    Action->OptionalParam2 = ActionRequest->UdAction.OptionalParam2;
+    Action->OptionalParam3 = ActionRequest->UdAction.OptionalParam3;
+    Action->OptionalParam4 = ActionRequest->UdAction.OptionalParam4;
+    Action->ActionType     = ActionRequest->UdAction.ActionType;
+
+    //
+    // At last we advance the tail to make it valid
+    //
+    InterlockedExchange(&ThreadDebuggingDetail->UdActionTail, Tail + 1);
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the next action of a thread without removing it
+ * @details This function can be used in vmx-root
+ * 
+ * @param ThreadDebuggingDetail 
+ *
+ * @return PDEBUGGER_UD_COMMAND_ACTION returns NULL if there is no action
+ */
+PDEBUGGER_UD_COMMAND_ACTION
+ThreadHolderPeekNextAction(PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetail)
+{
+    LONG Head = ThreadDebuggingDetail->UdActionHead;
+
+    if (Head == ThreadDebuggingDetail->UdActionTail)
+    {
+        return NULL;
+    }
+
+    return &ThreadDebuggingDetail->UdAction[Head & (MAX_USER_ACTIONS_FOR_THREADS - 1)];
+}
+
+/**
+ * @brief Remove the next action of a thread
+ * @details This function can be used in vmx-root
+ * 
+ * @param ProcessDebuggingDetail 
+ * @param ThreadDebuggingDetail 
+ *
+ * @return VOID
+ */
+VOID
+ThreadHolderRemoveNextAction(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail,
+                             PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetail)
+{
+    PDEBUGGER_UD_COMMAND_ACTION Action;
+
+    Action = ThreadHolderPeekNextAction(ThreadDebuggingDetail);
+
+    if (Action == NULL)
+    {
+        return;
+    }
+
+    //
+    // Remove the command
+    //
+    Action->OptionalParam1 = NULL;
+    Action->OptionalParam2 = NULL;
+    Action->OptionalParam3 = NULL;
+    Action->OptionalParam4 = NULL;
+    Action->ActionType     = DEBUGGER_UD_COMMAND_ACTION_TYPE_NONE;
+
+    InterlockedIncrement(&ThreadDebuggingDetail->UdActionHead);
+
+    //
+    // Once all of the actions are consumed, paused threads should stop
+    // causing vm-exits
+    //
+    if (ProcessDebuggingDetail != NULL &&
+        InterlockedDecrement(&ProcessDebuggingDetail->CountOfPendingThreadActions) == 0)
+    {
+        AttachingSetNopSledWakeFlag(ProcessDebuggingDetail, FALSE);
+
+        //
+        // A new action might be queued while we're clearing the flag
+        //
+        if (ProcessDebuggingDetail->CountOfPendingThreadActions != 0)
+        {
+            AttachingSetNopSledWakeFlag(ProcessDebuggingDetail, TRUE);
+        }
+    }
+}
+
 /**
  * @brief Apply the action of the user debugger to a specific thread or 
  * all threads
@@ -379,28 +504,9 @@ ThreadHolderApplyActionToPausedThreads(PUSERMODE_DEBUGGING_PROCESS_DETAILS Proce
         //
         // Apply the command
         //
-        for (size_t i = 0; i < MAX_USER_ACTIONS_FOR_THREADS; i++)
+        if (ThreadDebuggingDetails != NULL)
         {
-            if (ThreadDebuggingDetails->UdAction[i].ActionType == DEBUGGER_UD_COMMAND_ACTION_TYPE_NONE)
-            {
-                //
-                // Set the action
-                //
-                ThreadDebuggingDetails->UdAction[i].OptionalParam1 = ActionRequest->UdAction.OptionalParam1;
-                ThreadDebuggingDetails->UdAction[i].OptionalParam2 = ActionRequest->UdAction.OptionalParam2;
-                ThreadDebuggingDetails->UdAction[i].OptionalParam3 = ActionRequest->UdAction.OptionalParam3;
-                ThreadDebuggingDetails->UdAction[i].OptionalParam4 = ActionRequest->UdAction.OptionalParam4;
-
-                //
-                // At last we set the action type to make it valid
-                //
-                ThreadDebuggingDetails->UdAction[i].ActionType = ActionRequest->UdAction.ActionType;
-
-                //
-                // Command is applied
-                //
-                return TRUE;
-            }
+            CommandApplied = ThreadHolderQueueAction(ProcessDebuggingDetails, ThreadDebuggingDetails, ActionRequest);
         }
     }
     else
@@ -423,32 +529,23 @@ ThreadHolderApplyActionToPausedThreads(PUSERMODE_DEBUGGING_PROCESS_DETAILS Proce
                 if (ThreadHolder->Threads[i].ThreadId != NULL &&
                     ThreadHolder->Threads[i].IsPaused)
                 {
-                    for (size_t j = 0; j < MAX_USER_ACTIONS_FOR_THREADS; j++)
+                    if (ThreadHolderQueueAction(ProcessDebuggingDetails, &ThreadHolder->Threads[i], ActionRequest))
                     {
-                        if (ThreadHolder->Threads[i].UdAction[j].ActionType == DEBUGGER_UD_COMMAND_ACTION_TYPE_NONE)
-                        {
-                            //
-                            // Set the action
-                            //
-                            ThreadHolder->Threads[i].UdAction[j].OptionalParam1 = ActionRequest->UdAction.OptionalParam1;
-                            ThreadHolder->Threads[i].UdAction[j].OptionalParam2 = ActionRequest->UdAction.OptionalParam2;
-                            ThreadHolder->Threads[i].UdAction[j].OptionalParam3 = ActionRequest->UdAction.OptionalParam3;
-                            ThreadHolder->Threads[i].UdAction[j].OptionalParam4 = ActionRequest->UdAction.OptionalParam4;
-
-                            //
-                            // At last we set the action type to make it valid
-                            //
-                            ThreadHolder->Threads[i].UdAction[j].ActionType = ActionRequest->UdAction.ActionType;
-
-                            CommandApplied = TRUE;
-                            break;
-                        }
+                        CommandApplied = TRUE;
                     }
                 }
             }
         }
     }
 
+    //
+    // Wake up the paused threads, so they check for their commands
+    //
+    if (CommandApplied)
+    {
+        AttachingSetNopSledWakeFlag(ProcessDebuggingDetails, TRUE);
+    }
+
     //
     // Return the result of applying the command
     //
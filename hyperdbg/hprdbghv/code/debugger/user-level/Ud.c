@@ -104,7 +104,7 @@ UdRestoreToOriginalDirection(PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingD
     //
     // Configure the RIP again
     //
-    __vmx_vmwrite(VMCS_GUEST_RIP, ThreadDebuggingDetails->ThreadRip);
+    VmcsCacheWrite(VMCS_GUEST_RIP, ThreadDebuggingDetails->ThreadRip);
 }
 
 /**
@@ -158,11 +158,11 @@ UdStepInstructions(PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetails,
         //
         // Set the trap-flag
         //
-        __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+        Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
         Rflags.TrapFlag = TRUE;
 
-        __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+        VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
         //
         // Rflags' trap flag is set
@@ -253,7 +253,9 @@ UdPerformCommand(PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetails,
 BOOLEAN
 UdCheckForCommand()
 {
-    PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetails;
+    PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetails;
+    PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetails;
+    PDEBUGGER_UD_COMMAND_ACTION         UdAction;
 
     ThreadDebuggingDetails =
         ThreadHolderGetProcessThreadDetailsByProcessIdAndThreadId(PsGetCurrentProcessId(),
@@ -274,40 +276,38 @@ UdCheckForCommand()
     }
 
     //
-    // Here, we're sure that this thread is looking for command, let
-    // see if we find anything
+    // Here, we're sure that this thread is looking for command, actions are
+    // queued in a ring, so the next one (if any) is at the head of the ring
     //
-    for (size_t i = 0; i < MAX_USER_ACTIONS_FOR_THREADS; i++)
+    UdAction = ThreadHolderPeekNextAction(ThreadDebuggingDetails);
+
+    if (UdAction != NULL)
     {
-        if (ThreadDebuggingDetails->UdAction[i].ActionType != DEBUGGER_UD_COMMAND_ACTION_TYPE_NONE)
+        ProcessDebuggingDetails = AttachingFindProcessDebuggingDetailsByProcessId(PsGetCurrentProcessId());
+
+        //
+        // Perform the command
+        //
+        UdPerformCommand(ThreadDebuggingDetails,
+                         UdAction->ActionType,
+                         UdAction->OptionalParam1,
+                         UdAction->OptionalParam2,
+                         UdAction->OptionalParam3,
+                         UdAction->OptionalParam4);
+
+        //
+        // Remove the command (only one command at a time)
+        //
+        ThreadHolderRemoveNextAction(ProcessDebuggingDetails, ThreadDebuggingDetails);
+
+        //
+        // If the thread is not paused anymore, the remaining actions are
+        // no longer valid
+        //
+        while (!ThreadDebuggingDetails->IsPaused &&
+               ThreadHolderPeekNextAction(ThreadDebuggingDetails) != NULL)
         {
-            //
-            // Perform the command
-            //
-            UdPerformCommand(ThreadDebuggingDetails,
-                             ThreadDebuggingDetails->UdAction[i].ActionType,
-                             ThreadDebuggingDetails->UdAction[i].OptionalParam1,
-                             ThreadDebuggingDetails->UdAction[i].OptionalParam2,
-                             ThreadDebuggingDetails->UdAction[i].OptionalParam3,
-                             ThreadDebuggingDetails->UdAction[i].OptionalParam4);
-
-            //
-            // Remove the command
-            //
-            ThreadDebuggingDetails->UdAction[i].OptionalParam1 = NULL;
-            ThreadDebuggingDetails->UdAction[i].OptionalParam2 = NULL;
-            ThreadDebuggingDetails->UdAction[i].OptionalParam3 = NULL;
-            ThreadDebuggingDetails->UdAction[i].OptionalParam4 = NULL;
-
-            //
-            // At last disable it
-            //
-            ThreadDebuggingDetails->UdAction[i].ActionType = DEBUGGER_UD_COMMAND_ACTION_TYPE_NONE;
-
-            //
-            // only one command at a time
-            //
-            break;
+            ThreadHolderRemoveNextAction(ProcessDebuggingDetails, ThreadDebuggingDetails);
         }
     }
 
@@ -372,12 +372,20 @@ UdSpinThreadOnNop(PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetails,
     //
     // Save the RIP for future return
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &ThreadDebuggingDetails->ThreadRip);
+    ThreadDebuggingDetails->ThreadRip = VmcsCacheRead(VMCS_GUEST_RIP);
 
     //
-    // Set the rip to new spinning address
+    // Set the rip to new spinning address (the pause loop depends on
+    // whether the thread is running in long mode or not)
     //
-    __vmx_vmwrite(VMCS_GUEST_RIP, ProcessDebuggingDetails->UsermodeReservedBuffer);
+    if (KdIsGuestOnUsermode32Bit())
+    {
+        VmcsCacheWrite(VMCS_GUEST_RIP, ProcessDebuggingDetails->UsermodeReservedBuffer + USERMODE_NOP_SLED_LOOP32_OFFSET);
+    }
+    else
+    {
+        VmcsCacheWrite(VMCS_GUEST_RIP, ProcessDebuggingDetails->UsermodeReservedBuffer + USERMODE_NOP_SLED_LOOP64_OFFSET);
+    }
 
     //
     // Indicate that it's spinning
@@ -402,11 +410,11 @@ UdHandleAfterSteppingReason(UINT32                             CurrentCore,
     //
     // Unset the trap-flag
     //
-    __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+    Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
     Rflags.TrapFlag = FALSE;
 
-    __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+    VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
     //
     // Rflags' trap flag is not set anymore
@@ -547,7 +555,7 @@ UdCheckAndHandleBreakpointsAndDebugBreaks(UINT32                            Curr
     //
     // Set rflags for finding the results of conditional jumps
     //
-    __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+    Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
     PausePacket.Rflags = Rflags.AsUInt;
 
     //
@@ -323,298 +323,6 @@ UserAccessGetBaseAndEntrypointOfMainModuleIfLoadedInVmxRoot(PPEB PebAddress, BOO
     }
 }
 
-/**
- * @brief Gets the loaded modules details from PEB
- * @details This function should be called in vmx non-root
- * 
- * @param Proc 
- * @param OnlyCountModules 
- * @param ModulesCount 
- * @param ModulesList 
- * @param SizeOfBufferForModulesList 
- * @return BOOLEAN 
- */
-BOOLEAN
-UserAccessPrintLoadedModulesX64(PEPROCESS                       Proc,
-                                BOOLEAN                         OnlyCountModules,
-                                PUINT32                         ModulesCount,
-                                PUSERMODE_LOADED_MODULE_SYMBOLS ModulesList,
-                                UINT32                          SizeOfBufferForModulesList)
-{
-    KAPC_STATE     State;
-    UNICODE_STRING Name;
-    PPEB           Peb                 = NULL;
-    PPEB_LDR_DATA  Ldr                 = NULL;
-    UINT32         CountOfModules      = 0;
-    UINT32         CurrentSavedModules = 0;
-    UINT32         TempSize            = 0;
-
-    if (g_PsGetProcessPeb == NULL)
-    {
-        return FALSE;
-    }
-
-    //
-    // Process PEB, function is unexported and undocumented
-    //
-    Peb = (PPEB)g_PsGetProcessPeb(Proc);
-
-    if (!Peb)
-    {
-        return FALSE;
-    }
-
-    KeStackAttachProcess(Proc, &State);
-
-    Ldr = (PPEB_LDR_DATA)Peb->Ldr;
-
-    if (!Ldr)
-    {
-        KeUnstackDetachProcess(&State);
-        return FALSE;
-    }
-
-    if (OnlyCountModules)
-    {
-        //
-        // loop the linked list (Computer the size)
-        //
-        for (PLIST_ENTRY List = (PLIST_ENTRY)Ldr->ModuleListLoadOrder.Flink;
-             List != &Ldr->ModuleListLoadOrder;
-             List = (PLIST_ENTRY)List->Flink)
-        {
-            PLDR_DATA_TABLE_ENTRY Entry =
-                CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY, InLoadOrderModuleList);
-
-            //
-            // Calculate count of modules
-            //
-            CountOfModules++;
-
-            /*
-        Log("Base: %016llx\tEntryPoint: %016llx\tModule: %ws\tPath: %ws\n",
-            Entry->DllBase,
-            Entry->EntryPoint,
-            Entry->BaseDllName.Buffer,
-            Entry->FullDllName.Buffer);
-        */
-        }
-
-        *ModulesCount = CountOfModules;
-
-        KeUnstackDetachProcess(&State);
-        return TRUE;
-    }
-    else
-    {
-        //
-        // It's not counting the modules, so we compute the number of modules
-        // that can be stored in the buffer by using the size of the buffer
-        //
-        CountOfModules = SizeOfBufferForModulesList / sizeof(USERMODE_LOADED_MODULE_SYMBOLS);
-    }
-
-    //
-    // Walk again to save the buffer
-    //
-    Ldr = (PPEB_LDR_DATA)Peb->Ldr;
-
-    if (!Ldr)
-    {
-        KeUnstackDetachProcess(&State);
-        return FALSE;
-    }
-
-    //
-    // loop the linked list
-    //
-    for (PLIST_ENTRY List = (PLIST_ENTRY)Ldr->ModuleListLoadOrder.Flink;
-         List != &Ldr->ModuleListLoadOrder;
-         List = (PLIST_ENTRY)List->Flink)
-    {
-        PLDR_DATA_TABLE_ENTRY Entry =
-            CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY, InLoadOrderModuleList);
-
-        if (CountOfModules == CurrentSavedModules)
-        {
-            //
-            // Won't continue as the buffer is now full
-            // Generally, we shouldn't be at this stage, only when
-            // a module is just loaded and we didn't allocate enough
-            // memory for it, so it's better to continue
-            //
-            KeUnstackDetachProcess(&State);
-            return TRUE;
-        }
-
-        //
-        // Save the details into the storage
-        //
-        ModulesList[CurrentSavedModules].Entrypoint  = Entry->EntryPoint;
-        ModulesList[CurrentSavedModules].BaseAddress = Entry->DllBase;
-
-        //
-        // Copy the path
-        //
-        TempSize = Entry->FullDllName.Length;
-        if (TempSize >= MAX_PATH)
-        {
-            TempSize = MAX_PATH;
-        }
-
-        TempSize = TempSize * 2;
-        memcpy(&ModulesList[CurrentSavedModules].FilePath, Entry->FullDllName.Buffer, TempSize);
-
-        CurrentSavedModules++;
-    }
-
-    KeUnstackDetachProcess(&State);
-
-    return TRUE;
-}
-
-/**
- * @brief Gets the loaded modules details from PEB (x86)
- * @details This function should be called in vmx non-root
- * 
- * @param Proc 
- * @param OnlyCountModules 
- * @param ModulesCount 
- * @param ModulesList 
- * @param SizeOfBufferForModulesList 
- * @return BOOLEAN 
- */
-BOOLEAN
-UserAccessPrintLoadedModulesX86(PEPROCESS                       Proc,
-                                BOOLEAN                         OnlyCountModules,
-                                PUINT32                         ModulesCount,
-                                PUSERMODE_LOADED_MODULE_SYMBOLS ModulesList,
-                                UINT32                          SizeOfBufferForModulesList)
-{
-    KAPC_STATE      State;
-    UNICODE_STRING  Name;
-    PPEB32          Peb                 = NULL;
-    PPEB_LDR_DATA32 Ldr                 = NULL;
-    UINT32          CountOfModules      = 0;
-    UINT32          CurrentSavedModules = 0;
-    UINT32          TempSize            = 0;
-
-    if (g_PsGetProcessWow64Process == NULL)
-    {
-        return FALSE;
-    }
-
-    //
-    // Process PEB, function is unexported and undocumented
-    //
-    Peb = (PPEB32)g_PsGetProcessWow64Process(Proc);
-
-    if (!Peb)
-    {
-        return FALSE;
-    }
-
-    KeStackAttachProcess(Proc, &State);
-
-    Ldr = (PPEB_LDR_DATA32)Peb->Ldr;
-
-    if (!Ldr)
-    {
-        KeUnstackDetachProcess(&State);
-        return FALSE;
-    }
-
-    if (OnlyCountModules)
-    {
-        //
-        // loop the linked list (Computer the size)
-        //
-        for (PLIST_ENTRY32 List = (PLIST_ENTRY32)Ldr->InLoadOrderModuleList.Flink;
-             List != &Ldr->InLoadOrderModuleList;
-             List = (PLIST_ENTRY32)List->Flink)
-        {
-            PLDR_DATA_TABLE_ENTRY32 Entry =
-                CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY32, InLoadOrderLinks);
-
-            //
-            // Calculate count of modules
-            //
-            CountOfModules++;
-        }
-
-        *ModulesCount = CountOfModules;
-
-        KeUnstackDetachProcess(&State);
-        return TRUE;
-    }
-    else
-    {
-        //
-        // It's not counting the modules, so we compute the number of modules
-        // that can be stored in the buffer by using the size of the buffer
-        //
-        CountOfModules = SizeOfBufferForModulesList / sizeof(USERMODE_LOADED_MODULE_SYMBOLS);
-    }
-
-    //
-    // Walk again to save the buffer
-    //
-    Ldr = (PPEB_LDR_DATA32)Peb->Ldr;
-
-    if (!Ldr)
-    {
-        KeUnstackDetachProcess(&State);
-        return FALSE;
-    }
-
-    //
-    // loop the linked list
-    //
-    for (PLIST_ENTRY32 List = (PLIST_ENTRY32)Ldr->InLoadOrderModuleList.Flink;
-         List != &Ldr->InLoadOrderModuleList;
-         List = (PLIST_ENTRY32)List->Flink)
-    {
-        PLDR_DATA_TABLE_ENTRY32 Entry =
-            CONTAINING_RECORD(List, LDR_DATA_TABLE_ENTRY32, InLoadOrderLinks);
-
-        if (CountOfModules == CurrentSavedModules)
-        {
-            //
-            // Won't continue as the buffer is now full
-            // Generally, we shouldn't be at this stage, only when
-            // a module is just loaded and we didn't allocate enough
-            // memory for it, so it's better to continue
-            //
-            KeUnstackDetachProcess(&State);
-            return TRUE;
-        }
-
-        //
-        // Save the details into the storage
-        //
-        ModulesList[CurrentSavedModules].Entrypoint  = Entry->EntryPoint;
-        ModulesList[CurrentSavedModules].BaseAddress = Entry->DllBase;
-
-        //
-        // Copy the path
-        //
-        TempSize = Entry->FullDllName.Length;
-        if (TempSize >= MAX_PATH)
-        {
-            TempSize = MAX_PATH;
-        }
-
-        TempSize = TempSize * 2;
-        memcpy(&ModulesList[CurrentSavedModules].FilePath, Entry->FullDllName.Buffer, TempSize);
-
-        CurrentSavedModules++;
-    }
-
-    KeUnstackDetachProcess(&State);
-
-    return TRUE;
-}
-
 /**
  * @brief Print loaded modules details from PEB
  * @details This function should be called in vmx non-root
@@ -790,35 +498,17 @@ UserAccessGetLoadedModules(PUSERMODE_LOADED_MODULE_DETAILS ProcessLoadedModuleRe
         return FALSE;
     }
 
-    if (Is32Bit)
-    {
-        //
-        // x86 process, walk x86 module list
-        //
-        if (UserAccessPrintLoadedModulesX86(SourceProcess,
-                                            ProcessLoadedModuleRequest->OnlyCountModules,
-                                            &ProcessLoadedModuleRequest->ModulesCount,
-                                            (UINT64)ProcessLoadedModuleRequest + sizeof(USERMODE_LOADED_MODULE_DETAILS),
-                                            BufferSize - sizeof(USERMODE_LOADED_MODULE_DETAILS)))
-        {
-            ProcessLoadedModuleRequest->Result = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
-            return TRUE;
-        }
-    }
-    else
+    //
+    // Modules are kept in a map, so the names of modules are not read
+    // from the process for each request
+    //
+    if (ModuleMapQuery(SourceProcess,
+                       Is32Bit,
+                       ProcessLoadedModuleRequest,
+                       BufferSize))
     {
-        //
-        // x64 process, walk x64 module list
-        //
-        if (UserAccessPrintLoadedModulesX64(SourceProcess,
-                                            ProcessLoadedModuleRequest->OnlyCountModules,
-                                            &ProcessLoadedModuleRequest->ModulesCount,
-                                            (UINT64)ProcessLoadedModuleRequest + sizeof(USERMODE_LOADED_MODULE_DETAILS),
-                                            BufferSize - sizeof(USERMODE_LOADED_MODULE_DETAILS)))
-        {
-            ProcessLoadedModuleRequest->Result = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
-            return TRUE;
-        }
+        ProcessLoadedModuleRequest->Result = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+        return TRUE;
     }
 
     ProcessLoadedModuleRequest->Result = DEBUGGER_ERROR_UNABLE_TO_GET_MODULES_OF_THE_PROCESS;
@@ -0,0 +1,528 @@
+/**
+ * @file CommandRing.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Shared-memory command ring between the debugger and the driver
+ * @details The debugger puts a batch of requests (in the same format as
+ * the IOCTL buffers) into a ring that is shared with the driver and then
+ * the driver processes all of them by a single IOCTL, so the cost of the
+ * syscall and the IRP are paid once for the entire batch
+ *
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Detach the ring from the global state
+ * @details The lock should be held by the caller and the ring should
+ * not be in the middle of processing
+ *
+ * @return PMDL The MDL of the ring that should be freed by
+ * CommandRingFreeMdl after releasing the lock
+ */
+static PMDL
+CommandRingDetach()
+{
+    PMDL Mdl = g_CommandRingState.Mdl;
+
+    g_CommandRingState.Mdl              = NULL;
+    g_CommandRingState.Ring             = NULL;
+    g_CommandRingState.FileObject       = NULL;
+    g_CommandRingState.IsReleasePending = FALSE;
+
+    return Mdl;
+}
+
+/**
+ * @brief Unlock the pages of the ring and free its MDL
+ *
+ * @param Mdl
+ * @return VOID
+ */
+static VOID
+CommandRingFreeMdl(PMDL Mdl)
+{
+    if (Mdl != NULL)
+    {
+        //
+        // Unlocking the pages also unmaps the system address
+        //
+        MmUnlockPages(Mdl);
+        IoFreeMdl(Mdl);
+    }
+}
+
+/**
+ * @brief Release the ring that is registered by a handle
+ * @details If the ring is being processed, then it's released by
+ * the processor once the batch is finished
+ *
+ * @param FileObject The handle that registered the ring
+ * @return VOID
+ */
+static VOID
+CommandRingRelease(PFILE_OBJECT FileObject)
+{
+    PMDL Mdl = NULL;
+
+    SpinlockLock(&g_CommandRingState.Lock);
+
+    if (g_CommandRingState.Ring != NULL && g_CommandRingState.FileObject == FileObject)
+    {
+        if (g_CommandRingState.IsProcessing)
+        {
+            g_CommandRingState.IsReleasePending = TRUE;
+        }
+        else
+        {
+            Mdl = CommandRingDetach();
+        }
+    }
+
+    SpinlockUnlock(&g_CommandRingState.Lock);
+
+    CommandRingFreeMdl(Mdl);
+}
+
+/**
+ * @brief Register (or unregister) the shared command ring
+ * @details Should be called from the context of the debugger's
+ * process at PASSIVE_LEVEL, only one ring can be registered at a time
+ *
+ * @param RingRequest
+ * @param FileObject The handle that sends the request
+ * @return NTSTATUS
+ */
+NTSTATUS
+CommandRingRegister(PDEBUGGER_COMMAND_RING_REQUEST RingRequest, PFILE_OBJECT FileObject)
+{
+    PMDL          Mdl;
+    PCOMMAND_RING Ring;
+    BOOLEAN       IsRegistered;
+
+    if (!RingRequest->IsRegister)
+    {
+        CommandRingRelease(FileObject);
+
+        RingRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+        return STATUS_SUCCESS;
+    }
+
+    SpinlockLock(&g_CommandRingState.Lock);
+    IsRegistered = g_CommandRingState.Ring != NULL;
+    SpinlockUnlock(&g_CommandRingState.Lock);
+
+    if (IsRegistered || RingRequest->RingAddress == (UINT64)NULL)
+    {
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_INVALID_PARAMETER;
+    }
+
+    Mdl = IoAllocateMdl((PVOID)RingRequest->RingAddress, sizeof(COMMAND_RING), FALSE, FALSE, NULL);
+
+    if (Mdl == NULL)
+    {
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    //
+    // Lock the user-mode pages, so they remain valid even if the debugger
+    // frees or changes the protection of the buffer
+    //
+    __try
+    {
+        MmProbeAndLockPages(Mdl, UserMode, IoWriteAccess);
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        IoFreeMdl(Mdl);
+
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_INVALID_PARAMETER;
+    }
+
+    Ring = MmGetSystemAddressForMdlSafe(Mdl, NormalPagePriority | MdlMappingNoExecute);
+
+    if (Ring == NULL)
+    {
+        CommandRingFreeMdl(Mdl);
+
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_INSUFFICIENT_RESOURCES;
+    }
+
+    SpinlockLock(&g_CommandRingState.Lock);
+
+    //
+    // Another ring might be registered while the pages were locked
+    //
+    if (g_CommandRingState.Ring != NULL)
+    {
+        SpinlockUnlock(&g_CommandRingState.Lock);
+
+        CommandRingFreeMdl(Mdl);
+
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_INVALID_PARAMETER;
+    }
+
+    g_CommandRingState.Mdl        = Mdl;
+    g_CommandRingState.Ring       = Ring;
+    g_CommandRingState.FileObject = FileObject;
+
+    SpinlockUnlock(&g_CommandRingState.Lock);
+
+    RingRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Perform a single request of the ring
+ * @details The requests are handled exactly like their IOCTL
+ * counterparts in DrvDispatchIoControl
+ *
+ * @param IoctlCode The IOCTL code of the request
+ * @param Buffer The input and the output buffer of the request
+ * @param InputBufferLength
+ * @param OutputBufferLength
+ * @param ReturnedLength
+ * @return UINT32 The kernel status of the request
+ */
+static UINT32
+CommandRingPerformRequest(UINT32   IoctlCode,
+                          PVOID    Buffer,
+                          UINT32   InputBufferLength,
+                          UINT32   OutputBufferLength,
+                          UINT32 * ReturnedLength)
+{
+    PDEBUGGER_READ_MEMORY           ReadMemRequest;
+    PDEBUGGER_READ_AND_WRITE_ON_MSR ReadOrWriteMsrRequest;
+    PDEBUGGER_EDIT_MEMORY           EditMemRequest;
+    PDEBUGGER_BULK_MODIFY_EVENTS    BulkModifyEventsRequest;
+    SIZE_T                          ReturnSize = 0;
+
+    *ReturnedLength = 0;
+
+    switch (IoctlCode)
+    {
+    case IOCTL_DEBUGGER_READ_MEMORY:
+
+        ReadMemRequest = (PDEBUGGER_READ_MEMORY)Buffer;
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_READ_MEMORY || ReadMemRequest->Size > OutputBufferLength)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        if (DebuggerCommandReadMemory(ReadMemRequest, ReadMemRequest, &ReturnSize) != STATUS_SUCCESS)
+        {
+            return DEBUGGER_ERROR_INVALID_ADDRESS;
+        }
+
+        *ReturnedLength = (UINT32)ReturnSize;
+        break;
+
+    case IOCTL_DEBUGGER_READ_OR_WRITE_MSR:
+
+        ReadOrWriteMsrRequest = (PDEBUGGER_READ_AND_WRITE_ON_MSR)Buffer;
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_READ_AND_WRITE_ON_MSR)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        //
+        // The results of rdmsr on all cores might need more space than the
+        // output buffer, so it's left to the IOCTL
+        //
+        if (ReadOrWriteMsrRequest->ActionType != DEBUGGER_MSR_WRITE)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED;
+        }
+
+        if (DebuggerReadOrWriteMsr(ReadOrWriteMsrRequest, (UINT64 *)Buffer, &ReturnSize) != STATUS_SUCCESS)
+        {
+            return DEBUGGER_ERROR_INVALID_CORE_ID;
+        }
+
+        *ReturnedLength = (UINT32)ReturnSize;
+        break;
+
+    case IOCTL_DEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS:
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS ||
+            OutputBufferLength < SIZEOF_DEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        ExtensionCommandPte((PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS)Buffer, FALSE);
+
+        *ReturnedLength = SIZEOF_DEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS;
+        break;
+
+    case IOCTL_DEBUGGER_VA2PA_AND_PA2VA_COMMANDS:
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_VA2PA_AND_PA2VA_COMMANDS ||
+            OutputBufferLength < SIZEOF_DEBUGGER_VA2PA_AND_PA2VA_COMMANDS)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        ExtensionCommandVa2paAndPa2va((PDEBUGGER_VA2PA_AND_PA2VA_COMMANDS)Buffer, FALSE);
+
+        *ReturnedLength = SIZEOF_DEBUGGER_VA2PA_AND_PA2VA_COMMANDS;
+        break;
+
+    case IOCTL_DEBUGGER_EDIT_MEMORY:
+
+        EditMemRequest = (PDEBUGGER_EDIT_MEMORY)Buffer;
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_EDIT_MEMORY ||
+            OutputBufferLength < SIZEOF_DEBUGGER_EDIT_MEMORY ||
+            InputBufferLength != SIZEOF_DEBUGGER_EDIT_MEMORY + EditMemRequest->CountOf64Chunks * sizeof(UINT64))
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        DebuggerCommandEditMemory(EditMemRequest);
+
+        *ReturnedLength = SIZEOF_DEBUGGER_EDIT_MEMORY;
+        break;
+
+    case IOCTL_DEBUGGER_MODIFY_EVENTS:
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_MODIFY_EVENTS ||
+            OutputBufferLength < SIZEOF_DEBUGGER_MODIFY_EVENTS)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        DebuggerParseEventsModificationFromUsermode((PDEBUGGER_MODIFY_EVENTS)Buffer);
+
+        *ReturnedLength = SIZEOF_DEBUGGER_MODIFY_EVENTS;
+        break;
+
+    case IOCTL_DEBUGGER_BULK_MODIFY_EVENTS:
+
+        BulkModifyEventsRequest = (PDEBUGGER_BULK_MODIFY_EVENTS)Buffer;
+
+        if (InputBufferLength < SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS ||
+            BulkModifyEventsRequest->CountOfTags > DEBUGGER_BULK_MODIFY_EVENTS_MAXIMUM_TAGS ||
+            InputBufferLength != SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS + BulkModifyEventsRequest->CountOfTags * sizeof(DEBUGGER_BULK_MODIFY_EVENTS_ENTRY) ||
+            OutputBufferLength < InputBufferLength)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        DebuggerParseEventsBulkModificationFromUsermode(BulkModifyEventsRequest);
+
+        *ReturnedLength = InputBufferLength;
+        break;
+
+    case IOCTL_QUERY_CURRENT_PROCESS:
+
+        if (InputBufferLength < SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET ||
+            OutputBufferLength < SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        ProcessQueryDetails((PDEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET)Buffer);
+
+        *ReturnedLength = SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET;
+        break;
+
+    case IOCTL_QUERY_CURRENT_THREAD:
+
+        if (InputBufferLength < SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_THREAD_PACKET ||
+            OutputBufferLength < SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_THREAD_PACKET)
+        {
+            return DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+
+        ThreadQueryDetails((PDEBUGGEE_DETAILS_AND_SWITCH_THREAD_PACKET)Buffer);
+
+        *ReturnedLength = SIZEOF_DEBUGGEE_DETAILS_AND_SWITCH_THREAD_PACKET;
+        break;
+
+    default:
+
+        //
+        // Other requests should be sent using their IOCTLs
+        //
+        return DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED;
+    }
+
+    return DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
+/**
+ * @brief Process all the pending requests of the shared command ring
+ * @details Each request is copied to its own kernel buffer before being
+ * processed as the debugger might change the shared memory at any time,
+ * the lock is not held while the requests are performed, instead the
+ * ring is marked as processing so it's not released in the meantime
+ *
+ * @param RingRequest
+ * @return NTSTATUS
+ */
+NTSTATUS
+CommandRingProcess(PDEBUGGER_COMMAND_RING_REQUEST RingRequest)
+{
+    PCOMMAND_RING                 Ring;
+    PMDL                          Mdl;
+    PVOID                         Buffer;
+    COMMAND_RING_SUBMISSION_ENTRY Submission;
+    UINT32                        SubmissionHead;
+    UINT32                        SubmissionTail;
+    UINT32                        CompletionHead;
+    UINT32                        CompletionTail;
+    UINT32                        BufferLength;
+    UINT32                        ReturnedLength;
+    UINT32                        KernelStatus;
+    UINT32                        CountOfProcessedEntries = 0;
+
+    SpinlockLock(&g_CommandRingState.Lock);
+
+    Ring = g_CommandRingState.Ring;
+
+    if (Ring == NULL || g_CommandRingState.IsProcessing)
+    {
+        SpinlockUnlock(&g_CommandRingState.Lock);
+
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        return STATUS_SUCCESS;
+    }
+
+    g_CommandRingState.IsProcessing = TRUE;
+
+    SpinlockUnlock(&g_CommandRingState.Lock);
+
+    SubmissionHead = Ring->SubmissionHead;
+    SubmissionTail = Ring->SubmissionTail;
+    CompletionHead = Ring->CompletionHead;
+    CompletionTail = Ring->CompletionTail;
+
+    //
+    // Make sure that we read the entries after reading the tail
+    //
+    KeMemoryBarrier();
+
+    //
+    // The indexes are written by the debugger, so they're validated once
+    // and the local copies are used from now on
+    //
+    if (SubmissionTail - SubmissionHead > COMMAND_RING_ENTRY_COUNT ||
+        CompletionTail - CompletionHead > COMMAND_RING_ENTRY_COUNT)
+    {
+        RingRequest->KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        goto Finish;
+    }
+
+    //
+    // Stop if there is no room for the completions, the rest will be
+    // processed on the next call
+    //
+    while (SubmissionHead != SubmissionTail &&
+           CompletionTail - CompletionHead < COMMAND_RING_ENTRY_COUNT)
+    {
+        Submission     = Ring->Submissions[SubmissionHead & (COMMAND_RING_ENTRY_COUNT - 1)];
+        BufferLength   = max(Submission.InputBufferLength, Submission.OutputBufferLength);
+        ReturnedLength = 0;
+
+        //
+        // Validate the location of the buffer in the data area
+        //
+        if (BufferLength == 0 ||
+            Submission.BufferOffset >= COMMAND_RING_DATA_AREA_SIZE ||
+            BufferLength > COMMAND_RING_DATA_AREA_SIZE - Submission.BufferOffset)
+        {
+            KernelStatus = DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID;
+        }
+        else if ((Buffer = ExAllocatePoolWithTag(NonPagedPool, BufferLength, POOLTAG)) == NULL)
+        {
+            //
+            // The debugger sends the request by its IOCTL instead
+            //
+            KernelStatus = DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED;
+        }
+        else
+        {
+            RtlZeroMemory(Buffer, BufferLength);
+            RtlCopyMemory(Buffer, &Ring->Data[Submission.BufferOffset], Submission.InputBufferLength);
+
+            KernelStatus = CommandRingPerformRequest(Submission.IoctlCode,
+                                                     Buffer,
+                                                     Submission.InputBufferLength,
+                                                     Submission.OutputBufferLength,
+                                                     &ReturnedLength);
+
+            ReturnedLength = min(ReturnedLength, Submission.OutputBufferLength);
+
+            RtlCopyMemory(&Ring->Data[Submission.BufferOffset], Buffer, ReturnedLength);
+
+            ExFreePoolWithTag(Buffer, POOLTAG);
+        }
+
+        Ring->Completions[CompletionTail & (COMMAND_RING_ENTRY_COUNT - 1)].UserData       = Submission.UserData;
+        Ring->Completions[CompletionTail & (COMMAND_RING_ENTRY_COUNT - 1)].KernelStatus   = KernelStatus;
+        Ring->Completions[CompletionTail & (COMMAND_RING_ENTRY_COUNT - 1)].ReturnedLength = ReturnedLength;
+
+        SubmissionHead++;
+        CompletionTail++;
+        CountOfProcessedEntries++;
+    }
+
+    //
+    // Publish the completions after writing the entries
+    //
+    KeMemoryBarrier();
+
+    Ring->SubmissionHead = SubmissionHead;
+    Ring->CompletionTail = CompletionTail;
+
+    RingRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+Finish:
+
+    RingRequest->CountOfProcessedEntries = CountOfProcessedEntries;
+
+    //
+    // Release the ring if its handle is closed (or it's unregistered)
+    // while we were processing it
+    //
+    Mdl = NULL;
+
+    SpinlockLock(&g_CommandRingState.Lock);
+
+    g_CommandRingState.IsProcessing = FALSE;
+
+    if (g_CommandRingState.IsReleasePending)
+    {
+        Mdl = CommandRingDetach();
+    }
+
+    SpinlockUnlock(&g_CommandRingState.Lock);
+
+    CommandRingFreeMdl(Mdl);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Release the shared command ring of a handle (if any)
+ * @details Called when the debugger closes the handle of the device
+ *
+ * @param FileObject
+ * @return VOID
+ */
+VOID
+CommandRingUninitialize(PFILE_OBJECT FileObject)
+{
+    CommandRingRelease(FileObject);
+}
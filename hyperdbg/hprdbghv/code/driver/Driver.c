@@ -82,6 +82,7 @@ DriverEntry(
 
         LogDebugInfo("Setting device major functions");
         DriverObject->MajorFunction[IRP_MJ_CLOSE]          = DrvClose;
+        DriverObject->MajorFunction[IRP_MJ_CLEANUP]        = DrvCleanup;
         DriverObject->MajorFunction[IRP_MJ_CREATE]         = DrvCreate;
         DriverObject->MajorFunction[IRP_MJ_READ]           = DrvRead;
         DriverObject->MajorFunction[IRP_MJ_WRITE]          = DrvWrite;
@@ -143,6 +144,11 @@ DrvUnload(PDRIVER_OBJECT DriverObject)
         ExFreePoolWithTag(g_ScriptGlobalVariables, POOLTAG);
     }
 
+    //
+    // Free the snapshot of processes list
+    //
+    ProcessSnapshotUninitialize();
+
     //
     // Free core specific local and temp variables
     //
@@ -335,6 +341,33 @@ DrvWrite(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief IRP_MJ_CLEANUP Function handler
+ * @details Called in the context of the debugger when the last handle
+ * is closed, even if there are IOCTLs that are still pending
+ * 
+ * @param DeviceObject 
+ * @param Irp 
+ * @return NTSTATUS 
+ */
+NTSTATUS
+DrvCleanup(PDEVICE_OBJECT DeviceObject, PIRP Irp)
+{
+    PIO_STACK_LOCATION IrpStack = IoGetCurrentIrpStackLocation(Irp);
+
+    //
+    // The shared command ring (if any) belongs to this handle, so its
+    // pages should not remain locked after the debugger is gone
+    //
+    CommandRingUninitialize(IrpStack->FileObject);
+
+    Irp->IoStatus.Status      = STATUS_SUCCESS;
+    Irp->IoStatus.Information = 0;
+    IoCompleteRequest(Irp, IO_NO_INCREMENT);
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief IRP_MJ_CLOSE Function handler
  * 
@@ -34,6 +34,7 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     PDEBUGGER_EVENT_AND_ACTION_REG_BUFFER                   RegBufferResult;
     PDEBUGGER_GENERAL_EVENT_DETAIL                          DebuggerNewEventRequest;
     PDEBUGGER_MODIFY_EVENTS                                 DebuggerModifyEventRequest;
+    PDEBUGGER_BULK_MODIFY_EVENTS                            DebuggerBulkModifyEventsRequest;
     PDEBUGGER_FLUSH_LOGGING_BUFFERS                         DebuggerFlushBuffersRequest;
     PDEBUGGER_PREALLOC_COMMAND                              DebuggerReservePreallocPoolRequest;
     PDEBUGGER_UD_COMMAND_PACKET                             DebuggerUdCommandRequest;
@@ -50,6 +51,7 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     PDEBUGGER_PREPARE_DEBUGGEE                              DebuggeeRequest;
     PDEBUGGER_PAUSE_PACKET_RECEIVED                         DebuggerPauseKernelRequest;
     PDEBUGGER_GENERAL_ACTION                                DebuggerNewActionRequest;
+    PDEBUGGER_COMMAND_RING_REQUEST                          DebuggerCommandRingRequest;
     PVOID                                                   BufferToStoreThreadsAndProcessesDetails;
     NTSTATUS                                                Status;
     ULONG                                                   InBuffLength;  // Input buffer length
@@ -658,6 +660,59 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
             break;
 
+        case IOCTL_DEBUGGER_BULK_MODIFY_EVENTS:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            if (!InBuffLength || !OutBuffLength)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            DebuggerBulkModifyEventsRequest = (PDEBUGGER_BULK_MODIFY_EVENTS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Here we should validate whether the input parameter is
+            // valid or in other words whether we received enough space or not,
+            // the results of the tags are also returned to the same buffer
+            //
+            if (DebuggerBulkModifyEventsRequest->CountOfTags > DEBUGGER_BULK_MODIFY_EVENTS_MAXIMUM_TAGS ||
+                InBuffLength != SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS + DebuggerBulkModifyEventsRequest->CountOfTags * sizeof(DEBUGGER_BULK_MODIFY_EVENTS_ENTRY) ||
+                OutBuffLength < InBuffLength)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the comming buffer are
+            // at the same place
+            //
+            DebuggerParseEventsBulkModificationFromUsermode(DebuggerBulkModifyEventsRequest);
+
+            Irp->IoStatus.Information = InBuffLength;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
         case IOCTL_DEBUGGER_FLUSH_LOGGING_BUFFERS:
 
             //
@@ -1425,6 +1480,58 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
             break;
 
+        case IOCTL_REGISTER_COMMAND_RING:
+        case IOCTL_PROCESS_COMMAND_RING:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_COMMAND_RING_REQUEST ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            if (!InBuffLength || OutBuffLength < SIZEOF_DEBUGGER_COMMAND_RING_REQUEST)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            DebuggerCommandRingRequest = (PDEBUGGER_COMMAND_RING_REQUEST)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Both usermode and to send to usermode and the comming buffer are
+            // at the same place
+            //
+            if (IrpStack->Parameters.DeviceIoControl.IoControlCode == IOCTL_REGISTER_COMMAND_RING)
+            {
+                //
+                // The ring belongs to this handle and it's released when
+                // the handle is cleaned up
+                //
+                CommandRingRegister(DebuggerCommandRingRequest, IrpStack->FileObject);
+            }
+            else
+            {
+                CommandRingProcess(DebuggerCommandRingRequest);
+            }
+
+            Irp->IoStatus.Information = SIZEOF_DEBUGGER_COMMAND_RING_REQUEST;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
         default:
             LogError("Err, unknown IOCTL");
             Status = STATUS_NOT_IMPLEMENTED;
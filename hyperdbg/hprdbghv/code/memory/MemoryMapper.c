@@ -831,6 +831,72 @@ MemoryMapperReadMemorySafe(UINT64 VaAddressToRead, PVOID BufferToSaveMemory, SIZ
                                                               SizeToRead);
 }
 
+/**
+ * @brief Read multiple fields of an object safely
+ * @details If all of the fields are in a range that fits in the scratch
+ * buffer, the whole range is read once (each page is mapped once) instead
+ * of mapping the pages for each field separately
+ *
+ * @param ObjectAddress Virtual address of the object
+ * @param Fields Fields to read
+ * @param CountOfFields Count of fields
+ * @param ScratchBuffer Buffer to read the range of fields
+ * @param ScratchBufferSize Size of scratch buffer
+ * @return BOOLEAN if it was successful the returns TRUE and if it was
+ * unsuccessful then it returns FALSE
+ */
+_Use_decl_annotations_
+BOOLEAN
+MemoryMapperReadObjectFieldsSafe(UINT64                      ObjectAddress,
+                                 PMEMORY_MAPPER_OBJECT_FIELD Fields,
+                                 UINT32                      CountOfFields,
+                                 PVOID                       ScratchBuffer,
+                                 UINT32                      ScratchBufferSize)
+{
+    UINT32  StartOffset = MAXUINT32;
+    UINT32  EndOffset   = 0;
+    BOOLEAN Result      = TRUE;
+
+    if (CountOfFields == 0)
+    {
+        return TRUE;
+    }
+
+    //
+    // Find the range that covers all of the fields
+    //
+    for (UINT32 i = 0; i < CountOfFields; i++)
+    {
+        StartOffset = min(StartOffset, Fields[i].Offset);
+        EndOffset   = max(EndOffset, Fields[i].Offset + Fields[i].Size);
+    }
+
+    if (EndOffset - StartOffset > ScratchBufferSize)
+    {
+        //
+        // The fields are far from each other, read them separately
+        //
+        for (UINT32 i = 0; i < CountOfFields; i++)
+        {
+            Result &= MemoryMapperReadMemorySafe(ObjectAddress + Fields[i].Offset, Fields[i].Buffer, Fields[i].Size);
+        }
+
+        return Result;
+    }
+
+    if (!MemoryMapperReadMemorySafe(ObjectAddress + StartOffset, ScratchBuffer, EndOffset - StartOffset))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < CountOfFields; i++)
+    {
+        RtlCopyMemory(Fields[i].Buffer, (CHAR *)ScratchBuffer + Fields[i].Offset - StartOffset, Fields[i].Size);
+    }
+
+    return TRUE;
+}
+
 /**
  * @brief Read memory safely by mapping the buffer on the target process memory (It's a wrapper)
  * 
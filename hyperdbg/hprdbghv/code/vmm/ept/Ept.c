@@ -778,7 +778,7 @@ EptSetPML1AndInvalidateTLB(PEPT_PML1_ENTRY EntryAddress, EPT_PML1_ENTRY EntryVal
     //
     // acquire the lock
     //
-    SpinlockLock(&Pml1ModificationAndInvalidationLock);
+    TicketSpinlockLock(&Pml1ModificationAndInvalidationLock);
 
     //
     // set the value
@@ -804,5 +804,5 @@ EptSetPML1AndInvalidateTLB(PEPT_PML1_ENTRY EntryAddress, EPT_PML1_ENTRY EntryVal
     //
     // release the lock
     //
-    SpinlockUnlock(&Pml1ModificationAndInvalidationLock);
+    TicketSpinlockUnlock(&Pml1ModificationAndInvalidationLock);
 }
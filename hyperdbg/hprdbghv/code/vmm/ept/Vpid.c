@@ -88,3 +88,146 @@ VpidInvvpidSingleContextRetainingGlobals(UINT16 Vpid)
     INVVPID_DESCRIPTOR Descriptor = {Vpid, 0, 0, 0};
     VpidInvvpid(InvvpidSingleContextRetainingGlobals, &Descriptor);
 }
+
+/**
+ * @brief Mark a PCID as used (it might have TLB entries)
+ * 
+ * @param State 
+ * @param Pcid 
+ * @return VOID
+ */
+static VOID
+VpidMarkPcidAsUsed(PVPID_PCID_STATE State, UINT32 Pcid)
+{
+    State->UsedPcids[Pcid / 64] |= 1ULL << (Pcid % 64);
+}
+
+/**
+ * @brief Decide the TLB invalidation that is needed for emulating a mov-to-cr3
+ * @details Based on Intel SDM (4.10.4.1), if CR4.PCIDE = 1 and bit 63 of the
+ * operand is set, no TLB entry is invalidated, otherwise the entries of the
+ * new PCID (PCID 0 if CR4.PCIDE = 0) are invalidated except global pages
+ * 
+ * INVVPID cannot target a single PCID, so the entries of all PCIDs (except
+ * global pages) are invalidated, but if the new PCID is not used since the
+ * last invalidation, then it has no entries and no invalidation is needed
+ * 
+ * The address spaces in the CR3-target list are switched without vm-exits,
+ * so their PCIDs are always considered as used
+ * 
+ * This function doesn't use VMX instructions, it only updates the state
+ * 
+ * @param State The PCID state of the current core
+ * @param IsPcidEnabled Whether CR4.PCIDE is set
+ * @param Cr3Operand The source operand of the mov-to-cr3
+ * @param Cr3TargetValues The CR3-target values
+ * @param CountOfCr3TargetValues Count of CR3-target values
+ * @return VPID_CR3_WRITE_INVALIDATION 
+ */
+VPID_CR3_WRITE_INVALIDATION
+VpidGetCr3WriteInvalidation(PVPID_PCID_STATE State,
+                            BOOLEAN          IsPcidEnabled,
+                            UINT64           Cr3Operand,
+                            UINT64 *         Cr3TargetValues,
+                            UINT32           CountOfCr3TargetValues)
+{
+    UINT32 Pcid = IsPcidEnabled ? (Cr3Operand & (VPID_COUNT_OF_PCIDS - 1)) : 0;
+
+    //
+    // The guest asked to preserve the entries
+    //
+    if (IsPcidEnabled && (Cr3Operand & VPID_CR3_NO_INVALIDATION_BIT))
+    {
+        VpidMarkPcidAsUsed(State, Pcid);
+        State->CountOfAvoidedInvalidations++;
+
+        return VPID_CR3_WRITE_NO_INVALIDATION;
+    }
+
+    //
+    // The PCID has no entries since the last invalidation
+    //
+    if (State->IsValid && !(State->UsedPcids[Pcid / 64] & (1ULL << (Pcid % 64))))
+    {
+        VpidMarkPcidAsUsed(State, Pcid);
+        State->CountOfAvoidedInvalidations++;
+
+        return VPID_CR3_WRITE_NO_INVALIDATION;
+    }
+
+    //
+    // All of the entries (except global pages) are invalidated, so
+    // only the new PCID and the PCIDs of the CR3-target list are used
+    //
+    RtlZeroMemory(State->UsedPcids, sizeof(State->UsedPcids));
+    State->IsValid = TRUE;
+
+    VpidMarkPcidAsUsed(State, Pcid);
+
+    for (size_t i = 0; i < CountOfCr3TargetValues; i++)
+    {
+        VpidMarkPcidAsUsed(State, IsPcidEnabled ? (Cr3TargetValues[i] & (VPID_COUNT_OF_PCIDS - 1)) : 0);
+    }
+
+    return VPID_CR3_WRITE_INVALIDATE_RETAINING_GLOBALS;
+}
+
+/**
+ * @brief Emulate a mov-to-cr3 of the guest
+ * @details should be called in vmx-root
+ * 
+ * @param ProcessorIndex 
+ * @param Cr3Operand The source operand of the mov-to-cr3
+ * @return VOID
+ */
+VOID
+VpidEmulateCr3Write(UINT32 ProcessorIndex, UINT64 Cr3Operand)
+{
+    CR4    Cr4                                                    = {0};
+    UINT64 Cr3TargetCount                                         = 0;
+    UINT64 Cr3TargetValues[PROCESS_CR3_TARGET_LIST_MAXIMUM_COUNT] = {0};
+
+    __vmx_vmread(VMCS_GUEST_CR4, &Cr4.AsUInt);
+    __vmx_vmread(VMCS_CTRL_CR3_TARGET_COUNT, &Cr3TargetCount);
+
+    for (size_t i = 0; i < Cr3TargetCount && i < PROCESS_CR3_TARGET_LIST_MAXIMUM_COUNT; i++)
+    {
+        //
+        // The CR3-target value fields are consecutive (even encodings)
+        //
+        __vmx_vmread(VMCS_CTRL_CR3_TARGET_VALUE_0 + (i * 2), &Cr3TargetValues[i]);
+    }
+
+    //
+    // Bit 63 is not a part of CR3
+    //
+    __vmx_vmwrite(VMCS_GUEST_CR3, Cr3Operand & ~VPID_CR3_NO_INVALIDATION_BIT);
+
+    //
+    // As we use VPID tags, the vm-entry won't flush the TLB, so
+    // the invalidation should be done manually
+    //
+    if (VpidGetCr3WriteInvalidation(&g_GuestState[ProcessorIndex].PcidState,
+                                    (BOOLEAN)Cr4.PcidEnable,
+                                    Cr3Operand,
+                                    Cr3TargetValues,
+                                    (UINT32)min(Cr3TargetCount, PROCESS_CR3_TARGET_LIST_MAXIMUM_COUNT)) ==
+        VPID_CR3_WRITE_INVALIDATE_RETAINING_GLOBALS)
+    {
+        VpidInvvpidSingleContextRetainingGlobals(VPID_TAG);
+    }
+}
+
+/**
+ * @brief Forget the used PCIDs of a core
+ * @details should be called when mov-to-cr3s are switched without
+ * vm-exits (e.g., before enabling cr3-load exiting)
+ * 
+ * @param ProcessorIndex 
+ * @return VOID
+ */
+VOID
+VpidResetPcidState(UINT32 ProcessorIndex)
+{
+    g_GuestState[ProcessorIndex].PcidState.IsValid = FALSE;
+}
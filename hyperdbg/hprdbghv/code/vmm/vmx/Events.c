@@ -46,7 +46,7 @@ EventInjectBreakpoint()
 {
     EventInjectInterruption(INTERRUPT_TYPE_SOFTWARE_EXCEPTION, EXCEPTION_VECTOR_BREAKPOINT, FALSE, 0);
     UINT32 ExitInstrLength;
-    __vmx_vmread(VMCS_VMEXIT_INSTRUCTION_LENGTH, &ExitInstrLength);
+    ExitInstrLength = (UINT32)VmcsCacheRead(VMCS_VMEXIT_INSTRUCTION_LENGTH);
     __vmx_vmwrite(VMCS_CTRL_VMENTRY_INSTRUCTION_LENGTH, ExitInstrLength);
 }
 
@@ -60,7 +60,7 @@ EventInjectGeneralProtection()
 {
     EventInjectInterruption(INTERRUPT_TYPE_HARDWARE_EXCEPTION, EXCEPTION_VECTOR_GENERAL_PROTECTION_FAULT, TRUE, 0);
     UINT32 ExitInstrLength;
-    __vmx_vmread(VMCS_VMEXIT_INSTRUCTION_LENGTH, &ExitInstrLength);
+    ExitInstrLength = (UINT32)VmcsCacheRead(VMCS_VMEXIT_INSTRUCTION_LENGTH);
     __vmx_vmwrite(VMCS_CTRL_VMENTRY_INSTRUCTION_LENGTH, ExitInstrLength);
 }
 
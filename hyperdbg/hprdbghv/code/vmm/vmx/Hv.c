@@ -167,14 +167,14 @@ HvHandleCpuid(PGUEST_REGS RegistersState)
 VOID
 HvHandleControlRegisterAccess(PGUEST_REGS GuestState, UINT32 ProcessorIndex)
 {
-    ULONG                           ExitQualification = 0;
+    UINT64                          ExitQualification = 0;
     VMX_EXIT_QUALIFICATION_MOV_CR * CrExitQualification;
     UINT64 *                        RegPtr;
     UINT64                          NewCr3;
     CR3_TYPE                        NewCr3Reg;
     VIRTUAL_MACHINE_STATE *         CurrentVmState = &g_GuestState[ProcessorIndex];
 
-    __vmx_vmread(VMCS_EXIT_QUALIFICATION, &ExitQualification);
+    ExitQualification = VmcsCacheRead(VMCS_EXIT_QUALIFICATION);
 
     CrExitQualification = (VMX_EXIT_QUALIFICATION_MOV_CR *)&ExitQualification;
 
@@ -214,23 +214,23 @@ HvHandleControlRegisterAccess(PGUEST_REGS GuestState, UINT32 ProcessorIndex)
             NewCr3Reg.Flags = NewCr3;
 
             //
-            // Apply the new cr3
+            // Apply the new cr3 and invalidate the TLB (if needed) as we
+            // used VPID tags so the vm-exit won't normally (automatically)
+            // flush the TLB, we have to do it manually
             //
-            __vmx_vmwrite(VMCS_GUEST_CR3, NewCr3Reg.Flags);
-
-            //
-            // Invalidate as we used VPID tags so the vm-exit won't
-            // normally (automatically) flush the TLB, we have to do
-            // it manually
-            //
-            VpidInvvpidSingleContext(VPID_TAG);
+            VpidEmulateCr3Write(ProcessorIndex, *RegPtr);
 
             //
             // Call kernel debugger handler for mov to cr3 in kernel debugger
             //
-            if (CurrentVmState->DebuggingState.ThreadOrProcessTracingDetails.IsWatingForMovCr3VmExits)
+            if (CurrentVmState->DebuggingState.ThreadOrProcessTracingDetails.IsWatingForMovCr3VmExits &&
+                !ProcessHandleProcessChange(ProcessorIndex, GuestState))
             {
-                ProcessHandleProcessChange(ProcessorIndex, GuestState);
+                //
+                // Not the target process, avoid further vm-exits for this
+                // address space by adding it to the CR3-target list
+                //
+                ProcessCr3TargetListAdd(ProcessorIndex, *RegPtr);
             }
 
             //
@@ -324,12 +324,12 @@ HvResumeToNextInstruction()
     UINT64 CurrentRIP            = NULL;
     size_t ExitInstructionLength = 0;
 
-    __vmx_vmread(VMCS_GUEST_RIP, &CurrentRIP);
-    __vmx_vmread(VMCS_VMEXIT_INSTRUCTION_LENGTH, &ExitInstructionLength);
+    CurrentRIP            = VmcsCacheRead(VMCS_GUEST_RIP);
+    ExitInstructionLength = VmcsCacheRead(VMCS_VMEXIT_INSTRUCTION_LENGTH);
 
     ResumeRIP = CurrentRIP + ExitInstructionLength;
 
-    __vmx_vmwrite(VMCS_GUEST_RIP, ResumeRIP);
+    VmcsCacheWrite(VMCS_GUEST_RIP, ResumeRIP);
 }
 
 /**
@@ -346,7 +346,7 @@ HvSetMonitorTrapFlag(BOOLEAN Set)
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     if (Set)
     {
@@ -360,7 +360,7 @@ HvSetMonitorTrapFlag(BOOLEAN Set)
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -484,7 +484,7 @@ HvSetPmcVmexit(BOOLEAN Set)
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     if (Set)
     {
@@ -498,7 +498,7 @@ HvSetPmcVmexit(BOOLEAN Set)
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -579,7 +579,7 @@ HvSetInterruptWindowExiting(BOOLEAN Set)
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     //
     // interrupt-window exiting
@@ -596,7 +596,7 @@ HvSetInterruptWindowExiting(BOOLEAN Set)
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -613,7 +613,7 @@ HvSetNmiWindowExiting(BOOLEAN Set)
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     //
     // interrupt-window exiting
@@ -630,7 +630,7 @@ HvSetNmiWindowExiting(BOOLEAN Set)
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -652,7 +652,7 @@ HvHandleMovDebugRegister(UINT32 ProcessorIndex, PGUEST_REGS Regs)
     //
     // The implementation is derived from Hvpp
     //
-    __vmx_vmread(VMCS_EXIT_QUALIFICATION, &ExitQualification);
+    ExitQualification.AsUInt = VmcsCacheRead(VMCS_EXIT_QUALIFICATION);
 
     UINT64 GpRegister = GpRegs[ExitQualification.GeneralPurposeRegister];
 
@@ -73,7 +73,7 @@ IdtEmulationHandlePageFaults(_In_ UINT32                       CurrentProcessorI
     {
         UINT64 PageFaultAddress = 0;
 
-        __vmx_vmread(VMCS_EXIT_QUALIFICATION, &PageFaultAddress);
+        PageFaultAddress = VmcsCacheRead(VMCS_EXIT_QUALIFICATION);
 
         //
         // Cr2 is used as the page-fault address
@@ -347,42 +347,206 @@ IdtEmulationHandleExceptionAndNmi(_In_ UINT32                          CurrentPr
 }
 
 /**
- * @brief if the guest is not interruptible, then we save the details of each
+ * @brief Mark a vector as pending in a bitmap of pending interrupts
+ * 
+ * @param PendingInterrupts the bitmap of pending vectors
+ * @param Vector the vector of the interrupt
+ * @return BOOLEAN TRUE if the vector was not already pending
+ */
+static BOOLEAN
+IdtEmulationSetPendingVector(_Inout_ UINT64 * PendingInterrupts, _In_ UINT32 Vector)
+{
+    return !_bittestandset64((LONG64 *)&PendingInterrupts[Vector / 64], Vector % 64);
+}
+
+/**
+ * @brief Check whether there is any vector in a bitmap of pending interrupts
+ * 
+ * @param PendingInterrupts the bitmap of pending vectors
+ * @return BOOLEAN 
+ */
+static BOOLEAN
+IdtEmulationIsAnyVectorPending(_In_ UINT64 * PendingInterrupts)
+{
+    for (size_t i = 0; i < PENDING_INTERRUPTS_COUNT_OF_QWORDS; i++)
+    {
+        if (PendingInterrupts[i] != NULL)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Remove the vector with the highest priority from a bitmap of
+ * pending interrupts
+ * 
+ * @param PendingInterrupts the bitmap of pending vectors
+ * @param Vector the removed vector
+ * @return BOOLEAN FALSE if no vector is pending
+ */
+static BOOLEAN
+IdtEmulationPopHighestPendingVector(_Inout_ UINT64 * PendingInterrupts, _Out_ UINT32 * Vector)
+{
+    ULONG Index;
+
+    for (INT32 i = PENDING_INTERRUPTS_COUNT_OF_QWORDS - 1; i >= 0; i--)
+    {
+        if (!_BitScanReverse64(&Index, PendingInterrupts[i]))
+        {
+            continue;
+        }
+
+        PendingInterrupts[i] &= ~(1ULL << Index);
+
+        *Vector = (i * 64) + Index;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Check the bitmap of pending interrupts
+ * @details used by the kernel-side tests, the bitmap of the cores
+ * are not changed
+ * 
+ * @return BOOLEAN TRUE if the results were as expected
+ */
+BOOLEAN
+IdtEmulationPerformPendingInterruptsSelfCheck()
+{
+    UINT64 PendingInterrupts[PENDING_INTERRUPTS_COUNT_OF_QWORDS] = {0};
+    UINT32 Vectors[]                                             = {0x20, 0xd1, 0x3f, 0xff, 0x40, 0x41};
+    UINT32 ExpectedVectors[]                                     = {0xff, 0xd1, 0x41, 0x40, 0x3f, 0x20};
+    UINT32 Vector;
+
+    if (IdtEmulationIsAnyVectorPending(PendingInterrupts))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < sizeof(Vectors) / sizeof(Vectors[0]); i++)
+    {
+        if (!IdtEmulationSetPendingVector(PendingInterrupts, Vectors[i]))
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // A vector that is already pending is delivered once
+    //
+    if (IdtEmulationSetPendingVector(PendingInterrupts, 0xd1))
+    {
+        return FALSE;
+    }
+
+    //
+    // Vectors are delivered from the highest priority
+    //
+    for (UINT32 i = 0; i < sizeof(ExpectedVectors) / sizeof(ExpectedVectors[0]); i++)
+    {
+        if (!IdtEmulationIsAnyVectorPending(PendingInterrupts) ||
+            !IdtEmulationPopHighestPendingVector(PendingInterrupts, &Vector) ||
+            Vector != ExpectedVectors[i])
+        {
+            return FALSE;
+        }
+    }
+
+    return !IdtEmulationIsAnyVectorPending(PendingInterrupts) &&
+           !IdtEmulationPopHighestPendingVector(PendingInterrupts, &Vector);
+}
+
+/**
+ * @brief if the guest is not interruptible, then we save the vector of each
  * interrupt so we can re-inject them to the guest whenever the interrupt window
  * is open
+ * @details The vectors are kept in a bitmap (like the IRR of the local APIC),
+ * so no interrupt is dropped and if a vector is already pending, then it's
+ * delivered once
  * 
  * @param InterruptExit interrupt info from vm-exit
  * @param CurrentProcessorIndex processor index
- * @return BOOLEAN 
+ * @return BOOLEAN TRUE if the vector was not already pending
  */
 BOOLEAN
 IdtEmulationInjectInterruptWhenInterruptWindowIsOpen(_In_ VMEXIT_INTERRUPT_INFORMATION InterruptExit,
                                                      _In_ UINT32                       CurrentProcessorIndex)
 {
-    BOOLEAN                 FoundAPlaceForFutureInjection = FALSE;
-    VIRTUAL_MACHINE_STATE * CurrentGuestState             = &g_GuestState[CurrentProcessorIndex];
+    VIRTUAL_MACHINE_STATE * CurrentGuestState = &g_GuestState[CurrentProcessorIndex];
 
     //
     // We can't inject interrupt because the guest's state is not interruptible
     // we have to queue it an re-inject it when the interrupt window is opened !
     //
-    for (size_t i = 0; i < PENDING_INTERRUPTS_BUFFER_CAPACITY; i++)
+    return IdtEmulationSetPendingVector(CurrentGuestState->PendingExternalInterrupts, InterruptExit.Vector);
+}
+
+/**
+ * @brief Check whether there is any pending external interrupt
+ * 
+ * @param CurrentProcessorIndex processor index
+ * @return BOOLEAN 
+ */
+BOOLEAN
+IdtEmulationIsAnyInterruptPending(_In_ UINT32 CurrentProcessorIndex)
+{
+    VIRTUAL_MACHINE_STATE * CurrentGuestState = &g_GuestState[CurrentProcessorIndex];
+
+    return IdtEmulationIsAnyVectorPending(CurrentGuestState->PendingExternalInterrupts);
+}
+
+/**
+ * @brief Inject the pending external interrupt with the highest priority
+ * (vector) to the guest
+ * @details The guest should be interruptible, as only one event can be
+ * injected on each vm-entry, the interrupt-window exiting is kept enabled
+ * only if other interrupts are still pending
+ * 
+ * @param CurrentProcessorIndex processor index
+ * @return BOOLEAN TRUE if an interrupt is injected
+ */
+BOOLEAN
+IdtEmulationInjectHighestPriorityPendingInterrupt(_In_ UINT32 CurrentProcessorIndex)
+{
+    UINT32                       Vector;
+    VMEXIT_INTERRUPT_INFORMATION InterruptExit     = {0};
+    VIRTUAL_MACHINE_STATE *      CurrentGuestState = &g_GuestState[CurrentProcessorIndex];
+
+    //
+    // Remove it from the pending interrupts
+    //
+    if (IdtEmulationPopHighestPendingVector(CurrentGuestState->PendingExternalInterrupts, &Vector))
     {
         //
-        // Find an empty space
+        // Re-inject the interrupt
         //
-        if (CurrentGuestState->PendingExternalInterrupts[i] == NULL)
-        {
-            //
-            // Save it for future re-injection (interrupt-window exiting)
-            //
-            CurrentGuestState->PendingExternalInterrupts[i] = InterruptExit.AsUInt;
-            FoundAPlaceForFutureInjection                   = TRUE;
-            break;
-        }
+        InterruptExit.Vector           = Vector;
+        InterruptExit.InterruptionType = INTERRUPT_TYPE_EXTERNAL_INTERRUPT;
+        InterruptExit.Valid            = TRUE;
+
+        IdtEmulationReInjectInterruptOrException(InterruptExit);
+
+        //
+        // Another interrupt-window exiting is only needed if there are
+        // other pending interrupts
+        //
+        HvSetInterruptWindowExiting(IdtEmulationIsAnyInterruptPending(CurrentProcessorIndex));
+
+        return TRUE;
     }
 
-    return FoundAPlaceForFutureInjection;
+    //
+    // Nothing left in pending state, let's disable the interrupt window exiting
+    //
+    HvSetInterruptWindowExiting(FALSE);
+
+    return FALSE;
 }
 
 /**
@@ -521,7 +685,7 @@ IdtEmulationHandleExternalInterrupt(_In_ UINT32                          Current
     }
     else if (InterruptExit.Valid && InterruptExit.InterruptionType == INTERRUPT_TYPE_EXTERNAL_INTERRUPT)
     {
-        __vmx_vmread(VMCS_GUEST_RFLAGS, &GuestRflags);
+        GuestRflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
         __vmx_vmread(VMCS_GUEST_INTERRUPTIBILITY_STATE, &InterruptibilityState);
 
         //
@@ -531,7 +695,16 @@ IdtEmulationHandleExternalInterrupt(_In_ UINT32                          Current
         //
         Interruptible = GuestRflags.InterruptEnableFlag && !InterruptibilityState.BlockingByMovSs;
 
-        if (Interruptible)
+        if (Interruptible && IdtEmulationIsAnyInterruptPending(CurrentProcessorIndex))
+        {
+            //
+            // There are pending interrupts that might have higher priorities,
+            // so the interrupt is queued and the highest one is injected
+            //
+            IdtEmulationInjectInterruptWhenInterruptWindowIsOpen(InterruptExit, CurrentProcessorIndex);
+            IdtEmulationInjectHighestPriorityPendingInterrupt(CurrentProcessorIndex);
+        }
+        else if (Interruptible)
         {
             //
             // Re-inject the interrupt/exception
@@ -599,64 +772,13 @@ IdtEmulationHandleNmiWindowExiting(_In_ UINT32 CurrentProcessorIndex, _Inout_ PG
 VOID
 IdtEmulationHandleInterruptWindowExiting(_In_ UINT32 CurrentProcessorIndex)
 {
-    VMEXIT_INTERRUPT_INFORMATION InterruptExit     = {0};
-    ULONG                        ErrorCode         = 0;
-    VIRTUAL_MACHINE_STATE *      CurrentGuestState = &g_GuestState[CurrentProcessorIndex];
+    VIRTUAL_MACHINE_STATE * CurrentGuestState = &g_GuestState[CurrentProcessorIndex];
 
     //
-    // Find the pending interrupt to inject
+    // Inject the pending interrupt with the highest priority, the
+    // interrupt-window exiting is disabled if nothing else is pending
     //
-
-    for (size_t i = 0; i < PENDING_INTERRUPTS_BUFFER_CAPACITY; i++)
-    {
-        //
-        // Find an empty space
-        //
-        if (CurrentGuestState->PendingExternalInterrupts[i] != NULL)
-        {
-            //
-            // Save it for re-injection (interrupt-window exiting)
-            //
-            InterruptExit.AsUInt = CurrentGuestState->PendingExternalInterrupts[i];
-
-            //
-            // Free the entry
-            //
-            CurrentGuestState->PendingExternalInterrupts[i] = NULL;
-            break;
-        }
-    }
-
-    if (InterruptExit.AsUInt == 0)
-    {
-        //
-        // Nothing left in pending state, let's disable the interrupt window exiting
-        //
-        HvSetInterruptWindowExiting(FALSE);
-    }
-    else
-    {
-        //
-        // Re-inject the interrupt/exception
-        //
-        __vmx_vmwrite(VMCS_CTRL_VMENTRY_INTERRUPTION_INFORMATION_FIELD, InterruptExit.AsUInt);
-
-        //
-        // re-write error code (if any)
-        //
-        if (InterruptExit.ErrorCodeValid)
-        {
-            //
-            // Read the error code
-            //
-            __vmx_vmread(VMCS_VMEXIT_INTERRUPTION_ERROR_CODE, &ErrorCode);
-
-            //
-            // Write the error code
-            //
-            __vmx_vmwrite(VMCS_CTRL_VMENTRY_EXCEPTION_ERROR_CODE, ErrorCode);
-        }
-    }
+    IdtEmulationInjectHighestPriorityPendingInterrupt(CurrentProcessorIndex);
 
     //
     // avoid incrementing rip
@@ -397,7 +397,7 @@ GetGuestTr()
 VOID
 SetGuestRFlags(UINT64 RFlags)
 {
-    __vmx_vmwrite(VMCS_GUEST_RFLAGS, RFlags);
+    VmcsCacheWrite(VMCS_GUEST_RFLAGS, RFlags);
 }
 
 /**
@@ -409,7 +409,7 @@ UINT64
 GetGuestRFlags()
 {
     UINT64 RFlags;
-    __vmx_vmread(VMCS_GUEST_RFLAGS, &RFlags);
+    RFlags = VmcsCacheRead(VMCS_GUEST_RFLAGS);
     return RFlags;
 }
 
@@ -422,7 +422,7 @@ GetGuestRFlags()
 VOID
 SetGuestRIP(UINT64 RIP)
 {
-    __vmx_vmwrite(VMCS_GUEST_RIP, RIP);
+    VmcsCacheWrite(VMCS_GUEST_RIP, RIP);
 }
 
 /**
@@ -434,7 +434,7 @@ SetGuestRIP(UINT64 RIP)
 VOID
 SetGuestRSP(UINT64 RSP)
 {
-    __vmx_vmwrite(VMCS_GUEST_RSP, RSP);
+    VmcsCacheWrite(VMCS_GUEST_RSP, RSP);
 }
 
 /**
@@ -447,7 +447,7 @@ GetGuestRIP()
 {
     UINT64 RIP;
 
-    __vmx_vmread(VMCS_GUEST_RIP, &RIP);
+    RIP = VmcsCacheRead(VMCS_GUEST_RIP);
     return RIP;
 }
 
@@ -71,9 +71,9 @@ MtfHandleVmexit(ULONG CurrentProcessorIndex, PGUEST_REGS GuestRegs)
         {
             RFLAGS Rflags = {0};
 
-            __vmx_vmread(VMCS_GUEST_RFLAGS, &Rflags);
+            Rflags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
             Rflags.InterruptEnableFlag = TRUE;
-            __vmx_vmwrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
+            VmcsCacheWrite(VMCS_GUEST_RFLAGS, Rflags.AsUInt);
 
             CurrentDebuggingState->SoftwareBreakpointState->SetRflagsIFBitOnMtf = FALSE;
         }
@@ -123,7 +123,7 @@ MtfHandleVmexit(ULONG CurrentProcessorIndex, PGUEST_REGS GuestRegs)
             //
             // Check if there is at least an interrupt that needs to be delivered
             //
-            if (CurrentVmState->PendingExternalInterrupts[0] != NULL)
+            if (IdtEmulationIsAnyInterruptPending(CurrentProcessorIndex))
             {
                 //
                 // Enable Interrupt-window exiting.
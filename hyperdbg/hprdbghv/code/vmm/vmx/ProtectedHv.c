@@ -393,7 +393,7 @@ ProtectedHvSetTscVmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVERS PassOv
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     if (Set)
     {
@@ -406,7 +406,7 @@ ProtectedHvSetTscVmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVERS PassOv
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -470,7 +470,7 @@ ProtectedHvSetMovDebugRegsVmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVE
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     if (Set)
     {
@@ -484,7 +484,7 @@ ProtectedHvSetMovDebugRegsVmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVE
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -627,11 +627,22 @@ ProtectedHvSetMovToCr3Vmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVERS P
     //
     // Read the previous flags
     //
-    __vmx_vmread(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, &CpuBasedVmExecControls);
+    CpuBasedVmExecControls = (ULONG)VmcsCacheRead(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS);
 
     if (Set)
     {
         CpuBasedVmExecControls |= CPU_BASED_CR3_LOAD_EXITING;
+
+        //
+        // Clear the CR3-target list so all of the mov to cr3s cause vm-exits,
+        // it's learned again if we're waiting for a process switch
+        //
+        __vmx_vmwrite(VMCS_CTRL_CR3_TARGET_COUNT, 0);
+
+        //
+        // The mov to cr3s were not intercepted, so the used PCIDs are unknown
+        //
+        VpidResetPcidState(CurrentCoreId);
     }
     else
     {
@@ -641,7 +652,7 @@ ProtectedHvSetMovToCr3Vmexit(BOOLEAN Set, PROTECTED_HV_RESOURCES_PASSING_OVERS P
     //
     // Set the new value
     //
-    __vmx_vmwrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
+    VmcsCacheWrite(VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS, CpuBasedVmExecControls);
 }
 
 /**
@@ -0,0 +1,182 @@
+/**
+ * @file VmcsCache.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief The per-exit cache of the VMCS fields
+ * @details The VM-exit handlers read the guest RIP, RFLAGS, exit
+ * qualification, instruction length and the execution controls several
+ * times in a single VM-exit and modify them with read-modify-writes.
+ * VMREAD and VMWRITE are expensive (each one is a VM-exit when HyperDbg
+ * itself runs on a nested hypervisor), so these fields are read once
+ * and the modified ones are written once before resuming the guest
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The VMCS fields that are cached (the index of each field is
+ * its bit in the valid and dirty masks)
+ *
+ */
+static const UINT64 VmcsCacheFields[VMCS_CACHE_COUNT_OF_FIELDS] = {
+    VMCS_EXIT_REASON,
+    VMCS_EXIT_QUALIFICATION,
+    VMCS_VMEXIT_INSTRUCTION_LENGTH,
+    VMCS_VMEXIT_INTERRUPTION_INFORMATION,
+    VMCS_GUEST_PHYSICAL_ADDRESS,
+    VMCS_GUEST_RIP,
+    VMCS_GUEST_RSP,
+    VMCS_GUEST_RFLAGS,
+    VMCS_CTRL_PROCESSOR_BASED_VM_EXECUTION_CONTROLS,
+};
+
+/**
+ * @brief Find the index of a field in the cache
+ *
+ * @param Field The VMCS field encoding
+ * @param Index The index of the field in the cache
+ *
+ * @return BOOLEAN Returns true if the field is cached
+ */
+static BOOLEAN
+VmcsCacheGetIndex(UINT64 Field, UINT32 * Index)
+{
+    for (UINT32 i = 0; i < VMCS_CACHE_COUNT_OF_FIELDS; i++)
+    {
+        if (VmcsCacheFields[i] == Field)
+        {
+            *Index = i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Start caching the VMCS fields on a new VM-exit
+ * @details Should be called in vmx-root at the start of the VM-exit handler
+ *
+ * @param CurrentProcessorIndex
+ *
+ * @return VOID
+ */
+VOID
+VmcsCacheStart(ULONG CurrentProcessorIndex)
+{
+    VMCS_FIELD_CACHE * Cache = &g_GuestState[CurrentProcessorIndex].VmcsCache;
+
+    Cache->ValidMask = 0;
+    Cache->DirtyMask = 0;
+    Cache->IsActive  = TRUE;
+}
+
+/**
+ * @brief Write the modified fields back to the VMCS and stop caching
+ * @details Should be called in vmx-root before resuming the guest
+ *
+ * @param CurrentProcessorIndex
+ *
+ * @return VOID
+ */
+VOID
+VmcsCacheFlush(ULONG CurrentProcessorIndex)
+{
+    VMCS_FIELD_CACHE * Cache = &g_GuestState[CurrentProcessorIndex].VmcsCache;
+
+    if (!Cache->IsActive)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < VMCS_CACHE_COUNT_OF_FIELDS; i++)
+    {
+        if (Cache->DirtyMask & (1 << i))
+        {
+            __vmx_vmwrite(VmcsCacheFields[i], Cache->Values[i]);
+        }
+    }
+
+    Cache->DirtyMask = 0;
+    Cache->IsActive  = FALSE;
+}
+
+/**
+ * @brief Stop caching without writing the modified fields
+ * @details Used when the VMCS is not valid anymore (e.g., after vmxoff)
+ *
+ * @param CurrentProcessorIndex
+ *
+ * @return VOID
+ */
+VOID
+VmcsCacheDiscard(ULONG CurrentProcessorIndex)
+{
+    VMCS_FIELD_CACHE * Cache = &g_GuestState[CurrentProcessorIndex].VmcsCache;
+
+    Cache->ValidMask = 0;
+    Cache->DirtyMask = 0;
+    Cache->IsActive  = FALSE;
+}
+
+/**
+ * @brief Read a field of the current VMCS
+ * @details If the core is handling a VM-exit, the cached fields are
+ * read from the VMCS only once, otherwise it's a normal vmread
+ *
+ * @param Field The VMCS field encoding
+ *
+ * @return UINT64 The value of the field
+ */
+UINT64
+VmcsCacheRead(UINT64 Field)
+{
+    UINT32             Index = 0;
+    UINT64             Value = 0;
+    VMCS_FIELD_CACHE * Cache = &g_GuestState[KeGetCurrentProcessorNumber()].VmcsCache;
+
+    if (!Cache->IsActive || !VmcsCacheGetIndex(Field, &Index))
+    {
+        __vmx_vmread(Field, &Value);
+        return Value;
+    }
+
+    if (!(Cache->ValidMask & (1 << Index)))
+    {
+        __vmx_vmread(Field, &Cache->Values[Index]);
+        Cache->ValidMask |= (1 << Index);
+    }
+
+    return Cache->Values[Index];
+}
+
+/**
+ * @brief Write a field of the current VMCS
+ * @details If the core is handling a VM-exit, the write of the cached
+ * fields is deferred until the guest is resumed (so multiple writes to
+ * the same field are coalesced), otherwise it's a normal vmwrite
+ *
+ * @param Field The VMCS field encoding
+ * @param Value The new value of the field
+ *
+ * @return VOID
+ */
+VOID
+VmcsCacheWrite(UINT64 Field, UINT64 Value)
+{
+    UINT32             Index = 0;
+    VMCS_FIELD_CACHE * Cache = &g_GuestState[KeGetCurrentProcessorNumber()].VmcsCache;
+
+    if (!Cache->IsActive || !VmcsCacheGetIndex(Field, &Index))
+    {
+        __vmx_vmwrite(Field, Value);
+        return;
+    }
+
+    Cache->Values[Index] = Value;
+    Cache->ValidMask |= (1 << Index);
+    Cache->DirtyMask |= (1 << Index);
+}
@@ -48,10 +48,21 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     //
     CurrentGuestState->IsOnVmxRootMode = TRUE;
 
+    //
+    // Pseudo-registers of the script engine should be computed again
+    // in this VM exit
+    //
+    CurrentGuestState->DebuggingState.PseudoRegistersCache.ValidMask = 0;
+
+    //
+    // Fields of the VMCS should be read again in this VM exit
+    //
+    VmcsCacheStart(CurrentProcessorIndex);
+
     //
     // read the exit reason and exit qualification
     //
-    __vmx_vmread(VMCS_EXIT_REASON, &ExitReason);
+    ExitReason = (ULONG)VmcsCacheRead(VMCS_EXIT_REASON);
     ExitReason &= 0xffff;
 
     //
@@ -71,20 +82,20 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     //
     // Save the current rip
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &GuestRip);
+    GuestRip                         = VmcsCacheRead(VMCS_GUEST_RIP);
     CurrentGuestState->LastVmexitRip = GuestRip;
 
     //
     // Set the rsp in general purpose registers structure
     //
-    __vmx_vmread(VMCS_GUEST_RSP, &GuestRsp);
+    GuestRsp       = VmcsCacheRead(VMCS_GUEST_RSP);
     GuestRegs->rsp = GuestRsp;
 
     //
     // Read the exit qualification
     //
 
-    __vmx_vmread(VMCS_EXIT_QUALIFICATION, &ExitQualification);
+    ExitQualification = (ULONG)VmcsCacheRead(VMCS_EXIT_QUALIFICATION);
 
     //
     // Debugging purpose
@@ -193,12 +204,12 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         //
         // Read the I/O Qualification which indicates the I/O instruction
         //
-        __vmx_vmread(VMCS_EXIT_QUALIFICATION, &IoQualification);
+        IoQualification.AsUInt = VmcsCacheRead(VMCS_EXIT_QUALIFICATION);
 
         //
         // Read Guest's RFLAGS
         //
-        __vmx_vmread(VMCS_GUEST_RFLAGS, &Flags);
+        Flags.AsUInt = VmcsCacheRead(VMCS_GUEST_RFLAGS);
 
         //
         // Call the I/O Handler
@@ -224,7 +235,7 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         //
         // Reading guest physical address
         //
-        __vmx_vmread(VMCS_GUEST_PHYSICAL_ADDRESS, &GuestPhysicalAddr);
+        GuestPhysicalAddr = VmcsCacheRead(VMCS_GUEST_PHYSICAL_ADDRESS);
 
         if (EptHandleEptViolation(GuestRegs, ExitQualification, GuestPhysicalAddr) == FALSE)
         {
@@ -235,7 +246,7 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
     }
     case VMX_EXIT_REASON_EPT_MISCONFIGURATION:
     {
-        __vmx_vmread(VMCS_GUEST_PHYSICAL_ADDRESS, &GuestPhysicalAddr);
+        GuestPhysicalAddr = VmcsCacheRead(VMCS_GUEST_PHYSICAL_ADDRESS);
 
         EptHandleMisconfiguration(GuestPhysicalAddr);
 
@@ -255,7 +266,7 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         //
         // read the exit reason
         //
-        __vmx_vmread(VMCS_VMEXIT_INTERRUPTION_INFORMATION, &InterruptExit);
+        InterruptExit.AsUInt = (UINT32)VmcsCacheRead(VMCS_VMEXIT_INTERRUPTION_INFORMATION);
 
         //
         // Handle the emulation
@@ -269,7 +280,7 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         //
         // read the exit reason (for interrupt)
         //
-        __vmx_vmread(VMCS_VMEXIT_INTERRUPTION_INFORMATION, &InterruptExit);
+        InterruptExit.AsUInt = (UINT32)VmcsCacheRead(VMCS_VMEXIT_INTERRUPTION_INFORMATION);
 
         //
         // Call External Interrupt Handler
@@ -429,6 +440,12 @@ VmxVmexitHandler(_Inout_ PGUEST_REGS GuestRegs)
         HvResumeToNextInstruction();
     }
 
+    //
+    // Write the modified fields back to the VMCS before resuming
+    // (if vmxoff is executed, the cache is already discarded)
+    //
+    VmcsCacheFlush(CurrentProcessorIndex);
+
     //
     // Set indicator of Vmx non root mode to false
     //
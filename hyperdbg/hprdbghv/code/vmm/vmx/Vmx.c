@@ -784,13 +784,13 @@ VmxVmxoff()
     //
     // Read guest rsp and rip
     //
-    __vmx_vmread(VMCS_GUEST_RIP, &GuestRIP);
-    __vmx_vmread(VMCS_GUEST_RSP, &GuestRSP);
+    GuestRIP = VmcsCacheRead(VMCS_GUEST_RIP);
+    GuestRSP = VmcsCacheRead(VMCS_GUEST_RSP);
 
     //
     // Read instruction length
     //
-    __vmx_vmread(VMCS_VMEXIT_INSTRUCTION_LENGTH, &ExitInstructionLength);
+    ExitInstructionLength = VmcsCacheRead(VMCS_VMEXIT_INSTRUCTION_LENGTH);
     GuestRIP += ExitInstructionLength;
 
     //
@@ -809,6 +809,12 @@ VmxVmxoff()
     //
     HvRestoreRegisters();
 
+    //
+    // The VMCS won't be used anymore, so the modified fields are not
+    // written back to it
+    //
+    VmcsCacheDiscard(CurrentProcessorIndex);
+
     //
     // Before using vmxoff, you first need to use vmclear on any VMCSes that you want to be able to use again.
     // See sections 24.1 and 24.11 of the SDM.
@@ -85,7 +85,7 @@ VmxBroadcastNmi(UINT32 CurrentCoreIndex, NMI_BROADCAST_ACTION_TYPE VmxBroadcastA
     //
     // make sure, nobody is in the middle of sending anything
     //
-    SpinlockLock(&DebuggerResponseLock);
+    TicketSpinlockLock(&DebuggerResponseLock);
 
     //
     // Indicate that we're waiting for NMI
@@ -105,7 +105,7 @@ VmxBroadcastNmi(UINT32 CurrentCoreIndex, NMI_BROADCAST_ACTION_TYPE VmxBroadcastA
     //
     ApicTriggerGenericNmi();
 
-    SpinlockUnlock(&DebuggerResponseLock);
+    TicketSpinlockUnlock(&DebuggerResponseLock);
 
     return TRUE;
 }
@@ -43,33 +43,6 @@ typedef enum _PROCESS_KILL_METHODS
 
 } PROCESS_KILL_METHODS;
 
-//////////////////////////////////////////////////
-//				 Spinlock Funtions				//
-//////////////////////////////////////////////////
-
-BOOLEAN
-SpinlockTryLock(volatile LONG * Lock);
-
-void
-SpinlockLock(volatile LONG * Lock);
-
-void
-SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaxWait);
-
-void
-SpinlockUnlock(volatile LONG * Lock);
-
-void
-SpinlockInterlockedCompareExchange(
-    LONG volatile * Destination,
-    LONG            Exchange,
-    LONG            Comperand);
-
-#define ScopedSpinlock(LockObject, CodeToRun)   \
-    MetaScopedExpr(SpinlockLock(&LockObject),   \
-                   SpinlockUnlock(&LockObject), \
-                   CodeToRun)
-
 //////////////////////////////////////////////////
 //					Constants					//
 //////////////////////////////////////////////////
@@ -247,6 +220,13 @@ SpinlockInterlockedCompareExchange(
  */
 #define PAGE_OFFSET(Va) ((PVOID)((ULONG_PTR)(Va) & (PAGE_SIZE - 1)))
 
+/**
+ * @brief Size of chunks that are read from the guest memory by the
+ * vmx-root mode compatible memory and string functions
+ *
+ */
+#define VMXROOT_COMPATIBLE_CHUNK_SIZE 0x100
+
 /**
  * @brief Intel TSX Constants
  *
@@ -651,6 +631,9 @@ DrvWrite(PDEVICE_OBJECT DeviceObject, PIRP Irp);
 NTSTATUS
 DrvClose(PDEVICE_OBJECT DeviceObject, PIRP Irp);
 
+NTSTATUS
+DrvCleanup(PDEVICE_OBJECT DeviceObject, PIRP Irp);
+
 NTSTATUS
 DrvUnsupported(PDEVICE_OBJECT DeviceObject, PIRP Irp);
 
@@ -719,3 +702,18 @@ VmxrootCompatibleStrlen(const CHAR * S);
 
 UINT32
 VmxrootCompatibleWcslen(const wchar_t * S);
+
+BOOLEAN
+VmxrootCompatibleMemcmp(UINT64 Buffer1, UINT64 Buffer2, UINT32 Count, INT32 * Result);
+
+BOOLEAN
+VmxrootCompatibleMemchr(UINT64 Buffer, UINT8 Value, UINT32 Count, UINT64 * Address);
+
+BOOLEAN
+VmxrootCompatibleMemcpy(UINT64 Destination, UINT64 Source, UINT32 Count);
+
+BOOLEAN
+VmxrootCompatibleStrcmp(UINT64 S1, UINT64 S2, UINT32 CharSize, INT32 * Result);
+
+BOOLEAN
+VmxrootCompatibleStrstr(UINT64 S, UINT64 SubStr, UINT32 CharSize, UINT64 * Address);
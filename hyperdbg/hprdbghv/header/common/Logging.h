@@ -91,13 +91,13 @@ LOG_BUFFER_INFORMATION * MessageBufferInformation;
  * @brief Vmx-root lock for logging
  * 
  */
-volatile LONG VmxRootLoggingLock;
+TICKET_SPINLOCK VmxRootLoggingLock;
 
 /**
  * @brief Vmx-root lock for logging
  * 
  */
-volatile LONG VmxRootLoggingLockForNonImmBuffers;
+TICKET_SPINLOCK VmxRootLoggingLockForNonImmBuffers;
 
 //////////////////////////////////////////////////
 //					Illustration				//
@@ -0,0 +1,81 @@
+/**
+ * @file Spinlock.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the custom spinlocks
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The maximum wait (pause count) for the waiter that the ticket
+ * spinlock is handed to, after that, the next waiters skip its ticket
+ *
+ */
+#define TICKET_SPINLOCK_MAXIMUM_GRANT_WAIT 4096
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Ticket spinlock
+ * @details Grant is the ticket that the lock is handed to (shifted left
+ * by one) and its lowest bit shows whether the lock is taken by the
+ * holder of the ticket, if a waiter doesn't take the lock (e.g., it's
+ * halted by the debugger), its ticket is skipped by the next waiters and
+ * the waiter takes a new ticket once it's continued
+ *
+ */
+typedef struct _TICKET_SPINLOCK
+{
+    volatile LONG64 NextTicket;
+    volatile LONG64 Grant;
+
+} TICKET_SPINLOCK, *PTICKET_SPINLOCK;
+
+//////////////////////////////////////////////////
+//				 Spinlock Funtions				//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SpinlockTryLock(volatile LONG * Lock);
+
+void
+SpinlockLock(volatile LONG * Lock);
+
+void
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaxWait);
+
+void
+SpinlockUnlock(volatile LONG * Lock);
+
+void
+SpinlockInterlockedCompareExchange(
+    LONG volatile * Destination,
+    LONG            Exchange,
+    LONG            Comperand);
+
+void
+TicketSpinlockLock(PTICKET_SPINLOCK Lock);
+
+void
+TicketSpinlockUnlock(PTICKET_SPINLOCK Lock);
+
+#define ScopedSpinlock(LockObject, CodeToRun)   \
+    MetaScopedExpr(SpinlockLock(&LockObject),   \
+                   SpinlockUnlock(&LockObject), \
+                   CodeToRun)
+
+#define ScopedTicketSpinlock(LockObject, CodeToRun)   \
+    MetaScopedExpr(TicketSpinlockLock(&LockObject),   \
+                   TicketSpinlockUnlock(&LockObject), \
+                   CodeToRun)
@@ -0,0 +1,84 @@
+/**
+ * @file Capture.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for capture actions of events
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The interval of delivering partially filled capture buffers
+ * (in 100 nanoseconds units of the interrupt time)
+ *
+ */
+#define CAPTURE_FLUSH_INTERVAL 1000000
+
+/**
+ * @brief The bits of the state of the capture buffers of a core
+ *
+ */
+#define CAPTURE_STATE_ACTIVE_BUFFER 0x1 // Index of the buffer that records are saved to
+#define CAPTURE_STATE_BUSY          0x2 // The core is saving a record to the active buffer
+#define CAPTURE_STATE_FLUSHING      0x4 // A flusher is delivering the inactive buffer
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A capture buffer
+ * @details The records are appended to the packet, so the packet and
+ * the records are sent to the user-mode (or the debugger) at once
+ *
+ */
+typedef struct _CAPTURE_BUFFER
+{
+    DEBUGGER_CAPTURE_RECORDS_PACKET Packet;
+    DEBUGGER_CAPTURE_RECORD         Records[DEBUGGER_CAPTURE_MAXIMUM_RECORDS_IN_PACKET];
+
+} CAPTURE_BUFFER, *PCAPTURE_BUFFER;
+
+/**
+ * @brief The capture buffers of each core
+ * @details Only the owner core saves records to the active buffer, other
+ * cores deliver the records by swapping the active buffer (when the owner
+ * is not busy) and sending the previously active buffer, so no lock is
+ * held by any core
+ *
+ */
+typedef struct _CAPTURE_CORE_BUFFERS
+{
+    volatile LONG  State;                // CAPTURE_STATE_* bits
+    volatile LONG  CountOfMissedRecords; // Records that are not saved as the core was already busy
+    UINT64         LastFlushTime;
+    CAPTURE_BUFFER Buffers[2];
+
+} CAPTURE_CORE_BUFFERS, *PCAPTURE_CORE_BUFFERS;
+
+//////////////////////////////////////////////////
+//				    Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+CaptureInitialize();
+
+VOID
+CaptureUninitialize();
+
+VOID
+CapturePerformCapture(UINT64 Tag, PDEBUGGER_EVENT_ACTION Action, PGUEST_REGS Regs, PVOID Context);
+
+VOID
+CaptureFlushCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2);
+
+VOID
+CaptureFlushAllCores();
@@ -48,6 +48,12 @@ BOOLEAN g_TriggerEventForCpuids;
  */
 #define DEBUGGER_DEBUG_REGISTER_FOR_USER_MODE_ENTRY_POINT 1
 
+/**
+ * @brief The interval of rate limiting events (in 100 nanoseconds
+ * units of the interrupt time), the rate limit of events is per second
+ */
+#define DEBUGGER_EVENT_RATE_LIMIT_INTERVAL 10000000
+
 //////////////////////////////////////////////////
 //					Structures					//
 //////////////////////////////////////////////////
@@ -134,6 +140,8 @@ typedef struct _DEBUGGEE_PROCESS_OR_THREAD_TRACING_DETAILS
     //
     BOOLEAN IsWatingForMovCr3VmExits;
     BOOLEAN InterceptClockInterruptsForProcessChange;
+    UINT32  Cr3TargetListCapacity;
+    UINT32  Cr3TargetListMissedExits;
 
 } DEBUGGEE_PROCESS_OR_THREAD_TRACING_DETAILS, *PDEBUGGEE_PROCESS_OR_THREAD_TRACING_DETAILS;
 
@@ -166,6 +174,7 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     UINT64                                     HardwareDebugRegisterForStepping;
     UINT64 *                                   ScriptEngineCoreSpecificLocalVariable;
     UINT64 *                                   ScriptEngineCoreSpecificTempVariable;
+    SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE       PseudoRegistersCache;
 
 } PROCESSOR_DEBUGGING_STATE, PPROCESSOR_DEBUGGING_STATE;
 
@@ -186,6 +195,9 @@ typedef struct _DEBUGGER_EVENT_ACTION
     DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION
     ScriptConfiguration; // If it's run script
 
+    DEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION
+    CaptureConfiguration; // If it's capture
+
     DEBUGGER_EVENT_REQUEST_BUFFER
     RequestedBuffer; // if it's a custom code and needs a buffer then we use
                      // this structs
@@ -198,6 +210,27 @@ typedef struct _DEBUGGER_EVENT_ACTION
 /* ==============================================================================================
  */
 
+/**
+ * @brief Alignment of the per-core states of sampling and rate limiting
+ *
+ */
+#define DEBUGGER_EVENT_LIMITER_STATE_ALIGNMENT 64
+
+/**
+ * @brief The per-core state of sampling and rate limiting of events
+ * @details It's padded to the size of a cache line, so the cores don't
+ * share a cache line for updating the state
+ *
+ */
+typedef struct _DEBUGGER_EVENT_LIMITER_STATE
+{
+    UINT32 SampleCounter;  // Count of hits to skip before the next sample
+    UINT32 Tokens;         // Available tokens of the rate limit
+    UINT64 LastRefillTime; // Interrupt time of the last refill of tokens
+    UINT64 Reserved[6];
+
+} DEBUGGER_EVENT_LIMITER_STATE, *PDEBUGGER_EVENT_LIMITER_STATE;
+
 /**
  * @brief The structure of events in HyperDbg
  *
@@ -223,6 +256,13 @@ typedef struct _DEBUGGER_EVENT
     UINT64 OptionalParam3; // Optional parameter to be used differently by events
     UINT64 OptionalParam4; // Optional parameter to be used differently by events
 
+    BOOLEAN                       IsLimited;     // Whether the event has sampling, rate limit or hit limit
+    UINT32                        SamplingRate;  // Run the event once in each SamplingRate hits (on each core)
+    UINT32                        RateLimit;     // Maximum hits per second (on each core), 0 means unlimited
+    UINT64                        HitLimit;      // Maximum count of hits, 0 means unlimited
+    volatile LONG64               CountOfHits;   // Count of hits that passed the sampling and the rate limit
+    PDEBUGGER_EVENT_LIMITER_STATE LimiterStates; // Per-core states of sampling and rate limiting
+
     UINT32 ConditionsBufferSize;   // if null, means uncoditional
     PVOID  ConditionBufferAddress; // Address of the condition buffer (most of the
                                    // time at the end of this buffer)
@@ -314,7 +354,7 @@ PDEBUGGER_EVENT
 DebuggerCreateEvent(BOOLEAN Enabled, UINT32 CoreId, UINT32 ProcessId, DEBUGGER_EVENT_TYPE_ENUM EventType, UINT64 Tag, UINT64 OptionalParam1, UINT64 OptionalParam2, UINT64 OptionalParam3, UINT64 OptionalParam4, UINT32 ConditionsBufferSize, PVOID ConditionBuffer);
 
 PDEBUGGER_EVENT_ACTION
-DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType, BOOLEAN SendTheResultsImmediately, PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE InTheCaseOfCustomCode, PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript);
+DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType, BOOLEAN SendTheResultsImmediately, PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE InTheCaseOfCustomCode, PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript, PDEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION InTheCaseOfCapture);
 
 BOOLEAN
 DebuggerRegisterEvent(PDEBUGGER_EVENT Event);
@@ -322,6 +362,9 @@ DebuggerRegisterEvent(PDEBUGGER_EVENT Event);
 DEBUGGER_TRIGGERING_EVENT_STATUS_TYPE
 DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOID Context);
 
+BOOLEAN
+DebuggerCheckEventLimits(PDEBUGGER_EVENT Event, UINT32 CoreIndex);
+
 PDEBUGGER_EVENT
 DebuggerGetEventByTag(UINT64 Tag);
 
@@ -337,9 +380,18 @@ DebuggerParseActionFromUsermode(PDEBUGGER_GENERAL_ACTION Action, UINT32 BufferLe
 BOOLEAN
 DebuggerParseEventsModificationFromUsermode(PDEBUGGER_MODIFY_EVENTS DebuggerEventModificationRequest);
 
+BOOLEAN
+DebuggerIsTargetOfBulkModification(PDEBUGGER_BULK_MODIFY_EVENTS DebuggerBulkModificationRequest, UINT64 Tag, PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY * Entry);
+
+BOOLEAN
+DebuggerParseEventsBulkModificationFromUsermode(PDEBUGGER_BULK_MODIFY_EVENTS DebuggerBulkModificationRequest);
+
 BOOLEAN
 DebuggerTerminateEvent(UINT64 Tag);
 
+VOID
+DebuggerTerminateEventObject(PDEBUGGER_EVENT Event);
+
 BOOLEAN
 DebuggerEnableOrDisableAllEvents(BOOLEAN IsEnable);
 
@@ -28,7 +28,7 @@ VOID
 DebuggerEventDisableMovToCr3ExitingOnAllProcessors();
 
 PVOID
-DebuggerEventEptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PVOID CalledFrom);
+DebuggerEventEptHook2GeneralDetourEventHandler(PGUEST_REGS Regs, PHIDDEN_HOOKS_DETOUR_DETAILS DetourDetails);
 
 BOOLEAN
 DebuggerEventEnableMonitorReadAndWriteForAddress(UINT64  Address,
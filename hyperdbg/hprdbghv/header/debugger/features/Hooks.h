@@ -46,6 +46,24 @@
 #define IMAGE_VXD_SIGNATURE    0x454C     // LE
 #define IMAGE_NT_SIGNATURE     0x00004550 // PE00
 
+//////////////////////////////////////////////////
+//				   EPT Hook2 (Detours)			//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the absolute jump that is written to the hooked function
+ * (push low 4-byte, mov [rsp+4] high 4-byte, ret)
+ * 
+ */
+#define EPT_HOOK2_ABSOLUTE_JUMP_SIZE 14
+
+/**
+ * @brief Size of the entry stub of each detour hook (pushes the address of
+ * the detour details and jumps to the hook function)
+ * 
+ */
+#define EPT_HOOK2_ENTRY_STUB_SIZE (13 + EPT_HOOK2_ABSOLUTE_JUMP_SIZE)
+
 //////////////////////////////////////////////////
 //				   Structure					//
 //////////////////////////////////////////////////
@@ -78,13 +96,20 @@ typedef struct _SSDTStruct
 
 /**
  * @brief Details of detours style EPT hooks
+ * @details The entry stub of each hook passes the address of its details
+ * to the hook function, so the details are not searched on each call, a
+ * thread might still be in the entry stub when the hook is removed, so the
+ * details (like the trampoline) are kept until the pools are uninitialized
+ * and the hook is only marked as removed
  * 
  */
 typedef struct _HIDDEN_HOOKS_DETOUR_DETAILS
 {
-    LIST_ENTRY OtherHooksList;
-    PVOID      HookedFunctionAddress;
-    PVOID      ReturnAddress;
+    LIST_ENTRY       OtherHooksList;
+    PVOID            HookedFunctionAddress;
+    UINT64           HookedFunctionPhysicalAddress;
+    PVOID            ReturnAddress;
+    volatile BOOLEAN IsRemoved;
 } HIDDEN_HOOKS_DETOUR_DETAILS, *PHIDDEN_HOOKS_DETOUR_DETAILS;
 
 /**
@@ -256,6 +281,40 @@ EptHookUnHookAll();
 BOOLEAN
 EptHookUnHookSingleAddress(UINT64 VirtualAddress, UINT64 PhysAddress, UINT32 ProcessId);
 
+/**
+ * @brief Add the part of a monitored range which is on a page to the
+ * hooked page
+ * 
+ * @param PageAddress 
+ * @param FromAddress 
+ * @param ToAddress 
+ * @param Tag 
+ * @param ProcessId 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+EptHookAddMonitorRange(UINT64 PageAddress, UINT64 FromAddress, UINT64 ToAddress, UINT64 Tag, UINT32 ProcessId);
+
+/**
+ * @brief Remove the monitored range of an event which is on a page and 
+ * unhook the page if no other monitor is on the page
+ * 
+ * @param PageAddress 
+ * @param Tag 
+ * @param ProcessId 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+EptHookUnHookSingleAddressMonitor(UINT64 PageAddress, UINT64 Tag, UINT32 ProcessId);
+
+/**
+ * @brief Check the sort, merge and search of the monitor ranges
+ * 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+EptHookPerformMonitorRangesSelfCheck();
+
 /**
  * @brief get the length of active EPT hooks (!epthook and !epthook2)
  * 
@@ -267,10 +326,10 @@ UINT32
 EptHookGetCountOfEpthooks(BOOLEAN IsEptHook2);
 
 /**
- * @brief Remove an entry from g_EptHook2sDetourListHead
+ * @brief Remove an entry from g_EptHook2sDetourListHead and mark it as removed
  * 
  * @param Address 
  * @return BOOLEAN 
  */
 BOOLEAN
-EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(UINT64 Address);
+EptHookRemoveEntryFromEptHook2sDetourList(UINT64 Address);
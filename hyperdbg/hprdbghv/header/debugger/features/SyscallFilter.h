@@ -0,0 +1,85 @@
+/**
+ * @file SyscallFilter.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the filter of EFER syscall and sysret hooks
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Count of syscall numbers that are kept in the bitmap of
+ * the filter (covers both of the nt and win32k service tables)
+ *
+ */
+#define SYSCALL_HOOK_FILTER_MAXIMUM_SYSCALL_NUMBER 0x2000
+
+/**
+ * @brief Maximum number of distinct process ids in the filter, if more
+ * processes are specified, then the filter matches all processes
+ *
+ */
+#define SYSCALL_HOOK_FILTER_MAXIMUM_PROCESSES 16
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Processes of the events of a syscall or sysret hook
+ *
+ */
+typedef struct _SYSCALL_HOOK_FILTER_PROCESSES
+{
+    BOOLEAN HasEvents;
+    BOOLEAN MatchAllProcesses;
+    UINT32  CountOfProcesses;
+    UINT32  ProcessIds[SYSCALL_HOOK_FILTER_MAXIMUM_PROCESSES];
+
+} SYSCALL_HOOK_FILTER_PROCESSES, *PSYSCALL_HOOK_FILTER_PROCESSES;
+
+/**
+ * @brief Compiled form of the registered syscall and sysret events
+ * @details It's checked in vmx-root before triggering the events, the
+ * filter is built from all the registered events (even disabled ones)
+ * so it might match the syscalls that no event needs, but it never
+ * rejects a syscall that an event needs
+ *
+ * The generation is odd while the filter is rebuilt, so a core that
+ * still reads a previous filter that is being rebuilt can detect it
+ * and read the filter again (without any lock in vmx-root)
+ *
+ */
+typedef struct _SYSCALL_HOOK_FILTER
+{
+    volatile LONG                 Generation;
+    SYSCALL_HOOK_FILTER_PROCESSES SyscallProcesses;
+    SYSCALL_HOOK_FILTER_PROCESSES SysretProcesses;
+    BOOLEAN                       MatchAllSyscallNumbers;
+    UINT64                        SyscallNumbersBitmap[SYSCALL_HOOK_FILTER_MAXIMUM_SYSCALL_NUMBER / 64];
+
+} SYSCALL_HOOK_FILTER, *PSYSCALL_HOOK_FILTER;
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SyscallHookFilterInitialize();
+
+VOID
+SyscallHookFilterUninitialize();
+
+VOID
+SyscallHookFilterUpdate();
+
+BOOLEAN
+SyscallHookFilterIsMatched(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT64 SyscallNumber);
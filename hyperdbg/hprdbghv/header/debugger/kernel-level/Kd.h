@@ -19,7 +19,7 @@
  * @brief Vmx-root lock for sending response of debugger
  * 
  */
-volatile LONG DebuggerResponseLock;
+TICKET_SPINLOCK DebuggerResponseLock;
 
 /**
  * @brief Vmx-root lock for handling breaks to debugger
@@ -39,6 +39,7 @@ typedef struct _DEBUGGEE_REQUEST_TO_CHANGE_PROCESS
 {
     UINT32 ProcessId;
     UINT64 Process;
+    UINT64 DirectoryTableBase; // Kernel cr3 of the target process (if it's known)
 
 } DEBUGGEE_REQUEST_TO_CHANGE_PROCESS, *PDEBUGGEE_REQUEST_TO_CHANGE_PROCESS;
 
@@ -122,6 +123,13 @@ KdReadMemory(_In_ PGUEST_REGS                            Regs,
 static BOOLEAN
 KdSwitchCore(UINT32 CurrentCore, UINT32 NewCore);
 
+static BOOLEAN
+KdSetHaltPrefetchProfile(_Inout_ PDEBUGGEE_KD_HALT_PREFETCH_PROFILE Profile);
+
+static VOID
+KdSendPausePacket(_In_ PDEBUGGEE_KD_PAUSED_PACKET PausePacket,
+                  _In_ PGUEST_REGS                GuestRegs);
+
 static VOID
 KdCloseConnectionAndUnloadDebuggee();
 
@@ -12,6 +12,80 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of processes in the snapshot of
+ * the processes list
+ *
+ */
+#define PROCESS_SNAPSHOT_MAXIMUM_ENTRIES 4096
+
+/**
+ * @brief Size of the hash table of the snapshot (should be power of 2)
+ *
+ */
+#define PROCESS_SNAPSHOT_HASH_TABLE_SIZE (PROCESS_SNAPSHOT_MAXIMUM_ENTRIES * 2)
+
+/**
+ * @brief Maximum number of CR3-target values that are used for
+ * avoiding mov-to-cr3 vm-exits of non-target processes
+ * @details The architecture supports at most 4 CR3-target values
+ *
+ */
+#define PROCESS_CR3_TARGET_LIST_MAXIMUM_COUNT 4
+
+/**
+ * @brief Number of mov-to-cr3 vm-exits that missed the CR3-target
+ * list (when it's full) before we relearn the list
+ *
+ */
+#define PROCESS_CR3_TARGET_LIST_RELEARN_EXITS 0x100
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Details of a process in the snapshot
+ *
+ */
+typedef struct _PROCESS_SNAPSHOT_ENTRY
+{
+    UINT64 Eprocess;
+    UINT64 Pid;
+    UINT64 Cr3;
+    UCHAR  ImageFileName[15 + 1];
+
+} PROCESS_SNAPSHOT_ENTRY, *PPROCESS_SNAPSHOT_ENTRY;
+
+/**
+ * @brief Snapshot of the processes list
+ * @details The snapshot of the kernel debugger is reused as long as the
+ * debuggee is not continued (same halt generation) and the same symbols
+ * are used, requests from vmx non-root use their own snapshot
+ *
+ */
+typedef struct _PROCESS_SNAPSHOT
+{
+    BOOLEAN IsValid;
+    BOOLEAN IsComplete;
+    UINT64  HaltGeneration;
+    UINT64  ActiveProcessHead;
+    ULONG   ActiveProcessLinksOffset;
+    ULONG   UniquePidOffset;
+    ULONG   ImageFileNameOffset;
+    UINT32  CountOfEntries;
+    UINT64  NextProcess; // The first process that is not in the snapshot (if the snapshot is full)
+
+    PROCESS_SNAPSHOT_ENTRY Entries[PROCESS_SNAPSHOT_MAXIMUM_ENTRIES];
+    UINT32                 HashTable[PROCESS_SNAPSHOT_HASH_TABLE_SIZE]; // Index + 1 of entries, zero means empty
+    BYTE                   ObjectBuffer[PAGE_SIZE];                    // Used to read the fields of the objects
+
+} PROCESS_SNAPSHOT, *PPROCESS_SNAPSHOT;
+
 //////////////////////////////////////////////////
 //				   Functions					//
 //////////////////////////////////////////////////
@@ -24,9 +98,21 @@ ProcessEnableOrDisableThreadChangeMonitor(UINT32  CurrentProcessorIndex,
 BOOLEAN
 ProcessHandleProcessChange(UINT32 ProcessorIndex, PGUEST_REGS GuestState);
 
+VOID
+ProcessCr3TargetListReset(UINT32 CurrentProcessorIndex);
+
+VOID
+ProcessCr3TargetListAdd(UINT32 CurrentProcessorIndex, UINT64 Cr3Operand);
+
 BOOLEAN
 ProcessInterpretProcess(PDEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET PidRequest);
 
+BOOLEAN
+ProcessSnapshotInitialize();
+
+VOID
+ProcessSnapshotUninitialize();
+
 BOOLEAN
 ProcessCheckIfEprocessIsValid(UINT64 Eprocess, UINT64 ActiveProcessHead, ULONG ActiveProcessLinksOffset);
 
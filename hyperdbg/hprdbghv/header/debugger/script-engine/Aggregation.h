@@ -0,0 +1,185 @@
+/**
+ * @file Aggregation.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers for aggregations (count, sum, min, max, hist) of the script engine
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of entries in the aggregation table of
+ * each core (should be power of 2)
+ *
+ */
+#define AGGREGATION_TABLE_MAXIMUM_ENTRIES 1024
+
+/**
+ * @brief Maximum number of entries that are probed for finding
+ * a key in the aggregation table
+ *
+ */
+#define AGGREGATION_TABLE_MAXIMUM_PROBES 32
+
+/**
+ * @brief Maximum number of clears that are kept until all cores apply
+ * them to their tables (should be power of 2)
+ *
+ */
+#define AGGREGATION_MAXIMUM_PENDING_CLEARS 64
+
+/**
+ * @brief Maximum number of merged results that are waiting to be shown
+ *
+ */
+#define AGGREGATION_MAXIMUM_PENDING_PRINTS 4
+
+/**
+ * @brief The interval of showing the merged results (in 100 nanoseconds
+ * units of the interrupt time)
+ *
+ */
+#define AGGREGATION_PRINT_INTERVAL 1000000
+
+/**
+ * @brief Maximum number of retries for taking a consistent snapshot of
+ * an aggregation table
+ *
+ */
+#define AGGREGATION_MAXIMUM_SNAPSHOT_RETRIES 4
+
+//////////////////////////////////////////////////
+//				     Enums	    				//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Types of aggregations
+ *
+ */
+typedef enum _AGGREGATION_TYPE
+{
+    AGGREGATION_TYPE_FREE = 0,
+    AGGREGATION_TYPE_COUNT,
+    AGGREGATION_TYPE_SUM,
+    AGGREGATION_TYPE_MIN,
+    AGGREGATION_TYPE_MAX,
+    AGGREGATION_TYPE_HIST,
+
+} AGGREGATION_TYPE;
+
+/**
+ * @brief States of the merged results
+ *
+ */
+typedef enum _AGGREGATION_PRINT_STATE
+{
+    AGGREGATION_PRINT_STATE_FREE = 0,
+    AGGREGATION_PRINT_STATE_MERGING,
+    AGGREGATION_PRINT_STATE_READY,
+
+} AGGREGATION_PRINT_STATE;
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the aggregation table
+ * @details Entries are identified by the tag of the event, the type
+ * of aggregation, the key, and (for histograms) the bucket of the value,
+ * the sequence is odd while the entry is updated by its core
+ *
+ */
+typedef struct _AGGREGATION_ENTRY
+{
+    volatile UINT64 Sequence;
+    UINT64          Tag;
+    UINT64          Key;
+    UINT32          Type;
+    UINT32          Bucket;
+    UINT64          Count;
+    UINT64          Value;
+
+} AGGREGATION_ENTRY, *PAGGREGATION_ENTRY;
+
+/**
+ * @brief The aggregation table
+ * @details Each core only writes to its own table (including removing
+ * the cleared entries), so no lock is needed for updating aggregations,
+ * tables of all cores are merged from snapshots when the results are
+ * requested, the sequence is odd while the core moves its entries, the
+ * table is shared by all events (entries are identified by the tag)
+ *
+ */
+typedef struct _AGGREGATION_TABLE
+{
+    volatile UINT64   Sequence;
+    UINT64            CountOfAppliedClears;
+    UINT64            CountOfDroppedUpdates;
+    AGGREGATION_ENTRY Entries[AGGREGATION_TABLE_MAXIMUM_ENTRIES];
+
+} AGGREGATION_TABLE, *PAGGREGATION_TABLE;
+
+/**
+ * @brief A request for clearing the aggregations of an event
+ * @details The sequence is the (one-based) number of the clear, so the
+ * cores can detect whether they missed a clear or it's not yet written
+ *
+ */
+typedef struct _AGGREGATION_CLEAR_REQUEST
+{
+    volatile LONG64 Sequence;
+    UINT64          Tag;
+
+} AGGREGATION_CLEAR_REQUEST, *PAGGREGATION_CLEAR_REQUEST;
+
+/**
+ * @brief The merged results of an event that are waiting to be shown
+ * @details The results are merged where agg_print is called (could be
+ * vmx-root), but they are sorted and shown in vmx non-root
+ *
+ */
+typedef struct _AGGREGATION_PRINT_REQUEST
+{
+    volatile LONG     State;
+    BOOLEAN           ImmediateMessagePassing;
+    BOOLEAN           IsIncomplete; // A core was changing its table while merging
+    UINT64            Tag;
+    UINT64            CountOfDroppedUpdates;
+    AGGREGATION_TABLE Table;    // The merged results
+    AGGREGATION_TABLE Snapshot; // The entries of the event on a core
+
+} AGGREGATION_PRINT_REQUEST, *PAGGREGATION_PRINT_REQUEST;
+
+//////////////////////////////////////////////////
+//				    Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+AggregationInitialize();
+
+VOID
+AggregationUninitialize();
+
+VOID
+AggregationUpdate(UINT64 Tag, AGGREGATION_TYPE Type, UINT64 Key, UINT64 Value);
+
+VOID
+AggregationPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing);
+
+VOID
+AggregationClear(UINT64 Tag);
+
+VOID
+AggregationPrintAndClear(UINT64 Tag);
+
+VOID
+AggregationPrintCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2);
@@ -15,6 +15,9 @@
 //				   Functions					//
 //////////////////////////////////////////////////
 
+BOOLEAN
+TestKernelPerformSelfChecks();
+
 VOID
 TestKernelPerformTests(PDEBUGGER_PERFORM_KERNEL_TESTS KernelTestRequest);
 
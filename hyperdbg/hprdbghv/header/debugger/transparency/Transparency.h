@@ -40,10 +40,53 @@ TransparentUnhideDebugger();
  */
 #define RAND_MAX 0x7fff
 
+/**
+ * @brief Number of layers in the ziggurat of the gaussian sampler
+ * @details should be a power of two
+ *
+ */
+#define TRANSPARENT_ZIGGURAT_LAYERS 128
+
+/**
+ * @brief Start of the tail of the ziggurat (3.442619855899 in 16.16 format)
+ *
+ */
+#define TRANSPARENT_ZIGGURAT_R_Q16 225614
+
+/**
+ * @brief ln(2) in 16.16 fixed-point format
+ *
+ */
+#define TRANSPARENT_LN2_Q16 45426
+
+/**
+ * @brief ln(2) in 2.30 fixed-point format
+ *
+ */
+#define TRANSPARENT_LN2_Q30 744261118
+
+/**
+ * @brief Maximum standard deviation that the gaussian sampler accepts
+ *
+ */
+#define TRANSPARENT_MAXIMUM_SIGMA 0x100000
+
 //////////////////////////////////////////////////
 //				   Structures					//
 //////////////////////////////////////////////////
 
+/**
+ * @brief Precomputed ziggurat layers of a gaussian distribution
+ *
+ */
+typedef struct _TRANSPARENCY_GAUSSIAN_TABLE
+{
+    UINT64 Average;
+    UINT64 Sigma;
+    UINT32 ScaledW[TRANSPARENT_ZIGGURAT_LAYERS];
+
+} TRANSPARENCY_GAUSSIAN_TABLE, *PTRANSPARENCY_GAUSSIAN_TABLE;
+
 /**
  * @brief The status of transparency of each core after and before VMX
  * 
@@ -55,6 +98,7 @@ typedef struct _VM_EXIT_TRANSPARENCY
     HANDLE  ThreadId;
     UINT64  RevealedTimeStampCounterByRdtsc;
     BOOLEAN CpuidAfterRdtscDetected;
+    UINT64  RandomState;
 
 } VM_EXIT_TRANSPARENCY, *PVM_EXIT_TRANSPARENCY;
 
@@ -72,6 +116,9 @@ typedef struct _TRANSPARENCY_MEASUREMENTS
     UINT64 RdtscStandardDeviation;
     UINT64 RdtscMedian;
 
+    TRANSPARENCY_GAUSSIAN_TABLE CpuidGaussianTable;
+    TRANSPARENCY_GAUSSIAN_TABLE RdtscGaussianTable;
+
     LIST_ENTRY ProcessList;
 
 } TRANSPARENCY_MEASUREMENTS, *PTRANSPARENCY_MEASUREMENTS;
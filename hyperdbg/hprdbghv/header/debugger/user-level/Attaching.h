@@ -17,9 +17,10 @@
 
 /**
  * @brief Maximum actions in paused threads storage
+ * @details Actions are kept in a ring queue, so it should be power of 2
  * 
  */
-#define MAX_USER_ACTIONS_FOR_THREADS 3
+#define MAX_USER_ACTIONS_FOR_THREADS 4
 
 /**
  * @brief Maximum threads that a process thread holder might have 
@@ -36,6 +37,26 @@
  */
 #define MAX_CR3_IN_A_PROCESS 4
 
+/**
+ * @brief Offset of the wake flag in the nop sled buffer
+ * @details Paused threads spin on a pause loop that polls this flag
+ * and only execute a CPUID (which causes a vm-exit) once it is set
+ * 
+ */
+#define USERMODE_NOP_SLED_WAKE_FLAG_OFFSET (PAGE_SIZE - 8)
+
+/**
+ * @brief Offset of the pause loop for 64-bit threads in the nop sled buffer
+ * 
+ */
+#define USERMODE_NOP_SLED_LOOP64_OFFSET (PAGE_SIZE - 24)
+
+/**
+ * @brief Offset of the pause loop for 32-bit threads in the nop sled buffer
+ * 
+ */
+#define USERMODE_NOP_SLED_LOOP32_OFFSET (PAGE_SIZE - 48)
+
 //////////////////////////////////////////////////
 //				   Structures					//
 //////////////////////////////////////////////////
@@ -55,6 +76,7 @@ typedef struct _USERMODE_DEBUGGING_PROCESS_DETAILS
     UINT64     Context;        // $context
     LIST_ENTRY AttachedProcessList;
     UINT64     UsermodeReservedBuffer;
+    LONG       CountOfPendingThreadActions; // actions that are not yet consumed
     UINT64     EntrypointOfMainModule;
     UINT64     BaseAddressOfMainModule;
     PEPROCESS  Eprocess;
@@ -102,5 +124,8 @@ AttachingFindProcessDebuggingDetailsByToken(UINT64 Token);
 PUSERMODE_DEBUGGING_PROCESS_DETAILS
 AttachingFindProcessDebuggingDetailsByProcessId(UINT32 ProcessId);
 
+BOOLEAN
+AttachingSetNopSledWakeFlag(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail, BOOLEAN Wake);
+
 BOOLEAN
 AttachingQueryDetailsOfActiveDebuggingThreadsAndProcesses(PVOID BufferToStoreDetails, UINT32 BufferSize);
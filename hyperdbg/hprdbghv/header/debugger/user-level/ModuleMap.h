@@ -0,0 +1,96 @@
+/**
+ * @file ModuleMap.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the map of loaded modules of user-mode processes
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Initial count of modules in a map
+ *
+ */
+#define USERMODE_MODULE_MAP_INITIAL_CAPACITY 64
+
+/**
+ * @brief Maximum number of processes that their modules are kept
+ *
+ */
+#define USERMODE_MODULE_MAP_MAXIMUM_PROCESSES 32
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A module in the map
+ *
+ */
+typedef struct _USERMODE_MODULE_MAP_ENTRY
+{
+    UINT64                         SizeOfImage;
+    USERMODE_LOADED_MODULE_SYMBOLS Details;
+
+} USERMODE_MODULE_MAP_ENTRY, *PUSERMODE_MODULE_MAP_ENTRY;
+
+/**
+ * @brief A list of the loaded modules of a process
+ * @details Modules are kept in the load order, SortedIndexes holds the
+ * indexes of modules sorted by their base address, a list is not changed
+ * after it's built, so it's referenced by the requests that use it without
+ * holding the lock of module maps
+ *
+ */
+typedef struct _USERMODE_MODULE_MAP_LIST
+{
+    volatile LONG              ReferenceCount;
+    UINT32                     CountOfModules;
+    UINT32                     Capacity;
+    PUSERMODE_MODULE_MAP_ENTRY Modules;
+    UINT32 *                   SortedIndexes;
+
+} USERMODE_MODULE_MAP_LIST, *PUSERMODE_MODULE_MAP_LIST;
+
+/**
+ * @brief Loaded modules of a process
+ * @details The generation is changed each time that a module is loaded,
+ * unloaded or reordered (or the process id is reused)
+ *
+ */
+typedef struct _USERMODE_MODULE_MAP
+{
+    LIST_ENTRY                ModuleMapsList;
+    UINT32                    ProcessId;
+    PEPROCESS                 Eprocess;
+    UINT64                    Generation;
+    PUSERMODE_MODULE_MAP_LIST List;
+
+} USERMODE_MODULE_MAP, *PUSERMODE_MODULE_MAP;
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+VOID
+ModuleMapInitialize();
+
+VOID
+ModuleMapUninitialize();
+
+PUSERMODE_MODULE_MAP_ENTRY
+ModuleMapFindByAddress(PUSERMODE_MODULE_MAP_LIST List, UINT64 Address);
+
+BOOLEAN
+ModuleMapQuery(PEPROCESS                       Process,
+               BOOLEAN                         Is32Bit,
+               PUSERMODE_LOADED_MODULE_DETAILS ProcessLoadedModuleRequest,
+               UINT32                          BufferSize);
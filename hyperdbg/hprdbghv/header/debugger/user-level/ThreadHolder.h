@@ -35,7 +35,9 @@ typedef struct _USERMODE_DEBUGGING_THREAD_DETAILS
     UINT64                     ThreadRip; // if IsPaused is TRUE
     BOOLEAN                    IsPaused;
     BOOLEAN                    IsRflagsTrapFlagsSet;
-    DEBUGGER_UD_COMMAND_ACTION UdAction[MAX_USER_ACTIONS_FOR_THREADS];
+    DEBUGGER_UD_COMMAND_ACTION UdAction[MAX_USER_ACTIONS_FOR_THREADS]; // ring queue
+    LONG                       UdActionHead;                          // next action to perform
+    LONG                       UdActionTail;                          // next free action slot
 
 } USERMODE_DEBUGGING_THREAD_DETAILS, *PUSERMODE_DEBUGGING_THREAD_DETAILS;
 
@@ -75,6 +77,18 @@ ThreadHolderGetProcessDebuggingDetailsByThreadId(UINT32 ThreadId);
 PUSERMODE_DEBUGGING_THREAD_DETAILS
 ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail);
 
+BOOLEAN
+ThreadHolderQueueAction(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail,
+                        PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetail,
+                        PDEBUGGER_UD_COMMAND_PACKET         ActionRequest);
+
+PDEBUGGER_UD_COMMAND_ACTION
+ThreadHolderPeekNextAction(PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetail);
+
+VOID
+ThreadHolderRemoveNextAction(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail,
+                             PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetail);
+
 BOOLEAN
 ThreadHolderApplyActionToPausedThreads(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetails,
                                        PDEBUGGER_UD_COMMAND_PACKET         ActionRequest);
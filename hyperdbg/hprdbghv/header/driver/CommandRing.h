@@ -0,0 +1,44 @@
+/**
+ * @file CommandRing.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Shared-memory command ring between the debugger and the driver (headers)
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				   Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The kernel-side state of the shared command ring
+ *
+ */
+typedef struct _COMMAND_RING_STATE
+{
+    PMDL          Mdl;              // MDL of the locked user-mode pages of the ring
+    PCOMMAND_RING Ring;             // System address of the ring
+    PFILE_OBJECT  FileObject;       // The handle that registered the ring
+    volatile LONG Lock;             // Protects the fields of this structure
+    BOOLEAN       IsProcessing;     // The ring is being processed (without holding the lock)
+    BOOLEAN       IsReleasePending; // Release the ring once the processing is finished
+
+} COMMAND_RING_STATE, *PCOMMAND_RING_STATE;
+
+//////////////////////////////////////////////////
+//				   Functions					//
+//////////////////////////////////////////////////
+
+NTSTATUS
+CommandRingRegister(PDEBUGGER_COMMAND_RING_REQUEST RingRequest, PFILE_OBJECT FileObject);
+
+NTSTATUS
+CommandRingProcess(PDEBUGGER_COMMAND_RING_REQUEST RingRequest);
+
+VOID
+CommandRingUninitialize(PFILE_OBJECT FileObject);
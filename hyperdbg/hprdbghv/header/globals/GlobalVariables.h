@@ -141,6 +141,12 @@ VOID * g_ApicBase;
  */
 DEBUGGEE_PAUSING_REASON g_DebuggeeHaltReason;
 
+/**
+ * @brief Incremented each time the debuggee is halted
+ * 
+ */
+UINT64 g_DebuggeeHaltGeneration;
+
 /**
  * @brief Optional context as the debuggee is halted
  * 
@@ -274,3 +280,128 @@ LIST_ENTRY g_ProcessDebuggingDetailsListHead;
  * 
  */
 BOOLEAN g_CheckPageFaultsAndMov2Cr3VmexitsWithUserDebugger;
+
+/**
+ * @brief Snapshot of the processes list of the kernel debugger
+ * 
+ */
+PPROCESS_SNAPSHOT g_KdProcessSnapshot;
+
+/**
+ * @brief List header of the maps of loaded modules of processes
+ * 
+ */
+LIST_ENTRY g_ModuleMapsListHead;
+
+/**
+ * @brief Count of the maps of loaded modules
+ * 
+ */
+UINT32 g_CountOfModuleMaps;
+
+/**
+ * @brief Lock of the maps of loaded modules
+ * 
+ */
+volatile LONG g_ModuleMapsLock;
+
+/**
+ * @brief The filter of syscall and sysret events that is used by vmx-root
+ * 
+ */
+PSYSCALL_HOOK_FILTER g_SyscallHookFilter;
+
+/**
+ * @brief Buffers of the filters of syscall and sysret events
+ * 
+ */
+PSYSCALL_HOOK_FILTER g_SyscallHookFilterBuffers;
+
+/**
+ * @brief Lock of building the filter of syscall and sysret events
+ * 
+ */
+volatile LONG g_SyscallHookFilterLock;
+
+/**
+ * @brief Aggregation tables of the script engine (one for each core)
+ * 
+ */
+PAGGREGATION_TABLE g_AggregationTables;
+
+/**
+ * @brief The merged aggregations that are waiting to be shown
+ * 
+ */
+PAGGREGATION_PRINT_REQUEST g_AggregationPrintRequests;
+
+/**
+ * @brief Count of requests of showing aggregations that are dropped
+ * 
+ */
+volatile LONG g_AggregationCountOfDroppedPrints;
+
+/**
+ * @brief The recent requests of clearing aggregations
+ * 
+ */
+AGGREGATION_CLEAR_REQUEST g_AggregationClearRequests[AGGREGATION_MAXIMUM_PENDING_CLEARS];
+
+/**
+ * @brief Count of requests of clearing aggregations
+ * 
+ */
+volatile LONG64 g_AggregationCountOfClears;
+
+/**
+ * @brief The timer of showing the merged aggregations
+ * 
+ */
+KTIMER g_AggregationPrintTimer;
+
+/**
+ * @brief The DPC of showing the merged aggregations
+ * 
+ */
+KDPC g_AggregationPrintDpc;
+
+/**
+ * @brief Buffers of capture actions (one for each core)
+ * 
+ */
+PCAPTURE_CORE_BUFFERS g_CaptureBuffers;
+
+/**
+ * @brief The timer of delivering partially filled capture buffers
+ * 
+ */
+KTIMER g_CaptureFlushTimer;
+
+/**
+ * @brief The DPC of delivering partially filled capture buffers
+ * 
+ */
+KDPC g_CaptureFlushDpc;
+
+/**
+ * @brief The profile of the state that is prefetched and sent
+ * along with the pausing packet
+ * 
+ */
+DEBUGGEE_KD_HALT_PREFETCH_PROFILE g_KdHaltPrefetchProfile;
+
+/**
+ * @brief The buffer of the pausing packet and the prefetched state
+ * (only the main debugging core sends the pausing packet)
+ * 
+ */
+BYTE g_KdHaltPrefetchBuffer[sizeof(DEBUGGEE_KD_PAUSED_PACKET) +
+                            sizeof(DEBUGGEE_KD_HALT_PREFETCHED_STATE) +
+                            DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE +
+                            DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE];
+
+/**
+ * @brief The state of the shared command ring
+ * 
+ */
+COMMAND_RING_STATE g_CommandRingState;
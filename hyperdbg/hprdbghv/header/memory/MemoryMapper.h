@@ -138,6 +138,19 @@ typedef struct _CR3_TYPE
     };
 } CR3_TYPE, *PCR3_TYPE;
 
+/**
+ * @brief A field of an object that is read by
+ * MemoryMapperReadObjectFieldsSafe
+ *
+ */
+typedef struct _MEMORY_MAPPER_OBJECT_FIELD
+{
+    UINT32 Offset; // Offset of the field from the start of the object
+    UINT32 Size;   // Size of the field
+    PVOID  Buffer; // Destination to save the field
+
+} MEMORY_MAPPER_OBJECT_FIELD, *PMEMORY_MAPPER_OBJECT_FIELD;
+
 //////////////////////////////////////////////////
 //					Functions					//
 //////////////////////////////////////////////////
@@ -225,6 +238,13 @@ MemoryMapperReadMemorySafe(_In_ UINT64   VaAddressToRead,
                            _Inout_ PVOID BufferToSaveMemory,
                            _In_ SIZE_T   SizeToRead);
 
+BOOLEAN
+MemoryMapperReadObjectFieldsSafe(_In_ UINT64                         ObjectAddress,
+                                 _Inout_ PMEMORY_MAPPER_OBJECT_FIELD Fields,
+                                 _In_ UINT32                         CountOfFields,
+                                 _Inout_ PVOID                       ScratchBuffer,
+                                 _In_ UINT32                         ScratchBufferSize);
+
 BOOLEAN
 MemoryMapperReadMemorySafeByPhysicalAddress(_In_ UINT64    PaAddressToRead,
                                             _Inout_ UINT64 BufferToSaveMemory,
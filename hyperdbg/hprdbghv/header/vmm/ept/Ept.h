@@ -17,6 +17,8 @@
 
 #define MaximumHiddenBreakpointsOnPage 40
 
+#define MaximumMonitorRangesOnPage 40
+
 //////////////////////////////////////////////////
 //					Constants					//
 //////////////////////////////////////////////////
@@ -99,7 +101,7 @@
  * @brief Vmx-root lock for changing EPT PML1 Entry and Invalidating TLB
  * 
  */
-volatile LONG Pml1ModificationAndInvalidationLock;
+TICKET_SPINLOCK Pml1ModificationAndInvalidationLock;
 
 //////////////////////////////////////////////////
 //				Unions & Structs    			//
@@ -206,6 +208,33 @@ typedef struct _VMM_EPT_DYNAMIC_SPLIT
 
 } VMM_EPT_DYNAMIC_SPLIT, *PVMM_EPT_DYNAMIC_SPLIT;
 
+/**
+ * @brief Range of a page which is monitored for read/write
+ * @details The offsets are relative to the start of the page
+ * and the end offset is not included in the range
+ * 
+ */
+typedef struct _EPT_HOOKED_PAGE_MONITOR_RANGE
+{
+    UINT16 StartOffset;
+    UINT16 EndOffset;
+
+} EPT_HOOKED_PAGE_MONITOR_RANGE, *PEPT_HOOKED_PAGE_MONITOR_RANGE;
+
+/**
+ * @brief Sorted and merged (non-overlapping) monitor ranges of a page
+ * @details The generation is odd while the index is rebuilt, so the
+ * readers in vmx-root retry if the index is changed while they read it
+ * 
+ */
+typedef struct _EPT_HOOKED_PAGE_MONITOR_RANGES_INDEX
+{
+    volatile LONG                 Generation;
+    UINT32                        Count;
+    EPT_HOOKED_PAGE_MONITOR_RANGE Ranges[MaximumMonitorRangesOnPage];
+
+} EPT_HOOKED_PAGE_MONITOR_RANGES_INDEX, *PEPT_HOOKED_PAGE_MONITOR_RANGES_INDEX;
+
 /**
  * @brief Structure to save the state of each hooked pages
  * 
@@ -293,6 +322,35 @@ typedef struct _EPT_HOOKED_PAGE_DETAIL
      */
     UINT64 CountOfBreakpoints;
 
+    /**
+     * @brief Ranges of the page that are monitored by each monitor (read/write)
+     * event, this is only used in monitor hooks (multiple monitors on a single page)
+     */
+    EPT_HOOKED_PAGE_MONITOR_RANGE MonitorRanges[MaximumMonitorRangesOnPage];
+
+    /**
+     * @brief Tags of the events that own each of the monitor ranges, this is
+     * only used in monitor hooks
+     */
+    UINT64 MonitorRangesTags[MaximumMonitorRangesOnPage];
+
+    /**
+     * @brief Count of monitor ranges, this is only used in monitor hooks
+     */
+    UINT32 CountOfMonitorRanges;
+
+    /**
+     * @brief Buffers of the index of monitor ranges, the index is rebuilt in the
+     * buffer that is not used and then it's switched
+     */
+    EPT_HOOKED_PAGE_MONITOR_RANGES_INDEX MonitorRangesIndexBuffers[2];
+
+    /**
+     * @brief The index of monitor ranges, used to check whether an access should be
+     * dispatched to the events or not by a binary search (NULL if there is no range)
+     */
+    PEPT_HOOKED_PAGE_MONITOR_RANGES_INDEX MonitorRangesIndex;
+
 } EPT_HOOKED_PAGE_DETAIL, *PEPT_HOOKED_PAGE_DETAIL;
 
 //////////////////////////////////////////////////
@@ -12,22 +12,60 @@
 #pragma once
 
 //////////////////////////////////////////////////
-//					Enums						//
+//					Definitions					//
 //////////////////////////////////////////////////
 
+/**
+ * @brief VPID Tag
+ * 
+ */
+#define VPID_TAG 0x1
+
+/**
+ * @brief Count of PCIDs (bits 11:0 of CR3)
+ * 
+ */
+#define VPID_COUNT_OF_PCIDS 4096
+
+/**
+ * @brief Bit 63 of the source operand of mov-to-cr3 (no invalidation
+ * if CR4.PCIDE = 1)
+ * 
+ */
+#define VPID_CR3_NO_INVALIDATION_BIT (1ULL << 63)
+
 //////////////////////////////////////////////////
-//					Structures					//
+//					Enums						//
 //////////////////////////////////////////////////
 
+/**
+ * @brief The TLB invalidation that is needed for emulating a mov-to-cr3
+ * 
+ */
+typedef enum _VPID_CR3_WRITE_INVALIDATION
+{
+    VPID_CR3_WRITE_NO_INVALIDATION,
+    VPID_CR3_WRITE_INVALIDATE_RETAINING_GLOBALS,
+
+} VPID_CR3_WRITE_INVALIDATION;
+
 //////////////////////////////////////////////////
-//					Definitions					//
+//					Structures					//
 //////////////////////////////////////////////////
 
 /**
- * @brief VPID Tag
+ * @brief The PCIDs that might have TLB entries on a core
+ * @details A bit is set if the PCID is used since the last invalidation of
+ * the VPID, if IsValid is FALSE, then all of the PCIDs might have entries
  * 
  */
-#define VPID_TAG 0x1
+typedef struct _VPID_PCID_STATE
+{
+    BOOLEAN IsValid;
+    UINT64  CountOfAvoidedInvalidations;
+    UINT64  UsedPcids[VPID_COUNT_OF_PCIDS / 64];
+
+} VPID_PCID_STATE, *PVPID_PCID_STATE;
 
 //////////////////////////////////////////////////
 //					Functions					//
@@ -47,3 +85,16 @@ VpidInvvpidAllContext();
 
 VOID
 VpidInvvpidSingleContextRetainingGlobals(UINT16 Vpid);
+
+VPID_CR3_WRITE_INVALIDATION
+VpidGetCr3WriteInvalidation(PVPID_PCID_STATE State,
+                            BOOLEAN          IsPcidEnabled,
+                            UINT64           Cr3Operand,
+                            UINT64 *         Cr3TargetValues,
+                            UINT32           CountOfCr3TargetValues);
+
+VOID
+VpidEmulateCr3Write(UINT32 ProcessorIndex, UINT64 Cr3Operand);
+
+VOID
+VpidResetPcidState(UINT32 ProcessorIndex);
@@ -36,6 +36,12 @@ IdtEmulationHandleNmiWindowExiting(_In_ UINT32         CurrentProcessorIndex,
 VOID
 IdtEmulationHandleInterruptWindowExiting(_In_ UINT32 CurrentProcessorIndex);
 
+BOOLEAN
+IdtEmulationIsAnyInterruptPending(_In_ UINT32 CurrentProcessorIndex);
+
+BOOLEAN
+IdtEmulationPerformPendingInterruptsSelfCheck();
+
 BOOLEAN
 IdtEmulationHandlePageFaults(_In_ UINT32                       CurrentProcessorIndex,
                              _In_ VMEXIT_INTERRUPT_INFORMATION InterruptExit,
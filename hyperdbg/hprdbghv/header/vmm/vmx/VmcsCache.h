@@ -0,0 +1,61 @@
+/**
+ * @file VmcsCache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the per-exit cache of the VMCS fields
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//				    Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Count of the VMCS fields that are cached in each VM-exit
+ *
+ */
+#define VMCS_CACHE_COUNT_OF_FIELDS 9
+
+//////////////////////////////////////////////////
+//				    Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The cache of the frequently accessed VMCS fields of a core
+ * @details The cache is only active while the core handles a VM-exit,
+ * fields are read from the VMCS on first use and the modified fields
+ * are written back once before resuming the guest
+ *
+ */
+typedef struct _VMCS_FIELD_CACHE
+{
+    BOOLEAN IsActive;                           // Whether the core is handling a VM-exit or not
+    UINT32  ValidMask;                          // Fields that are read (or written) in this VM-exit
+    UINT32  DirtyMask;                          // Fields that should be written back to the VMCS
+    UINT64  Values[VMCS_CACHE_COUNT_OF_FIELDS]; // Values of the fields
+
+} VMCS_FIELD_CACHE, *PVMCS_FIELD_CACHE;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+VmcsCacheStart(ULONG CurrentProcessorIndex);
+
+VOID
+VmcsCacheFlush(ULONG CurrentProcessorIndex);
+
+VOID
+VmcsCacheDiscard(ULONG CurrentProcessorIndex);
+
+UINT64
+VmcsCacheRead(UINT64 Field);
+
+VOID
+VmcsCacheWrite(UINT64 Field, UINT64 Value);
@@ -140,10 +140,16 @@
 #define VMM_STACK_SIZE 0x8000
 
 /**
- * @brief Pending External Interrups Buffer Capacity
+ * @brief Count of vectors of the pending external interrupts
  * 
  */
-#define PENDING_INTERRUPTS_BUFFER_CAPACITY 64
+#define PENDING_INTERRUPTS_COUNT_OF_VECTORS 256
+
+/**
+ * @brief Size of the bitmap of pending external interrupts (in QWORDs)
+ * 
+ */
+#define PENDING_INTERRUPTS_COUNT_OF_QWORDS (PENDING_INTERRUPTS_COUNT_OF_VECTORS / 64)
 
 #define IS_VALID_DEBUG_REGISTER(DebugRegister)                   \
     (((DebugRegister <= VMX_EXIT_QUALIFICATION_REGISTER_DR0) &&  \
@@ -348,18 +354,18 @@ typedef struct _VIRTUAL_MACHINE_STATE
     UINT64  IoBitmapPhysicalAddressA;                                      // I/O Bitmap Physical Address (A)
     UINT64  IoBitmapVirtualAddressB;                                       // I/O Bitmap Virtual Address (B)
     UINT64  IoBitmapPhysicalAddressB;                                      // I/O Bitmap Physical Address (B)
-    UINT32  PendingExternalInterrupts[PENDING_INTERRUPTS_BUFFER_CAPACITY]; // This list holds a buffer for external-interrupts that are in pending state due to the external-interrupt
+    UINT64  PendingExternalInterrupts[PENDING_INTERRUPTS_COUNT_OF_QWORDS]; // This bitmap holds the vectors of external-interrupts that are in pending state due to the external-interrupt
                                                                            // blocking and waits for interrupt-window exiting
-                                                                           // From hvpp :
-                                                                           // Pending interrupt queue (FIFO).
-                                                                           // Make storage for up-to 64 pending interrupts.
-                                                                           // In practice I haven't seen more than 2 pending interrupts.
+                                                                           // Like the IRR of the local APIC, each vector is pending at most once and
+                                                                           // the highest vector (priority) is injected first
 
     PROCESSOR_DEBUGGING_STATE DebuggingState;         // Holds the debugging state of the processor (used by HyperDbg to execute commands)
     VMX_VMXOFF_STATE          VmxoffState;            // Shows the vmxoff state of the guest
     VM_EXIT_TRANSPARENCY      TransparencyState;      // The state of the debugger in transparent-mode
     PEPT_HOOKED_PAGE_DETAIL   MtfEptHookRestorePoint; // It shows the detail of the hooked paged that should be restore in MTF vm-exit
     MEMORY_MAPPER_ADDRESSES   MemoryMapper;           // Memory mapper details for each core, contains PTE Virtual Address, Actual Kernel Virtual Address
+    VPID_PCID_STATE           PcidState;              // The PCIDs that are used by the guest since the last invalidation of the TLB (for emulating mov to cr3s)
+    VMCS_FIELD_CACHE          VmcsCache;              // The VMCS fields that are read or modified in the current VM-exit
 } VIRTUAL_MACHINE_STATE, *PVIRTUAL_MACHINE_STATE;
 
 //////////////////////////////////////////////////
@@ -49,6 +49,7 @@
 #include "platform/Environment.h"
 #include "platform/MetaMacros.h"
 
+#include "..\hprdbghv\header\common\Spinlock.h"
 #include "..\hprdbghv\header\vmm\vmx\VmxBroadcast.h"
 #include "..\hprdbghv\header\common\Dpc.h"
 #include "..\hprdbghv\header\common\LengthDisassemblerEngine.h"
@@ -66,12 +67,15 @@
 #include "..\hprdbghv\header\common\Common.h"
 #include "..\hprdbghv\header\vmm\vmx\Events.h"
 #include "..\hprdbghv\header\debugger\script-engine\ScriptEngine.h"
+#include "..\hprdbghv\header\debugger\script-engine\Aggregation.h"
 #include "..\hprdbghv\header\devices\Apic.h"
 #include "..\hprdbghv\header\debugger\kernel-level\Kd.h"
 #include "..\hprdbghv\header\debugger\user-level\Ud.h"
 #include "..\hprdbghv\header\vmm\vmx\Mtf.h"
-#include "..\hprdbghv\header\debugger\core\DebuggerEvents.h"
 #include "..\hprdbghv\header\debugger\features\Hooks.h"
+#include "..\hprdbghv\header\debugger\core\DebuggerEvents.h"
+#include "..\hprdbghv\header\debugger\core\Capture.h"
+#include "..\hprdbghv\header\debugger\features\SyscallFilter.h"
 #include "..\hprdbghv\header\vmm\vmx\Counters.h"
 #include "..\hprdbghv\header\debugger\transparency\Transparency.h"
 #include "..\hprdbghv\header\vmm\vmx\IdtEmulation.h"
@@ -79,6 +83,7 @@
 #include "..\hprdbghv\header\debugger\broadcast\Broadcast.h"
 #include "..\hprdbghv\header\vmm\vmx\Vmcall.h"
 #include "..\hprdbghv\header\vmm\vmx\ManageRegs.h"
+#include "..\hprdbghv\header\vmm\vmx\VmcsCache.h"
 #include "..\hprdbghv\header\vmm\vmx\Vmx.h"
 #include "..\hprdbghv\header\debugger\commands\BreakpointCommands.h"
 #include "..\hprdbghv\header\debugger\commands\DebuggerCommands.h"
@@ -96,7 +101,9 @@
 #include "..\hprdbghv\header\debugger\user-level\Attaching.h"
 #include "..\hprdbghv\header\debugger\core\Termination.h"
 #include "..\hprdbghv\header\debugger\user-level\UserAccess.h"
+#include "..\hprdbghv\header\debugger\user-level\ModuleMap.h"
 #include "..\hprdbghv\header\debugger\user-level\ThreadHolder.h"
+#include "..\hprdbghv\header\driver\CommandRing.h"
 #include "..\script-eval\header\ScriptEngineCommonDefinitions.h"
 #include "..\script-eval\header\ScriptEngineHeader.h"
 
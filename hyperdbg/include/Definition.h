@@ -117,6 +117,15 @@ typedef struct _DEBUGGER_GENERAL_EVENT_DETAIL
 
     UINT32 CountOfActions;
 
+    UINT32 SamplingRate; // run the event once in each SamplingRate hits
+                         // (on each core), 0 means all of the hits
+
+    UINT32 RateLimit; // maximum hits per second (on each core) that the
+                      // event runs, 0 means unlimited
+
+    UINT64 HitLimit; // only run the event for the first HitLimit hits,
+                     // 0 means unlimited
+
     UINT64                   Tag; // is same as operation code
     DEBUGGER_EVENT_TYPE_ENUM EventType;
 
@@ -148,6 +157,8 @@ typedef struct _DEBUGGER_GENERAL_ACTION
     UINT32 ScriptBufferSize;
     UINT32 ScriptBufferPointer;
 
+    DEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION CaptureConfiguration;
+
 } DEBUGGER_GENERAL_ACTION, *PDEBUGGER_GENERAL_ACTION;
 
 /**
@@ -117,13 +117,33 @@ typedef struct _DEBUGGER_TRIGGERED_EVENT_DETAILS
 
 } DEBUGGER_TRIGGERED_EVENT_DETAILS, *PDEBUGGER_TRIGGERED_EVENT_DETAILS;
 
+/**
+ * @brief Maximum number of pseudo-registers that can be cached
+ *
+ */
+#define SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE_SIZE 16
+
+/**
+ * @brief Values of pseudo-registers that are computed at most once
+ * @details The bit of each pseudo-register in ValidMask is set when its
+ * value is computed, in kernel-mode the mask is cleared on each VM exit
+ *
+ */
+typedef struct _SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE
+{
+    UINT64 ValidMask;
+    UINT64 Values[SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE_SIZE];
+
+} SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE, *PSCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE;
+
 /**
  * @brief List of different variables
  */
 typedef struct _SCRIPT_ENGINE_VARIABLES_LIST
 {
-    UINT64 * TempList;
-    UINT64 * GlobalVariablesList;
-    UINT64 * LocalVariablesList;
+    UINT64 *                              TempList;
+    UINT64 *                              GlobalVariablesList;
+    UINT64 *                              LocalVariablesList;
+    PSCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE PseudoRegistersCache; // null if pseudo-registers shouldn't be cached
 
 } SCRIPT_ENGINE_VARIABLES_LIST, *PSCRIPT_ENGINE_VARIABLES_LIST;
@@ -332,6 +332,8 @@ const unsigned char BuildVersion[] =
 #define OPERATION_NOTIFICATION_FROM_USER_DEBUGGER_PAUSE \
     0xe | OPERATION_MANDATORY_DEBUGGEE_BIT
 
+#define OPERATION_LOG_CAPTURE_RECORDS 0xf
+
 //////////////////////////////////////////////////
 //            Breakpoint Backup                 //
 //////////////////////////////////////////////////
@@ -434,6 +436,24 @@ const unsigned char BuildVersion[] =
  */
 #define MaximumSearchResults 0x1000
 
+//////////////////////////////////////////////////
+//                 Command Ring                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief number of submission (and completion) entries of the
+ * shared command ring, should be a power of two
+ *
+ */
+#define COMMAND_RING_ENTRY_COUNT 256
+
+/**
+ * @brief size of the data area of the shared command ring that
+ * holds the input and output buffers of the requests
+ *
+ */
+#define COMMAND_RING_DATA_AREA_SIZE 0x40000
+
 //////////////////////////////////////////////////
 //                 Script Engine                //
 //////////////////////////////////////////////////
@@ -92,9 +92,80 @@ typedef struct _DEBUGGEE_KD_PAUSED_PACKET
     UINT64                  Rflags;
     BYTE                    InstructionBytesOnRip[MAXIMUM_INSTR_SIZE];
     UINT16                  ReadInstructionLen;
+    BOOLEAN                 HasPrefetchedState; // if true, a DEBUGGEE_KD_HALT_PREFETCHED_STATE is after this structure
 
 } DEBUGGEE_KD_PAUSED_PACKET, *PDEBUGGEE_KD_PAUSED_PACKET;
 
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Maximum size of the stack that is prefetched on halts
+ *
+ */
+#define DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_STACK_SIZE 0x400
+
+/**
+ * @brief Maximum size of the code (from RIP) that is prefetched on halts
+ *
+ */
+#define DEBUGGEE_KD_HALT_PREFETCH_MAXIMUM_CODE_SIZE 0x100
+
+/**
+ * @brief Default size of the stack that is prefetched on halts
+ * (the default size of 'dq @rsp' is 0x80)
+ *
+ */
+#define DEBUGGEE_KD_HALT_PREFETCH_DEFAULT_STACK_SIZE 0x100
+
+/**
+ * @brief Default size of the code that is prefetched on halts
+ * (the default size of 'u @rip' is 0x40)
+ *
+ */
+#define DEBUGGEE_KD_HALT_PREFETCH_DEFAULT_CODE_SIZE 0x40
+
+/**
+ * @brief The profile of the state that is sent along with the pausing
+ * packet in kHyperDbg
+ *
+ */
+typedef struct _DEBUGGEE_KD_HALT_PREFETCH_PROFILE
+{
+    BOOLEAN IsEnabled;
+    UINT32  StackSize;
+    UINT32  CodeSize;
+    UINT32  KernelStatus;
+
+} DEBUGGEE_KD_HALT_PREFETCH_PROFILE, *PDEBUGGEE_KD_HALT_PREFETCH_PROFILE;
+
+/**
+ * @brief The state that is prefetched on halts in kHyperDbg
+ * @details The stack bytes and then the code bytes are after this structure,
+ * only the bytes that are read successfully are sent
+ *
+ */
+typedef struct _DEBUGGEE_KD_HALT_PREFETCHED_STATE
+{
+    GUEST_REGS            Regs;
+    GUEST_EXTRA_REGISTERS ExtraRegs;
+    UINT64                Cr0;
+    UINT64                Cr2;
+    UINT64                Cr3;
+    UINT64                Cr4;
+    UINT32                ProcessId;
+    UINT32                ThreadId;
+    UINT64                StackAddress;
+    UINT32                StackSize;
+    UINT64                CodeAddress;
+    UINT32                CodeSize;
+
+    //
+    // The stack and the code bytes are here
+    //
+
+} DEBUGGEE_KD_HALT_PREFETCHED_STATE, *PDEBUGGEE_KD_HALT_PREFETCHED_STATE;
+
 /* ==============================================================================================
  */
 
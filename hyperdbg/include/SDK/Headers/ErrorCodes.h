@@ -385,6 +385,42 @@
  */
 #define DEBUGGER_ERROR_UNABLE_TO_QUERY_COUNT_OF_PROCESSES_OR_THREADS 0xc0000039
 
+/**
+ * @brief error, the tags of the bulk modification request are invalid
+ *
+ */
+#define DEBUGGER_ERROR_BULK_MODIFY_EVENTS_INVALID_TAGS 0xc000003a
+
+/**
+ * @brief error, the configuration of the capture action is invalid
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_CAPTURE_CONFIGURATION 0xc000003b
+
+/**
+ * @brief error, the profile of halt prefetching is invalid
+ *
+ */
+#define DEBUGGER_ERROR_INVALID_HALT_PREFETCH_PROFILE 0xc000003c
+
+/**
+ * @brief error, the command ring is not registered or is invalid
+ *
+ */
+#define DEBUGGER_ERROR_COMMAND_RING_IS_NOT_VALID 0xc000003d
+
+/**
+ * @brief error, the request is not supported by the command ring
+ *
+ */
+#define DEBUGGER_ERROR_COMMAND_RING_REQUEST_IS_NOT_SUPPORTED 0xc000003e
+
+/**
+ * @brief error, at least one of the self-checks of the kernel failed
+ *
+ */
+#define DEBUGGER_ERROR_KERNEL_SELF_CHECK_FAILED 0xc000003f
+
 //
 // WHEN YOU ADD ANYTHING TO THIS LIST OF ERRORS, THEN
 // MAKE SURE TO ADD AN ERROR MESSAGE TO ShowErrorMessage(UINT32 Error)
@@ -62,7 +62,8 @@ typedef enum _DEBUGGER_EVENT_ACTION_TYPE_ENUM
 {
     BREAK_TO_DEBUGGER,
     RUN_SCRIPT,
-    RUN_CUSTOM_CODE
+    RUN_CUSTOM_CODE,
+    RUN_CAPTURE
 
 } DEBUGGER_EVENT_ACTION_TYPE_ENUM;
 
@@ -104,3 +105,42 @@ typedef struct _DEBUGGER_MODIFY_EVENTS
     BOOLEAN IsEnabled; // Determines what's the action (enable | disable | clear)
 
 } DEBUGGER_MODIFY_EVENTS, *PDEBUGGER_MODIFY_EVENTS;
+
+#define SIZEOF_DEBUGGER_BULK_MODIFY_EVENTS sizeof(DEBUGGER_BULK_MODIFY_EVENTS)
+
+/**
+ * @brief maximum number of tags in a bulk modification request
+ *
+ */
+#define DEBUGGER_BULK_MODIFY_EVENTS_MAXIMUM_TAGS 0x4000
+
+/**
+ * @brief state of each tag in a bulk modification request
+ *
+ */
+typedef struct _DEBUGGER_BULK_MODIFY_EVENTS_ENTRY
+{
+    UINT64  Tag;       // Tag of the target event
+    BOOLEAN IsFound;   // Kernel sets it if the event exists
+    BOOLEAN IsEnabled; // State of the event after applying the action
+
+} DEBUGGER_BULK_MODIFY_EVENTS_ENTRY, *PDEBUGGER_BULK_MODIFY_EVENTS_ENTRY;
+
+/**
+ * @brief request for modifying a set of events at once
+ * (query/enable/disable/clear)
+ *
+ * @details CountOfTags entries of DEBUGGER_BULK_MODIFY_EVENTS_ENTRY
+ * are appended to this structure, the tags should be sorted in
+ * ascending order (ranges of tags are expanded by the debugger)
+ *
+ */
+typedef struct _DEBUGGER_BULK_MODIFY_EVENTS
+{
+    UINT64 KernelStatus; // Kerenl put the status in this field
+    DEBUGGER_MODIFY_EVENTS_TYPE
+    TypeOfAction;                 // Determines what's the action (query | enable | disable | clear)
+    UINT32 CountOfTags;           // Count of entries that are appended to the request
+    UINT32 CountOfAffectedEvents; // Kernel put the count of target events in this field
+
+} DEBUGGER_BULK_MODIFY_EVENTS, *PDEBUGGER_BULK_MODIFY_EVENTS;
@@ -232,3 +232,24 @@
  */
 #define IOCTL_QUERY_CURRENT_THREAD \
     CTL_CODE(FILE_DEVICE_UNKNOWN, 0x81e, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to modify or query a set of events at once
+ *
+ */
+#define IOCTL_DEBUGGER_BULK_MODIFY_EVENTS \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x81f, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, register or unregister the shared command ring
+ *
+ */
+#define IOCTL_REGISTER_COMMAND_RING \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x820, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, process the pending requests of the shared command ring
+ *
+ */
+#define IOCTL_PROCESS_COMMAND_RING \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x821, METHOD_BUFFERED, FILE_ANY_ACCESS)
@@ -79,6 +79,9 @@ typedef struct _DEBUGGER_DT_COMMAND_OPTIONS
     PVOID        BufferAddress;
     UINT32       TargetPid;
     const char * AdditionalParameters;
+    BOOLEAN      UseTypeLayout;
+    const char * NextFieldName; // the field that links the nodes of a list
+    UINT64       NextAddress;   // address of the next node of the list
 
 } DEBUGGER_DT_COMMAND_OPTIONS, *PDEBUGGER_DT_COMMAND_OPTIONS;
 
@@ -740,6 +743,75 @@ typedef struct _DEBUGGER_EVENT_REQUEST_CUSTOM_CODE
 
 } DEBUGGER_EVENT_REQUEST_CUSTOM_CODE, *PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE;
 
+/**
+ * @brief Count of registers that can be captured (general-purpose
+ * registers in the order of GUEST_REGS, then rip and rflags)
+ *
+ */
+#define DEBUGGER_CAPTURE_COUNT_OF_REGISTERS 18
+
+#define DEBUGGER_CAPTURE_REGISTER_RIP    16
+#define DEBUGGER_CAPTURE_REGISTER_RFLAGS 17
+
+/**
+ * @brief Maximum size of the memory snippet of each capture record
+ *
+ */
+#define DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE 64
+
+/**
+ * @brief used in the case of capture actions
+ *
+ */
+typedef struct _DEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION
+{
+    UINT32 RegisterMask;    // bit n is set if the register n should be captured
+    UINT32 SnippetRegister; // the register that holds the address of the snippet
+    UINT32 SnippetSize;     // zero if no memory snippet is captured
+
+} DEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION, *PDEBUGGER_EVENT_ACTION_CAPTURE_CONFIGURATION;
+
+/**
+ * @brief The binary record that is saved by capture actions
+ * @details Registers that are not in the RegisterMask are zero
+ *
+ */
+typedef struct _DEBUGGER_CAPTURE_RECORD
+{
+    UINT64 Tag;
+    UINT64 Tsc;
+    UINT64 Context;
+    UINT32 CoreId;
+    UINT32 RegisterMask;
+    UINT64 Registers[DEBUGGER_CAPTURE_COUNT_OF_REGISTERS];
+    UINT64 SnippetAddress;
+    UINT32 SnippetSize; // zero if the snippet was not captured (or not valid)
+    UINT32 Reserved;
+    BYTE   Snippet[DEBUGGER_CAPTURE_MAXIMUM_SNIPPET_SIZE];
+
+} DEBUGGER_CAPTURE_RECORD, *PDEBUGGER_CAPTURE_RECORD;
+
+/**
+ * @brief The packet of capture records that is sent from each core
+ * @details CountOfRecords entries of DEBUGGER_CAPTURE_RECORD are
+ * appended to this structure
+ *
+ */
+typedef struct _DEBUGGER_CAPTURE_RECORDS_PACKET
+{
+    UINT32 CoreId;
+    UINT32 CountOfRecords;
+    UINT64 CountOfDroppedRecords; // records that are dropped since the previous packet
+
+} DEBUGGER_CAPTURE_RECORDS_PACKET, *PDEBUGGER_CAPTURE_RECORDS_PACKET;
+
+/**
+ * @brief Maximum number of records in each packet of capture records
+ *
+ */
+#define DEBUGGER_CAPTURE_MAXIMUM_RECORDS_IN_PACKET \
+    ((PacketChunkSize - 1 - sizeof(DEBUGGER_CAPTURE_RECORDS_PACKET)) / sizeof(DEBUGGER_CAPTURE_RECORD))
+
 /* ==============================================================================================
  */
 
@@ -1057,3 +1129,73 @@ typedef struct _DEBUGGEE_REGISTER_READ_DESCRIPTION
 
 /* ==============================================================================================
  */
+
+#define SIZEOF_DEBUGGER_COMMAND_RING_REQUEST \
+    sizeof(DEBUGGER_COMMAND_RING_REQUEST)
+
+/**
+ * @brief A request (submission entry) in the shared command ring
+ * @details the input and the output of the request are at the same
+ * place (BufferOffset) of the data area, like METHOD_BUFFERED IOCTLs
+ *
+ */
+typedef struct _COMMAND_RING_SUBMISSION_ENTRY
+{
+    UINT64 UserData;
+    UINT32 IoctlCode;
+    UINT32 BufferOffset;
+    UINT32 InputBufferLength;
+    UINT32 OutputBufferLength;
+
+} COMMAND_RING_SUBMISSION_ENTRY, *PCOMMAND_RING_SUBMISSION_ENTRY;
+
+/**
+ * @brief The result (completion entry) of a request in the shared command ring
+ *
+ */
+typedef struct _COMMAND_RING_COMPLETION_ENTRY
+{
+    UINT64 UserData;
+    UINT32 KernelStatus;
+    UINT32 ReturnedLength;
+
+} COMMAND_RING_COMPLETION_ENTRY, *PCOMMAND_RING_COMPLETION_ENTRY;
+
+/**
+ * @brief The layout of the memory that is shared between the debugger
+ * and the driver
+ * @details the heads and the tails are free-running indexes, the debugger
+ * produces submissions and consumes completions while the driver consumes
+ * submissions and produces completions
+ *
+ */
+typedef struct _COMMAND_RING
+{
+    volatile UINT32 SubmissionHead;
+    volatile UINT32 SubmissionTail;
+    volatile UINT32 CompletionHead;
+    volatile UINT32 CompletionTail;
+
+    COMMAND_RING_SUBMISSION_ENTRY Submissions[COMMAND_RING_ENTRY_COUNT];
+    COMMAND_RING_COMPLETION_ENTRY Completions[COMMAND_RING_ENTRY_COUNT];
+
+    BYTE Data[COMMAND_RING_DATA_AREA_SIZE];
+
+} COMMAND_RING, *PCOMMAND_RING;
+
+/**
+ * @brief The request of registering (or unregistering) the shared command
+ * ring or processing its pending requests
+ *
+ */
+typedef struct _DEBUGGER_COMMAND_RING_REQUEST
+{
+    UINT64  RingAddress;
+    BOOLEAN IsRegister;
+    UINT32  CountOfProcessedEntries;
+    UINT32  KernelStatus;
+
+} DEBUGGER_COMMAND_RING_REQUEST, *PDEBUGGER_COMMAND_RING_REQUEST;
+
+/* ==============================================================================================
+ */
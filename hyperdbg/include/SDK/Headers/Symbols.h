@@ -48,6 +48,7 @@ typedef struct _USERMODE_LOADED_MODULE_DETAILS
     BOOLEAN OnlyCountModules;
     UINT32  ModulesCount;
     UINT32  Result;
+    UINT64  Generation; // Generation of the counted modules (zero if not counted)
 
     //
     // Here is a list of USERMODE_LOADED_MODULE_SYMBOLS (appended)
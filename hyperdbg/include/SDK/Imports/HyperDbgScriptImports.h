@@ -44,6 +44,8 @@ __declspec(dllimport) BOOLEAN
     ScriptEngineSymbolInitLoad(PVOID BufferToStoreDetails, UINT32 StoredLength, BOOLEAN DownloadIfAvailable, const char * SymbolPath, BOOLEAN IsSilentLoad);
 __declspec(dllimport) BOOLEAN
     ScriptEngineShowDataBasedOnSymbolTypes(const char * TypeName, UINT64 Address, BOOLEAN IsStruct, PVOID BufferAddress, const char * AdditionalParameters);
+__declspec(dllimport) BOOLEAN
+    ScriptEngineShowDataBasedOnTypeLayout(const char * TypeName, UINT64 Address, PVOID BufferAddress, UINT32 BufferSize, const char * NextFieldName, UINT64 * NextAddress);
 
 #ifdef __cplusplus
 }
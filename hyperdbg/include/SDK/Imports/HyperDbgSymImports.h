@@ -44,6 +44,13 @@ __declspec(dllimport) BOOLEAN
                                   BOOLEAN      IsStruct,
                                   PVOID        BufferAddress,
                                   const char * AdditionalParameters);
+__declspec(dllimport) BOOLEAN
+    SymShowDataBasedOnTypeLayout(const char * TypeName,
+                                 UINT64       Address,
+                                 PVOID        BufferAddress,
+                                 UINT32       BufferSize,
+                                 const char * NextFieldName,
+                                 UINT64 *     NextAddress);
 __declspec(dllimport) BOOLEAN
     SymQuerySizeof(_In_ const char * StructNameOrTypeName, _Out_ UINT32 * SizeOfField);
 __declspec(dllimport) BOOLEAN
@@ -51,6 +51,20 @@ const struct _TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "IF_STATEMENT"},
@@ -131,6 +145,13 @@ const struct _TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "STRING"},
 	{NON_TERMINAL, "L_VALUE"},
 	{NON_TERMINAL, "L_VALUE"},
@@ -160,11 +181,18 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "test_statement"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@TEST_STATEMENT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_lock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_unlock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_UNLOCK"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_COUNT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "printf"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@PRINTF"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "pause"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PAUSE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "flush"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@FLUSH"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_ignore"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_IGNORE"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_print"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@AGG_PRINT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_clear"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@AGG_CLEAR"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_lock_custom_wait"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK_CUSTOM_WAIT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_SUM"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_MIN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_MAX"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "agg_hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@AGG_HIST"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "poi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@POI"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "db"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DB"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "dd"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
@@ -187,7 +215,14 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "strcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRCMP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "wcscmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSCMP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "strstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRSTR"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "wcsstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSSTR"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "memcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCMP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "memchr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCHR"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "memcpy"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCPY"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{NON_TERMINAL, "VA"}},
 	{{EPSILON, "eps"}},
 	{{KEYWORD, "if"},{SEMANTIC_RULE, "@START_OF_IF"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "BOOLEAN_EXPRESSION"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@JZ"},{SPECIAL_TOKEN, "{"},{NON_TERMINAL, "S"},{SPECIAL_TOKEN, "}"},{NON_TERMINAL, "ELSIF_STATEMENT"},{NON_TERMINAL, "ELSE_STATEMENT"},{SEMANTIC_RULE, "@END_OF_IF"},{NON_TERMINAL, "END_OF_IF"}},
@@ -253,7 +288,14 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "strcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRCMP"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "wcscmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSCMP"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "strstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRSTR"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "wcsstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSSTR"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "memcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCMP"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "memchr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCHR"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "memcpy"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCPY"},{SPECIAL_TOKEN, ")"}},
 	{{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ")"}},
 	{{SEMANTIC_RULE, "@PUSH"},{REGISTER, "_register"}},
 	{{SEMANTIC_RULE, "@PUSH"},{LOCAL_ID, "_local_id"}},
@@ -297,10 +339,17 @@ const unsigned int RhsSize[RULES_COUNT]=
 5,
 5,
 5,
+5,
 7,
 4,
 4,
 4,
+4,
+4,
+7,
+7,
+7,
+7,
 7,
 6,
 6,
@@ -324,6 +373,13 @@ const unsigned int RhsSize[RULES_COUNT]=
 8,
 8,
 8,
+8,
+8,
+8,
+8,
+10,
+10,
+10,
 10,
 3,
 1,
@@ -390,6 +446,13 @@ const unsigned int RhsSize[RULES_COUNT]=
 7,
 7,
 7,
+7,
+7,
+7,
+7,
+9,
+9,
+9,
 9,
 3,
 2,
@@ -412,153 +475,167 @@ const unsigned int RhsSize[RULES_COUNT]=
 };
 const char* NoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"ELSE_STATEMENT",
-"BOOLEAN_EXPRESSION",
+"S",
+"IF_STATEMENT",
+"VA",
+"FOR_STATEMENT",
+"ELSIF_STATEMENT",
 "CALL_FUNC_STATEMENT",
-"L_VALUE",
-"E2'",
 "INC_DEC'",
-"VA",
-"S",
+"E4'",
+"E3'",
+"SIMPLE_ASSIGNMENT'",
+"E3",
 "E4",
+"STATEMENT",
+"E2",
+"END_OF_IF",
 "E5",
+"ELSE_STATEMENT",
+"ASSIGNMENT_STATEMENT'",
 "E5'",
-"INC_DEC",
-"IF_STATEMENT",
-"E0'",
 "SIMPLE_ASSIGNMENT",
-"ASSIGNMENT_STATEMENT",
-"STRING",
-"END_OF_IF",
-"E4'",
-"FOR_STATEMENT",
-"WHILE_STATEMENT",
-"E2",
-"STATEMENT",
+"BOOLEAN_EXPRESSION",
+"E1'",
+"E2'",
 "EXPRESSION",
+"ASSIGNMENT_STATEMENT",
+"L_VALUE",
+"DO_WHILE_STATEMENT",
 "ELSIF_STATEMENT'",
 "E12",
-"E3'",
+"INC_DEC",
 "E1",
-"DO_WHILE_STATEMENT",
-"ELSIF_STATEMENT",
-"E3",
-"E1'",
-"ASSIGNMENT_STATEMENT'",
-"SIMPLE_ASSIGNMENT'"
+"STRING",
+"WHILE_STATEMENT",
+"E0'"
 };
 const char* TerminalMap[TERMINAL_COUNT]= 
 {
-"spinlock_unlock",
-"interlocked_compare_exchange",
-"+",
-"pause",
+"memcpy",
+";",
+"agg_print",
+"~",
+"agg_sum",
+"++",
+"test_statement",
 "interlocked_exchange",
-"formats",
-"event_ignore",
-"db",
-"dd",
-"neg",
-"hi",
-"interlocked_increment",
-"ed",
+"poi",
 "&",
-">>",
-"_pseudo_register",
 "/",
-"$",
 "strlen",
-"=",
-"poi",
-"event_disable",
-"_octal",
-"_register",
-"wcslen",
-"virtual_to_physical",
-"else",
+"spinlock_unlock",
 "do",
-"dq",
-"interlocked_exchange_add",
-"_string",
-"spinlock_lock_custom_wait",
-"not",
+"reference",
 "continue",
+"spinlock_lock_custom_wait",
+"}",
 "_binary",
+"check_address",
+">>",
+"_hex",
+"_register",
+"|",
+"$",
+"wcslen",
+"if",
+"*",
+"interlocked_compare_exchange",
+"spinlock_lock",
 "elsif",
-"++",
-"while",
+"{",
+"-",
+"--",
 "_decimal",
-"interlocked_decrement",
-"_local_id",
-"physical_to_virtual",
-"reference",
-"<<",
-"print",
-"printf",
-"spinlock_lock",
-"low",
-";",
-"if",
-"_hex",
-"eq",
-"(",
+"%",
+"^",
 ")",
+"dw",
+"eq",
+"printf",
+"interlocked_exchange_add",
+"memcmp",
+"pause",
+"event_enable",
 "_global_id",
-"~",
-"eb",
+"agg_max",
+"(",
+"hi",
+"while",
+"ed",
+"interlocked_increment",
+"virtual_to_physical",
 ",",
-"*",
-"^",
-"|",
-"break",
-"event_enable",
+"low",
+"print",
 "flush",
-"}",
-"{",
-"dw",
-"check_address",
-"%",
-"--",
-"test_statement",
+"not",
+"_pseudo_register",
+"dq",
+"_string",
+"event_ignore",
+"agg_min",
+"+",
+"memchr",
+"_octal",
+"wcscmp",
+"interlocked_decrement",
+"strcmp",
+"break",
+"formats",
+"agg_hist",
+"event_disable",
+"eb",
+"strstr",
+"else",
+"neg",
+"agg_count",
+"dd",
+"agg_clear",
+"physical_to_virtual",
+"wcsstr",
+"<<",
 "for",
-"-"
+"db",
+"=",
+"_local_id"
 };
 const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
 {
-	{57		,57		,-999		,57		,57		,57		,57		,57		,57		,57		,57		,57		,57		,-999		,-999		,-999		,-999		,57		,57		,-999		,57		,57		,-999		,57		,57		,57		,56		,57		,57		,57		,-999		,57		,57		,57		,-999		,-999		,-999		,57		,-999		,57		,57		,57		,57		,-999		,57		,57		,57		,57		,-999		,57		,-999		,57		,-999		,-999		,57		,-999		,57		,-999		,-999		,-999		,-999		,57		,57		,57		,57		,57		,57		,57		,-999		,-999		,57		,57		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,70		,-999		,-999		,-999		,-999		,70		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{21		,49		,-999		,23		,47		,16		,25		,28		,29		,32		,33		,39		,44		,-999		,-999		,-999		,-999		,-999		,37		,-999		,27		,18		,-999		,-999		,38		,43		,-999		,-999		,31		,48		,-999		,26		,35		,-999		,-999		,-999		,-999		,-999		,-999		,40		,-999		,42		,41		,-999		,15		,22		,20		,34		,-999		,-999		,-999		,46		,-999		,-999		,-999		,-999		,45		,-999		,-999		,-999		,-999		,-999		,17		,24		,-999		,-999		,30		,36		,-999		,-999		,19		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,133		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,132		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,131		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,78		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,79		,-999		,79		,79		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,68		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,66		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,69		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,67		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,51		,-999		,-999		,-999		,50		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{0		,0		,-999		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,-999		,-999		,-999		,-999		,2		,0		,-999		,0		,0		,-999		,0		,0		,0		,-999		,0		,0		,0		,-999		,0		,0		,0		,-999		,-999		,-999		,0		,-999		,0		,0		,0		,0		,-999		,0		,0		,0		,0		,-999		,0		,-999		,0		,-999		,-999		,0		,-999		,0		,-999		,-999		,-999		,-999		,0		,0		,0		,2		,1		,0		,0		,-999		,-999		,0		,0		,-999	},
-	{-999		,84		,84		,-999		,84		,-999		,-999		,84		,84		,84		,84		,84		,84		,84		,-999		,84		,-999		,-999		,84		,-999		,84		,-999		,84		,84		,84		,84		,-999		,-999		,84		,84		,-999		,-999		,84		,-999		,84		,-999		,-999		,-999		,84		,84		,84		,84		,84		,-999		,-999		,-999		,-999		,84		,-999		,-999		,84		,84		,84		,-999		,84		,84		,84		,-999		,84		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,84		,84		,-999		,-999		,-999		,-999		,84	},
-	{-999		,88		,88		,-999		,88		,-999		,-999		,88		,88		,88		,88		,88		,88		,88		,-999		,88		,-999		,-999		,88		,-999		,88		,-999		,88		,88		,88		,88		,-999		,-999		,88		,88		,-999		,-999		,88		,-999		,88		,-999		,-999		,-999		,88		,88		,88		,88		,88		,-999		,-999		,-999		,-999		,88		,-999		,-999		,88		,88		,88		,-999		,88		,88		,88		,-999		,88		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,88		,88		,-999		,-999		,-999		,-999		,88	},
-	{-999		,-999		,92		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,92		,92		,-999		,89		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,92		,-999		,-999		,-999		,-999		,92		,-999		,-999		,-999		,-999		,92		,-999		,-999		,-999		,92		,91		,92		,92		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,90		,-999		,-999		,-999		,92	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,65		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,65		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,65		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,52		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,73		,-999		,-999		,-999		,-999		,73		,-999		,-999		,-999		,73		,-999		,-999		,72		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,63		,-999		,-999		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,130		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{58		,58		,-999		,58		,58		,58		,58		,58		,58		,58		,58		,58		,58		,-999		,-999		,-999		,-999		,58		,58		,-999		,58		,58		,-999		,58		,58		,58		,-999		,58		,58		,58		,-999		,58		,58		,58		,-999		,-999		,-999		,58		,-999		,58		,58		,58		,58		,-999		,58		,58		,58		,58		,-999		,58		,-999		,58		,-999		,-999		,58		,-999		,58		,-999		,-999		,-999		,-999		,58		,58		,58		,58		,58		,58		,58		,-999		,-999		,58		,58		,-999	},
-	{-999		,-999		,85		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,87		,-999		,87		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,86	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,61		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,59		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,77		,77		,-999		,77		,-999		,-999		,77		,77		,77		,77		,77		,77		,77		,-999		,77		,-999		,-999		,77		,-999		,77		,-999		,77		,77		,77		,77		,-999		,-999		,77		,77		,-999		,-999		,77		,-999		,77		,-999		,-999		,-999		,77		,77		,77		,77		,77		,-999		,-999		,-999		,-999		,77		,-999		,-999		,77		,77		,77		,-999		,77		,77		,77		,-999		,77		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,77		,77		,-999		,-999		,-999		,-999		,77	},
-	{8		,8		,-999		,8		,8		,8		,8		,8		,8		,8		,8		,8		,8		,-999		,-999		,-999		,-999		,-999		,8		,-999		,8		,8		,-999		,7		,8		,8		,-999		,5		,8		,8		,-999		,8		,8		,10		,-999		,-999		,-999		,4		,-999		,8		,7		,8		,8		,-999		,8		,8		,8		,8		,-999		,3		,-999		,8		,-999		,-999		,7		,-999		,8		,-999		,-999		,-999		,-999		,9		,8		,8		,-999		,-999		,8		,8		,-999		,-999		,8		,6		,-999	},
-	{-999		,71		,71		,-999		,71		,-999		,-999		,71		,71		,71		,71		,71		,71		,71		,-999		,71		,-999		,-999		,71		,-999		,71		,-999		,71		,71		,71		,71		,-999		,-999		,71		,71		,-999		,-999		,71		,-999		,71		,-999		,-999		,-999		,71		,71		,71		,71		,71		,-999		,-999		,-999		,-999		,71		,-999		,-999		,71		,71		,71		,-999		,71		,71		,71		,-999		,71		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,71		,71		,-999		,-999		,-999		,-999		,71	},
-	{55		,55		,-999		,55		,55		,55		,55		,55		,55		,55		,55		,55		,55		,-999		,-999		,-999		,-999		,55		,55		,-999		,55		,55		,-999		,55		,55		,55		,55		,55		,55		,55		,-999		,55		,55		,55		,-999		,-999		,-999		,55		,-999		,55		,55		,55		,55		,-999		,55		,55		,55		,55		,-999		,55		,-999		,55		,-999		,-999		,55		,-999		,55		,-999		,-999		,-999		,-999		,55		,55		,55		,55		,55		,55		,55		,-999		,-999		,55		,55		,-999	},
-	{-999		,115		,126		,-999		,113		,-999		,-999		,94		,95		,98		,99		,105		,110		,129		,-999		,124		,-999		,-999		,103		,-999		,93		,-999		,122		,117		,104		,109		,-999		,-999		,97		,114		,-999		,-999		,101		,-999		,123		,-999		,-999		,-999		,121		,106		,118		,108		,107		,-999		,-999		,-999		,-999		,100		,-999		,-999		,120		,112		,116		,-999		,119		,127		,111		,-999		,128		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,96		,102		,-999		,-999		,-999		,-999		,125	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,83		,81		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,82		,-999		,-999		,-999		,-999		,83		,-999		,-999		,-999		,-999		,83		,-999		,-999		,-999		,83		,-999		,83		,83		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,74		,74		,-999		,74		,-999		,-999		,74		,74		,74		,74		,74		,74		,74		,-999		,74		,-999		,-999		,74		,-999		,74		,-999		,74		,74		,74		,74		,-999		,-999		,74		,74		,-999		,-999		,74		,-999		,74		,-999		,-999		,-999		,74		,74		,74		,74		,74		,-999		,-999		,-999		,-999		,74		,-999		,-999		,74		,74		,74		,-999		,74		,74		,74		,-999		,74		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,74		,74		,-999		,-999		,-999		,-999		,74	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,60		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{54		,54		,-999		,54		,54		,54		,54		,54		,54		,54		,54		,54		,54		,-999		,-999		,-999		,-999		,54		,54		,-999		,54		,54		,-999		,54		,54		,54		,54		,54		,54		,54		,-999		,54		,54		,54		,-999		,53		,-999		,54		,-999		,54		,54		,54		,54		,-999		,54		,54		,54		,54		,-999		,54		,-999		,54		,-999		,-999		,54		,-999		,54		,-999		,-999		,-999		,-999		,54		,54		,54		,54		,54		,54		,54		,-999		,-999		,54		,54		,-999	},
-	{-999		,80		,80		,-999		,80		,-999		,-999		,80		,80		,80		,80		,80		,80		,80		,-999		,80		,-999		,-999		,80		,-999		,80		,-999		,80		,80		,80		,80		,-999		,-999		,80		,80		,-999		,-999		,80		,-999		,80		,-999		,-999		,-999		,80		,80		,80		,80		,80		,-999		,-999		,-999		,-999		,80		,-999		,-999		,80		,80		,80		,-999		,80		,80		,80		,-999		,80		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,80		,80		,-999		,-999		,-999		,-999		,80	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,76		,-999		,-999		,-999		,-999		,76		,-999		,-999		,-999		,76		,-999		,75		,76		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,14		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,13		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,64		,-999		,-999		,-999		,-999		,64		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	}
+	{0		,-999		,0		,-999		,0		,-999		,0		,0		,0		,-999		,-999		,0		,0		,0		,0		,0		,0		,2		,-999		,0		,-999		,-999		,0		,-999		,2		,0		,0		,-999		,0		,0		,-999		,1		,-999		,-999		,-999		,-999		,-999		,-999		,0		,0		,0		,0		,0		,0		,0		,0		,0		,-999		,0		,0		,0		,0		,0		,-999		,0		,0		,0		,0		,-999		,0		,-999		,0		,0		,-999		,0		,-999		,0		,0		,0		,0		,0		,0		,0		,0		,0		,-999		,0		,0		,0		,0		,0		,0		,-999		,0		,0		,-999		,0	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,66		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,65		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,64		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,75		,-999		,-999		,-999	},
+	{68		,-999		,68		,-999		,68		,-999		,68		,68		,68		,-999		,-999		,68		,68		,68		,68		,68		,68		,68		,-999		,68		,-999		,-999		,68		,-999		,68		,68		,68		,-999		,68		,68		,67		,68		,-999		,-999		,-999		,-999		,-999		,-999		,68		,68		,68		,68		,68		,68		,68		,68		,68		,-999		,68		,68		,68		,68		,68		,-999		,68		,68		,68		,68		,-999		,68		,-999		,68		,68		,-999		,68		,-999		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,68		,-999		,68		,68		,-999		,68	},
+	{63		,-999		,27		,-999		,30		,-999		,19		,54		,34		,-999		,-999		,44		,21		,-999		,48		,-999		,29		,-999		,-999		,43		,-999		,-999		,-999		,-999		,-999		,45		,-999		,-999		,60		,20		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,37		,53		,23		,55		,61		,24		,17		,-999		,32		,-999		,40		,-999		,51		,46		,50		,-999		,41		,15		,25		,42		,-999		,38		,-999		,26		,31		,-999		,62		,-999		,57		,47		,56		,-999		,16		,33		,18		,52		,58		,-999		,39		,22		,36		,28		,49		,59		,-999		,-999		,35		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,80		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,81		,-999		,-999		,-999		,83		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,82		,-999	},
+	{-999		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,101		,-999		,-999		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,100		,-999		,-999		,-999		,101		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,99		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,101		,-999		,-999		,-999		,-999	},
+	{-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,95		,-999		,-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,97		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,96		,-999		,-999		,-999		,-999	},
+	{-999		,78		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,78		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{94		,-999		,-999		,94		,-999		,-999		,-999		,94		,94		,94		,-999		,94		,-999		,-999		,94		,-999		,-999		,-999		,94		,94		,-999		,94		,94		,-999		,-999		,94		,-999		,94		,94		,-999		,-999		,-999		,94		,-999		,94		,-999		,-999		,-999		,94		,94		,-999		,94		,94		,-999		,-999		,94		,-999		,94		,94		,-999		,94		,94		,94		,-999		,94		,-999		,-999		,94		,94		,94		,-999		,-999		,-999		,94		,94		,94		,94		,94		,94		,-999		,-999		,-999		,-999		,94		,94		,-999		,94		,-999		,94		,-999		,94		,94		,-999		,-999		,94		,-999		,94	},
+	{98		,-999		,-999		,98		,-999		,-999		,-999		,98		,98		,98		,-999		,98		,-999		,-999		,98		,-999		,-999		,-999		,98		,98		,-999		,98		,98		,-999		,-999		,98		,-999		,98		,98		,-999		,-999		,-999		,98		,-999		,98		,-999		,-999		,-999		,98		,98		,-999		,98		,98		,-999		,-999		,98		,-999		,98		,98		,-999		,98		,98		,98		,-999		,98		,-999		,-999		,98		,98		,98		,-999		,-999		,-999		,98		,98		,98		,98		,98		,98		,-999		,-999		,-999		,-999		,98		,98		,-999		,98		,-999		,98		,-999		,98		,98		,-999		,-999		,98		,-999		,98	},
+	{8		,-999		,8		,-999		,8		,-999		,8		,8		,8		,-999		,-999		,8		,8		,5		,8		,10		,8		,-999		,-999		,8		,-999		,-999		,7		,-999		,-999		,8		,3		,-999		,8		,8		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,8		,8		,8		,8		,8		,8		,8		,7		,8		,-999		,8		,4		,8		,8		,8		,-999		,8		,8		,8		,8		,-999		,8		,-999		,8		,8		,-999		,8		,-999		,8		,8		,8		,9		,8		,8		,8		,8		,8		,-999		,8		,8		,8		,8		,8		,8		,-999		,6		,8		,-999		,7	},
+	{91		,-999		,-999		,91		,-999		,-999		,-999		,91		,91		,91		,-999		,91		,-999		,-999		,91		,-999		,-999		,-999		,91		,91		,-999		,91		,91		,-999		,-999		,91		,-999		,91		,91		,-999		,-999		,-999		,91		,-999		,91		,-999		,-999		,-999		,91		,91		,-999		,91		,91		,-999		,-999		,91		,-999		,91		,91		,-999		,91		,91		,91		,-999		,91		,-999		,-999		,91		,91		,91		,-999		,-999		,-999		,91		,91		,91		,91		,91		,91		,-999		,-999		,-999		,-999		,91		,91		,-999		,91		,-999		,91		,-999		,91		,91		,-999		,-999		,91		,-999		,91	},
+	{72		,-999		,72		,-999		,72		,-999		,72		,72		,72		,-999		,-999		,72		,72		,72		,72		,72		,72		,72		,-999		,72		,-999		,-999		,72		,-999		,72		,72		,72		,-999		,72		,72		,-999		,72		,-999		,-999		,-999		,-999		,-999		,-999		,72		,72		,72		,72		,72		,72		,72		,72		,72		,-999		,72		,72		,72		,72		,72		,-999		,72		,72		,72		,72		,-999		,72		,-999		,72		,72		,-999		,72		,-999		,72		,72		,72		,72		,72		,72		,72		,72		,72		,-999		,72		,72		,72		,72		,72		,72		,-999		,72		,72		,-999		,72	},
+	{102		,-999		,-999		,102		,-999		,-999		,-999		,102		,102		,102		,-999		,102		,-999		,-999		,102		,-999		,-999		,-999		,102		,102		,-999		,102		,102		,-999		,-999		,102		,-999		,102		,102		,-999		,-999		,-999		,102		,-999		,102		,-999		,-999		,-999		,102		,102		,-999		,102		,102		,-999		,-999		,102		,-999		,102		,102		,-999		,102		,102		,102		,-999		,102		,-999		,-999		,102		,102		,102		,-999		,-999		,-999		,102		,102		,102		,102		,102		,102		,-999		,-999		,-999		,-999		,102		,102		,-999		,102		,-999		,102		,-999		,102		,102		,-999		,-999		,102		,-999		,102	},
+	{71		,-999		,71		,-999		,71		,-999		,71		,71		,71		,-999		,-999		,71		,71		,71		,71		,71		,71		,71		,-999		,71		,-999		,-999		,71		,-999		,71		,71		,71		,-999		,71		,71		,-999		,71		,-999		,-999		,-999		,-999		,-999		,-999		,71		,71		,71		,71		,71		,71		,71		,71		,71		,-999		,71		,71		,71		,71		,71		,-999		,71		,71		,71		,71		,-999		,71		,-999		,71		,71		,-999		,71		,-999		,71		,71		,71		,71		,71		,71		,71		,71		,71		,70		,71		,71		,71		,71		,71		,71		,-999		,71		,71		,-999		,71	},
+	{-999		,-999		,-999		,-999		,-999		,12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,13		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,14		,-999	},
+	{-999		,106		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,106		,103		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,106		,-999		,-999		,106		,-999		,-999		,-999		,105		,-999		,-999		,-999		,-999		,106		,-999		,-999		,104		,106		,106		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,106		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,106		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,106		,-999		,-999		,-999		,-999	},
+	{-999		,77		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,76		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,76		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,76	},
+	{-999		,84		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,84		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,89		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,92		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,93		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{85		,-999		,-999		,85		,-999		,-999		,-999		,85		,85		,85		,-999		,85		,-999		,-999		,85		,-999		,-999		,-999		,85		,85		,-999		,85		,85		,-999		,-999		,85		,-999		,85		,85		,-999		,-999		,-999		,85		,-999		,85		,-999		,-999		,-999		,85		,85		,-999		,85		,85		,-999		,-999		,85		,-999		,85		,85		,-999		,85		,85		,85		,-999		,85		,-999		,-999		,85		,85		,85		,-999		,-999		,-999		,85		,85		,85		,85		,85		,85		,-999		,-999		,-999		,-999		,85		,85		,-999		,85		,-999		,85		,-999		,85		,85		,-999		,-999		,85		,-999		,85	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,11	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,154		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,152		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,153	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,74		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{69		,-999		,69		,-999		,69		,-999		,69		,69		,69		,-999		,-999		,69		,69		,69		,69		,69		,69		,69		,-999		,69		,-999		,-999		,69		,-999		,69		,69		,69		,-999		,69		,69		,-999		,69		,-999		,-999		,-999		,-999		,-999		,-999		,69		,69		,69		,69		,69		,69		,69		,69		,69		,-999		,69		,69		,69		,69		,69		,-999		,69		,69		,69		,69		,-999		,69		,-999		,69		,69		,-999		,69		,-999		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,-999		,69		,69		,-999		,69	},
+	{136		,-999		,-999		,148		,-999		,-999		,-999		,127		,107		,150		,-999		,117		,-999		,-999		,121		,-999		,-999		,-999		,144		,116		,-999		,141		,138		,-999		,-999		,118		,-999		,149		,133		,-999		,-999		,-999		,146		,-999		,142		,-999		,-999		,-999		,110		,126		,-999		,128		,134		,-999		,-999		,140		,-999		,137		,113		,-999		,124		,119		,123		,-999		,114		,-999		,-999		,115		,145		,111		,-999		,-999		,-999		,147		,135		,143		,130		,120		,129		,-999		,-999		,-999		,-999		,125		,131		,-999		,112		,-999		,109		,-999		,122		,132		,-999		,-999		,108		,-999		,139	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,79	},
+	{88		,-999		,-999		,88		,-999		,-999		,-999		,88		,88		,88		,-999		,88		,-999		,-999		,88		,-999		,-999		,-999		,88		,88		,-999		,88		,88		,-999		,-999		,88		,-999		,88		,88		,-999		,-999		,-999		,88		,-999		,88		,-999		,-999		,-999		,88		,88		,-999		,88		,88		,-999		,-999		,88		,-999		,88		,88		,-999		,88		,88		,88		,-999		,88		,-999		,-999		,88		,88		,88		,-999		,-999		,-999		,88		,88		,88		,88		,88		,88		,-999		,-999		,-999		,-999		,88		,88		,-999		,88		,-999		,88		,-999		,88		,88		,-999		,-999		,88		,-999		,88	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,151		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,73		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,86		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	}
 };
 const char* KeywordList[]= {
 "print",
@@ -568,11 +645,18 @@ const char* KeywordList[]= {
 "test_statement",
 "spinlock_lock",
 "spinlock_unlock",
+"agg_count",
 "printf",
 "pause",
 "flush",
 "event_ignore",
+"agg_print",
+"agg_clear",
 "spinlock_lock_custom_wait",
+"agg_sum",
+"agg_min",
+"agg_max",
+"agg_hist",
 "poi",
 "db",
 "dd",
@@ -595,7 +679,14 @@ const char* KeywordList[]= {
 "eq",
 "interlocked_exchange",
 "interlocked_exchange_add",
+"strcmp",
+"wcscmp",
+"strstr",
+"wcsstr",
 "interlocked_compare_exchange",
+"memcmp",
+"memchr",
+"memcpy",
 "poi",
 "db",
 "dd",
@@ -618,7 +709,14 @@ const char* KeywordList[]= {
 "eq",
 "interlocked_exchange",
 "interlocked_exchange_add",
-"interlocked_compare_exchange"
+"strcmp",
+"wcscmp",
+"strstr",
+"wcsstr",
+"interlocked_compare_exchange",
+"memcmp",
+"memchr",
+"memcpy"
 };
 const char* OperatorsTwoOperandList[]= {
 "@OR",
@@ -645,7 +743,10 @@ const char* OperatorsOneOperandList[]= {
 "@DEREFERENCE"
 };
 const char* ThreeOpFunc1[] = {
-"@INTERLOCKED_COMPARE_EXCHANGE"
+"@INTERLOCKED_COMPARE_EXCHANGE",
+"@MEMCMP",
+"@MEMCHR",
+"@MEMCPY",
 };
 const char* TwoOpFunc1[] = {
 "@ED",
@@ -653,9 +754,17 @@ const char* TwoOpFunc1[] = {
 "@EQ",
 "@INTERLOCKED_EXCHANGE",
 "@INTERLOCKED_EXCHANGE_ADD",
+"@STRCMP",
+"@WCSCMP",
+"@STRSTR",
+"@WCSSTR",
 };
 const char* TwoOpFunc2[] = {
-"@SPINLOCK_LOCK_CUSTOM_WAIT"
+"@SPINLOCK_LOCK_CUSTOM_WAIT",
+"@AGG_SUM",
+"@AGG_MIN",
+"@AGG_MAX",
+"@AGG_HIST",
 };
 const char* OneOpFunc1[] = {
 "@POI",
@@ -684,11 +793,14 @@ const char* OneOpFunc2[] = {
 "@TEST_STATEMENT",
 "@SPINLOCK_LOCK",
 "@SPINLOCK_UNLOCK",
+"@AGG_COUNT",
 };
 const char* ZeroOpFunc1[] = {
 "@PAUSE",
 "@FLUSH",
 "@EVENT_IGNORE",
+"@AGG_PRINT",
+"@AGG_CLEAR",
 };
 const char* VarArgFunc1[] = {
 "@PRINTF"
@@ -740,11 +852,18 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@TEST_STATEMENT", FUNC_TEST_STATEMENT},
 {"@SPINLOCK_LOCK", FUNC_SPINLOCK_LOCK},
 {"@SPINLOCK_UNLOCK", FUNC_SPINLOCK_UNLOCK},
+{"@AGG_COUNT", FUNC_AGG_COUNT},
 {"@PRINTF", FUNC_PRINTF},
 {"@PAUSE", FUNC_PAUSE},
 {"@FLUSH", FUNC_FLUSH},
 {"@EVENT_IGNORE", FUNC_EVENT_IGNORE},
+{"@AGG_PRINT", FUNC_AGG_PRINT},
+{"@AGG_CLEAR", FUNC_AGG_CLEAR},
 {"@SPINLOCK_LOCK_CUSTOM_WAIT", FUNC_SPINLOCK_LOCK_CUSTOM_WAIT},
+{"@AGG_SUM", FUNC_AGG_SUM},
+{"@AGG_MIN", FUNC_AGG_MIN},
+{"@AGG_MAX", FUNC_AGG_MAX},
+{"@AGG_HIST", FUNC_AGG_HIST},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
 {"@DD", FUNC_DD},
@@ -767,7 +886,14 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EQ", FUNC_EQ},
 {"@INTERLOCKED_EXCHANGE", FUNC_INTERLOCKED_EXCHANGE},
 {"@INTERLOCKED_EXCHANGE_ADD", FUNC_INTERLOCKED_EXCHANGE_ADD},
+{"@STRCMP", FUNC_STRCMP},
+{"@WCSCMP", FUNC_WCSCMP},
+{"@STRSTR", FUNC_STRSTR},
+{"@WCSSTR", FUNC_WCSSTR},
 {"@INTERLOCKED_COMPARE_EXCHANGE", FUNC_INTERLOCKED_COMPARE_EXCHANGE},
+{"@MEMCMP", FUNC_MEMCMP},
+{"@MEMCHR", FUNC_MEMCHR},
+{"@MEMCPY", FUNC_MEMCPY},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
 {"@DD", FUNC_DD},
@@ -790,7 +916,14 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EQ", FUNC_EQ},
 {"@INTERLOCKED_EXCHANGE", FUNC_INTERLOCKED_EXCHANGE},
 {"@INTERLOCKED_EXCHANGE_ADD", FUNC_INTERLOCKED_EXCHANGE_ADD},
+{"@STRCMP", FUNC_STRCMP},
+{"@WCSCMP", FUNC_WCSCMP},
+{"@STRSTR", FUNC_STRSTR},
+{"@WCSSTR", FUNC_WCSSTR},
 {"@INTERLOCKED_COMPARE_EXCHANGE", FUNC_INTERLOCKED_COMPARE_EXCHANGE},
+{"@MEMCMP", FUNC_MEMCMP},
+{"@MEMCHR", FUNC_MEMCHR},
+{"@MEMCPY", FUNC_MEMCPY},
 };
 const SYMBOL_MAP RegisterMapList[]= {
 {"rax", REGISTER_RAX},
@@ -999,6 +1132,13 @@ const struct _TOKEN LalrLhs[RULES_COUNT]=
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"}
 };
 const struct _TOKEN LalrRhs[RULES_COUNT][MAX_RHS_LEN]= 
@@ -1062,7 +1202,14 @@ const struct _TOKEN LalrRhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@EQ"}},
 	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"}},
 	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"}},
+	{{KEYWORD, "strcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@STRCMP"}},
+	{{KEYWORD, "wcscmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@WCSCMP"}},
+	{{KEYWORD, "strstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@STRSTR"}},
+	{{KEYWORD, "wcsstr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@WCSSTR"}},
 	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"}},
+	{{KEYWORD, "memcmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@MEMCMP"}},
+	{{KEYWORD, "memchr"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@MEMCHR"}},
+	{{KEYWORD, "memcpy"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@MEMCPY"}},
 	{{SPECIAL_TOKEN, "("},{NON_TERMINAL, "BE"},{SPECIAL_TOKEN, ")"}},
 	{{REGISTER, "_register"},{SEMANTIC_RULE, "@PUSH"}},
 	{{GLOBAL_ID, "_global_id"},{SEMANTIC_RULE, "@PUSH"}},
@@ -1134,6 +1281,13 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 7,
 7,
 7,
+7,
+7,
+7,
+7,
+9,
+9,
+9,
 9,
 3,
 2,
@@ -1147,86 +1301,125 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 };
 const char* LalrNoneTerminalMap[NONETERMINAL_COUNT]= 
 {
+"E5",
+"S",
+"EXP",
+"B5",
 "E3",
 "BE",
-"B3",
-"B6",
 "E12",
-"B1",
-"B4",
-"EXP",
-"B5",
-"CMP",
-"S",
+"B3",
 "E4",
-"E5",
+"B4",
+"B1",
+"B6",
 "E10",
-"B2"
+"B2",
+"CMP"
 };
 const char* LalrTerminalMap[TERMINAL_COUNT]= 
 {
-"interlocked_compare_exchange",
+"memcpy",
 "+",
-"interlocked_exchange",
-"ed",
-"&",
-">>",
-">",
-"db",
-"dd",
-"neg",
-"hi",
-"interlocked_increment",
+"<=",
 "-",
-"/",
-"_pseudo_register",
-"$",
-"strlen",
-"poi",
+"memchr",
+"~",
+"_decimal",
 "_octal",
-">=",
+"wcscmp",
+"<",
+"interlocked_decrement",
+">>",
+"check_address",
+"%",
 "||",
-"wcslen",
-"virtual_to_physical",
-"&&",
-"dq",
-"interlocked_exchange_add",
-"<=",
-"not",
+"^",
+"strcmp",
+"_hex",
 "_binary",
-"==",
-"_decimal",
-"interlocked_decrement",
+")",
+">",
+"dw",
+"eq",
+"_register",
+"|",
+"interlocked_exchange_add",
+"memcmp",
+"strstr",
+"eb",
+"$",
+"wcslen",
+"_global_id",
+">=",
+"interlocked_exchange",
+"_pseudo_register",
 "_local_id",
+"==",
+"*",
+"poi",
+"neg",
+"&",
+"(",
+"hi",
+"ed",
 "!=",
+"dd",
+"interlocked_increment",
 "physical_to_virtual",
-"reference",
+"/",
 "<<",
-"low",
-"_hex",
-"eq",
-"(",
-")",
-"_global_id",
-"~",
-"eb",
+"wcsstr",
+"virtual_to_physical",
+"db",
 ",",
-"^",
-"|",
-"%",
-"<",
-"dw",
-"check_address",
-"_register",
-"*"
+"low",
+"interlocked_compare_exchange",
+"strlen",
+"not",
+"dq",
+"&&",
+"reference"
 };
 const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]= 
 {
-	{11		,2		,5		,8		,15		,3		,6		,10		,7		,9		,1		,12		,13		,14		,4	},
+	{13		,1		,10		,7		,11		,2		,15		,5		,12		,6		,3		,8		,14		,4		,9	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,10		,7		,11		,92		,15		,5		,12		,6		,3		,8		,14		,4		,9	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
@@ -1234,28 +1427,77 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,98		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,103		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,106		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,75		,5		,8		,15		,3		,6		,10		,7		,9		,-999		,12		,13		,14		,4	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,111		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,112		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,10		,7		,11		,-999		,15		,114		,12		,6		,-999		,8		,14		,-999		,9	},
+	{13		,-999		,10		,7		,11		,-999		,15		,5		,12		,6		,115		,8		,14		,116		,9	},
+	{13		,-999		,10		,7		,11		,-999		,15		,-999		,12		,117		,-999		,8		,14		,-999		,9	},
+	{13		,-999		,10		,118		,11		,-999		,15		,-999		,12		,-999		,-999		,8		,14		,-999		,9	},
+	{13		,-999		,10		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,119		,14		,-999		,9	},
+	{13		,-999		,120		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,121		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,122		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,123		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,124		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,125		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,-999		,-999		,-999		,-999		,15		,-999		,126		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,-999		,-999		,-999		,-999		,15		,-999		,127		,-999		,-999		,-999		,14		,-999		,-999	},
+	{128		,-999		,-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,14		,-999		,-999	},
+	{129		,-999		,-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,14		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,130		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,131		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,132		,-999		,-999	},
+	{13		,-999		,133		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,134		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,135		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,136		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,137		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,138		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,139		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,140		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,141		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,142		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,143		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,144		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,145		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,146		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,148		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,149		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,150		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,151		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,152		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,153		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,154		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,155		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,156		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,157		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,158		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,159		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,160		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,161		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,162		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,163		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,83		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,84		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
@@ -1265,63 +1507,20 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,92		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,96		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,100		,8		,15		,-999		,6		,10		,7		,9		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,5		,8		,15		,101		,6		,10		,7		,9		,-999		,12		,13		,14		,102	},
-	{11		,-999		,-999		,8		,15		,-999		,103		,10		,7		,9		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,8		,15		,-999		,-999		,10		,104		,9		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,105		,15		,-999		,-999		,10		,-999		,9		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,106		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,107		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,108		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,109		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,110		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,111		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,112		,13		,14		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,113		,13		,14		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,114		,14		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,115		,14		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,116		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,117		,-999	},
-	{-999		,-999		,-999		,-999		,15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,118		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,119		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,120		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,121		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,122		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,124		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,125		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,126		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,127		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,128		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,129		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,130		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,131		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,132		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,133		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,134		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,135		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,136		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,137		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,138		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,139		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,140		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,141		,-999		,-999		,-999		,12		,13		,14		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,142		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
@@ -1349,54 +1548,64 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,194		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,195		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,196		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,197		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,198		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,199		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,200		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,201		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,202		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,203		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,204		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,205		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,206		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,166		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,167		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,168		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,169		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,170		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,171		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,220		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
+	{13		,-999		,221		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,222		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{13		,-999		,223		,-999		,11		,-999		,15		,-999		,12		,-999		,-999		,-999		,14		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{11		,-999		,-999		,-999		,15		,-999		,-999		,178		,-999		,-999		,-999		,12		,13		,14		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
 	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
@@ -1405,186 +1614,234 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 };
 const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT]= 
 {
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-1		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-2		,-999		,-999		,-999		,-999		,54		,-999		,-999		,53		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-2		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,-999		,55		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,-8		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,56		,-8		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,57		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-10		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-10		,-10		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-12		,-12		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-13		,-999		,61		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-13		,-999		,-999		,-999		,63		,-13		,-999		,-999		,-13		,-999		,-999		,59		,-999		,-999		,60		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-13		,-999		,-999		,-999		,-999		,-13		,-13		,-999		,58		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-20		,-999		,-20		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-20		,-20		,-999		,-999		,-20		,-999		,-999		,-20		,-999		,-999		,-20		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-999		,-20		,-20		,-999		,-20		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-21		,64		,-21		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-21		,-999		,-999		,-21		,-999		,-999		,-21		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-999		,-999		,65		,-999		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-21		,-21		,-999		,-21		,-999		,-999		,-999		,-999	},
-	{-999		,66		,-999		,-999		,-24		,-24		,-24		,-999		,-999		,-999		,-999		,-999		,67		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-24		,-999		,-999		,-24		,-999		,-999		,-24		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-24		,-999		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-24		,-24		,-999		,-24		,-999		,-999		,-999		,-999	},
-	{-999		,-27		,-999		,-999		,-27		,-27		,-27		,-999		,-999		,-999		,-999		,-999		,-27		,68		,-999		,-27		,-999		,-999		,-999		,-27		,-27		,-999		,-999		,-27		,-999		,-999		,-27		,-999		,-999		,-27		,-999		,-999		,-999		,-27		,-999		,-999		,-27		,-999		,-999		,-999		,-999		,-27		,-999		,-999		,-999		,-27		,-27		,-27		,70		,-27		,-999		,-999		,-999		,69	},
-	{-999		,-31		,-999		,-999		,-31		,-31		,-31		,-999		,-999		,-999		,-999		,-999		,-31		,-31		,-999		,-31		,-999		,-999		,-999		,-31		,-31		,-999		,-999		,-31		,-999		,-999		,-31		,-999		,-999		,-31		,-999		,-999		,-999		,-31		,-999		,-999		,-31		,-999		,-999		,-999		,-999		,-31		,-999		,-999		,-999		,-31		,-31		,-31		,-31		,-31		,-999		,-999		,-999		,-31	},
-	{-999		,-32		,-999		,-999		,-32		,-32		,-32		,-999		,-999		,-999		,-999		,-999		,-32		,-32		,-999		,-32		,-999		,-999		,-999		,-32		,-32		,-999		,-999		,-32		,-999		,-999		,-32		,-999		,-999		,-32		,-999		,-999		,-999		,-32		,-999		,-999		,-32		,-999		,-999		,-999		,-999		,-32		,-999		,-999		,-999		,-32		,-32		,-32		,-32		,-32		,-999		,-999		,-999		,-32	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,71		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-66		,-999		,-999		,-66		,-66		,-66		,-999		,-999		,-999		,-999		,-999		,-66		,-66		,-999		,-66		,-999		,-999		,-999		,-66		,-66		,-999		,-999		,-66		,-999		,-999		,-66		,-999		,-999		,-66		,-999		,-999		,-999		,-66		,-999		,-999		,-66		,-999		,-999		,-999		,-999		,-66		,-999		,-999		,-999		,-66		,-66		,-66		,-66		,-66		,-999		,-999		,-999		,-66	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,72		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,73		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,74		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,76		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-64		,-999		,-999		,-64		,-64		,-64		,-999		,-999		,-999		,-999		,-999		,-64		,-64		,-999		,-64		,-999		,-999		,-999		,-64		,-64		,-999		,-999		,-64		,-999		,-999		,-64		,-999		,-999		,-64		,-999		,-999		,-999		,-64		,-999		,-999		,-64		,-999		,-999		,-999		,-999		,-64		,-999		,-999		,-999		,-64		,-64		,-64		,-64		,-64		,-999		,-999		,-999		,-64	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,77		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,78		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,-999		,35		,16		,-999		,-999		,-999		,42		,19		,39		,30		,24		,-999		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,-999		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,80		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-63		,-999		,-999		,-63		,-63		,-63		,-999		,-999		,-999		,-999		,-999		,-63		,-63		,-999		,-63		,-999		,-999		,-999		,-63		,-63		,-999		,-999		,-63		,-999		,-999		,-63		,-999		,-999		,-63		,-999		,-999		,-999		,-63		,-999		,-999		,-63		,-999		,-999		,-999		,-999		,-63		,-999		,-999		,-999		,-63		,-63		,-63		,-63		,-63		,-999		,-999		,-999		,-63	},
-	{-999		,-69		,-999		,-999		,-69		,-69		,-69		,-999		,-999		,-999		,-999		,-999		,-69		,-69		,-999		,-69		,-999		,-999		,-999		,-69		,-69		,-999		,-999		,-69		,-999		,-999		,-69		,-999		,-999		,-69		,-999		,-999		,-999		,-69		,-999		,-999		,-69		,-999		,-999		,-999		,-999		,-69		,-999		,-999		,-999		,-69		,-69		,-69		,-69		,-69		,-999		,-999		,-999		,-69	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,81		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,82		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,-999		,35		,16		,-999		,-999		,-999		,42		,19		,39		,30		,24		,-999		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,-999		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,-999	},
-	{27		,-999		,35		,16		,-999		,-999		,-999		,42		,19		,39		,30		,24		,-999		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,-999		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,-999	},
-	{-999		,-62		,-999		,-999		,-62		,-62		,-62		,-999		,-999		,-999		,-999		,-999		,-62		,-62		,-999		,-62		,-999		,-999		,-999		,-62		,-62		,-999		,-999		,-62		,-999		,-999		,-62		,-999		,-999		,-62		,-999		,-999		,-999		,-62		,-999		,-999		,-62		,-999		,-999		,-999		,-999		,-62		,-999		,-999		,-999		,-62		,-62		,-62		,-62		,-62		,-999		,-999		,-999		,-62	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,85		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,86		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-65		,-999		,-999		,-65		,-65		,-65		,-999		,-999		,-999		,-999		,-999		,-65		,-65		,-999		,-65		,-999		,-999		,-999		,-65		,-65		,-999		,-999		,-65		,-999		,-999		,-65		,-999		,-999		,-65		,-999		,-999		,-999		,-65		,-999		,-999		,-65		,-999		,-999		,-999		,-999		,-65		,-999		,-999		,-999		,-65		,-65		,-65		,-65		,-65		,-999		,-999		,-999		,-65	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,88		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,89		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,91		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,-999		,35		,16		,-999		,-999		,-999		,42		,19		,39		,30		,24		,-999		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,-999		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,94		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,95		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-68		,-999		,-999		,-68		,-68		,-68		,-999		,-999		,-999		,-999		,-999		,-68		,-68		,-999		,-68		,-999		,-999		,-999		,-68		,-68		,-999		,-999		,-68		,-999		,-999		,-68		,-999		,-999		,-68		,-999		,-999		,-999		,-68		,-999		,-999		,-68		,-999		,-999		,-999		,-999		,-68		,-999		,-999		,-999		,-68		,-68		,-68		,-68		,-68		,-999		,-999		,-999		,-68	},
-	{27		,-999		,35		,16		,-999		,-999		,-999		,42		,19		,39		,30		,24		,-999		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,-999		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,98		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,99		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-67		,-999		,-999		,-67		,-67		,-67		,-999		,-999		,-999		,-999		,-999		,-67		,-67		,-999		,-67		,-999		,-999		,-999		,-67		,-67		,-999		,-999		,-67		,-999		,-999		,-67		,-999		,-999		,-67		,-999		,-999		,-999		,-67		,-999		,-999		,-67		,-999		,-999		,-999		,-999		,-67		,-999		,-999		,-999		,-67		,-67		,-67		,-67		,-67		,-999		,-999		,-999		,-67	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,123		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-36		,-999		,-999		,-36		,-36		,-36		,-999		,-999		,-999		,-999		,-999		,-36		,-36		,-999		,-36		,-999		,-999		,-999		,-36		,-36		,-999		,-999		,-36		,-999		,-999		,-36		,-999		,-999		,-36		,-999		,-999		,-999		,-36		,-999		,-999		,-36		,-999		,-999		,-999		,-999		,-36		,-999		,-999		,-999		,-36		,-36		,-36		,-36		,-36		,-999		,-999		,-999		,-36	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-34		,-999		,-999		,-34		,-34		,-34		,-999		,-999		,-999		,-999		,-999		,-34		,-34		,-999		,-34		,-999		,-999		,-999		,-34		,-34		,-999		,-999		,-34		,-999		,-999		,-34		,-999		,-999		,-34		,-999		,-999		,-999		,-34		,-999		,-999		,-34		,-999		,-999		,-999		,-999		,-34		,-999		,-999		,-999		,-34		,-34		,-34		,-34		,-34		,-999		,-999		,-999		,-34	},
-	{-999		,-33		,-999		,-999		,-33		,-33		,-33		,-999		,-999		,-999		,-999		,-999		,-33		,-33		,-999		,-33		,-999		,-999		,-999		,-33		,-33		,-999		,-999		,-33		,-999		,-999		,-33		,-999		,-999		,-33		,-999		,-999		,-999		,-33		,-999		,-999		,-33		,-999		,-999		,-999		,-999		,-33		,-999		,-999		,-999		,-33		,-33		,-33		,-33		,-33		,-999		,-999		,-999		,-33	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-35		,-999		,-999		,-35		,-35		,-35		,-999		,-999		,-999		,-999		,-999		,-35		,-35		,-999		,-35		,-999		,-999		,-999		,-35		,-35		,-999		,-999		,-35		,-999		,-999		,-35		,-999		,-999		,-35		,-999		,-999		,-999		,-35		,-999		,-999		,-35		,-999		,-999		,-999		,-999		,-35		,-999		,-999		,-999		,-35		,-35		,-35		,-35		,-35		,-999		,-999		,-999		,-35	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-37		,-999		,-999		,-37		,-37		,-37		,-999		,-999		,-999		,-999		,-999		,-37		,-37		,-999		,-37		,-999		,-999		,-999		,-37		,-37		,-999		,-999		,-37		,-999		,-999		,-37		,-999		,-999		,-37		,-999		,-999		,-999		,-37		,-999		,-999		,-37		,-999		,-999		,-999		,-999		,-37		,-999		,-999		,-999		,-37		,-37		,-37		,-37		,-37		,-999		,-999		,-999		,-37	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,-999		,55		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,54		,-999		,-999		,53		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-3		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-3		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,-7		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,56		,-7		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,57		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-9		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-9		,-9		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-11		,-11		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-15		,-999		,-15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-15		,-15		,-999		,-999		,-15		,-999		,-999		,-15		,-999		,-999		,-15		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-999		,-15		,-15		,-999		,-15		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-17		,-999		,-17		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-17		,-17		,-999		,-999		,-17		,-999		,-999		,-17		,-999		,-999		,-17		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-999		,-17		,-17		,-999		,-17		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-18		,-999		,-18		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-18		,-18		,-999		,-999		,-18		,-999		,-999		,-18		,-999		,-999		,-18		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-999		,-18		,-18		,-999		,-18		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-14		,-999		,-14		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-14		,-14		,-999		,-999		,-14		,-999		,-999		,-14		,-999		,-999		,-14		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-999		,-14		,-14		,-999		,-14		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-19		,-999		,-19		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-19		,-19		,-999		,-999		,-19		,-999		,-999		,-19		,-999		,-999		,-19		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-999		,-19		,-19		,-999		,-19		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-16		,-999		,-16		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-16		,-16		,-999		,-999		,-16		,-999		,-999		,-16		,-999		,-999		,-16		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-999		,-16		,-16		,-999		,-16		,-999		,-999		,-999		,-999	},
-	{-999		,66		,-999		,-999		,-22		,-22		,-22		,-999		,-999		,-999		,-999		,-999		,67		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-22		,-999		,-999		,-22		,-999		,-999		,-22		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-22		,-999		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-22		,-22		,-999		,-22		,-999		,-999		,-999		,-999	},
-	{-999		,66		,-999		,-999		,-23		,-23		,-23		,-999		,-999		,-999		,-999		,-999		,67		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-23		,-999		,-999		,-23		,-999		,-999		,-23		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-23		,-999		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-23		,-23		,-999		,-23		,-999		,-999		,-999		,-999	},
-	{-999		,-25		,-999		,-999		,-25		,-25		,-25		,-999		,-999		,-999		,-999		,-999		,-25		,68		,-999		,-25		,-999		,-999		,-999		,-25		,-25		,-999		,-999		,-25		,-999		,-999		,-25		,-999		,-999		,-25		,-999		,-999		,-999		,-25		,-999		,-999		,-25		,-999		,-999		,-999		,-999		,-25		,-999		,-999		,-999		,-25		,-25		,-25		,70		,-25		,-999		,-999		,-999		,69	},
-	{-999		,-26		,-999		,-999		,-26		,-26		,-26		,-999		,-999		,-999		,-999		,-999		,-26		,68		,-999		,-26		,-999		,-999		,-999		,-26		,-26		,-999		,-999		,-26		,-999		,-999		,-26		,-999		,-999		,-26		,-999		,-999		,-999		,-26		,-999		,-999		,-26		,-999		,-999		,-999		,-999		,-26		,-999		,-999		,-999		,-26		,-26		,-26		,70		,-26		,-999		,-999		,-999		,69	},
-	{-999		,-28		,-999		,-999		,-28		,-28		,-28		,-999		,-999		,-999		,-999		,-999		,-28		,-28		,-999		,-28		,-999		,-999		,-999		,-28		,-28		,-999		,-999		,-28		,-999		,-999		,-28		,-999		,-999		,-28		,-999		,-999		,-999		,-28		,-999		,-999		,-28		,-999		,-999		,-999		,-999		,-28		,-999		,-999		,-999		,-28		,-28		,-28		,-28		,-28		,-999		,-999		,-999		,-28	},
-	{-999		,-30		,-999		,-999		,-30		,-30		,-30		,-999		,-999		,-999		,-999		,-999		,-30		,-30		,-999		,-30		,-999		,-999		,-999		,-30		,-30		,-999		,-999		,-30		,-999		,-999		,-30		,-999		,-999		,-30		,-999		,-999		,-999		,-30		,-999		,-999		,-30		,-999		,-999		,-999		,-999		,-30		,-999		,-999		,-999		,-30		,-30		,-30		,-30		,-30		,-999		,-999		,-999		,-30	},
-	{-999		,-29		,-999		,-999		,-29		,-29		,-29		,-999		,-999		,-999		,-999		,-999		,-29		,-29		,-999		,-29		,-999		,-999		,-999		,-29		,-29		,-999		,-999		,-29		,-999		,-999		,-29		,-999		,-999		,-29		,-999		,-999		,-999		,-29		,-999		,-999		,-29		,-999		,-999		,-999		,-999		,-29		,-999		,-999		,-999		,-29		,-29		,-29		,-29		,-29		,-999		,-999		,-999		,-29	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,143		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,144		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,145		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,146		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-61		,-999		,-999		,-61		,-61		,-61		,-999		,-999		,-999		,-999		,-999		,-61		,-61		,-999		,-61		,-999		,-999		,-999		,-61		,-61		,-999		,-999		,-61		,-999		,-999		,-61		,-999		,-999		,-61		,-999		,-999		,-999		,-61		,-999		,-999		,-61		,-999		,-999		,-999		,-999		,-61		,-999		,-999		,-999		,-61		,-61		,-61		,-61		,-61		,-999		,-999		,-999		,-61	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,147		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,148		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,149		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,150		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,151		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,152		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,153		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,154		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,155		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,156		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,157		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,158		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,159		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,160		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,161		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,162		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,163		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,164		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,165		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-48		,-999		,-999		,-48		,-48		,-48		,-999		,-999		,-999		,-999		,-999		,-48		,-48		,-999		,-48		,-999		,-999		,-999		,-48		,-48		,-999		,-999		,-48		,-999		,-999		,-48		,-999		,-999		,-48		,-999		,-999		,-999		,-48		,-999		,-999		,-48		,-999		,-999		,-999		,-999		,-48		,-999		,-999		,-999		,-48		,-48		,-48		,-48		,-48		,-999		,-999		,-999		,-48	},
-	{-999		,-40		,-999		,-999		,-40		,-40		,-40		,-999		,-999		,-999		,-999		,-999		,-40		,-40		,-999		,-40		,-999		,-999		,-999		,-40		,-40		,-999		,-999		,-40		,-999		,-999		,-40		,-999		,-999		,-40		,-999		,-999		,-999		,-40		,-999		,-999		,-40		,-999		,-999		,-999		,-999		,-40		,-999		,-999		,-999		,-40		,-40		,-40		,-40		,-40		,-999		,-999		,-999		,-40	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-45		,-999		,-999		,-45		,-45		,-45		,-999		,-999		,-999		,-999		,-999		,-45		,-45		,-999		,-45		,-999		,-999		,-999		,-45		,-45		,-999		,-999		,-45		,-999		,-999		,-45		,-999		,-999		,-45		,-999		,-999		,-999		,-45		,-999		,-999		,-45		,-999		,-999		,-999		,-999		,-45		,-999		,-999		,-999		,-45		,-45		,-45		,-45		,-45		,-999		,-999		,-999		,-45	},
-	{-999		,-50		,-999		,-999		,-50		,-50		,-50		,-999		,-999		,-999		,-999		,-999		,-50		,-50		,-999		,-50		,-999		,-999		,-999		,-50		,-50		,-999		,-999		,-50		,-999		,-999		,-50		,-999		,-999		,-50		,-999		,-999		,-999		,-50		,-999		,-999		,-50		,-999		,-999		,-999		,-999		,-50		,-999		,-999		,-999		,-50		,-50		,-50		,-50		,-50		,-999		,-999		,-999		,-50	},
-	{-999		,-38		,-999		,-999		,-38		,-38		,-38		,-999		,-999		,-999		,-999		,-999		,-38		,-38		,-999		,-38		,-999		,-999		,-999		,-38		,-38		,-999		,-999		,-38		,-999		,-999		,-38		,-999		,-999		,-38		,-999		,-999		,-999		,-38		,-999		,-999		,-38		,-999		,-999		,-999		,-999		,-38		,-999		,-999		,-999		,-38		,-38		,-38		,-38		,-38		,-999		,-999		,-999		,-38	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-44		,-999		,-999		,-44		,-44		,-44		,-999		,-999		,-999		,-999		,-999		,-44		,-44		,-999		,-44		,-999		,-999		,-999		,-44		,-44		,-999		,-999		,-44		,-999		,-999		,-44		,-999		,-999		,-44		,-999		,-999		,-999		,-44		,-999		,-999		,-44		,-999		,-999		,-999		,-999		,-44		,-999		,-999		,-999		,-44		,-44		,-44		,-44		,-44		,-999		,-999		,-999		,-44	},
-	{-999		,-41		,-999		,-999		,-41		,-41		,-41		,-999		,-999		,-999		,-999		,-999		,-41		,-41		,-999		,-41		,-999		,-999		,-999		,-41		,-41		,-999		,-999		,-41		,-999		,-999		,-41		,-999		,-999		,-41		,-999		,-999		,-999		,-41		,-999		,-999		,-41		,-999		,-999		,-999		,-999		,-41		,-999		,-999		,-999		,-41		,-41		,-41		,-41		,-41		,-999		,-999		,-999		,-41	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-46		,-999		,-999		,-46		,-46		,-46		,-999		,-999		,-999		,-999		,-999		,-46		,-46		,-999		,-46		,-999		,-999		,-999		,-46		,-46		,-999		,-999		,-46		,-999		,-999		,-46		,-999		,-999		,-46		,-999		,-999		,-999		,-46		,-999		,-999		,-46		,-999		,-999		,-999		,-999		,-46		,-999		,-999		,-999		,-46		,-46		,-46		,-46		,-46		,-999		,-999		,-999		,-46	},
-	{-999		,-42		,-999		,-999		,-42		,-42		,-42		,-999		,-999		,-999		,-999		,-999		,-42		,-42		,-999		,-42		,-999		,-999		,-999		,-42		,-42		,-999		,-999		,-42		,-999		,-999		,-42		,-999		,-999		,-42		,-999		,-999		,-999		,-42		,-999		,-999		,-42		,-999		,-999		,-999		,-999		,-42		,-999		,-999		,-999		,-42		,-42		,-42		,-42		,-42		,-999		,-999		,-999		,-42	},
-	{-999		,-43		,-999		,-999		,-43		,-43		,-43		,-999		,-999		,-999		,-999		,-999		,-43		,-43		,-999		,-43		,-999		,-999		,-999		,-43		,-43		,-999		,-999		,-43		,-999		,-999		,-43		,-999		,-999		,-43		,-999		,-999		,-999		,-43		,-999		,-999		,-43		,-999		,-999		,-999		,-999		,-43		,-999		,-999		,-999		,-43		,-43		,-43		,-43		,-43		,-999		,-999		,-999		,-43	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-54		,-999		,-999		,-54		,-54		,-54		,-999		,-999		,-999		,-999		,-999		,-54		,-54		,-999		,-54		,-999		,-999		,-999		,-54		,-54		,-999		,-999		,-54		,-999		,-999		,-54		,-999		,-999		,-54		,-999		,-999		,-999		,-54		,-999		,-999		,-54		,-999		,-999		,-999		,-999		,-54		,-999		,-999		,-999		,-54		,-54		,-54		,-54		,-54		,-999		,-999		,-999		,-54	},
-	{-999		,-39		,-999		,-999		,-39		,-39		,-39		,-999		,-999		,-999		,-999		,-999		,-39		,-39		,-999		,-39		,-999		,-999		,-999		,-39		,-39		,-999		,-999		,-39		,-999		,-999		,-39		,-999		,-999		,-39		,-999		,-999		,-999		,-39		,-999		,-999		,-39		,-999		,-999		,-999		,-999		,-39		,-999		,-999		,-999		,-39		,-39		,-39		,-39		,-39		,-999		,-999		,-999		,-39	},
-	{-999		,-47		,-999		,-999		,-47		,-47		,-47		,-999		,-999		,-999		,-999		,-999		,-47		,-47		,-999		,-47		,-999		,-999		,-999		,-47		,-47		,-999		,-999		,-47		,-999		,-999		,-47		,-999		,-999		,-47		,-999		,-999		,-999		,-47		,-999		,-999		,-47		,-999		,-999		,-999		,-999		,-47		,-999		,-999		,-999		,-47		,-47		,-47		,-47		,-47		,-999		,-999		,-999		,-47	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-52		,-999		,-999		,-52		,-52		,-52		,-999		,-999		,-999		,-999		,-999		,-52		,-52		,-999		,-52		,-999		,-999		,-999		,-52		,-52		,-999		,-999		,-52		,-999		,-999		,-52		,-999		,-999		,-52		,-999		,-999		,-999		,-52		,-999		,-999		,-52		,-999		,-999		,-999		,-999		,-52		,-999		,-999		,-999		,-52		,-52		,-52		,-52		,-52		,-999		,-999		,-999		,-52	},
-	{-999		,-49		,-999		,-999		,-49		,-49		,-49		,-999		,-999		,-999		,-999		,-999		,-49		,-49		,-999		,-49		,-999		,-999		,-999		,-49		,-49		,-999		,-999		,-49		,-999		,-999		,-49		,-999		,-999		,-49		,-999		,-999		,-999		,-49		,-999		,-999		,-49		,-999		,-999		,-999		,-999		,-49		,-999		,-999		,-999		,-49		,-49		,-49		,-49		,-49		,-999		,-999		,-999		,-49	},
-	{-999		,-51		,-999		,-999		,-51		,-51		,-51		,-999		,-999		,-999		,-999		,-999		,-51		,-51		,-999		,-51		,-999		,-999		,-999		,-51		,-51		,-999		,-999		,-51		,-999		,-999		,-51		,-999		,-999		,-51		,-999		,-999		,-999		,-51		,-999		,-999		,-51		,-999		,-999		,-999		,-999		,-51		,-999		,-999		,-999		,-51		,-51		,-51		,-51		,-51		,-999		,-999		,-999		,-51	},
-	{-999		,-53		,-999		,-999		,-53		,-53		,-53		,-999		,-999		,-999		,-999		,-999		,-53		,-53		,-999		,-53		,-999		,-999		,-999		,-53		,-53		,-999		,-999		,-53		,-999		,-999		,-53		,-999		,-999		,-53		,-999		,-999		,-999		,-53		,-999		,-999		,-53		,-999		,-999		,-999		,-999		,-53		,-999		,-999		,-999		,-53		,-53		,-53		,-53		,-53		,-999		,-999		,-999		,-53	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,172		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,173		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,174		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,175		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,176		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,177		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-55		,-999		,-999		,-55		,-55		,-55		,-999		,-999		,-999		,-999		,-999		,-55		,-55		,-999		,-55		,-999		,-999		,-999		,-55		,-55		,-999		,-999		,-55		,-999		,-999		,-55		,-999		,-999		,-55		,-999		,-999		,-999		,-55		,-999		,-999		,-55		,-999		,-999		,-999		,-999		,-55		,-999		,-999		,-999		,-55		,-55		,-55		,-55		,-55		,-999		,-999		,-999		,-55	},
-	{-999		,-56		,-999		,-999		,-56		,-56		,-56		,-999		,-999		,-999		,-999		,-999		,-56		,-56		,-999		,-56		,-999		,-999		,-999		,-56		,-56		,-999		,-999		,-56		,-999		,-999		,-56		,-999		,-999		,-56		,-999		,-999		,-999		,-56		,-999		,-999		,-56		,-999		,-999		,-999		,-999		,-56		,-999		,-999		,-999		,-56		,-56		,-56		,-56		,-56		,-999		,-999		,-999		,-56	},
-	{27		,32		,35		,16		,48		,-999		,-999		,42		,19		,39		,30		,24		,33		,-999		,29		,-999		,18		,25		,52		,-999		,-999		,49		,41		,-999		,37		,40		,-999		,36		,47		,-999		,17		,50		,23		,-999		,51		,46		,-999		,22		,38		,45		,21		,-999		,28		,43		,20		,-999		,-999		,-999		,-999		,-999		,31		,44		,34		,26	},
-	{-999		,-58		,-999		,-999		,-58		,-58		,-58		,-999		,-999		,-999		,-999		,-999		,-58		,-58		,-999		,-58		,-999		,-999		,-999		,-58		,-58		,-999		,-999		,-58		,-999		,-999		,-58		,-999		,-999		,-58		,-999		,-999		,-999		,-58		,-999		,-999		,-58		,-999		,-999		,-999		,-999		,-58		,-999		,-999		,-999		,-58		,-58		,-58		,-58		,-58		,-999		,-999		,-999		,-58	},
-	{-999		,-59		,-999		,-999		,-59		,-59		,-59		,-999		,-999		,-999		,-999		,-999		,-59		,-59		,-999		,-59		,-999		,-999		,-999		,-59		,-59		,-999		,-999		,-59		,-999		,-999		,-59		,-999		,-999		,-59		,-999		,-999		,-999		,-59		,-999		,-999		,-59		,-999		,-999		,-999		,-999		,-59		,-999		,-999		,-999		,-59		,-59		,-59		,-59		,-59		,-999		,-999		,-999		,-59	},
-	{-999		,-57		,-999		,-999		,-57		,-57		,-57		,-999		,-999		,-999		,-999		,-999		,-57		,-57		,-999		,-57		,-999		,-999		,-999		,-57		,-57		,-999		,-999		,-57		,-999		,-999		,-57		,-999		,-999		,-57		,-999		,-999		,-999		,-57		,-999		,-999		,-57		,-999		,-999		,-999		,-999		,-57		,-999		,-999		,-999		,-57		,-57		,-57		,-57		,-57		,-999		,-999		,-999		,-57	},
-	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,179		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
-	{-999		,-60		,-999		,-999		,-60		,-60		,-60		,-999		,-999		,-999		,-999		,-999		,-60		,-60		,-999		,-60		,-999		,-999		,-999		,-60		,-60		,-999		,-999		,-60		,-999		,-999		,-60		,-999		,-999		,-60		,-999		,-999		,-999		,-60		,-999		,-999		,-60		,-999		,-999		,-999		,-999		,-60		,-999		,-999		,-999		,-60		,-60		,-60		,-60		,-60		,-999		,-999		,-999		,-60	}
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-1		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,61		,-999		,-999		,-999		,-999		,-2		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-2		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,60		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-6		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-6		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-8		,63		,-999		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,-8		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-8		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-10		,-10		,-999		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-10		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,64		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-10		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-12		,-12		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-12		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-12		,-999	},
+	{-999		,-999		,65		,-999		,-999		,-999		,-999		,-999		,-999		,70		,-999		,-999		,-999		,-999		,-13		,-13		,-999		,-999		,-999		,-13		,68		,-999		,-999		,-999		,-13		,-999		,-999		,-999		,-999		,-13		,-999		,-999		,69		,-999		,-999		,-999		,67		,-999		,-999		,-999		,-13		,-999		,-999		,-999		,66		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-13		,-999	},
+	{-999		,-999		,-20		,-999		,-999		,-999		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-999		,-20		,-20		,-999		,-999		,-999		,-20		,-20		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-999		,-20		,-999		,-999		,-20		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-20		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-20		,-999	},
+	{-999		,-999		,-21		,-999		,-999		,-999		,-999		,-999		,-999		,-21		,-999		,72		,-999		,-999		,-21		,-21		,-999		,-999		,-999		,-21		,-21		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-999		,-21		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-999		,71		,-999		,-999		,-999		,-21		,-999		,-999		,-999		,-999		,-999		,-21		,-999	},
+	{-999		,74		,-24		,73		,-999		,-999		,-999		,-999		,-999		,-24		,-999		,-24		,-999		,-999		,-24		,-24		,-999		,-999		,-999		,-24		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-999		,-24		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-24		,-999		,-999		,-999		,-999		,-999		,-24		,-999	},
+	{-999		,-27		,-27		,-27		,-999		,-999		,-999		,-999		,-999		,-27		,-999		,-27		,-999		,76		,-27		,-27		,-999		,-999		,-999		,-27		,-27		,-999		,-999		,-999		,-27		,-999		,-999		,-999		,-999		,-27		,-999		,-999		,-27		,-999		,-999		,-999		,-27		,77		,-999		,-999		,-27		,-999		,-999		,-999		,-27		,-999		,-999		,-999		,75		,-27		,-999		,-999		,-999		,-27		,-999		,-999		,-999		,-999		,-999		,-27		,-999	},
+	{-999		,-31		,-31		,-31		,-999		,-999		,-999		,-999		,-999		,-31		,-999		,-31		,-999		,-31		,-31		,-31		,-999		,-999		,-999		,-31		,-31		,-999		,-999		,-999		,-31		,-999		,-999		,-999		,-999		,-31		,-999		,-999		,-31		,-999		,-999		,-999		,-31		,-31		,-999		,-999		,-31		,-999		,-999		,-999		,-31		,-999		,-999		,-999		,-31		,-31		,-999		,-999		,-999		,-31		,-999		,-999		,-999		,-999		,-999		,-31		,-999	},
+	{-999		,-32		,-32		,-32		,-999		,-999		,-999		,-999		,-999		,-32		,-999		,-32		,-999		,-32		,-32		,-32		,-999		,-999		,-999		,-32		,-32		,-999		,-999		,-999		,-32		,-999		,-999		,-999		,-999		,-32		,-999		,-999		,-32		,-999		,-999		,-999		,-32		,-32		,-999		,-999		,-32		,-999		,-999		,-999		,-32		,-999		,-999		,-999		,-32		,-32		,-999		,-999		,-999		,-32		,-999		,-999		,-999		,-999		,-999		,-32		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,78		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,79		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-73		,-73		,-73		,-999		,-999		,-999		,-999		,-999		,-73		,-999		,-73		,-999		,-73		,-73		,-73		,-999		,-999		,-999		,-73		,-73		,-999		,-999		,-999		,-73		,-999		,-999		,-999		,-999		,-73		,-999		,-999		,-73		,-999		,-999		,-999		,-73		,-73		,-999		,-999		,-73		,-999		,-999		,-999		,-73		,-999		,-999		,-999		,-73		,-73		,-999		,-999		,-999		,-73		,-999		,-999		,-999		,-999		,-999		,-73		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,80		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,81		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,82		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,83		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,84		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-70		,-70		,-70		,-999		,-999		,-999		,-999		,-999		,-70		,-999		,-70		,-999		,-70		,-70		,-70		,-999		,-999		,-999		,-70		,-70		,-999		,-999		,-999		,-70		,-999		,-999		,-999		,-999		,-70		,-999		,-999		,-70		,-999		,-999		,-999		,-70		,-70		,-999		,-999		,-70		,-999		,-999		,-999		,-70		,-999		,-999		,-999		,-70		,-70		,-999		,-999		,-999		,-70		,-999		,-999		,-999		,-999		,-999		,-70		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,85		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-69		,-69		,-69		,-999		,-999		,-999		,-999		,-999		,-69		,-999		,-69		,-999		,-69		,-69		,-69		,-999		,-999		,-999		,-69		,-69		,-999		,-999		,-999		,-69		,-999		,-999		,-999		,-999		,-69		,-999		,-999		,-69		,-999		,-999		,-999		,-69		,-69		,-999		,-999		,-69		,-999		,-999		,-999		,-69		,-999		,-999		,-999		,-69		,-69		,-999		,-999		,-999		,-69		,-999		,-999		,-999		,-999		,-999		,-69		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,86		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-74		,-74		,-74		,-999		,-999		,-999		,-999		,-999		,-74		,-999		,-74		,-999		,-74		,-74		,-74		,-999		,-999		,-999		,-74		,-74		,-999		,-999		,-999		,-74		,-999		,-999		,-999		,-999		,-74		,-999		,-999		,-74		,-999		,-999		,-999		,-74		,-74		,-999		,-999		,-74		,-999		,-999		,-999		,-74		,-999		,-999		,-999		,-74		,-74		,-999		,-999		,-999		,-74		,-999		,-999		,-999		,-999		,-999		,-74		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,87		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,88		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,89		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,90		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-71		,-71		,-71		,-999		,-999		,-999		,-999		,-999		,-71		,-999		,-71		,-999		,-71		,-71		,-71		,-999		,-999		,-999		,-71		,-71		,-999		,-999		,-999		,-71		,-999		,-999		,-999		,-999		,-71		,-999		,-999		,-71		,-999		,-999		,-999		,-71		,-71		,-999		,-999		,-71		,-999		,-999		,-999		,-71		,-999		,-999		,-999		,-71		,-71		,-999		,-999		,-999		,-71		,-999		,-999		,-999		,-999		,-999		,-71		,-999	},
+	{-999		,-75		,-75		,-75		,-999		,-999		,-999		,-999		,-999		,-75		,-999		,-75		,-999		,-75		,-75		,-75		,-999		,-999		,-999		,-75		,-75		,-999		,-999		,-999		,-75		,-999		,-999		,-999		,-999		,-75		,-999		,-999		,-75		,-999		,-999		,-999		,-75		,-75		,-999		,-999		,-75		,-999		,-999		,-999		,-75		,-999		,-999		,-999		,-75		,-75		,-999		,-999		,-999		,-75		,-999		,-999		,-999		,-999		,-999		,-75		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,91		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,93		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,94		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,95		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,96		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-76		,-76		,-76		,-999		,-999		,-999		,-999		,-999		,-76		,-999		,-76		,-999		,-76		,-76		,-76		,-999		,-999		,-999		,-76		,-76		,-999		,-999		,-999		,-76		,-999		,-999		,-999		,-999		,-76		,-999		,-999		,-76		,-999		,-999		,-999		,-76		,-76		,-999		,-999		,-76		,-999		,-999		,-999		,-76		,-999		,-999		,-999		,-76		,-76		,-999		,-999		,-999		,-76		,-999		,-999		,-999		,-999		,-999		,-76		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,97		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-72		,-72		,-72		,-999		,-999		,-999		,-999		,-999		,-72		,-999		,-72		,-999		,-72		,-72		,-72		,-999		,-999		,-999		,-72		,-72		,-999		,-999		,-999		,-72		,-999		,-999		,-999		,-999		,-72		,-999		,-999		,-72		,-999		,-999		,-999		,-72		,-72		,-999		,-999		,-72		,-999		,-999		,-999		,-72		,-999		,-999		,-999		,-72		,-72		,-999		,-999		,-999		,-72		,-999		,-999		,-999		,-999		,-999		,-72		,-999	},
+	{27		,-999		,-999		,-999		,56		,-999		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,-999		,48		,38		,-999		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,99		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,100		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,101		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,102		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,-999		,-999		,-999		,56		,-999		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,-999		,48		,38		,-999		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,104		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,105		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,-999		,-999		,-999		,56		,-999		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,-999		,48		,38		,-999		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,107		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,108		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,109		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,110		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,-999		,-999		,-999		,56		,-999		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,-999		,48		,38		,-999		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,-999		,-999		,-999		,56		,-999		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,-999		,48		,38		,-999		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,113		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,147		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-33		,-33		,-33		,-999		,-999		,-999		,-999		,-999		,-33		,-999		,-33		,-999		,-33		,-33		,-33		,-999		,-999		,-999		,-33		,-33		,-999		,-999		,-999		,-33		,-999		,-999		,-999		,-999		,-33		,-999		,-999		,-33		,-999		,-999		,-999		,-33		,-33		,-999		,-999		,-33		,-999		,-999		,-999		,-33		,-999		,-999		,-999		,-33		,-33		,-999		,-999		,-999		,-33		,-999		,-999		,-999		,-999		,-999		,-33		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-37		,-37		,-37		,-999		,-999		,-999		,-999		,-999		,-37		,-999		,-37		,-999		,-37		,-37		,-37		,-999		,-999		,-999		,-37		,-37		,-999		,-999		,-999		,-37		,-999		,-999		,-999		,-999		,-37		,-999		,-999		,-37		,-999		,-999		,-999		,-37		,-37		,-999		,-999		,-37		,-999		,-999		,-999		,-37		,-999		,-999		,-999		,-37		,-37		,-999		,-999		,-999		,-37		,-999		,-999		,-999		,-999		,-999		,-37		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-35		,-35		,-35		,-999		,-999		,-999		,-999		,-999		,-35		,-999		,-35		,-999		,-35		,-35		,-35		,-999		,-999		,-999		,-35		,-35		,-999		,-999		,-999		,-35		,-999		,-999		,-999		,-999		,-35		,-999		,-999		,-35		,-999		,-999		,-999		,-35		,-35		,-999		,-999		,-35		,-999		,-999		,-999		,-35		,-999		,-999		,-999		,-35		,-35		,-999		,-999		,-999		,-35		,-999		,-999		,-999		,-999		,-999		,-35		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-34		,-34		,-34		,-999		,-999		,-999		,-999		,-999		,-34		,-999		,-34		,-999		,-34		,-34		,-34		,-999		,-999		,-999		,-34		,-34		,-999		,-999		,-999		,-34		,-999		,-999		,-999		,-999		,-34		,-999		,-999		,-34		,-999		,-999		,-999		,-34		,-34		,-999		,-999		,-34		,-999		,-999		,-999		,-34		,-999		,-999		,-999		,-34		,-34		,-999		,-999		,-999		,-34		,-999		,-999		,-999		,-999		,-999		,-34		,-999	},
+	{-999		,-36		,-36		,-36		,-999		,-999		,-999		,-999		,-999		,-36		,-999		,-36		,-999		,-36		,-36		,-36		,-999		,-999		,-999		,-36		,-36		,-999		,-999		,-999		,-36		,-999		,-999		,-999		,-999		,-36		,-999		,-999		,-36		,-999		,-999		,-999		,-36		,-36		,-999		,-999		,-36		,-999		,-999		,-999		,-36		,-999		,-999		,-999		,-36		,-36		,-999		,-999		,-999		,-36		,-999		,-999		,-999		,-999		,-999		,-36		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,62		,-999		,-999		,-999		,-999		,-5		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-5		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,61		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,60		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999		,-999		,-999		,-999		,-3		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-3		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-4		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-7		,63		,-999		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,-7		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-7		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-9		,-9		,-999		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-9		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,64		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-9		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-11		,-11		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-11		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-11		,-999	},
+	{-999		,-999		,-17		,-999		,-999		,-999		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-999		,-17		,-17		,-999		,-999		,-999		,-17		,-17		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-999		,-17		,-999		,-999		,-17		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-17		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-17		,-999	},
+	{-999		,-999		,-19		,-999		,-999		,-999		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-999		,-19		,-19		,-999		,-999		,-999		,-19		,-19		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-999		,-19		,-999		,-999		,-19		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-19		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-19		,-999	},
+	{-999		,-999		,-18		,-999		,-999		,-999		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-999		,-18		,-18		,-999		,-999		,-999		,-18		,-18		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-999		,-18		,-999		,-999		,-18		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-18		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-18		,-999	},
+	{-999		,-999		,-14		,-999		,-999		,-999		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-999		,-14		,-14		,-999		,-999		,-999		,-14		,-14		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-999		,-14		,-999		,-999		,-14		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-14		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-14		,-999	},
+	{-999		,-999		,-16		,-999		,-999		,-999		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-999		,-16		,-16		,-999		,-999		,-999		,-16		,-16		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-999		,-16		,-999		,-999		,-16		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-16		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-16		,-999	},
+	{-999		,-999		,-15		,-999		,-999		,-999		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-999		,-15		,-15		,-999		,-999		,-999		,-15		,-15		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-999		,-15		,-999		,-999		,-15		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-15		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-15		,-999	},
+	{-999		,74		,-23		,73		,-999		,-999		,-999		,-999		,-999		,-23		,-999		,-23		,-999		,-999		,-23		,-23		,-999		,-999		,-999		,-23		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-999		,-23		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-23		,-999		,-999		,-999		,-999		,-999		,-23		,-999	},
+	{-999		,74		,-22		,73		,-999		,-999		,-999		,-999		,-999		,-22		,-999		,-22		,-999		,-999		,-22		,-22		,-999		,-999		,-999		,-22		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-999		,-22		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-22		,-999		,-999		,-999		,-999		,-999		,-22		,-999	},
+	{-999		,-26		,-26		,-26		,-999		,-999		,-999		,-999		,-999		,-26		,-999		,-26		,-999		,76		,-26		,-26		,-999		,-999		,-999		,-26		,-26		,-999		,-999		,-999		,-26		,-999		,-999		,-999		,-999		,-26		,-999		,-999		,-26		,-999		,-999		,-999		,-26		,77		,-999		,-999		,-26		,-999		,-999		,-999		,-26		,-999		,-999		,-999		,75		,-26		,-999		,-999		,-999		,-26		,-999		,-999		,-999		,-999		,-999		,-26		,-999	},
+	{-999		,-25		,-25		,-25		,-999		,-999		,-999		,-999		,-999		,-25		,-999		,-25		,-999		,76		,-25		,-25		,-999		,-999		,-999		,-25		,-25		,-999		,-999		,-999		,-25		,-999		,-999		,-999		,-999		,-25		,-999		,-999		,-25		,-999		,-999		,-999		,-25		,77		,-999		,-999		,-25		,-999		,-999		,-999		,-25		,-999		,-999		,-999		,75		,-25		,-999		,-999		,-999		,-25		,-999		,-999		,-999		,-999		,-999		,-25		,-999	},
+	{-999		,-28		,-28		,-28		,-999		,-999		,-999		,-999		,-999		,-28		,-999		,-28		,-999		,-28		,-28		,-28		,-999		,-999		,-999		,-28		,-28		,-999		,-999		,-999		,-28		,-999		,-999		,-999		,-999		,-28		,-999		,-999		,-28		,-999		,-999		,-999		,-28		,-28		,-999		,-999		,-28		,-999		,-999		,-999		,-28		,-999		,-999		,-999		,-28		,-28		,-999		,-999		,-999		,-28		,-999		,-999		,-999		,-999		,-999		,-28		,-999	},
+	{-999		,-29		,-29		,-29		,-999		,-999		,-999		,-999		,-999		,-29		,-999		,-29		,-999		,-29		,-29		,-29		,-999		,-999		,-999		,-29		,-29		,-999		,-999		,-999		,-29		,-999		,-999		,-999		,-999		,-29		,-999		,-999		,-29		,-999		,-999		,-999		,-29		,-29		,-999		,-999		,-29		,-999		,-999		,-999		,-29		,-999		,-999		,-999		,-29		,-29		,-999		,-999		,-999		,-29		,-999		,-999		,-999		,-999		,-999		,-29		,-999	},
+	{-999		,-30		,-30		,-30		,-999		,-999		,-999		,-999		,-999		,-30		,-999		,-30		,-999		,-30		,-30		,-30		,-999		,-999		,-999		,-30		,-30		,-999		,-999		,-999		,-30		,-999		,-999		,-999		,-999		,-30		,-999		,-999		,-30		,-999		,-999		,-999		,-30		,-30		,-999		,-999		,-30		,-999		,-999		,-999		,-30		,-999		,-999		,-999		,-30		,-30		,-999		,-999		,-999		,-30		,-999		,-999		,-999		,-999		,-999		,-30		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,164		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,165		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,166		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,167		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,168		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,169		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,170		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,171		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,172		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,173		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,174		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,175		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,176		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,177		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-68		,-68		,-68		,-999		,-999		,-999		,-999		,-999		,-68		,-999		,-68		,-999		,-68		,-68		,-68		,-999		,-999		,-999		,-68		,-68		,-999		,-999		,-999		,-68		,-999		,-999		,-999		,-999		,-68		,-999		,-999		,-68		,-999		,-999		,-999		,-68		,-68		,-999		,-999		,-68		,-999		,-999		,-999		,-68		,-999		,-999		,-999		,-68		,-68		,-999		,-999		,-999		,-68		,-999		,-999		,-999		,-999		,-999		,-68		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,178		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,179		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,180		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,181		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,182		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,183		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,184		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,185		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,186		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,187		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,188		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,189		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,190		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,191		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,192		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,193		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-45		,-45		,-45		,-999		,-999		,-999		,-999		,-999		,-45		,-999		,-45		,-999		,-45		,-45		,-45		,-999		,-999		,-999		,-45		,-45		,-999		,-999		,-999		,-45		,-999		,-999		,-999		,-999		,-45		,-999		,-999		,-45		,-999		,-999		,-999		,-45		,-45		,-999		,-999		,-45		,-999		,-999		,-999		,-45		,-999		,-999		,-999		,-45		,-45		,-999		,-999		,-999		,-45		,-999		,-999		,-999		,-999		,-999		,-45		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-49		,-49		,-49		,-999		,-999		,-999		,-999		,-999		,-49		,-999		,-49		,-999		,-49		,-49		,-49		,-999		,-999		,-999		,-49		,-49		,-999		,-999		,-999		,-49		,-999		,-999		,-999		,-999		,-49		,-999		,-999		,-49		,-999		,-999		,-999		,-49		,-49		,-999		,-999		,-49		,-999		,-999		,-999		,-49		,-999		,-999		,-999		,-49		,-49		,-999		,-999		,-999		,-49		,-999		,-999		,-999		,-999		,-999		,-49		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-40		,-40		,-40		,-999		,-999		,-999		,-999		,-999		,-40		,-999		,-40		,-999		,-40		,-40		,-40		,-999		,-999		,-999		,-40		,-40		,-999		,-999		,-999		,-40		,-999		,-999		,-999		,-999		,-40		,-999		,-999		,-40		,-999		,-999		,-999		,-40		,-40		,-999		,-999		,-40		,-999		,-999		,-999		,-40		,-999		,-999		,-999		,-40		,-40		,-999		,-999		,-999		,-40		,-999		,-999		,-999		,-999		,-999		,-40		,-999	},
+	{-999		,-47		,-47		,-47		,-999		,-999		,-999		,-999		,-999		,-47		,-999		,-47		,-999		,-47		,-47		,-47		,-999		,-999		,-999		,-47		,-47		,-999		,-999		,-999		,-47		,-999		,-999		,-999		,-999		,-47		,-999		,-999		,-47		,-999		,-999		,-999		,-47		,-47		,-999		,-999		,-47		,-999		,-999		,-999		,-47		,-999		,-999		,-999		,-47		,-47		,-999		,-999		,-999		,-47		,-999		,-999		,-999		,-999		,-999		,-47		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-51		,-51		,-51		,-999		,-999		,-999		,-999		,-999		,-51		,-999		,-51		,-999		,-51		,-51		,-51		,-999		,-999		,-999		,-51		,-51		,-999		,-999		,-999		,-51		,-999		,-999		,-999		,-999		,-51		,-999		,-999		,-51		,-999		,-999		,-999		,-51		,-51		,-999		,-999		,-51		,-999		,-999		,-999		,-51		,-999		,-999		,-999		,-51		,-51		,-999		,-999		,-999		,-51		,-999		,-999		,-999		,-999		,-999		,-51		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-48		,-48		,-48		,-999		,-999		,-999		,-999		,-999		,-48		,-999		,-48		,-999		,-48		,-48		,-48		,-999		,-999		,-999		,-48		,-48		,-999		,-999		,-999		,-48		,-999		,-999		,-999		,-999		,-48		,-999		,-999		,-48		,-999		,-999		,-999		,-48		,-48		,-999		,-999		,-48		,-999		,-999		,-999		,-48		,-999		,-999		,-999		,-48		,-48		,-999		,-999		,-999		,-48		,-999		,-999		,-999		,-999		,-999		,-48		,-999	},
+	{-999		,-41		,-41		,-41		,-999		,-999		,-999		,-999		,-999		,-41		,-999		,-41		,-999		,-41		,-41		,-41		,-999		,-999		,-999		,-41		,-41		,-999		,-999		,-999		,-41		,-999		,-999		,-999		,-999		,-41		,-999		,-999		,-41		,-999		,-999		,-999		,-41		,-41		,-999		,-999		,-41		,-999		,-999		,-999		,-41		,-999		,-999		,-999		,-41		,-41		,-999		,-999		,-999		,-41		,-999		,-999		,-999		,-999		,-999		,-41		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-43		,-43		,-43		,-999		,-999		,-999		,-999		,-999		,-43		,-999		,-43		,-999		,-43		,-43		,-43		,-999		,-999		,-999		,-43		,-43		,-999		,-999		,-999		,-43		,-999		,-999		,-999		,-999		,-43		,-999		,-999		,-43		,-999		,-999		,-999		,-43		,-43		,-999		,-999		,-43		,-999		,-999		,-999		,-43		,-999		,-999		,-999		,-43		,-43		,-999		,-999		,-999		,-43		,-999		,-999		,-999		,-999		,-999		,-43		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-54		,-54		,-54		,-999		,-999		,-999		,-999		,-999		,-54		,-999		,-54		,-999		,-54		,-54		,-54		,-999		,-999		,-999		,-54		,-54		,-999		,-999		,-999		,-54		,-999		,-999		,-999		,-999		,-54		,-999		,-999		,-54		,-999		,-999		,-999		,-54		,-54		,-999		,-999		,-54		,-999		,-999		,-999		,-54		,-999		,-999		,-999		,-54		,-54		,-999		,-999		,-999		,-54		,-999		,-999		,-999		,-999		,-999		,-54		,-999	},
+	{-999		,-52		,-52		,-52		,-999		,-999		,-999		,-999		,-999		,-52		,-999		,-52		,-999		,-52		,-52		,-52		,-999		,-999		,-999		,-52		,-52		,-999		,-999		,-999		,-52		,-999		,-999		,-999		,-999		,-52		,-999		,-999		,-52		,-999		,-999		,-999		,-52		,-52		,-999		,-999		,-52		,-999		,-999		,-999		,-52		,-999		,-999		,-999		,-52		,-52		,-999		,-999		,-999		,-52		,-999		,-999		,-999		,-999		,-999		,-52		,-999	},
+	{-999		,-39		,-39		,-39		,-999		,-999		,-999		,-999		,-999		,-39		,-999		,-39		,-999		,-39		,-39		,-39		,-999		,-999		,-999		,-39		,-39		,-999		,-999		,-999		,-39		,-999		,-999		,-999		,-999		,-39		,-999		,-999		,-39		,-999		,-999		,-999		,-39		,-39		,-999		,-999		,-39		,-999		,-999		,-999		,-39		,-999		,-999		,-999		,-39		,-39		,-999		,-999		,-999		,-39		,-999		,-999		,-999		,-999		,-999		,-39		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-38		,-38		,-38		,-999		,-999		,-999		,-999		,-999		,-38		,-999		,-38		,-999		,-38		,-38		,-38		,-999		,-999		,-999		,-38		,-38		,-999		,-999		,-999		,-38		,-999		,-999		,-999		,-999		,-38		,-999		,-999		,-38		,-999		,-999		,-999		,-38		,-38		,-999		,-999		,-38		,-999		,-999		,-999		,-38		,-999		,-999		,-999		,-38		,-38		,-999		,-999		,-999		,-38		,-999		,-999		,-999		,-999		,-999		,-38		,-999	},
+	{-999		,-42		,-42		,-42		,-999		,-999		,-999		,-999		,-999		,-42		,-999		,-42		,-999		,-42		,-42		,-42		,-999		,-999		,-999		,-42		,-42		,-999		,-999		,-999		,-42		,-999		,-999		,-999		,-999		,-42		,-999		,-999		,-42		,-999		,-999		,-999		,-42		,-42		,-999		,-999		,-42		,-999		,-999		,-999		,-42		,-999		,-999		,-999		,-42		,-42		,-999		,-999		,-999		,-42		,-999		,-999		,-999		,-999		,-999		,-42		,-999	},
+	{-999		,-44		,-44		,-44		,-999		,-999		,-999		,-999		,-999		,-44		,-999		,-44		,-999		,-44		,-44		,-44		,-999		,-999		,-999		,-44		,-44		,-999		,-999		,-999		,-44		,-999		,-999		,-999		,-999		,-44		,-999		,-999		,-44		,-999		,-999		,-999		,-44		,-44		,-999		,-999		,-44		,-999		,-999		,-999		,-44		,-999		,-999		,-999		,-44		,-44		,-999		,-999		,-999		,-44		,-999		,-999		,-999		,-999		,-999		,-44		,-999	},
+	{-999		,-46		,-46		,-46		,-999		,-999		,-999		,-999		,-999		,-46		,-999		,-46		,-999		,-46		,-46		,-46		,-999		,-999		,-999		,-46		,-46		,-999		,-999		,-999		,-46		,-999		,-999		,-999		,-999		,-46		,-999		,-999		,-46		,-999		,-999		,-999		,-46		,-46		,-999		,-999		,-46		,-999		,-999		,-999		,-46		,-999		,-999		,-999		,-46		,-46		,-999		,-999		,-999		,-46		,-999		,-999		,-999		,-999		,-999		,-46		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-53		,-53		,-53		,-999		,-999		,-999		,-999		,-999		,-53		,-999		,-53		,-999		,-53		,-53		,-53		,-999		,-999		,-999		,-53		,-53		,-999		,-999		,-999		,-53		,-999		,-999		,-999		,-999		,-53		,-999		,-999		,-53		,-999		,-999		,-999		,-53		,-53		,-999		,-999		,-53		,-999		,-999		,-999		,-53		,-999		,-999		,-999		,-53		,-53		,-999		,-999		,-999		,-53		,-999		,-999		,-999		,-999		,-999		,-53		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-50		,-50		,-50		,-999		,-999		,-999		,-999		,-999		,-50		,-999		,-50		,-999		,-50		,-50		,-50		,-999		,-999		,-999		,-50		,-50		,-999		,-999		,-999		,-50		,-999		,-999		,-999		,-999		,-50		,-999		,-999		,-50		,-999		,-999		,-999		,-50		,-50		,-999		,-999		,-50		,-999		,-999		,-999		,-50		,-999		,-999		,-999		,-50		,-50		,-999		,-999		,-999		,-50		,-999		,-999		,-999		,-999		,-999		,-50		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,207		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,208		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,209		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,210		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,211		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,212		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,213		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,214		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,215		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,216		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,217		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,218		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,219		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-58		,-58		,-58		,-999		,-999		,-999		,-999		,-999		,-58		,-999		,-58		,-999		,-58		,-58		,-58		,-999		,-999		,-999		,-58		,-58		,-999		,-999		,-999		,-58		,-999		,-999		,-999		,-999		,-58		,-999		,-999		,-58		,-999		,-999		,-999		,-58		,-58		,-999		,-999		,-58		,-999		,-999		,-999		,-58		,-999		,-999		,-999		,-58		,-58		,-999		,-999		,-999		,-58		,-999		,-999		,-999		,-999		,-999		,-58		,-999	},
+	{-999		,-60		,-60		,-60		,-999		,-999		,-999		,-999		,-999		,-60		,-999		,-60		,-999		,-60		,-60		,-60		,-999		,-999		,-999		,-60		,-60		,-999		,-999		,-999		,-60		,-999		,-999		,-999		,-999		,-60		,-999		,-999		,-60		,-999		,-999		,-999		,-60		,-60		,-999		,-999		,-60		,-999		,-999		,-999		,-60		,-999		,-999		,-999		,-60		,-60		,-999		,-999		,-999		,-60		,-999		,-999		,-999		,-999		,-999		,-60		,-999	},
+	{-999		,-63		,-63		,-63		,-999		,-999		,-999		,-999		,-999		,-63		,-999		,-63		,-999		,-63		,-63		,-63		,-999		,-999		,-999		,-63		,-63		,-999		,-999		,-999		,-63		,-999		,-999		,-999		,-999		,-63		,-999		,-999		,-63		,-999		,-999		,-999		,-63		,-63		,-999		,-999		,-63		,-999		,-999		,-999		,-63		,-999		,-999		,-999		,-63		,-63		,-999		,-999		,-999		,-63		,-999		,-999		,-999		,-999		,-999		,-63		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-57		,-57		,-57		,-999		,-999		,-999		,-999		,-999		,-57		,-999		,-57		,-999		,-57		,-57		,-57		,-999		,-999		,-999		,-57		,-57		,-999		,-999		,-999		,-57		,-999		,-999		,-999		,-999		,-57		,-999		,-999		,-57		,-999		,-999		,-999		,-57		,-57		,-999		,-999		,-57		,-999		,-999		,-999		,-57		,-999		,-999		,-999		,-57		,-57		,-999		,-999		,-999		,-57		,-999		,-999		,-999		,-999		,-999		,-57		,-999	},
+	{-999		,-61		,-61		,-61		,-999		,-999		,-999		,-999		,-999		,-61		,-999		,-61		,-999		,-61		,-61		,-61		,-999		,-999		,-999		,-61		,-61		,-999		,-999		,-999		,-61		,-999		,-999		,-999		,-999		,-61		,-999		,-999		,-61		,-999		,-999		,-999		,-61		,-61		,-999		,-999		,-61		,-999		,-999		,-999		,-61		,-999		,-999		,-999		,-61		,-61		,-999		,-999		,-999		,-61		,-999		,-999		,-999		,-999		,-999		,-61		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-56		,-56		,-56		,-999		,-999		,-999		,-999		,-999		,-56		,-999		,-56		,-999		,-56		,-56		,-56		,-999		,-999		,-999		,-56		,-56		,-999		,-999		,-999		,-56		,-999		,-999		,-999		,-999		,-56		,-999		,-999		,-56		,-999		,-999		,-999		,-56		,-56		,-999		,-999		,-56		,-999		,-999		,-999		,-56		,-999		,-999		,-999		,-56		,-56		,-999		,-999		,-999		,-56		,-999		,-999		,-999		,-999		,-999		,-56		,-999	},
+	{-999		,-62		,-62		,-62		,-999		,-999		,-999		,-999		,-999		,-62		,-999		,-62		,-999		,-62		,-62		,-62		,-999		,-999		,-999		,-62		,-62		,-999		,-999		,-999		,-62		,-999		,-999		,-999		,-999		,-62		,-999		,-999		,-62		,-999		,-999		,-999		,-62		,-62		,-999		,-999		,-62		,-999		,-999		,-999		,-62		,-999		,-999		,-999		,-62		,-62		,-999		,-999		,-999		,-62		,-999		,-999		,-999		,-999		,-999		,-62		,-999	},
+	{-999		,-59		,-59		,-59		,-999		,-999		,-999		,-999		,-999		,-59		,-999		,-59		,-999		,-59		,-59		,-59		,-999		,-999		,-999		,-59		,-59		,-999		,-999		,-999		,-59		,-999		,-999		,-999		,-999		,-59		,-999		,-999		,-59		,-999		,-999		,-999		,-59		,-59		,-999		,-999		,-59		,-999		,-999		,-999		,-59		,-999		,-999		,-999		,-59		,-59		,-999		,-999		,-999		,-59		,-999		,-999		,-999		,-999		,-999		,-59		,-999	},
+	{-999		,-55		,-55		,-55		,-999		,-999		,-999		,-999		,-999		,-55		,-999		,-55		,-999		,-55		,-55		,-55		,-999		,-999		,-999		,-55		,-55		,-999		,-999		,-999		,-55		,-999		,-999		,-999		,-999		,-55		,-999		,-999		,-55		,-999		,-999		,-999		,-55		,-55		,-999		,-999		,-55		,-999		,-999		,-999		,-55		,-999		,-999		,-999		,-55		,-55		,-999		,-999		,-999		,-55		,-999		,-999		,-999		,-999		,-999		,-55		,-999	},
+	{27		,57		,-999		,44		,56		,52		,18		,28		,31		,-999		,30		,-999		,22		,-999		,-999		,-999		,20		,43		,34		,-999		,-999		,35		,29		,26		,-999		,47		,37		,40		,39		,-999		,19		,24		,-999		,17		,41		,33		,-999		,58		,48		,38		,49		,36		,51		,54		,-999		,21		,59		,55		,-999		,-999		,23		,42		,46		,-999		,16		,25		,32		,53		,50		,-999		,45	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,224		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,225		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,226		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,227		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999		,-999	},
+	{-999		,-64		,-64		,-64		,-999		,-999		,-999		,-999		,-999		,-64		,-999		,-64		,-999		,-64		,-64		,-64		,-999		,-999		,-999		,-64		,-64		,-999		,-999		,-999		,-64		,-999		,-999		,-999		,-999		,-64		,-999		,-999		,-64		,-999		,-999		,-999		,-64		,-64		,-999		,-999		,-64		,-999		,-999		,-999		,-64		,-999		,-999		,-999		,-64		,-64		,-999		,-999		,-999		,-64		,-999		,-999		,-999		,-999		,-999		,-64		,-999	},
+	{-999		,-67		,-67		,-67		,-999		,-999		,-999		,-999		,-999		,-67		,-999		,-67		,-999		,-67		,-67		,-67		,-999		,-999		,-999		,-67		,-67		,-999		,-999		,-999		,-67		,-999		,-999		,-999		,-999		,-67		,-999		,-999		,-67		,-999		,-999		,-999		,-67		,-67		,-999		,-999		,-67		,-999		,-999		,-999		,-67		,-999		,-999		,-999		,-67		,-67		,-999		,-999		,-999		,-67		,-999		,-999		,-999		,-999		,-999		,-67		,-999	},
+	{-999		,-65		,-65		,-65		,-999		,-999		,-999		,-999		,-999		,-65		,-999		,-65		,-999		,-65		,-65		,-65		,-999		,-999		,-999		,-65		,-65		,-999		,-999		,-999		,-65		,-999		,-999		,-999		,-999		,-65		,-999		,-999		,-65		,-999		,-999		,-999		,-65		,-65		,-999		,-999		,-65		,-999		,-999		,-999		,-65		,-999		,-999		,-999		,-65		,-65		,-999		,-999		,-999		,-65		,-999		,-999		,-999		,-999		,-999		,-65		,-999	},
+	{-999		,-66		,-66		,-66		,-999		,-999		,-999		,-999		,-999		,-66		,-999		,-66		,-999		,-66		,-66		,-66		,-999		,-999		,-999		,-66		,-66		,-999		,-999		,-999		,-66		,-999		,-999		,-999		,-999		,-66		,-999		,-999		,-66		,-999		,-999		,-999		,-66		,-66		,-999		,-999		,-66		,-999		,-999		,-999		,-66		,-999		,-999		,-999		,-66		,-66		,-999		,-999		,-999		,-66		,-999		,-999		,-999		,-999		,-999		,-66		,-999	}
 };
 const struct _TOKEN LalrSemanticRules[RULES_COUNT]= 
 {
@@ -1647,7 +1904,14 @@ const struct _TOKEN LalrSemanticRules[RULES_COUNT]=
 	{SEMANTIC_RULE, "@EQ"},
 	{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},
 	{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},
+	{SEMANTIC_RULE, "@STRCMP"},
+	{SEMANTIC_RULE, "@WCSCMP"},
+	{SEMANTIC_RULE, "@STRSTR"},
+	{SEMANTIC_RULE, "@WCSSTR"},
 	{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},
+	{SEMANTIC_RULE, "@MEMCMP"},
+	{SEMANTIC_RULE, "@MEMCHR"},
+	{SEMANTIC_RULE, "@MEMCPY"},
 	{UNKNOWN, ""},
 	{SEMANTIC_RULE, "@PUSH"},
 	{SEMANTIC_RULE, "@PUSH"},
@@ -216,6 +216,31 @@ ScriptEngineShowDataBasedOnSymbolTypes(const char * TypeName,
     return SymShowDataBasedOnSymbolTypes(TypeName, Address, IsStruct, BufferAddress, AdditionalParameters);
 }
 
+/**
+ * @brief Show data based on the compiled layout of types
+ * 
+ * @param TypeName 
+ * @param Address 
+ * @param BufferAddress 
+ * @param BufferSize 
+ * @param NextFieldName 
+ * @param NextAddress 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+ScriptEngineShowDataBasedOnTypeLayout(const char * TypeName,
+                                      UINT64       Address,
+                                      PVOID        BufferAddress,
+                                      UINT32       BufferSize,
+                                      const char * NextFieldName,
+                                      UINT64 *     NextAddress)
+{
+    //
+    // A wrapper for showing data within structures from their compiled layouts
+    //
+    return SymShowDataBasedOnTypeLayout(TypeName, Address, BufferAddress, BufferSize, NextFieldName, NextAddress);
+}
+
 /**
  * @brief Cancel loading
  * 
@@ -45,6 +45,8 @@ __declspec(dllexport) BOOLEAN
     ScriptEngineSymbolInitLoad(PVOID BufferToStoreDetails, UINT32 StoredLength, BOOLEAN DownloadIfAvailable, const char * SymbolPath, BOOLEAN IsSilentLoad);
 __declspec(dllexport) BOOLEAN
     ScriptEngineShowDataBasedOnSymbolTypes(const char * TypeName, UINT64 Address, BOOLEAN IsStruct, PVOID BufferAddress, const char * AdditionalParameters);
+__declspec(dllexport) BOOLEAN
+    ScriptEngineShowDataBasedOnTypeLayout(const char * TypeName, UINT64 Address, PVOID BufferAddress, UINT32 BufferSize, const char * NextFieldName, UINT64 * NextAddress);
 __declspec(dllexport) VOID
     ScriptEngineSymbolAbortLoading();
 __declspec(dllexport) VOID
@@ -401,6 +401,216 @@ ScriptEngineFunctionWcslen(const wchar_t * Address)
     return Result;
 }
 
+/**
+ * @brief Convert the result of a comparison to the result of the
+ * script engine's comparison functions (0, 1, or -1)
+ * 
+ * @param Result 
+ * @return UINT64 
+ */
+static UINT64
+ScriptEngineFunctionCompareResult(INT32 Result)
+{
+    if (Result == 0)
+    {
+        return 0;
+    }
+
+    return Result < 0 ? (UINT64)-1 : 1;
+}
+
+/**
+ * @brief Implementation of memcmp function
+ * @details If the memory is not accessible, the result is 1 (not equal)
+ * 
+ * @param Buffer1 
+ * @param Buffer2 
+ * @param Count 
+ * @return UINT64 
+ */
+UINT64
+ScriptEngineFunctionMemcmp(UINT64 Buffer1, UINT64 Buffer2, UINT64 Count)
+{
+    INT32 Result = 1;
+
+    if (Count > MAXUINT32)
+    {
+        return 1;
+    }
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = memcmp((const void *)Buffer1, (const void *)Buffer2, Count);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    if (!VmxrootCompatibleMemcmp(Buffer1, Buffer2, (UINT32)Count, &Result))
+    {
+        return 1;
+    }
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return ScriptEngineFunctionCompareResult(Result);
+}
+
+/**
+ * @brief Implementation of memchr function
+ * 
+ * @param Buffer 
+ * @param Value 
+ * @param Count 
+ * @return UINT64 Address of the first matching byte or NULL
+ */
+UINT64
+ScriptEngineFunctionMemchr(UINT64 Buffer, UINT64 Value, UINT64 Count)
+{
+    UINT64 Result = NULL;
+
+    if (Count > MAXUINT32)
+    {
+        return NULL;
+    }
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (UINT64)memchr((const void *)Buffer, (BYTE)Value, Count);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    VmxrootCompatibleMemchr(Buffer, (BYTE)Value, (UINT32)Count, &Result);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return Result;
+}
+
+/**
+ * @brief Implementation of memcpy function
+ * 
+ * @param Destination 
+ * @param Source 
+ * @param Count 
+ * @return UINT64 Count of copied bytes (0 if the memory is not accessible)
+ */
+UINT64
+ScriptEngineFunctionMemcpy(UINT64 Destination, UINT64 Source, UINT64 Count)
+{
+    if (Count > MAXUINT32)
+    {
+        return 0;
+    }
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    memcpy((void *)Destination, (const void *)Source, Count);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    if (!VmxrootCompatibleMemcpy(Destination, Source, (UINT32)Count))
+    {
+        return 0;
+    }
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return Count;
+}
+
+/**
+ * @brief Implementation of strcmp function
+ * @details If the strings are not accessible, the result is 1 (not equal)
+ * 
+ * @param S1 
+ * @param S2 
+ * @return UINT64 
+ */
+UINT64
+ScriptEngineFunctionStrcmp(const char * S1, const char * S2)
+{
+    INT32 Result = 1;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = strcmp(S1, S2);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    if (!VmxrootCompatibleStrcmp((UINT64)S1, (UINT64)S2, sizeof(CHAR), &Result))
+    {
+        return 1;
+    }
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return ScriptEngineFunctionCompareResult(Result);
+}
+
+/**
+ * @brief Implementation of wcscmp function
+ * @details If the strings are not accessible, the result is 1 (not equal)
+ * 
+ * @param S1 
+ * @param S2 
+ * @return UINT64 
+ */
+UINT64
+ScriptEngineFunctionWcscmp(const wchar_t * S1, const wchar_t * S2)
+{
+    INT32 Result = 1;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = wcscmp(S1, S2);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    if (!VmxrootCompatibleStrcmp((UINT64)S1, (UINT64)S2, sizeof(wchar_t), &Result))
+    {
+        return 1;
+    }
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return ScriptEngineFunctionCompareResult(Result);
+}
+
+/**
+ * @brief Implementation of strstr function
+ * 
+ * @param S 
+ * @param SubStr 
+ * @return UINT64 Address of the first occurrence or NULL
+ */
+UINT64
+ScriptEngineFunctionStrstr(const char * S, const char * SubStr)
+{
+    UINT64 Result = NULL;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (UINT64)strstr(S, SubStr);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    VmxrootCompatibleStrstr((UINT64)S, (UINT64)SubStr, sizeof(CHAR), &Result);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return Result;
+}
+
+/**
+ * @brief Implementation of wcsstr function
+ * 
+ * @param S 
+ * @param SubStr 
+ * @return UINT64 Address of the first occurrence or NULL
+ */
+UINT64
+ScriptEngineFunctionWcsstr(const wchar_t * S, const wchar_t * SubStr)
+{
+    UINT64 Result = NULL;
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    Result = (UINT64)wcsstr(S, SubStr);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    VmxrootCompatibleStrstr((UINT64)S, (UINT64)SubStr, sizeof(wchar_t), &Result);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    return Result;
+}
+
 /**
  * @brief Implementation of interlocked_exchange function
  * 
@@ -707,6 +917,94 @@ ScriptEngineFunctionEventIgnore()
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
+/**
+ * @brief Implementation of agg_count, agg_sum, agg_min, agg_max and
+ * agg_hist functions
+ * 
+ * @param Tag 
+ * @param Function The aggregation function (FUNC_AGG_*)
+ * @param Key 
+ * @param Value 
+ * @return VOID 
+ */
+VOID
+ScriptEngineFunctionAggregate(UINT64 Tag, UINT64 Function, UINT64 Key, UINT64 Value)
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to aggregate values in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    AGGREGATION_TYPE Type;
+
+    switch (Function)
+    {
+    case FUNC_AGG_COUNT:
+        Type = AGGREGATION_TYPE_COUNT;
+        break;
+    case FUNC_AGG_SUM:
+        Type = AGGREGATION_TYPE_SUM;
+        break;
+    case FUNC_AGG_MIN:
+        Type = AGGREGATION_TYPE_MIN;
+        break;
+    case FUNC_AGG_MAX:
+        Type = AGGREGATION_TYPE_MAX;
+        break;
+    case FUNC_AGG_HIST:
+        Type = AGGREGATION_TYPE_HIST;
+        break;
+    default:
+        return;
+    }
+
+    AggregationUpdate(Tag, Type, Key, Value);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
+/**
+ * @brief Implementation of agg_print function
+ * 
+ * @param Tag 
+ * @param ImmediateMessagePassing 
+ * @return VOID 
+ */
+VOID
+ScriptEngineFunctionAggregationPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing)
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to show aggregations in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    AggregationPrint(Tag, ImmediateMessagePassing);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
+/**
+ * @brief Implementation of agg_clear function
+ * 
+ * @param Tag 
+ * @return VOID 
+ */
+VOID
+ScriptEngineFunctionAggregationClear(UINT64 Tag)
+{
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("err, it's not possible to clear aggregations in user-mode\n");
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    AggregationClear(Tag);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
 /**
  * @brief Implementation of formats function
  * 
@@ -85,7 +85,11 @@ ScriptEnginePseudoRegGetPname()
 
     if (Handle)
     {
-        CHAR CurrentModulePath[MAX_PATH] = {0};
+        //
+        // The buffer is static as the name is returned (and cached) as a
+        // pointer to this buffer
+        //
+        static CHAR CurrentModulePath[MAX_PATH] = {0};
         if (GetModuleFileNameEx(Handle, 0, CurrentModulePath, MAX_PATH))
         {
             //
@@ -14,14 +14,43 @@
 #include "..\script-eval\header\ScriptEngineInternalHeader.h"
 
 /**
- * @brief Get the Pseudo reg value
+ * @brief Check whether the pseudo-register can be cached or not
+ * @details In kernel-mode, the pseudo-registers of the current process
+ * and thread won't change in a VM exit, in user-mode, only the
+ * pseudo-registers of the current process are cached
+ *
+ * @param PseudoReg
+ * @return BOOLEAN
+ */
+static BOOLEAN
+IsPseudoRegCacheable(UINT64 PseudoReg)
+{
+    switch (PseudoReg)
+    {
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    case PSEUDO_REGISTER_TID:
+    case PSEUDO_REGISTER_PROC:
+    case PSEUDO_REGISTER_THREAD:
+    case PSEUDO_REGISTER_TEB:
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+    case PSEUDO_REGISTER_PID:
+    case PSEUDO_REGISTER_PNAME:
+    case PSEUDO_REGISTER_PEB:
+        return PseudoReg < SCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE_SIZE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Compute the Pseudo reg value
  *
  * @param Symbol
  * @param ActionBuffer
  * @return UINT64
  */
 UINT64
-GetPseudoRegValue(PSYMBOL Symbol, PACTION_BUFFER ActionBuffer)
+ComputePseudoRegValue(PSYMBOL Symbol, PACTION_BUFFER ActionBuffer)
 {
     switch (Symbol->Value)
     {
@@ -68,6 +97,38 @@ GetPseudoRegValue(PSYMBOL Symbol, PACTION_BUFFER ActionBuffer)
     }
 }
 
+/**
+ * @brief Get the Pseudo reg value
+ * @details Cacheable pseudo-registers are computed at most once and
+ * are shared by all of the scripts that use the same cache
+ *
+ * @param Symbol
+ * @param ActionBuffer
+ * @param VariablesList
+ * @return UINT64
+ */
+UINT64
+GetPseudoRegValue(PSYMBOL Symbol, PACTION_BUFFER ActionBuffer, PSCRIPT_ENGINE_VARIABLES_LIST VariablesList)
+{
+    PSCRIPT_ENGINE_PSEUDO_REGISTERS_CACHE Cache = VariablesList->PseudoRegistersCache;
+    UINT64                                Mask;
+
+    if (Cache == NULL || !IsPseudoRegCacheable(Symbol->Value))
+    {
+        return ComputePseudoRegValue(Symbol, ActionBuffer);
+    }
+
+    Mask = 1ull << Symbol->Value;
+
+    if (!(Cache->ValidMask & Mask))
+    {
+        Cache->Values[Symbol->Value] = ComputePseudoRegValue(Symbol, ActionBuffer);
+        Cache->ValidMask |= Mask;
+    }
+
+    return Cache->Values[Symbol->Value];
+}
+
 /**
  * @brief Get the Value (reg, peseudo-reg, etc.)
  *
@@ -120,7 +181,7 @@ GetValue(PGUEST_REGS                   GuestRegs,
         if (ReturnReference)
             return NULL; // Not reasonable, you should not dereference a pseudo-register!
         else
-            return GetPseudoRegValue(Symbol, ActionBuffer);
+            return GetPseudoRegValue(Symbol, ActionBuffer, VariablesList);
 
     case SYMBOL_TEMP_TYPE:
 
@@ -468,6 +529,56 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
 
         return HasError;
 
+    case FUNC_AGG_PRINT:
+
+        ScriptEngineFunctionAggregationPrint(ActionDetail->Tag,
+                                             ActionDetail->ImmediatelySendTheResults);
+
+        return HasError;
+
+    case FUNC_AGG_CLEAR:
+
+        ScriptEngineFunctionAggregationClear(ActionDetail->Tag);
+
+        return HasError;
+
+    case FUNC_AGG_SUM:
+    case FUNC_AGG_MIN:
+    case FUNC_AGG_MAX:
+    case FUNC_AGG_HIST:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        ScriptEngineFunctionAggregate(ActionDetail->Tag, Operator->Value, SrcVal1, SrcVal0);
+
+        return HasError;
+
+    case FUNC_AGG_COUNT:
+
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        ScriptEngineFunctionAggregate(ActionDetail->Tag, FUNC_AGG_COUNT, SrcVal0, 0);
+
+        return HasError;
+
     case FUNC_OR:
 
         Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
@@ -1183,6 +1294,226 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
 
         return HasError;
 
+    case FUNC_STRCMP:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionStrcmp((const char *)SrcVal1, (const char *)SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_WCSCMP:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionWcscmp((const wchar_t *)SrcVal1, (const wchar_t *)SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_STRSTR:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionStrstr((const char *)SrcVal1, (const char *)SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_WCSSTR:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionWcsstr((const wchar_t *)SrcVal1, (const wchar_t *)SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_MEMCMP:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Src2 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionMemcmp(SrcVal2, SrcVal1, SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_MEMCHR:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Src2 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionMemchr(SrcVal2, SrcVal1, SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
+    case FUNC_MEMCPY:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
+        Src2 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
+
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+
+        DesVal = ScriptEngineFunctionMemcpy(SrcVal2, SrcVal1, SrcVal0);
+
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
+
+        return HasError;
+
     case FUNC_INTERLOCKED_INCREMENT:
 
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
@@ -86,57 +86,78 @@ typedef struct ACTION_BUFFER {
 #define FUNC_TEST_STATEMENT 43
 #define FUNC_SPINLOCK_LOCK 44
 #define FUNC_SPINLOCK_UNLOCK 45
-#define FUNC_PRINTF 46
-#define FUNC_PAUSE 47
-#define FUNC_FLUSH 48
-#define FUNC_EVENT_IGNORE 49
-#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 50
-#define FUNC_POI 51
-#define FUNC_DB 52
-#define FUNC_DD 53
-#define FUNC_DW 54
-#define FUNC_DQ 55
-#define FUNC_NEG 56
-#define FUNC_HI 57
-#define FUNC_LOW 58
-#define FUNC_NOT 59
-#define FUNC_CHECK_ADDRESS 60
-#define FUNC_STRLEN 61
-#define FUNC_WCSLEN 62
-#define FUNC_INTERLOCKED_INCREMENT 63
-#define FUNC_INTERLOCKED_DECREMENT 64
-#define FUNC_REFERENCE 65
-#define FUNC_PHYSICAL_TO_VIRTUAL 66
-#define FUNC_VIRTUAL_TO_PHYSICAL 67
-#define FUNC_ED 68
-#define FUNC_EB 69
-#define FUNC_EQ 70
-#define FUNC_INTERLOCKED_EXCHANGE 71
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 72
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 73
-#define FUNC_POI 74
-#define FUNC_DB 75
-#define FUNC_DD 76
-#define FUNC_DW 77
-#define FUNC_DQ 78
-#define FUNC_NEG 79
-#define FUNC_HI 80
-#define FUNC_LOW 81
-#define FUNC_NOT 82
-#define FUNC_CHECK_ADDRESS 83
-#define FUNC_STRLEN 84
-#define FUNC_WCSLEN 85
-#define FUNC_INTERLOCKED_INCREMENT 86
-#define FUNC_INTERLOCKED_DECREMENT 87
-#define FUNC_REFERENCE 88
-#define FUNC_PHYSICAL_TO_VIRTUAL 89
-#define FUNC_VIRTUAL_TO_PHYSICAL 90
-#define FUNC_ED 91
-#define FUNC_EB 92
-#define FUNC_EQ 93
-#define FUNC_INTERLOCKED_EXCHANGE 94
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 95
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 96
+#define FUNC_AGG_COUNT 46
+#define FUNC_PRINTF 47
+#define FUNC_PAUSE 48
+#define FUNC_FLUSH 49
+#define FUNC_EVENT_IGNORE 50
+#define FUNC_AGG_PRINT 51
+#define FUNC_AGG_CLEAR 52
+#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 53
+#define FUNC_AGG_SUM 54
+#define FUNC_AGG_MIN 55
+#define FUNC_AGG_MAX 56
+#define FUNC_AGG_HIST 57
+#define FUNC_POI 58
+#define FUNC_DB 59
+#define FUNC_DD 60
+#define FUNC_DW 61
+#define FUNC_DQ 62
+#define FUNC_NEG 63
+#define FUNC_HI 64
+#define FUNC_LOW 65
+#define FUNC_NOT 66
+#define FUNC_CHECK_ADDRESS 67
+#define FUNC_STRLEN 68
+#define FUNC_WCSLEN 69
+#define FUNC_INTERLOCKED_INCREMENT 70
+#define FUNC_INTERLOCKED_DECREMENT 71
+#define FUNC_REFERENCE 72
+#define FUNC_PHYSICAL_TO_VIRTUAL 73
+#define FUNC_VIRTUAL_TO_PHYSICAL 74
+#define FUNC_ED 75
+#define FUNC_EB 76
+#define FUNC_EQ 77
+#define FUNC_INTERLOCKED_EXCHANGE 78
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 79
+#define FUNC_STRCMP 80
+#define FUNC_WCSCMP 81
+#define FUNC_STRSTR 82
+#define FUNC_WCSSTR 83
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 84
+#define FUNC_MEMCMP 85
+#define FUNC_MEMCHR 86
+#define FUNC_MEMCPY 87
+#define FUNC_POI 88
+#define FUNC_DB 89
+#define FUNC_DD 90
+#define FUNC_DW 91
+#define FUNC_DQ 92
+#define FUNC_NEG 93
+#define FUNC_HI 94
+#define FUNC_LOW 95
+#define FUNC_NOT 96
+#define FUNC_CHECK_ADDRESS 97
+#define FUNC_STRLEN 98
+#define FUNC_WCSLEN 99
+#define FUNC_INTERLOCKED_INCREMENT 100
+#define FUNC_INTERLOCKED_DECREMENT 101
+#define FUNC_REFERENCE 102
+#define FUNC_PHYSICAL_TO_VIRTUAL 103
+#define FUNC_VIRTUAL_TO_PHYSICAL 104
+#define FUNC_ED 105
+#define FUNC_EB 106
+#define FUNC_EQ 107
+#define FUNC_INTERLOCKED_EXCHANGE 108
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 109
+#define FUNC_STRCMP 110
+#define FUNC_WCSCMP 111
+#define FUNC_STRSTR 112
+#define FUNC_WCSSTR 113
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 114
+#define FUNC_MEMCMP 115
+#define FUNC_MEMCHR 116
+#define FUNC_MEMCPY 117
 typedef enum REGS_ENUM {
 	REGISTER_RAX = 0,
 	REGISTER_EAX = 1,
@@ -292,5 +313,5 @@ static const char *const RegistersNames[] = {
 #define PSEUDO_REGISTER_CONTEXT 10
 #define PSEUDO_REGISTER_EVENT_TAG 11
 #define PSEUDO_REGISTER_EVENT_ID 12
- 
+
 #endif
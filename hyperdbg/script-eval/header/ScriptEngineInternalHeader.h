@@ -130,6 +130,27 @@ ScriptEngineFunctionStrlen(const char * Address);
 UINT64
 ScriptEngineFunctionWcslen(const wchar_t * Address);
 
+UINT64
+ScriptEngineFunctionMemcmp(UINT64 Buffer1, UINT64 Buffer2, UINT64 Count);
+
+UINT64
+ScriptEngineFunctionMemchr(UINT64 Buffer, UINT64 Value, UINT64 Count);
+
+UINT64
+ScriptEngineFunctionMemcpy(UINT64 Destination, UINT64 Source, UINT64 Count);
+
+UINT64
+ScriptEngineFunctionStrcmp(const char * S1, const char * S2);
+
+UINT64
+ScriptEngineFunctionWcscmp(const wchar_t * S1, const wchar_t * S2);
+
+UINT64
+ScriptEngineFunctionStrstr(const char * S, const char * SubStr);
+
+UINT64
+ScriptEngineFunctionWcsstr(const wchar_t * S, const wchar_t * SubStr);
+
 long long
 ScriptEngineFunctionInterlockedExchange(long long volatile * Target,
                                         long long            Value,
@@ -177,6 +198,15 @@ ScriptEngineFunctionFlush();
 VOID
 ScriptEngineFunctionEventIgnore();
 
+VOID
+ScriptEngineFunctionAggregate(UINT64 Tag, UINT64 Function, UINT64 Key, UINT64 Value);
+
+VOID
+ScriptEngineFunctionAggregationPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing);
+
+VOID
+ScriptEngineFunctionAggregationClear(UINT64 Tag);
+
 VOID
 ScriptEngineFunctionFormats(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT64 Value);
 
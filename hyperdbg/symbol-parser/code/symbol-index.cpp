@@ -0,0 +1,668 @@
+/**
+ * @file symbol-index.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Index of symbol names for searching masks
+ * @details Symbols of each module are enumerated once, sorted by name and
+ * saved next to the PDB file, searches use the sorted names for prefixes
+ * and the trigrams of names for substrings, exact names are resolved to
+ * addresses from a hash table of names
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the name of an entry in the index
+ *
+ * @param Index
+ * @param EntryIndex
+ *
+ * @return const char *
+ */
+const char *
+SymbolIndexGetName(PSYMBOL_INDEX Index, UINT32 EntryIndex)
+{
+    return &Index->Names[Index->Entries[EntryIndex].NameOffset];
+}
+
+/**
+ * @brief Make the key of a trigram (lowercase)
+ *
+ * @param Str
+ *
+ * @return UINT32
+ */
+UINT32
+SymbolIndexTrigramKey(const char * Str)
+{
+    return (UINT32)tolower((unsigned char)Str[0]) |
+           ((UINT32)tolower((unsigned char)Str[1]) << 8) |
+           ((UINT32)tolower((unsigned char)Str[2]) << 16);
+}
+
+/**
+ * @brief Callback for collecting the symbols of a module
+ *
+ * @param SymInfo
+ * @param SymbolSize
+ * @param UserContext
+ *
+ * @return BOOL
+ */
+BOOL CALLBACK
+SymbolIndexCollectCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext)
+{
+    PSYMBOL_INDEX_COLLECT_CONTEXT Context = (PSYMBOL_INDEX_COLLECT_CONTEXT)UserContext;
+    SYMBOL_INDEX_ENTRY            Entry   = {0};
+
+    if (SymInfo != 0)
+    {
+        Entry.Rva        = SymInfo->Address - Context->ModuleBase;
+        Entry.NameOffset = (UINT32)Context->Index->Names.size();
+        Entry.NameLength = (UINT32)strlen(SymInfo->Name);
+
+        Context->Index->Names.insert(Context->Index->Names.end(), SymInfo->Name, SymInfo->Name + Entry.NameLength + 1);
+        Context->Index->Entries.push_back(Entry);
+    }
+
+    //
+    // Continue enumeration
+    //
+    return TRUE;
+}
+
+/**
+ * @brief Get the size and the last write time of the PDB file
+ *
+ * @param PdbFilePath
+ * @param FileSize
+ * @param LastWriteTime
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolIndexGetPdbFileDetails(const char * PdbFilePath, UINT64 * FileSize, FILETIME * LastWriteTime)
+{
+    WIN32_FILE_ATTRIBUTE_DATA FileAttributes = {0};
+
+    if (!GetFileAttributesExA(PdbFilePath, GetFileExInfoStandard, &FileAttributes))
+    {
+        return FALSE;
+    }
+
+    *FileSize      = ((UINT64)FileAttributes.nFileSizeHigh << 32) | FileAttributes.nFileSizeLow;
+    *LastWriteTime = FileAttributes.ftLastWriteTime;
+
+    return TRUE;
+}
+
+/**
+ * @brief Load the index from the file that is saved next to the PDB file
+ *
+ * @param ModuleDetails
+ * @param Index
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolIndexLoadFromFile(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, PSYMBOL_INDEX Index)
+{
+    FILE *                   FileHandle;
+    SYMBOL_INDEX_FILE_HEADER Header        = {0};
+    UINT64                   PdbFileSize   = 0;
+    FILETIME                 LastWriteTime = {0};
+    BOOLEAN                  Result        = FALSE;
+    string                   IndexFilePath = string(ModuleDetails->PdbFilePath) + SYMBOL_INDEX_FILE_EXTENSION;
+
+    if (!SymbolIndexGetPdbFileDetails(ModuleDetails->PdbFilePath, &PdbFileSize, &LastWriteTime))
+    {
+        return FALSE;
+    }
+
+    FileHandle = fopen(IndexFilePath.c_str(), "rb");
+
+    if (FileHandle == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // The index is only valid for the same PDB file
+    //
+    if (fread(&Header, sizeof(Header), 1, FileHandle) != 1 ||
+        Header.Magic != SYMBOL_INDEX_FILE_MAGIC ||
+        Header.PdbFileSize != PdbFileSize ||
+        CompareFileTime(&Header.PdbLastWriteTime, &LastWriteTime) != 0 ||
+        Header.SizeOfNames > MAXUINT32)
+    {
+        goto Return;
+    }
+
+    Index->Entries.resize(Header.CountOfEntries);
+    Index->Names.resize(Header.SizeOfNames);
+
+    if ((Header.CountOfEntries != 0 &&
+         fread(Index->Entries.data(), sizeof(SYMBOL_INDEX_ENTRY), Header.CountOfEntries, FileHandle) != Header.CountOfEntries) ||
+        (Header.SizeOfNames != 0 &&
+         fread(Index->Names.data(), 1, Header.SizeOfNames, FileHandle) != Header.SizeOfNames))
+    {
+        goto Return;
+    }
+
+    //
+    // Validate the names
+    //
+    for (auto & Entry : Index->Entries)
+    {
+        if ((UINT64)Entry.NameOffset + Entry.NameLength >= Header.SizeOfNames ||
+            Index->Names[Entry.NameOffset + Entry.NameLength] != '\0')
+        {
+            goto Return;
+        }
+    }
+
+    Result = TRUE;
+
+Return:
+
+    if (!Result)
+    {
+        Index->Entries.clear();
+        Index->Names.clear();
+    }
+
+    fclose(FileHandle);
+
+    return Result;
+}
+
+/**
+ * @brief Save the index next to the PDB file
+ * @details errors are ignored as the index can be built again
+ *
+ * @param ModuleDetails
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexSaveToFile(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, PSYMBOL_INDEX Index)
+{
+    FILE *                   FileHandle;
+    SYMBOL_INDEX_FILE_HEADER Header        = {0};
+    string                   IndexFilePath = string(ModuleDetails->PdbFilePath) + SYMBOL_INDEX_FILE_EXTENSION;
+
+    if (!SymbolIndexGetPdbFileDetails(ModuleDetails->PdbFilePath, &Header.PdbFileSize, &Header.PdbLastWriteTime))
+    {
+        return;
+    }
+
+    FileHandle = fopen(IndexFilePath.c_str(), "wb");
+
+    if (FileHandle == NULL)
+    {
+        return;
+    }
+
+    Header.Magic          = SYMBOL_INDEX_FILE_MAGIC;
+    Header.CountOfEntries = (UINT32)Index->Entries.size();
+    Header.SizeOfNames    = Index->Names.size();
+
+    if (fwrite(&Header, sizeof(Header), 1, FileHandle) != 1 ||
+        fwrite(Index->Entries.data(), sizeof(SYMBOL_INDEX_ENTRY), Index->Entries.size(), FileHandle) != Index->Entries.size() ||
+        fwrite(Index->Names.data(), 1, Index->Names.size(), FileHandle) != Index->Names.size())
+    {
+        //
+        // Do not leave a partial index
+        //
+        fclose(FileHandle);
+        remove(IndexFilePath.c_str());
+        return;
+    }
+
+    fclose(FileHandle);
+}
+
+/**
+ * @brief Build the trigrams of the names
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexBuildTrigrams(PSYMBOL_INDEX Index)
+{
+    for (UINT32 i = 0; i < Index->Entries.size(); i++)
+    {
+        const char * Name = SymbolIndexGetName(Index, i);
+
+        for (UINT32 j = 0; j + 3 <= Index->Entries[i].NameLength; j++)
+        {
+            std::vector<UINT32> & Postings = Index->Trigrams[SymbolIndexTrigramKey(&Name[j])];
+
+            //
+            // Entries are added in order, so the postings are sorted and
+            // a name is only added once for each trigram
+            //
+            if (Postings.empty() || Postings.back() != i)
+            {
+                Postings.push_back(i);
+            }
+        }
+    }
+
+    Index->IsTrigramsBuilt = TRUE;
+}
+
+/**
+ * @brief Build the hash table of the names
+ * @details If more than one symbol has the same name, the first one is
+ * kept
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexBuildNameTable(PSYMBOL_INDEX Index)
+{
+    Index->EntriesByName.reserve(Index->Entries.size());
+
+    for (UINT32 i = 0; i < Index->Entries.size(); i++)
+    {
+        Index->EntriesByName.emplace(std::string(SymbolIndexGetName(Index, i), Index->Entries[i].NameLength), i);
+    }
+}
+
+/**
+ * @brief Get (and build if needed) the index of a module
+ *
+ * @param ModuleDetails
+ *
+ * @return PSYMBOL_INDEX NULL if it's not possible to build the index
+ */
+PSYMBOL_INDEX
+SymbolIndexGet(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    PSYMBOL_INDEX                Index;
+    SYMBOL_INDEX_COLLECT_CONTEXT Context = {0};
+
+    if (ModuleDetails->SymbolIndex != NULL)
+    {
+        return ModuleDetails->SymbolIndex;
+    }
+
+    Index                  = new SYMBOL_INDEX;
+    Index->IsTrigramsBuilt = FALSE;
+
+    if (!SymbolIndexLoadFromFile(ModuleDetails, Index))
+    {
+        //
+        // Enumerate all of the symbols of the module
+        //
+        Context.Index      = Index;
+        Context.ModuleBase = ModuleDetails->ModuleBase;
+
+        if (!SymEnumSymbols(GetCurrentProcess(),        // Process handle of the current process
+                            ModuleDetails->ModuleBase,  // Base address of the module
+                            NULL,                       // Mask (NULL -> all symbols)
+                            SymbolIndexCollectCallback, // The callback function
+                            &Context                    // A used-defined context
+                            ))
+        {
+            delete Index;
+            return NULL;
+        }
+
+        //
+        // Sort the symbols by their names
+        //
+        std::sort(Index->Entries.begin(), Index->Entries.end(), [Index](const SYMBOL_INDEX_ENTRY & A, const SYMBOL_INDEX_ENTRY & B) {
+            return _stricmp(&Index->Names[A.NameOffset], &Index->Names[B.NameOffset]) < 0;
+        });
+
+        SymbolIndexSaveToFile(ModuleDetails, Index);
+    }
+
+    //
+    // The trigrams are only needed for the wildcard masks, so they're
+    // built on the first search of such a mask
+    //
+    SymbolIndexBuildNameTable(Index);
+
+    ModuleDetails->SymbolIndex = Index;
+
+    return Index;
+}
+
+/**
+ * @brief Free the index of a module
+ *
+ * @param ModuleDetails
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexFree(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    if (ModuleDetails->SymbolIndex != NULL)
+    {
+        delete ModuleDetails->SymbolIndex;
+        ModuleDetails->SymbolIndex = NULL;
+    }
+}
+
+/**
+ * @brief Check whether a name matches a mask (case-insensitive)
+ * @details '*' matches any sequence and '?' matches one character
+ *
+ * @param Name
+ * @param Mask
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolIndexMatchMask(const char * Name, const char * Mask)
+{
+    const char * StarMask = NULL;
+    const char * StarName = NULL;
+
+    while (*Name != '\0')
+    {
+        if (*Mask == '*')
+        {
+            StarMask = ++Mask;
+            StarName = Name;
+        }
+        else if (*Mask == '?' || (*Mask != '\0' && tolower((unsigned char)*Mask) == tolower((unsigned char)*Name)))
+        {
+            Mask++;
+            Name++;
+        }
+        else if (StarMask != NULL)
+        {
+            //
+            // Let the last star match one more character
+            //
+            Mask = StarMask;
+            Name = ++StarName;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    while (*Mask == '*')
+    {
+        Mask++;
+    }
+
+    return *Mask == '\0';
+}
+
+/**
+ * @brief Search the index for a mask
+ * @details The results are the indexes of the entries sorted by name
+ *
+ * @param Index
+ * @param Mask the mask, module name (module!) is ignored
+ * @param Results
+ *
+ * @return VOID
+ */
+VOID
+SymbolIndexSearch(PSYMBOL_INDEX Index, const char * Mask, std::vector<UINT32> & Results)
+{
+    const char *                Delimiter;
+    size_t                      PrefixLength;
+    size_t                      SegmentLength;
+    UINT32                      Low;
+    UINT32                      High;
+    std::vector<UINT32>                      Candidates;
+    std::vector<const std::vector<UINT32> *> PostingsOfMask;
+
+    Results.clear();
+
+    //
+    // Remove the module name
+    //
+    Delimiter = strchr(Mask, '!');
+
+    if (Delimiter != NULL)
+    {
+        Mask = Delimiter + 1;
+    }
+
+    //
+    // Find the range of the names that start with the literal prefix
+    //
+    PrefixLength = strcspn(Mask, "*?");
+
+    auto LowIt = std::lower_bound(Index->Entries.begin(), Index->Entries.end(), Mask, [Index, PrefixLength](const SYMBOL_INDEX_ENTRY & Entry, const char * Prefix) {
+        return _strnicmp(&Index->Names[Entry.NameOffset], Prefix, PrefixLength) < 0;
+    });
+
+    auto HighIt = std::upper_bound(LowIt, Index->Entries.end(), Mask, [Index, PrefixLength](const char * Prefix, const SYMBOL_INDEX_ENTRY & Entry) {
+        return _strnicmp(Prefix, &Index->Names[Entry.NameOffset], PrefixLength) < 0;
+    });
+
+    Low  = (UINT32)(LowIt - Index->Entries.begin());
+    High = (UINT32)(HighIt - Index->Entries.begin());
+
+    if (Mask[PrefixLength] == '\0')
+    {
+        //
+        // No wildcard, the names with the same prefix are the names that
+        // match the mask (case-insensitive)
+        //
+        for (UINT32 i = Low; i < High; i++)
+        {
+            if (Index->Entries[i].NameLength == PrefixLength)
+            {
+                Results.push_back(i);
+            }
+        }
+
+        return;
+    }
+
+    if (!Index->IsTrigramsBuilt)
+    {
+        SymbolIndexBuildTrigrams(Index);
+    }
+
+    //
+    // Find the trigrams of the literal parts of the mask
+    //
+    for (const char * Segment = Mask; *Segment != '\0'; Segment += SegmentLength)
+    {
+        SegmentLength = strcspn(Segment, "*?");
+
+        for (size_t i = 0; i + 3 <= SegmentLength; i++)
+        {
+            auto Postings = Index->Trigrams.find(SymbolIndexTrigramKey(&Segment[i]));
+
+            if (Postings == Index->Trigrams.end())
+            {
+                //
+                // No name contains this part of the mask
+                //
+                return;
+            }
+
+            PostingsOfMask.push_back(&Postings->second);
+        }
+
+        if (SegmentLength == 0)
+        {
+            //
+            // Skip the wildcard
+            //
+            SegmentLength = 1;
+        }
+    }
+
+    if (PostingsOfMask.empty())
+    {
+        //
+        // No trigram, check all the names with the same prefix
+        //
+        for (UINT32 i = Low; i < High; i++)
+        {
+            if (SymbolIndexMatchMask(SymbolIndexGetName(Index, i), Mask))
+            {
+                Results.push_back(i);
+            }
+        }
+
+        return;
+    }
+
+    //
+    // Start from the rarest trigram (in the range of prefix) and remove
+    // the names that don't contain the other trigrams
+    //
+    std::sort(PostingsOfMask.begin(), PostingsOfMask.end(), [](const std::vector<UINT32> * A, const std::vector<UINT32> * B) {
+        return A->size() < B->size();
+    });
+
+    Candidates.assign(std::lower_bound(PostingsOfMask[0]->begin(), PostingsOfMask[0]->end(), Low),
+                      std::lower_bound(PostingsOfMask[0]->begin(), PostingsOfMask[0]->end(), High));
+
+    for (size_t i = 1; i < PostingsOfMask.size() && !Candidates.empty(); i++)
+    {
+        const std::vector<UINT32> * Postings = PostingsOfMask[i];
+
+        Candidates.erase(std::remove_if(Candidates.begin(), Candidates.end(), [Postings](UINT32 Candidate) {
+                             return !std::binary_search(Postings->begin(), Postings->end(), Candidate);
+                         }),
+                         Candidates.end());
+    }
+
+    for (auto Candidate : Candidates)
+    {
+        if (SymbolIndexMatchMask(SymbolIndexGetName(Index, Candidate), Mask))
+        {
+            Results.push_back(Candidate);
+        }
+    }
+}
+
+/**
+ * @brief Undecorate a name
+ * @details C++ names (?Name@@...) are undecorated by DbgHelp, for the C
+ * names, the prefix ('_' or '@') and the size of arguments (@n) are
+ * removed, a '@' prefix is only a decoration if the size of arguments is
+ * also there (__fastcall), this is only used when the exact name is not
+ * found, so a leading '_' of a real name is never removed
+ *
+ * @param Name
+ * @param UndecoratedName
+ *
+ * @return BOOLEAN whether the name is decorated or not
+ */
+BOOLEAN
+SymbolIndexUndecorateName(const char * Name, std::string & UndecoratedName)
+{
+    char   Buffer[MAX_SYM_NAME];
+    size_t Length;
+    size_t Digits = 0;
+
+    if (Name[0] == '?')
+    {
+        if (UnDecorateSymbolName(Name, Buffer, sizeof(Buffer), UNDNAME_NAME_ONLY) == 0 ||
+            strcmp(Buffer, Name) == 0)
+        {
+            return FALSE;
+        }
+
+        UndecoratedName = Buffer;
+        return TRUE;
+    }
+
+    if (Name[0] != '_' && Name[0] != '@')
+    {
+        return FALSE;
+    }
+
+    UndecoratedName = &Name[1];
+
+    //
+    // Remove the size of arguments of __stdcall and __fastcall names
+    //
+    Length = UndecoratedName.size();
+
+    while (Digits < Length && isdigit((unsigned char)UndecoratedName[Length - Digits - 1]))
+    {
+        Digits++;
+    }
+
+    if (Digits != 0 && Digits < Length && UndecoratedName[Length - Digits - 1] == '@')
+    {
+        UndecoratedName.erase(Length - Digits - 1);
+    }
+    else if (Name[0] == '@')
+    {
+        //
+        // Not a __fastcall name
+        //
+        return FALSE;
+    }
+
+    return !UndecoratedName.empty();
+}
+
+/**
+ * @brief Find the address of a name in the index
+ *
+ * @param Index
+ * @param Name the name, module name (module!) is ignored
+ * @param Rva the relative address of the symbol
+ *
+ * @return BOOLEAN whether the name is found or not
+ */
+BOOLEAN
+SymbolIndexFindName(PSYMBOL_INDEX Index, const char * Name, UINT64 * Rva)
+{
+    const char * Delimiter;
+    std::string  UndecoratedName;
+
+    //
+    // Remove the module name
+    //
+    Delimiter = strchr(Name, '!');
+
+    if (Delimiter != NULL)
+    {
+        Name = Delimiter + 1;
+    }
+
+    auto Entry = Index->EntriesByName.find(Name);
+
+    if (Entry == Index->EntriesByName.end())
+    {
+        //
+        // Names in the index are undecorated
+        //
+        if (!SymbolIndexUndecorateName(Name, UndecoratedName))
+        {
+            return FALSE;
+        }
+
+        Entry = Index->EntriesByName.find(UndecoratedName);
+
+        if (Entry == Index->EntriesByName.end())
+        {
+            return FALSE;
+        }
+    }
+
+    *Rva = Index->Entries[Entry->second].Rva;
+
+    return TRUE;
+}
@@ -589,6 +589,8 @@ SymUnloadModuleSymbol(char * ModuleName)
 
             OneModuleFound = TRUE;
 
+            SymbolIndexFree(item);
+            SymbolTypeLayoutFree(item);
             free(item);
 
             break;
@@ -639,6 +641,8 @@ SymUnloadAllSymbols()
                          GetLastError());
         }
 
+        SymbolIndexFree(item);
+        SymbolTypeLayoutFree(item);
         free(item);
     }
 
@@ -672,11 +676,14 @@ SymUnloadAllSymbols()
 UINT64
 SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
 {
-    BOOLEAN      Found   = FALSE;
-    UINT64       Address = NULL;
-    UINT64       Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
-    PSYMBOL_INFO Symbol = (PSYMBOL_INFO)Buffer;
-    string       name   = FunctionOrVariableName;
+    BOOLEAN                       Found   = FALSE;
+    UINT64                        Address = NULL;
+    UINT64                        Rva     = NULL;
+    UINT64                        Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
+    PSYMBOL_INFO                  Symbol = (PSYMBOL_INFO)Buffer;
+    PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails;
+    PSYMBOL_INDEX                 Index;
+    string                        name = FunctionOrVariableName;
 
     //
     // Not found by default
@@ -684,7 +691,25 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
     *WasFound = FALSE;
 
     //
-    // Retrieve the address from name
+    // Look up the name in the index of the module (names without module
+    // are looked up in nt), the index is built once for each module
+    //
+    ModuleDetails = SymGetModuleBaseFromSearchMask(FunctionOrVariableName, FALSE);
+
+    if (ModuleDetails != NULL)
+    {
+        Index = SymbolIndexGet(ModuleDetails);
+
+        if (Index != NULL && SymbolIndexFindName(Index, FunctionOrVariableName, &Rva))
+        {
+            *WasFound = TRUE;
+            return ModuleDetails->ModuleBase + Rva;
+        }
+    }
+
+    //
+    // Not in the index, retrieve the address from name by DbgHelp
+    // (e.g., unqualified names of other modules)
     //
     Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
     Symbol->MaxNameLen   = MAX_SYM_NAME;
@@ -881,6 +906,8 @@ SymSearchSymbolForMask(const char * SearchMask)
 {
     BOOL                          Ret        = FALSE;
     PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
+    PSYMBOL_INDEX                 Index      = NULL;
+    std::vector<UINT32>           Results;
 
     //
     // Get the module info
@@ -898,6 +925,27 @@ SymSearchSymbolForMask(const char * SearchMask)
         return -1;
     }
 
+    //
+    // Search the index of the module's symbols, the index is built
+    // once and used for the next searches
+    //
+    Index = SymbolIndexGet(SymbolInfo);
+
+    if (Index != NULL)
+    {
+        SymbolIndexSearch(Index, SearchMask, Results);
+
+        for (auto Result : Results)
+        {
+            ShowMessages("%s  %s!%s\n",
+                         SymSeparateTo64BitValue(SymbolInfo->ModuleBase + Index->Entries[Result].Rva).c_str(),
+                         g_CurrentModuleName,
+                         &Index->Names[Index->Entries[Result].NameOffset]);
+        }
+
+        return 0;
+    }
+
     Ret = SymEnumSymbols(
         GetCurrentProcess(),           // Process handle of the current process
         SymbolInfo->ModuleBase,        // Base address of the module
@@ -1916,3 +1964,113 @@ SymShowDataBasedOnSymbolTypes(const char * TypeName,
 
     return TRUE;
 }
+
+/**
+ * @brief Show data based on the compiled layout of the type
+ * @details used by dt command, the buffer might contain more than one
+ * element (arrays), the layout of each type is compiled once and data
+ * is shown from the raw bytes
+ *
+ * @param TypeName
+ * @param Address
+ * @param BufferAddress
+ * @param BufferSize
+ * @param NextFieldName the field that links the nodes of a list (can be NULL)
+ * @param NextAddress the address of the next node (if NextFieldName is available)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymShowDataBasedOnTypeLayout(const char * TypeName,
+                             UINT64       Address,
+                             PVOID        BufferAddress,
+                             UINT32       BufferSize,
+                             const char * NextFieldName,
+                             UINT64 *     NextAddress)
+{
+    PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo    = NULL;
+    UINT32                        TypeNameIndex = 0;
+    UINT32                        LayoutIndex   = 0;
+    UINT32                        CountOfElements;
+    UINT32                        SizeOfElement;
+    const BYTE *                  Buffer = (const BYTE *)BufferAddress;
+
+    //
+    // Find the symbol info (to get the module base)
+    //
+    SymbolInfo = SymGetModuleBaseFromSearchMask(TypeName, FALSE);
+
+    if (!SymbolInfo)
+    {
+        //
+        // Symbol not found
+        //
+        ShowMessages("err, couldn't resolve error at '%s'\n", TypeName);
+
+        return FALSE;
+    }
+
+    //
+    // Remove the module name (if any)
+    //
+    while (TypeName[TypeNameIndex] != NULL)
+    {
+        if (TypeName[TypeNameIndex] == '!')
+        {
+            TypeName = &TypeName[++TypeNameIndex];
+            break;
+        }
+
+        TypeNameIndex++;
+    }
+
+    //
+    // Get the compiled layout (it's only compiled for the first time)
+    //
+    LayoutIndex = SymbolTypeLayoutGet(SymbolInfo, TypeName);
+
+    if (LayoutIndex == SYMBOL_TYPE_LAYOUT_INVALID_INDEX)
+    {
+        ShowMessages("err, couldn't find the structure layout of '%s'\n", TypeName);
+
+        return FALSE;
+    }
+
+    SizeOfElement = SymbolInfo->TypeLayoutCache->Layouts[LayoutIndex].Size;
+
+    if (SizeOfElement == 0 || BufferSize < SizeOfElement)
+    {
+        ShowMessages("err, invalid address or memory is smaller than the structure size\n");
+
+        return FALSE;
+    }
+
+    CountOfElements = BufferSize / SizeOfElement;
+
+    for (UINT32 i = 0; i < CountOfElements; i++)
+    {
+        if (CountOfElements != 1)
+        {
+            ShowMessages("[%d] %s\n", i, SymSeparateTo64BitValue(Address + i * SizeOfElement).c_str());
+        }
+
+        SymbolTypeLayoutShow(SymbolInfo->TypeLayoutCache, LayoutIndex, Buffer + i * SizeOfElement, 0);
+    }
+
+    //
+    // Find the next node of the list (if needed)
+    //
+    if (NextFieldName != NULL && NextAddress != NULL &&
+        !SymbolTypeLayoutGetNextNodeAddress(SymbolInfo->TypeLayoutCache,
+                                            LayoutIndex,
+                                            Buffer + (CountOfElements - 1) * SizeOfElement,
+                                            NextFieldName,
+                                            NextAddress))
+    {
+        ShowMessages("err, couldn't find the field '%s' in '%s'\n", NextFieldName, TypeName);
+
+        return FALSE;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,798 @@
+/**
+ * @file type-layout.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Compiled layouts of types for showing data (dt command)
+ * @details Each type is compiled once into flat tables of fields (offsets,
+ * sizes, kinds and references to the nested layouts), after that showing the
+ * data only needs the raw bytes and no query to the symbol engine is needed
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Add a name to the names table of the layouts
+ *
+ * @param Cache
+ * @param Name
+ *
+ * @return UINT32 offset of the name in the table
+ */
+UINT32
+SymbolTypeLayoutAddName(PSYMBOL_TYPE_LAYOUT_CACHE Cache, const char * Name)
+{
+    UINT32 Offset = (UINT32)Cache->Names.size();
+
+    Cache->Names.insert(Cache->Names.end(), Name, Name + strlen(Name) + 1);
+
+    return Offset;
+}
+
+/**
+ * @brief Get the name of a symbol (type or field) from the symbol engine
+ *
+ * @param Base
+ * @param TypeIndex
+ * @param Name
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolTypeLayoutGetSymbolName(UINT64 Base, ULONG TypeIndex, std::string & Name)
+{
+    WCHAR * NameW               = NULL;
+    char    NameA[MAX_SYM_NAME] = {0};
+
+    if (!SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_SYMNAME, &NameW) || NameW == NULL)
+    {
+        return FALSE;
+    }
+
+    wcstombs(NameA, NameW, sizeof(NameA) - 1);
+    LocalFree(NameW);
+
+    Name = NameA;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the name of a base type
+ *
+ * @param BaseType
+ * @param Size
+ *
+ * @return std::string
+ */
+std::string
+SymbolTypeLayoutGetBaseTypeName(UINT32 BaseType, UINT32 Size)
+{
+    switch (BaseType)
+    {
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_VOID:
+        return "void";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_CHAR:
+        return "char";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_WCHAR:
+        return "wchar_t";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_INT:
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_LONG:
+        return "int" + std::to_string(Size * 8) + "_t";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_UINT:
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_ULONG:
+        return "uint" + std::to_string(Size * 8) + "_t";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_FLOAT:
+        return Size == sizeof(float) ? "float" : "double";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_BOOL:
+        return "bool";
+
+    case SYMBOL_TYPE_LAYOUT_BASE_TYPE_HRESULT:
+        return "HRESULT";
+
+    default:
+        return "base" + std::to_string(Size * 8);
+    }
+}
+
+/**
+ * @brief Get the name of a type (for showing it next to the fields)
+ *
+ * @param Base
+ * @param TypeIndex
+ *
+ * @return std::string
+ */
+std::string
+SymbolTypeLayoutGetTypeName(UINT64 Base, ULONG TypeIndex)
+{
+    DWORD       Tag      = 0;
+    DWORD       BaseType = 0;
+    DWORD       Count    = 0;
+    DWORD       SubType  = 0;
+    ULONG64     Length   = 0;
+    std::string Name;
+
+    SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_SYMTAG, &Tag);
+    SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_LENGTH, &Length);
+
+    switch (Tag)
+    {
+    case SymTagBaseType:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_BASETYPE, &BaseType);
+
+        return SymbolTypeLayoutGetBaseTypeName(BaseType, (UINT32)Length);
+
+    case SymTagPointerType:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_TYPEID, &SubType);
+
+        return SymbolTypeLayoutGetTypeName(Base, SubType) + " *";
+
+    case SymTagArrayType:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_TYPEID, &SubType);
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_COUNT, &Count);
+
+        return SymbolTypeLayoutGetTypeName(Base, SubType) + "[" + std::to_string(Count) + "]";
+
+    default:
+
+        if (SymbolTypeLayoutGetSymbolName(Base, TypeIndex, Name))
+        {
+            return Name;
+        }
+
+        return SymTagStr(Tag);
+    }
+}
+
+UINT32
+SymbolTypeLayoutCompile(PSYMBOL_TYPE_LAYOUT_CACHE Cache, UINT64 Base, ULONG TypeIndex, UINT32 Depth, BOOLEAN * Truncated);
+
+/**
+ * @brief Describe the type of a field (kind, size, base type, nested layout)
+ *
+ * @param Cache
+ * @param Base
+ * @param TypeIndex
+ * @param Depth
+ * @param Field
+ * @param Truncated Set if a nested layout is truncated at the maximum depth
+ *
+ * @return VOID
+ */
+VOID
+SymbolTypeLayoutDescribeType(PSYMBOL_TYPE_LAYOUT_CACHE Cache,
+                             UINT64                    Base,
+                             ULONG                     TypeIndex,
+                             UINT32                    Depth,
+                             PSYMBOL_TYPE_LAYOUT_FIELD Field,
+                             BOOLEAN *                 Truncated)
+{
+    DWORD                    Tag      = 0;
+    DWORD                    BaseType = 0;
+    DWORD                    Count    = 0;
+    DWORD                    SubType  = 0;
+    ULONG64                  Length   = 0;
+    SYMBOL_TYPE_LAYOUT_FIELD Element  = {0};
+
+    SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_SYMTAG, &Tag);
+    SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_LENGTH, &Length);
+
+    Field->Size = (UINT32)Length;
+
+    switch (Tag)
+    {
+    case SymTagTypedef:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_TYPEID, &SubType);
+        SymbolTypeLayoutDescribeType(Cache, Base, SubType, Depth, Field, Truncated);
+
+        break;
+
+    case SymTagBaseType:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_BASETYPE, &BaseType);
+
+        Field->Kind     = SYMBOL_TYPE_LAYOUT_KIND_BASE;
+        Field->BaseType = BaseType;
+
+        break;
+
+    case SymTagPointerType:
+
+        Field->Kind = SYMBOL_TYPE_LAYOUT_KIND_POINTER;
+
+        break;
+
+    case SymTagEnum:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_BASETYPE, &BaseType);
+
+        Field->Kind     = SYMBOL_TYPE_LAYOUT_KIND_ENUM;
+        Field->BaseType = BaseType;
+
+        break;
+
+    case SymTagUDT:
+
+        Field->Kind         = SYMBOL_TYPE_LAYOUT_KIND_STRUCT;
+        Field->NestedLayout = SymbolTypeLayoutCompile(Cache, Base, TypeIndex, Depth + 1, Truncated);
+
+        break;
+
+    case SymTagArrayType:
+
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_TYPEID, &SubType);
+        SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_COUNT, &Count);
+
+        Element.NestedLayout = SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+        SymbolTypeLayoutDescribeType(Cache, Base, SubType, Depth, &Element, Truncated);
+
+        Field->Kind         = SYMBOL_TYPE_LAYOUT_KIND_ARRAY;
+        Field->ElementKind  = Element.Kind;
+        Field->ElementSize  = Element.Size;
+        Field->ElementCount = Count;
+        Field->BaseType     = Element.BaseType;
+        Field->NestedLayout = Element.NestedLayout;
+
+        break;
+
+    default:
+
+        Field->Kind = SYMBOL_TYPE_LAYOUT_KIND_UNKNOWN;
+
+        break;
+    }
+}
+
+/**
+ * @brief Compile the layout of a structure (or union)
+ * @details Layouts of the nested structures are compiled before the fields of
+ * this layout are added, so the fields of each layout are contiguous, layouts
+ * that are truncated at the maximum depth are not cached by their type index
+ * as the same type might be compiled completely on a lower depth
+ *
+ * @param Cache
+ * @param Base
+ * @param TypeIndex
+ * @param Depth
+ * @param Truncated Set if this layout (or a nested layout) is truncated
+ *
+ * @return UINT32 index of the layout or SYMBOL_TYPE_LAYOUT_INVALID_INDEX
+ */
+UINT32
+SymbolTypeLayoutCompile(PSYMBOL_TYPE_LAYOUT_CACHE Cache, UINT64 Base, ULONG TypeIndex, UINT32 Depth, BOOLEAN * Truncated)
+{
+    SYMBOL_TYPE_LAYOUT                    Layout        = {0};
+    std::vector<SYMBOL_TYPE_LAYOUT_FIELD> LayoutFields;
+    DWORD                                 ChildrenCount = 0;
+    ULONG64                               Length        = 0;
+    BOOLEAN                               IsTruncated   = FALSE;
+    std::string                           Name;
+
+    auto It = Cache->LayoutsByTypeIndex.find(TypeIndex);
+
+    if (It != Cache->LayoutsByTypeIndex.end())
+    {
+        return It->second;
+    }
+
+    if (Depth >= SYMBOL_TYPE_LAYOUT_MAXIMUM_DEPTH)
+    {
+        *Truncated = TRUE;
+        return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+    }
+
+    if (!SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_LENGTH, &Length) ||
+        !SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_GET_CHILDRENCOUNT, &ChildrenCount))
+    {
+        return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+    }
+
+    if (ChildrenCount != 0)
+    {
+        //
+        // Allocate enough memory to receive the children ids
+        //
+        auto FindChildrenParamsBacking = std::make_unique<uint8_t[]>(
+            sizeof(_TI_FINDCHILDREN_PARAMS) + ((ChildrenCount - 1) * sizeof(ULONG)));
+        auto FindChildrenParams =
+            (_TI_FINDCHILDREN_PARAMS *)FindChildrenParamsBacking.get();
+
+        FindChildrenParams->Count = ChildrenCount;
+
+        if (!SymGetTypeInfo(GetCurrentProcess(), Base, TypeIndex, TI_FINDCHILDREN, FindChildrenParams))
+        {
+            return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+        }
+
+        for (DWORD ChildIdx = 0; ChildIdx < ChildrenCount; ChildIdx++)
+        {
+            const ULONG              ChildId     = FindChildrenParams->ChildId[ChildIdx];
+            SYMBOL_TYPE_LAYOUT_FIELD Field       = {0};
+            DWORD                    Tag         = 0;
+            DWORD                    Offset      = 0;
+            DWORD                    ChildType   = 0;
+            DWORD                    BitPosition = 0;
+            ULONG64                  BitLength   = 0;
+            std::string              FieldName;
+
+            //
+            // Only the data members that have an offset (not static members, functions, etc.)
+            //
+            if (!SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_SYMTAG, &Tag) ||
+                Tag != SymTagData ||
+                !SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_OFFSET, &Offset) ||
+                !SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_TYPEID, &ChildType))
+            {
+                continue;
+            }
+
+            Field.Offset       = Offset;
+            Field.NestedLayout = SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+
+            SymbolTypeLayoutDescribeType(Cache, Base, ChildType, Depth, &Field, &IsTruncated);
+
+            //
+            // For bit-fields, the length of the member is the count of bits
+            //
+            if (SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_BITPOSITION, &BitPosition) &&
+                SymGetTypeInfo(GetCurrentProcess(), Base, ChildId, TI_GET_LENGTH, &BitLength))
+            {
+                Field.BitPosition = BitPosition;
+                Field.BitLength   = (UINT32)BitLength;
+            }
+
+            if (!SymbolTypeLayoutGetSymbolName(Base, ChildId, FieldName))
+            {
+                FieldName = "<unnamed>";
+            }
+
+            Field.NameOffset     = SymbolTypeLayoutAddName(Cache, FieldName.c_str());
+            Field.TypeNameOffset = SymbolTypeLayoutAddName(Cache, SymbolTypeLayoutGetTypeName(Base, ChildType).c_str());
+
+            LayoutFields.push_back(Field);
+        }
+    }
+
+    if (!SymbolTypeLayoutGetSymbolName(Base, TypeIndex, Name))
+    {
+        Name = "<unnamed>";
+    }
+
+    Layout.NameOffset    = SymbolTypeLayoutAddName(Cache, Name.c_str());
+    Layout.Size          = (UINT32)Length;
+    Layout.FirstField    = (UINT32)Cache->Fields.size();
+    Layout.CountOfFields = (UINT32)LayoutFields.size();
+
+    Cache->Fields.insert(Cache->Fields.end(), LayoutFields.begin(), LayoutFields.end());
+    Cache->Layouts.push_back(Layout);
+
+    if (IsTruncated)
+    {
+        *Truncated = TRUE;
+    }
+    else
+    {
+        Cache->LayoutsByTypeIndex[TypeIndex] = (UINT32)(Cache->Layouts.size() - 1);
+    }
+
+    return (UINT32)(Cache->Layouts.size() - 1);
+}
+
+/**
+ * @brief Get (compile if it's not compiled before) the layout of a type
+ *
+ * @param ModuleDetails
+ * @param TypeName name of the type without the module name
+ *
+ * @return UINT32 index of the layout or SYMBOL_TYPE_LAYOUT_INVALID_INDEX
+ */
+UINT32
+SymbolTypeLayoutGet(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, const char * TypeName)
+{
+    PSYMBOL_TYPE_LAYOUT_CACHE Cache;
+    UINT32                    LayoutIndex;
+    BOOLEAN                   Truncated = FALSE;
+    DWORD                     Tag       = 0;
+    ULONG                     TypeIndex = 0;
+    UINT64                    Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
+    PSYMBOL_INFO              Symbol = (PSYMBOL_INFO)Buffer;
+
+    if (ModuleDetails->TypeLayoutCache == NULL)
+    {
+        ModuleDetails->TypeLayoutCache = new SYMBOL_TYPE_LAYOUT_CACHE;
+    }
+
+    Cache = ModuleDetails->TypeLayoutCache;
+
+    auto It = Cache->LayoutsByName.find(TypeName);
+
+    if (It != Cache->LayoutsByName.end())
+    {
+        return It->second;
+    }
+
+    RtlZeroMemory(Buffer, sizeof(Buffer));
+
+    Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    Symbol->MaxNameLen   = MAX_SYM_NAME;
+
+    if (!SymGetTypeFromName(GetCurrentProcess(), ModuleDetails->ModuleBase, TypeName, Symbol))
+    {
+        return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+    }
+
+    //
+    // Resolve the typedefs to reach the structure
+    //
+    TypeIndex = Symbol->TypeIndex;
+
+    while (SymGetTypeInfo(GetCurrentProcess(), ModuleDetails->ModuleBase, TypeIndex, TI_GET_SYMTAG, &Tag) &&
+           Tag == SymTagTypedef)
+    {
+        if (!SymGetTypeInfo(GetCurrentProcess(), ModuleDetails->ModuleBase, TypeIndex, TI_GET_TYPEID, &TypeIndex))
+        {
+            return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+        }
+    }
+
+    if (Tag != SymTagUDT)
+    {
+        return SYMBOL_TYPE_LAYOUT_INVALID_INDEX;
+    }
+
+    //
+    // The layouts are compiled from the depth zero here, so even a truncated
+    // layout is as complete as it can be shown and is cached by its name
+    //
+    LayoutIndex = SymbolTypeLayoutCompile(Cache, ModuleDetails->ModuleBase, TypeIndex, 0, &Truncated);
+
+    if (LayoutIndex != SYMBOL_TYPE_LAYOUT_INVALID_INDEX)
+    {
+        Cache->LayoutsByName[TypeName] = LayoutIndex;
+    }
+
+    return LayoutIndex;
+}
+
+/**
+ * @brief Free the compiled layouts of a module
+ *
+ * @param ModuleDetails
+ *
+ * @return VOID
+ */
+VOID
+SymbolTypeLayoutFree(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    if (ModuleDetails->TypeLayoutCache != NULL)
+    {
+        delete ModuleDetails->TypeLayoutCache;
+        ModuleDetails->TypeLayoutCache = NULL;
+    }
+}
+
+/**
+ * @brief Read a value (up to 8 bytes) from the buffer
+ *
+ * @param Buffer
+ * @param Size
+ *
+ * @return UINT64
+ */
+UINT64
+SymbolTypeLayoutReadValue(const BYTE * Buffer, UINT32 Size)
+{
+    UINT64 Value = 0;
+
+    memcpy(&Value, Buffer, Size < sizeof(UINT64) ? Size : sizeof(UINT64));
+
+    return Value;
+}
+
+/**
+ * @brief Show a value based on its kind
+ *
+ * @param Cache
+ * @param Kind
+ * @param Size
+ * @param BaseType
+ * @param NestedLayout
+ * @param TypeName
+ * @param Buffer
+ * @param Depth
+ *
+ * @return VOID
+ */
+VOID
+SymbolTypeLayoutShowValue(PSYMBOL_TYPE_LAYOUT_CACHE Cache,
+                          UINT32                    Kind,
+                          UINT32                    Size,
+                          UINT32                    BaseType,
+                          UINT32                    NestedLayout,
+                          const char *              TypeName,
+                          const BYTE *              Buffer,
+                          UINT32                    Depth)
+{
+    UINT64 Value = SymbolTypeLayoutReadValue(Buffer, Size);
+    INT64  SignedValue;
+    float  FloatValue;
+    double DoubleValue;
+
+    switch (Kind)
+    {
+    case SYMBOL_TYPE_LAYOUT_KIND_BASE:
+
+        switch (BaseType)
+        {
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_BOOL:
+
+            ShowMessages("%s\n", Value ? "true" : "false");
+            break;
+
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_CHAR:
+
+            ShowMessages("0x%02llx '%c'\n", Value, isprint((int)Value) ? (int)Value : '.');
+            break;
+
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_FLOAT:
+
+            if (Size == sizeof(float))
+            {
+                memcpy(&FloatValue, Buffer, sizeof(float));
+                ShowMessages("%f\n", FloatValue);
+            }
+            else
+            {
+                memcpy(&DoubleValue, Buffer, sizeof(double));
+                ShowMessages("%f\n", DoubleValue);
+            }
+            break;
+
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_INT:
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_LONG:
+        case SYMBOL_TYPE_LAYOUT_BASE_TYPE_HRESULT:
+
+            //
+            // Sign-extend the value
+            //
+            SignedValue = (INT64)Value;
+
+            if (Size != 0 && Size < sizeof(UINT64))
+            {
+                SignedValue = (INT64)(Value << (64 - Size * 8)) >> (64 - Size * 8);
+            }
+
+            ShowMessages("0n%lld\n", SignedValue);
+            break;
+
+        default:
+
+            ShowMessages("0x%llx\n", Value);
+            break;
+        }
+
+        break;
+
+    case SYMBOL_TYPE_LAYOUT_KIND_POINTER:
+
+        if (Size == sizeof(UINT64))
+        {
+            ShowMessages("%s\n", SymSeparateTo64BitValue(Value).c_str());
+        }
+        else
+        {
+            ShowMessages("0x%08llx\n", Value);
+        }
+
+        break;
+
+    case SYMBOL_TYPE_LAYOUT_KIND_ENUM:
+
+        ShowMessages("0x%llx (%s)\n", Value, TypeName);
+
+        break;
+
+    case SYMBOL_TYPE_LAYOUT_KIND_STRUCT:
+
+        ShowMessages("%s\n", TypeName);
+
+        if (NestedLayout != SYMBOL_TYPE_LAYOUT_INVALID_INDEX && Depth + 1 < SYMBOL_TYPE_LAYOUT_MAXIMUM_DEPTH)
+        {
+            SymbolTypeLayoutShow(Cache, NestedLayout, Buffer, Depth + 1);
+        }
+
+        break;
+
+    default:
+
+        ShowMessages("%s\n", TypeName);
+
+        break;
+    }
+}
+
+/**
+ * @brief Show an array of characters (or wide-characters) as a string
+ *
+ * @param Field
+ * @param Buffer
+ *
+ * @return VOID
+ */
+VOID
+SymbolTypeLayoutShowString(PSYMBOL_TYPE_LAYOUT_FIELD Field, const BYTE * Buffer)
+{
+    ShowMessages("\"");
+
+    for (UINT32 i = 0; i < Field->ElementCount; i++)
+    {
+        UINT64 Character = SymbolTypeLayoutReadValue(Buffer + i * Field->ElementSize, Field->ElementSize);
+
+        if (Character == 0)
+        {
+            break;
+        }
+
+        ShowMessages("%c", Character < 0x80 && isprint((int)Character) ? (int)Character : '.');
+    }
+
+    ShowMessages("\"\n");
+}
+
+/**
+ * @brief Show the data of a layout from the raw bytes
+ *
+ * @param Cache
+ * @param LayoutIndex
+ * @param Buffer buffer that contains the bytes of the structure
+ * @param Depth
+ *
+ * @return VOID
+ */
+VOID
+SymbolTypeLayoutShow(PSYMBOL_TYPE_LAYOUT_CACHE Cache, UINT32 LayoutIndex, const BYTE * Buffer, UINT32 Depth)
+{
+    SYMBOL_TYPE_LAYOUT Layout = Cache->Layouts[LayoutIndex];
+    UINT32             Indent = (Depth + 1) * 3;
+
+    for (UINT32 i = 0; i < Layout.CountOfFields; i++)
+    {
+        PSYMBOL_TYPE_LAYOUT_FIELD Field       = &Cache->Fields[Layout.FirstField + i];
+        const BYTE *              FieldBuffer = Buffer + Field->Offset;
+        const char *              TypeName    = &Cache->Names[Field->TypeNameOffset];
+
+        ShowMessages("%*s+0x%03x %-*s : ",
+                     Indent,
+                     "",
+                     Field->Offset,
+                     SYMBOL_TYPE_LAYOUT_FIELD_NAME_WIDTH,
+                     &Cache->Names[Field->NameOffset]);
+
+        if (Field->BitLength != 0)
+        {
+            UINT64 Value = SymbolTypeLayoutReadValue(FieldBuffer, Field->Size);
+            UINT64 Mask  = Field->BitLength >= 64 ? MAXUINT64 : ((1ull << Field->BitLength) - 1);
+
+            ShowMessages("0x%llx (Pos %d, %d Bit%s)\n",
+                         (Value >> Field->BitPosition) & Mask,
+                         Field->BitPosition,
+                         Field->BitLength,
+                         Field->BitLength == 1 ? "" : "s");
+        }
+        else if (Field->Kind == SYMBOL_TYPE_LAYOUT_KIND_ARRAY)
+        {
+            if (Field->ElementKind == SYMBOL_TYPE_LAYOUT_KIND_BASE &&
+                ((Field->BaseType == SYMBOL_TYPE_LAYOUT_BASE_TYPE_CHAR && Field->ElementSize == sizeof(CHAR)) ||
+                 (Field->BaseType == SYMBOL_TYPE_LAYOUT_BASE_TYPE_WCHAR && Field->ElementSize == sizeof(WCHAR))))
+            {
+                SymbolTypeLayoutShowString(Field, FieldBuffer);
+                continue;
+            }
+
+            ShowMessages("%s\n", TypeName);
+
+            for (UINT32 j = 0; j < Field->ElementCount && j < SYMBOL_TYPE_LAYOUT_MAXIMUM_ARRAY_ELEMENTS; j++)
+            {
+                ShowMessages("%*s[%d] ", Indent + 3, "", j);
+
+                SymbolTypeLayoutShowValue(Cache,
+                                          Field->ElementKind,
+                                          Field->ElementSize,
+                                          Field->BaseType,
+                                          Field->NestedLayout,
+                                          TypeName,
+                                          FieldBuffer + j * Field->ElementSize,
+                                          Depth + 1);
+            }
+
+            if (Field->ElementCount > SYMBOL_TYPE_LAYOUT_MAXIMUM_ARRAY_ELEMENTS)
+            {
+                ShowMessages("%*s...\n", Indent + 3, "");
+            }
+        }
+        else
+        {
+            SymbolTypeLayoutShowValue(Cache,
+                                      Field->Kind,
+                                      Field->Size,
+                                      Field->BaseType,
+                                      Field->NestedLayout,
+                                      TypeName,
+                                      FieldBuffer,
+                                      Depth);
+        }
+    }
+}
+
+/**
+ * @brief Get the address of the next node of a linked list
+ * @details If the field is a pointer, it points to the next structure, otherwise
+ * the field is considered as an embedded list entry (e.g., LIST_ENTRY) which its
+ * first pointer points to the same field in the next structure
+ *
+ * @param Cache
+ * @param LayoutIndex
+ * @param Buffer buffer that contains the bytes of the structure
+ * @param FieldName
+ * @param NextAddress
+ *
+ * @return BOOLEAN whether the field is found or not
+ */
+BOOLEAN
+SymbolTypeLayoutGetNextNodeAddress(PSYMBOL_TYPE_LAYOUT_CACHE Cache,
+                                   UINT32                    LayoutIndex,
+                                   const BYTE *              Buffer,
+                                   const char *              FieldName,
+                                   UINT64 *                  NextAddress)
+{
+    SYMBOL_TYPE_LAYOUT Layout = Cache->Layouts[LayoutIndex];
+
+    for (UINT32 i = 0; i < Layout.CountOfFields; i++)
+    {
+        PSYMBOL_TYPE_LAYOUT_FIELD Field       = &Cache->Fields[Layout.FirstField + i];
+        UINT32                    PointerSize = sizeof(UINT64);
+        UINT64                    Value;
+
+        if (strcmp(&Cache->Names[Field->NameOffset], FieldName) != 0)
+        {
+            continue;
+        }
+
+        if (Field->Kind == SYMBOL_TYPE_LAYOUT_KIND_POINTER)
+        {
+            *NextAddress = SymbolTypeLayoutReadValue(Buffer + Field->Offset, Field->Size);
+            return TRUE;
+        }
+
+        //
+        // The size of the pointers of the list entry (e.g., LIST_ENTRY32)
+        //
+        if (Field->Kind == SYMBOL_TYPE_LAYOUT_KIND_STRUCT &&
+            Field->NestedLayout != SYMBOL_TYPE_LAYOUT_INVALID_INDEX &&
+            Cache->Layouts[Field->NestedLayout].CountOfFields != 0 &&
+            Cache->Fields[Cache->Layouts[Field->NestedLayout].FirstField].Kind == SYMBOL_TYPE_LAYOUT_KIND_POINTER)
+        {
+            PointerSize = Cache->Fields[Cache->Layouts[Field->NestedLayout].FirstField].Size;
+        }
+
+        Value        = SymbolTypeLayoutReadValue(Buffer + Field->Offset, PointerSize);
+        *NextAddress = Value != NULL ? Value - Field->Offset : NULL;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file symbol-index.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of the index of symbol names
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The extension of the index file that is saved next to the PDB file
+ *
+ */
+#define SYMBOL_INDEX_FILE_EXTENSION ".hsi"
+
+/**
+ * @brief The magic of the index file ('HSI1')
+ *
+ */
+#define SYMBOL_INDEX_FILE_MAGIC 0x31495348
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A symbol in the index
+ *
+ */
+typedef struct _SYMBOL_INDEX_ENTRY
+{
+    UINT64 Rva;
+    UINT32 NameOffset;
+    UINT32 NameLength;
+
+} SYMBOL_INDEX_ENTRY, *PSYMBOL_INDEX_ENTRY;
+
+/**
+ * @brief The header of the saved index file
+ *
+ */
+typedef struct _SYMBOL_INDEX_FILE_HEADER
+{
+    UINT32   Magic;
+    UINT32   CountOfEntries;
+    UINT64   SizeOfNames;
+    UINT64   PdbFileSize;
+    FILETIME PdbLastWriteTime;
+
+} SYMBOL_INDEX_FILE_HEADER, *PSYMBOL_INDEX_FILE_HEADER;
+
+/**
+ * @brief Index of the symbol names of a module
+ * @details Entries are sorted by their names (case-insensitive), the
+ * trigrams (lowercase) point to the entries that contain them, and the
+ * exact names point to their entries for resolving names to addresses,
+ * the trigrams are only built on the first search of a wildcard mask
+ *
+ */
+typedef struct _SYMBOL_INDEX
+{
+    std::vector<SYMBOL_INDEX_ENTRY>                 Entries;
+    std::vector<char>                               Names;
+    BOOLEAN                                         IsTrigramsBuilt;
+    std::unordered_map<UINT32, std::vector<UINT32>> Trigrams;
+    std::unordered_map<std::string, UINT32>         EntriesByName;
+
+} SYMBOL_INDEX, *PSYMBOL_INDEX;
+
+/**
+ * @brief The context that is passed to the callback of collecting symbols
+ *
+ */
+typedef struct _SYMBOL_INDEX_COLLECT_CONTEXT
+{
+    PSYMBOL_INDEX Index;
+    UINT64        ModuleBase;
+
+} SYMBOL_INDEX_COLLECT_CONTEXT, *PSYMBOL_INDEX_COLLECT_CONTEXT;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+PSYMBOL_INDEX
+SymbolIndexGet(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+VOID
+SymbolIndexFree(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+VOID
+SymbolIndexSearch(PSYMBOL_INDEX Index, const char * Mask, std::vector<UINT32> & Results);
+
+BOOLEAN
+SymbolIndexFindName(PSYMBOL_INDEX Index, const char * Name, UINT64 * Rva);
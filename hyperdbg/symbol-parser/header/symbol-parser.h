@@ -32,6 +32,9 @@ typedef struct _SYMBOL_LOADED_MODULE_DETAILS
     char   ModuleName[_MAX_FNAME];
     char   PdbFilePath[MAX_PATH];
 
+    struct _SYMBOL_INDEX *             SymbolIndex;
+    struct _SYMBOL_TYPE_LAYOUT_CACHE * TypeLayoutCache;
+
 } SYMBOL_LOADED_MODULE_DETAILS, *PSYMBOL_LOADED_MODULE_DETAILS;
 
 //////////////////////////////////////////////////
@@ -61,6 +64,7 @@ __declspec(dllexport) BOOLEAN SymConvertFileToPdbPath(const char * LocalFilePath
 __declspec(dllexport) BOOLEAN SymConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath, char * PdbFilePath, char * GuidAndAgeDetails);
 __declspec(dllexport) BOOLEAN SymbolInitLoad(PVOID BufferToStoreDetails, UINT32 StoredLength, BOOLEAN DownloadIfAvailable, const char * SymbolPath, BOOLEAN IsSilentLoad);
 __declspec(dllexport) BOOLEAN SymShowDataBasedOnSymbolTypes(const char * TypeName, UINT64 Address, BOOLEAN IsStruct, PVOID BufferAddress, const char * AdditionalParameters);
+__declspec(dllexport) BOOLEAN SymShowDataBasedOnTypeLayout(const char * TypeName, UINT64 Address, PVOID BufferAddress, UINT32 BufferSize, const char * NextFieldName, UINT64 * NextAddress);
 __declspec(dllexport) VOID SymbolAbortLoading();
 __declspec(dllexport) BOOLEAN SymQuerySizeof(_In_ const char * StructNameOrTypeName, _Out_ UINT32 * SizeOfField);
 __declspec(dllexport) BOOLEAN SymCastingQueryForFiledsAndTypes(_In_ const char * StructName, _In_ const char * FiledOfStructName, _Out_ PBOOLEAN IsStructNamePointerOrNot, _Out_ PBOOLEAN IsFiledOfStructNamePointerOrNot, _Out_ char ** NewStructOrTypeName, _Out_ UINT32 * OffsetOfFieldFromTop, _Out_ UINT32 * SizeOfField);
@@ -70,6 +74,9 @@ __declspec(dllexport) BOOLEAN SymCastingQueryForFiledsAndTypes(_In_ const char *
 //					Functions                   //
 //////////////////////////////////////////////////
 
+VOID
+ShowMessages(const char * Fmt, ...);
+
 BOOL
 SymGetFileParams(const char * FileName, DWORD & FileSize);
 
@@ -88,6 +95,9 @@ SymDeliverDisassemblerSymbolMapCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize,
 VOID
 SymShowSymbolDetails(SYMBOL_INFO & SymInfo);
 
+string
+SymSeparateTo64BitValue(UINT64 Value);
+
 const char *
 SymTagStr(ULONG Tag);
 
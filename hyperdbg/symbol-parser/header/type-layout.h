@@ -0,0 +1,155 @@
+/**
+ * @file type-layout.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief headers of the compiled layouts of types
+ * @details
+ * @version 0.2
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Index of a layout that is not available
+ *
+ */
+#define SYMBOL_TYPE_LAYOUT_INVALID_INDEX 0xffffffff
+
+/**
+ * @brief Maximum depth of nested structures that are compiled and shown
+ *
+ */
+#define SYMBOL_TYPE_LAYOUT_MAXIMUM_DEPTH 8
+
+/**
+ * @brief Maximum number of the elements of an array field that are shown
+ *
+ */
+#define SYMBOL_TYPE_LAYOUT_MAXIMUM_ARRAY_ELEMENTS 16
+
+/**
+ * @brief Width of the names of fields when showing a layout
+ *
+ */
+#define SYMBOL_TYPE_LAYOUT_FIELD_NAME_WIDTH 24
+
+//////////////////////////////////////////////////
+//					Enums                       //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Kinds of the fields of a layout
+ *
+ */
+typedef enum _SYMBOL_TYPE_LAYOUT_KIND
+{
+    SYMBOL_TYPE_LAYOUT_KIND_UNKNOWN = 0,
+    SYMBOL_TYPE_LAYOUT_KIND_BASE,
+    SYMBOL_TYPE_LAYOUT_KIND_POINTER,
+    SYMBOL_TYPE_LAYOUT_KIND_ENUM,
+    SYMBOL_TYPE_LAYOUT_KIND_STRUCT,
+    SYMBOL_TYPE_LAYOUT_KIND_ARRAY,
+
+} SYMBOL_TYPE_LAYOUT_KIND;
+
+/**
+ * @brief Base types of the fields (the same as BasicType of DIA)
+ *
+ */
+typedef enum _SYMBOL_TYPE_LAYOUT_BASE_TYPE
+{
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_NONE    = 0,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_VOID    = 1,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_CHAR    = 2,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_WCHAR   = 3,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_INT     = 6,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_UINT    = 7,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_FLOAT   = 8,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_BOOL    = 10,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_LONG    = 13,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_ULONG   = 14,
+    SYMBOL_TYPE_LAYOUT_BASE_TYPE_HRESULT = 31,
+
+} SYMBOL_TYPE_LAYOUT_BASE_TYPE;
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A field of a compiled layout
+ * @details For arrays, the element details (kind, size, base type and
+ * nested layout) describe the type of each element
+ *
+ */
+typedef struct _SYMBOL_TYPE_LAYOUT_FIELD
+{
+    UINT32 NameOffset;
+    UINT32 TypeNameOffset;
+    UINT32 Offset;
+    UINT32 Size;
+    UINT32 Kind;
+    UINT32 ElementKind;
+    UINT32 ElementSize;
+    UINT32 ElementCount;
+    UINT32 BaseType;
+    UINT32 BitPosition;
+    UINT32 BitLength; // zero if it's not a bit-field
+    UINT32 NestedLayout;
+
+} SYMBOL_TYPE_LAYOUT_FIELD, *PSYMBOL_TYPE_LAYOUT_FIELD;
+
+/**
+ * @brief A compiled layout of a structure (or union)
+ *
+ */
+typedef struct _SYMBOL_TYPE_LAYOUT
+{
+    UINT32 NameOffset;
+    UINT32 Size;
+    UINT32 FirstField;
+    UINT32 CountOfFields;
+
+} SYMBOL_TYPE_LAYOUT, *PSYMBOL_TYPE_LAYOUT;
+
+/**
+ * @brief Compiled layouts of the types of a module
+ * @details Layouts, fields and names are kept in flat tables, nested
+ * structures are referenced by their index in the table of layouts
+ *
+ */
+typedef struct _SYMBOL_TYPE_LAYOUT_CACHE
+{
+    std::vector<SYMBOL_TYPE_LAYOUT>         Layouts;
+    std::vector<SYMBOL_TYPE_LAYOUT_FIELD>   Fields;
+    std::vector<char>                       Names;
+    std::unordered_map<ULONG, UINT32>       LayoutsByTypeIndex;
+    std::unordered_map<std::string, UINT32> LayoutsByName;
+
+} SYMBOL_TYPE_LAYOUT_CACHE, *PSYMBOL_TYPE_LAYOUT_CACHE;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+UINT32
+SymbolTypeLayoutGet(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, const char * TypeName);
+
+VOID
+SymbolTypeLayoutFree(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+VOID
+SymbolTypeLayoutShow(PSYMBOL_TYPE_LAYOUT_CACHE Cache, UINT32 LayoutIndex, const BYTE * Buffer, UINT32 Depth);
+
+BOOLEAN
+SymbolTypeLayoutGetNextNodeAddress(PSYMBOL_TYPE_LAYOUT_CACHE Cache,
+                                   UINT32                    LayoutIndex,
+                                   const BYTE *              Buffer,
+                                   const char *              FieldName,
+                                   UINT64 *                  NextAddress);
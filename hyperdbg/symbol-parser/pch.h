@@ -16,6 +16,8 @@
 #include <iomanip>
 #include <sstream>
 #include <vector>
+#include <unordered_map>
+#include <algorithm>
 
 #define _NO_CVCONST_H // for symbol parsing
 #include <DbgHelp.h>
@@ -38,6 +40,8 @@ typedef RFLAGS * PRFLAGS;
 #include "Definition.h"
 #include "..\symbol-parser\header\common-utils.h"
 #include "..\symbol-parser\header\symbol-parser.h"
+#include "..\symbol-parser\header\symbol-index.h"
+#include "..\symbol-parser\header\type-layout.h"
 
 using namespace std;
 